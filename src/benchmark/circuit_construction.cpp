@@ -0,0 +1,82 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <future>
+#include <vector>
+
+#include "base/party.h"
+#include "protocols/share_wrapper.h"
+#include "utility/bit_vector.h"
+#include "utility/logger.h"
+
+/**
+ * Benchmark for the construction of a Boolean GMW circuit consisting of alternating XOR and AND
+ * gates, which measures the time spent in creating gates, wires and shares.
+ *
+ * @param state the benchmark state, state.range(0) is the number of gates
+ */
+static void BM_BooleanGmwCircuitConstruction(benchmark::State& state) {
+  constexpr auto kBooleanGmw = encrypto::motion::MpcProtocol::kBooleanGmw;
+  const std::size_t number_of_gates = state.range(0);
+
+  std::size_t counter{0};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto parties = encrypto::motion::MakeLocallyConnectedParties(2, 0);
+    for (auto& party : parties) {
+      party->GetLogger()->SetEnabled(false);
+    }
+    state.ResumeTiming();
+
+    // only the first party constructs the circuit, it is never evaluated
+    auto& party{parties.at(0)};
+    encrypto::motion::ShareWrapper a{
+        party->In<kBooleanGmw>(encrypto::motion::BitVector<>(1, true), 0)};
+    encrypto::motion::ShareWrapper b{party->In<kBooleanGmw>(encrypto::motion::BitVector<>(1), 1)};
+    for (std::size_t i = 0; i < number_of_gates / 2; ++i) {
+      a = a ^ b;
+      b = a & b;
+    }
+    benchmark::DoNotOptimize(b);
+    counter += number_of_gates;
+
+    state.PauseTiming();
+    // the parties shut down their communication layers on destruction, which must happen
+    // concurrently
+    std::vector<std::future<void>> futures;
+    for (auto& p : parties) {
+      futures.emplace_back(std::async(std::launch::async, [&p] { p.reset(); }));
+    }
+    std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+    state.ResumeTiming();
+  }
+
+  state.counters["Gates"] = benchmark::Counter(counter, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_BooleanGmwCircuitConstruction)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 22)
+    ->Unit(benchmark::kMillisecond);
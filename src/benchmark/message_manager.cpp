@@ -0,0 +1,85 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "communication/message.h"
+#include "communication/message_manager.h"
+
+namespace {
+
+namespace communication = encrypto::motion::communication;
+
+constexpr auto kMessageType = communication::MessageType::kOutputMessage;
+
+// delivers one message to every registered id and retrieves it from its future
+void FulfillAndGet(communication::MessageManager& message_manager,
+                   std::vector<communication::MessageManager::future_type>& futures) {
+  for (std::size_t i = 0; i < futures.size(); ++i) {
+    message_manager.Fulfill(1, kMessageType, i, communication::MessageManager::container_type{});
+  }
+  for (auto& future : futures) benchmark::DoNotOptimize(future.get());
+}
+
+}  // namespace
+
+/**
+ * Benchmark for registering and fulfilling one message per gate, where each message id gets its
+ * own promise in the hash maps of the MessageManager.
+ *
+ * @param state the benchmark state, state.range(0) is the number of message ids
+ */
+static void BM_MessageManagerRegisterReceive(benchmark::State& state) {
+  const std::size_t number_of_messages = state.range(0);
+  for (auto _ : state) {
+    communication::MessageManager message_manager(2, 0);
+    std::vector<communication::MessageManager::future_type> futures;
+    futures.reserve(number_of_messages);
+    for (std::size_t i = 0; i < number_of_messages; ++i) {
+      futures.emplace_back(message_manager.RegisterReceive(1, kMessageType, i));
+    }
+    FulfillAndGet(message_manager, futures);
+  }
+  state.SetItemsProcessed(state.iterations() * number_of_messages);
+}
+BENCHMARK(BM_MessageManagerRegisterReceive)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+
+/**
+ * Benchmark for registering and fulfilling one message per gate, where the promises of all
+ * message ids are preallocated in one contiguous slot array.
+ *
+ * @param state the benchmark state, state.range(0) is the number of message ids
+ */
+static void BM_MessageManagerRegisterReceiveRange(benchmark::State& state) {
+  const std::size_t number_of_messages = state.range(0);
+  for (auto _ : state) {
+    communication::MessageManager message_manager(2, 0);
+    auto futures{message_manager.RegisterReceiveRange(1, kMessageType, 0, number_of_messages)};
+    FulfillAndGet(message_manager, futures);
+  }
+  state.SetItemsProcessed(state.iterations() * number_of_messages);
+}
+BENCHMARK(BM_MessageManagerRegisterReceiveRange)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
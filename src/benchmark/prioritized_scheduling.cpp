@@ -0,0 +1,155 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "base/configuration.h"
+#include "base/party.h"
+#include "communication/communication_layer.h"
+#include "communication/dummy_transport.h"
+#include "protocols/share_wrapper.h"
+#include "utility/bit_vector.h"
+#include "utility/logger.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Delivers each message not before a fixed latency has passed since it was sent. The time of
+// delivery is prepended to the message by the sender.
+class DelayedTransport final : public encrypto::motion::communication::Transport {
+ public:
+  DelayedTransport(std::unique_ptr<encrypto::motion::communication::Transport> transport,
+                   Clock::duration latency)
+      : transport_(std::move(transport)), latency_(latency) {}
+
+  void SendMessage(std::span<const std::uint8_t> message) override {
+    const auto delivery_time{(Clock::now() + latency_).time_since_epoch().count()};
+    std::vector<std::uint8_t> buffer(sizeof(delivery_time) + message.size());
+    std::memcpy(buffer.data(), &delivery_time, sizeof(delivery_time));
+    std::copy(message.begin(), message.end(), buffer.begin() + sizeof(delivery_time));
+    transport_->SendMessage(buffer);
+  }
+
+  bool Available() const override { return transport_->Available(); }
+
+  std::optional<std::vector<std::uint8_t>> ReceiveMessage() override {
+    auto buffer{transport_->ReceiveMessage()};
+    if (!buffer) return std::nullopt;
+    Clock::rep delivery_time;
+    std::memcpy(&delivery_time, buffer->data(), sizeof(delivery_time));
+    std::this_thread::sleep_until(Clock::time_point(Clock::duration(delivery_time)));
+    return std::vector<std::uint8_t>(buffer->begin() + sizeof(delivery_time), buffer->end());
+  }
+
+  void ShutdownSend() override { transport_->ShutdownSend(); }
+
+  void Shutdown() override { transport_->Shutdown(); }
+
+ private:
+  std::unique_ptr<encrypto::motion::communication::Transport> transport_;
+  Clock::duration latency_;
+};
+
+std::vector<encrypto::motion::PartyPointer> MakeDelayedParties(Clock::duration latency) {
+  auto [transport_01, transport_10] =
+      encrypto::motion::communication::DummyTransport::MakeTransportPair();
+  std::vector<std::vector<std::unique_ptr<encrypto::motion::communication::Transport>>> transports(
+      2);
+  transports.at(0).resize(2);
+  transports.at(1).resize(2);
+  transports.at(0).at(1) = std::make_unique<DelayedTransport>(std::move(transport_01), latency);
+  transports.at(1).at(0) = std::make_unique<DelayedTransport>(std::move(transport_10), latency);
+
+  std::vector<encrypto::motion::PartyPointer> parties;
+  for (std::size_t party_id = 0; party_id < 2; ++party_id) {
+    parties.emplace_back(std::make_unique<encrypto::motion::Party>(
+        std::make_unique<encrypto::motion::communication::CommunicationLayer>(
+            party_id, std::move(transports.at(party_id)))));
+  }
+  return parties;
+}
+
+}  // namespace
+
+/**
+ * Benchmark for the end-to-end latency of a Boolean GMW circuit on a transport with 1 ms latency.
+ * The circuit consists of many independent AND gates, which are registered first, and a chain of
+ * AND gates that forms the critical path.
+ *
+ * @param state the benchmark state, state.range(0) enables prioritized scheduling and
+ *              state.range(1) is the number of independent AND gates
+ */
+static void BM_PrioritizedSchedulingLatency(benchmark::State& state) {
+  constexpr auto kBooleanGmw = encrypto::motion::MpcProtocol::kBooleanGmw;
+  constexpr std::size_t kDepth{16};
+  const bool prioritized = state.range(0) != 0;
+  const std::size_t number_of_independent_gates = state.range(1);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto parties = MakeDelayedParties(std::chrono::milliseconds(1));
+    for (auto& party : parties) {
+      party->GetLogger()->SetEnabled(false);
+      party->GetConfiguration()->SetPrioritizedScheduling(prioritized);
+    }
+    for (auto& party : parties) {
+      encrypto::motion::ShareWrapper a{
+          party->In<kBooleanGmw>(encrypto::motion::BitVector<>(1, true), 0)};
+      encrypto::motion::ShareWrapper b{
+          party->In<kBooleanGmw>(encrypto::motion::BitVector<>(1, true), 1)};
+      for (std::size_t i = 0; i < number_of_independent_gates; ++i) {
+        (a & b).Out();
+      }
+      auto chain{a};
+      for (std::size_t i = 0; i < kDepth; ++i) {
+        chain = chain & b;
+      }
+      chain.Out();
+    }
+    state.ResumeTiming();
+
+    auto future{std::async(std::launch::async, [&parties] { parties.at(1)->Run(); })};
+    parties.at(0)->Run();
+    future.get();
+
+    state.PauseTiming();
+    std::vector<std::future<void>> futures;
+    for (auto& p : parties) {
+      futures.emplace_back(std::async(std::launch::async, [&p] { p.reset(); }));
+    }
+    std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(BM_PrioritizedSchedulingLatency)
+    ->ArgsProduct({{0, 1}, {256, 4096}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,100 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <vector>
+
+#include "communication/communication_layer.h"
+#include "communication/message.h"
+#include "communication/message_manager.h"
+
+namespace {
+
+namespace communication = encrypto::motion::communication;
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t kNumberOfIterations = 32;
+
+}  // namespace
+
+/**
+ * Benchmark for the latency of an online message which is sent to the other party right after a
+ * bulk message, e.g., of an OT extension, over a local TCP connection.
+ *
+ * @param state the benchmark state, state.range(0) enables prioritized sending and
+ *              state.range(1) is the size of the bulk message in bytes
+ */
+static void BM_PrioritizedSendingOnlineLatency(benchmark::State& state) {
+  const bool prioritized_sending = state.range(0) != 0;
+  const std::vector<std::uint8_t> bulk_payload(state.range(1));
+  const std::vector<std::uint8_t> online_payload(16);
+
+  auto communication_layers{communication::MakeLocalTcpCommunicationLayers(2, false)};
+  auto& communication_layer_alice{*communication_layers.at(0)};
+  auto& message_manager_bob{communication_layers.at(1)->GetMessageManager()};
+  std::vector<communication::MessageManager::future_type> bulk_futures, online_futures;
+  for (std::size_t i = 0; i < kNumberOfIterations; ++i) {
+    bulk_futures.emplace_back(
+        message_manager_bob.RegisterReceive(0, communication::MessageType::kOtExtensionSender, i));
+    online_futures.emplace_back(
+        message_manager_bob.RegisterReceive(0, communication::MessageType::kOutputMessage, i));
+  }
+  for (auto& communication_layer : communication_layers) {
+    communication_layer->SetPrioritizedSending(prioritized_sending);
+    communication_layer->Start();
+  }
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    auto bulk_message{communication::BuildMessage(communication::MessageType::kOtExtensionSender,
+                                                  i, bulk_payload)
+                          .Release()};
+    const auto start{Clock::now()};
+    communication_layer_alice.SendMessage(1, std::move(bulk_message));
+    communication_layer_alice.SendFastMessage(1, communication::MessageType::kOutputMessage, i,
+                                              std::vector<std::uint8_t>(online_payload));
+    online_futures.at(i).get();
+    state.SetIterationTime(std::chrono::duration<double>(Clock::now() - start).count());
+    // the next iteration starts on an idle connection
+    bulk_futures.at(i).get();
+    ++i;
+  }
+
+  std::vector<std::future<void>> futures;
+  for (auto& communication_layer : communication_layers) {
+    futures.emplace_back(std::async(std::launch::async,
+                                    [&communication_layer] { communication_layer->Shutdown(); }));
+  }
+  std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+}
+BENCHMARK(BM_PrioritizedSendingOnlineLatency)
+    ->ArgsProduct({{0, 1}, {1 << 20, 16 << 20, 64 << 20}})
+    ->Iterations(kNumberOfIterations)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,176 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "base/motion_base_provider.h"
+#include "communication/communication_layer.h"
+#include "oblivious_transfer/base_ots/base_ot_provider.h"
+#include "oblivious_transfer/ot_flavors.h"
+#include "oblivious_transfer/ot_provider.h"
+
+namespace {
+
+using encrypto::motion::OtExtensionProtocol;
+
+// two parties connected by dummy transports that have computed their base OTs
+class OtExtensionParties {
+ public:
+  explicit OtExtensionParties(OtExtensionProtocol protocol, std::size_t softspoken_field_bits = 4)
+      : communication_layers_(encrypto::motion::communication::MakeDummyCommunicationLayers(2)) {
+    for (std::size_t i = 0; i < 2; ++i) {
+      base_ot_providers_[i] =
+          std::make_unique<encrypto::motion::BaseOtProvider>(*communication_layers_[i]);
+      motion_base_providers_[i] =
+          std::make_unique<encrypto::motion::BaseProvider>(*communication_layers_[i]);
+      managers_[i] = std::make_unique<encrypto::motion::OtProviderManager>(
+          *communication_layers_[i], *base_ot_providers_[i], *motion_base_providers_[i],
+          protocol, softspoken_field_bits);
+    }
+    // the base OTs are requested by the first extension
+    RegisterOts(1);
+    RunOtExtension(true);
+  }
+
+  ~OtExtensionParties() {
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 0; i < 2; ++i) {
+      futures.emplace_back(
+          std::async(std::launch::async, [this, i] { communication_layers_[i]->Shutdown(); }));
+    }
+    std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+  }
+
+  void RegisterOts(std::size_t number_of_ots) {
+    for (auto& manager : managers_) manager->Clear();
+    sender_ = managers_[0]->GetProvider(1).RegisterSendROt(number_of_ots, 128);
+    receiver_ = managers_[1]->GetProvider(0).RegisterReceiveROt(number_of_ots, 128);
+  }
+
+  void RunOtExtension(bool first = false) {
+    for (std::size_t i = 0; i < 2; ++i) {
+      managers_[i]->PreSetup();
+      if (first) base_ot_providers_[i]->PreSetup();
+    }
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 0; i < 2; ++i) {
+      futures.emplace_back(std::async(std::launch::async, [this, i, first] {
+        if (first) {
+          communication_layers_[i]->Start();
+          communication_layers_[i]->Synchronize();
+          motion_base_providers_[i]->Setup();
+          base_ot_providers_[i]->ComputeBaseOts();
+        }
+        auto send_setup{std::async(std::launch::async,
+                                   [this, i] { managers_[i]->GetProvider(1 - i).SendSetup(); })};
+        managers_[i]->GetProvider(1 - i).ReceiveSetup();
+        send_setup.get();
+      }));
+    }
+    std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+  }
+
+  std::size_t GetNumberOfBytesSent() const {
+    std::size_t number_of_bytes{0};
+    for (const auto& communication_layer : communication_layers_) {
+      for (const auto& statistics : communication_layer->GetTransportStatistics()) {
+        number_of_bytes += statistics.number_of_bytes_sent;
+      }
+    }
+    return number_of_bytes;
+  }
+
+ private:
+  std::vector<std::unique_ptr<encrypto::motion::communication::CommunicationLayer>>
+      communication_layers_;
+  std::array<std::unique_ptr<encrypto::motion::BaseOtProvider>, 2> base_ot_providers_;
+  std::array<std::unique_ptr<encrypto::motion::BaseProvider>, 2> motion_base_providers_;
+  std::array<std::unique_ptr<encrypto::motion::OtProviderManager>, 2> managers_;
+  std::unique_ptr<encrypto::motion::ROtSender> sender_;
+  std::unique_ptr<encrypto::motion::ROtReceiver> receiver_;
+};
+
+// runs one OT extension of number_of_ots OTs per benchmark iteration and reports the OTs per
+// second and the bytes sent by both parties per OT
+void RunOtExtensions(benchmark::State& state, OtExtensionParties& parties,
+                     std::size_t number_of_ots) {
+  const std::size_t bytes_before{parties.GetNumberOfBytesSent()};
+  std::size_t counter{0};
+  for (auto _ : state) {
+    state.PauseTiming();
+    parties.RegisterOts(number_of_ots);
+    state.ResumeTiming();
+    parties.RunOtExtension();
+    counter += number_of_ots;
+  }
+
+  const double number_of_bytes = parties.GetNumberOfBytesSent() - bytes_before;
+  state.counters["OTs"] = benchmark::Counter(counter, benchmark::Counter::kIsRate);
+  state.counters["BytesPerOT"] = number_of_bytes / counter;
+}
+
+}  // namespace
+
+/**
+ * Benchmark for the generation of random 128-bit OTs between two parties connected by dummy
+ * transports, without the base OTs. Besides the time, the number of bytes sent by both parties
+ * per OT is reported.
+ *
+ * @param state the benchmark state, state.range(0) is the OT extension protocol (0 for IKNP and 1
+ *              for silent OT) and state.range(1) is the number of OTs
+ */
+static void BM_OtExtension(benchmark::State& state) {
+  const auto protocol{static_cast<OtExtensionProtocol>(state.range(0))};
+  const std::size_t number_of_ots = state.range(1);
+  OtExtensionParties parties(protocol);
+  RunOtExtensions(state, parties, number_of_ots);
+}
+BENCHMARK(BM_OtExtension)
+    ->ArgsProduct({{0, 1}, {1 << 16, 1 << 20}})
+    ->ArgNames({"protocol", "ots"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+/**
+ * Benchmark for SoftSpokenOT, which trades the communication of IKNP for computation, in the
+ * setting of BM_OtExtension.
+ *
+ * @param state the benchmark state, state.range(0) is the number of bits k of the field and
+ *              state.range(1) is the number of OTs
+ */
+static void BM_SoftSpokenOt(benchmark::State& state) {
+  const std::size_t number_of_ots = state.range(1);
+  OtExtensionParties parties(OtExtensionProtocol::kSoftSpoken, state.range(0));
+  RunOtExtensions(state, parties, number_of_ots);
+}
+BENCHMARK(BM_SoftSpokenOt)
+    ->ArgsProduct({{2, 4, 8}, {1 << 16, 1 << 20}})
+    ->ArgNames({"k", "ots"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
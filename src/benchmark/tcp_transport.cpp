@@ -0,0 +1,240 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <fmt/format.h>
+#include <unistd.h>
+
+#include "communication/receive_buffer_pool.h"
+#include "communication/shared_memory_transport.h"
+#include "communication/tcp_transport.h"
+
+namespace {
+
+using encrypto::motion::communication::Transport;
+
+std::pair<std::unique_ptr<Transport>, std::unique_ptr<Transport>> MakeTcpTransportPair(
+    std::size_t number_of_connections = 1,
+    std::shared_ptr<encrypto::motion::communication::TcpIoService> io_service = nullptr) {
+  const encrypto::motion::communication::TcpPartiesConfiguration configuration{
+      {"127.0.0.1", 13441}, {"127.0.0.1", 13442}};
+  auto transport_0_future =
+      std::async(std::launch::async, [&configuration, number_of_connections, io_service] {
+        encrypto::motion::communication::TcpSetupHelper helper(0, configuration,
+                                                               number_of_connections);
+        if (io_service) helper.SetIoService(io_service);
+        return std::move(helper.SetupConnections().at(1));
+      });
+  auto transport_1_future =
+      std::async(std::launch::async, [&configuration, number_of_connections, io_service] {
+        encrypto::motion::communication::TcpSetupHelper helper(1, configuration,
+                                                               number_of_connections);
+        if (io_service) helper.SetIoService(io_service);
+        return std::move(helper.SetupConnections().at(0));
+      });
+  auto transport_0 = transport_0_future.get();
+  return {std::move(transport_0), transport_1_future.get()};
+}
+
+std::pair<std::unique_ptr<Transport>, std::unique_ptr<Transport>> MakeSharedMemoryTransportPair() {
+  static std::size_t counter{0};
+  const auto name{fmt::format("/motion-benchmark-{}-{}", getpid(), counter++)};
+  auto transport_0_future = std::async(std::launch::async, [&name] {
+    encrypto::motion::communication::SharedMemorySetupHelper helper(0, 2, name);
+    return std::move(helper.SetupConnections().at(1));
+  });
+  auto transport_1_future = std::async(std::launch::async, [&name] {
+    encrypto::motion::communication::SharedMemorySetupHelper helper(1, 2, name);
+    return std::move(helper.SetupConnections().at(0));
+  });
+  auto transport_0 = transport_0_future.get();
+  return {std::move(transport_0), transport_1_future.get()};
+}
+
+}  // namespace
+
+/**
+ * Benchmark for the receive path of TcpTransport over the loopback interface, which measures
+ * the number of messages per second that are sent and received and consumed by the receiver.
+ *
+ * @param state the benchmark state, state.range(0) is the message size in bytes and
+ *              state.range(1) is 1 if the receiver recycles the buffers via a ReceiveBufferPool
+ */
+static void BM_TcpTransportReceive(benchmark::State& state) {
+  constexpr std::size_t kMessagesPerIteration{1000};
+  const std::size_t message_size = state.range(0);
+  const bool use_pool = state.range(1) != 0;
+
+  auto [sender, receiver] = MakeTcpTransportPair();
+  auto pool = std::make_shared<encrypto::motion::communication::ReceiveBufferPool>();
+  if (use_pool) receiver->SetReceiveBufferPool(pool);
+  const std::vector<std::uint8_t> message(message_size, 0x42);
+
+  std::size_t counter{0};
+  for (auto _ : state) {
+    auto send_future = std::async(std::launch::async, [&sender, &message] {
+      for (std::size_t i = 0; i < kMessagesPerIteration; ++i) sender->SendMessage(message);
+    });
+    for (std::size_t i = 0; i < kMessagesPerIteration; ++i) {
+      auto received_message = receiver->ReceiveMessage();
+      benchmark::DoNotOptimize(received_message->data());
+      if (use_pool) pool->Release(std::move(*received_message));
+    }
+    send_future.get();
+    counter += kMessagesPerIteration;
+  }
+
+  sender->Shutdown();
+  receiver->Shutdown();
+  state.counters["Messages"] = benchmark::Counter(counter, benchmark::Counter::kIsRate);
+  state.SetBytesProcessed(counter * message_size);
+}
+BENCHMARK(BM_TcpTransportReceive)
+    ->ArgsProduct({{64, 1 << 10, 1 << 16, 1 << 20}, {0, 1}})
+    ->ArgNames({"size", "pool"})
+    ->UseRealTime();
+
+/**
+ * Benchmark for the throughput of TcpTransport and StripedTcpTransport over the loopback
+ * interface. The bytes are taken from the TransportStatistics of the receiver and include the
+ * message headers.
+ *
+ * @param state the benchmark state, state.range(0) is the message size in bytes and
+ *              state.range(1) is the number of TCP connections
+ */
+static void BM_StripedTcpTransport(benchmark::State& state) {
+  constexpr std::size_t kMessagesPerIteration{100};
+  const std::size_t message_size = state.range(0);
+
+  auto [sender, receiver] = MakeTcpTransportPair(state.range(1));
+  const std::vector<std::uint8_t> message(message_size, 0x42);
+
+  for (auto _ : state) {
+    auto send_future = std::async(std::launch::async, [&sender, &message] {
+      for (std::size_t i = 0; i < kMessagesPerIteration; ++i) sender->SendMessage(message);
+    });
+    for (std::size_t i = 0; i < kMessagesPerIteration; ++i) {
+      auto received_message = receiver->ReceiveMessage();
+      benchmark::DoNotOptimize(received_message->data());
+    }
+    send_future.get();
+  }
+
+  const auto& statistics{receiver->GetStatistics()};
+  sender->Shutdown();
+  receiver->Shutdown();
+  state.counters["Messages"] =
+      benchmark::Counter(statistics.number_of_messages_received, benchmark::Counter::kIsRate);
+  state.SetBytesProcessed(statistics.number_of_bytes_received);
+}
+BENCHMARK(BM_StripedTcpTransport)
+    ->ArgsProduct({{1 << 20, 1 << 24}, {1, 2, 4, 8}})
+    ->ArgNames({"size", "connections"})
+    ->UseRealTime();
+
+/**
+ * Benchmark for AsyncTcpTransport over the loopback interface, to be compared with
+ * BM_TcpTransportReceive without a pool. Both transports run on the same TcpIoService. Besides the
+ * message rate, the numbers of read and write calls per message of the receiver are reported.
+ *
+ * @param state the benchmark state, state.range(0) is the message size in bytes and
+ *              state.range(1) is the number of I/O threads
+ */
+static void BM_AsyncTcpTransport(benchmark::State& state) {
+  constexpr std::size_t kMessagesPerIteration{1000};
+  const std::size_t message_size = state.range(0);
+
+  auto io_service =
+      std::make_shared<encrypto::motion::communication::TcpIoService>(state.range(1));
+  auto [sender, receiver] = MakeTcpTransportPair(1, io_service);
+  const std::vector<std::uint8_t> message(message_size, 0x42);
+
+  for (auto _ : state) {
+    auto send_future = std::async(std::launch::async, [&sender, &message] {
+      for (std::size_t i = 0; i < kMessagesPerIteration; ++i) sender->SendMessage(message);
+    });
+    for (std::size_t i = 0; i < kMessagesPerIteration; ++i) {
+      auto received_message = receiver->ReceiveMessage();
+      benchmark::DoNotOptimize(received_message->data());
+    }
+    send_future.get();
+  }
+
+  sender->Shutdown();
+  receiver->Shutdown();
+  const auto& sender_statistics{sender->GetStatistics()};
+  const auto& receiver_statistics{receiver->GetStatistics()};
+  const double number_of_messages = receiver_statistics.number_of_messages_received;
+  state.counters["Messages"] =
+      benchmark::Counter(number_of_messages, benchmark::Counter::kIsRate);
+  state.counters["WritesPerMessage"] = sender_statistics.number_of_write_calls / number_of_messages;
+  state.counters["ReadsPerMessage"] = receiver_statistics.number_of_read_calls / number_of_messages;
+  state.SetBytesProcessed(receiver_statistics.number_of_bytes_received);
+}
+BENCHMARK(BM_AsyncTcpTransport)
+    ->ArgsProduct({{64, 1 << 10, 1 << 16, 1 << 20}, {1, 2}})
+    ->ArgNames({"size", "threads"})
+    ->UseRealTime();
+
+/**
+ * Benchmark for the throughput of SharedMemoryTransport, to be compared with
+ * BM_TcpTransportReceive without a pool.
+ *
+ * @param state the benchmark state, state.range(0) is the message size in bytes
+ */
+static void BM_SharedMemoryTransport(benchmark::State& state) {
+  constexpr std::size_t kMessagesPerIteration{1000};
+  const std::size_t message_size = state.range(0);
+
+  auto [sender, receiver] = MakeSharedMemoryTransportPair();
+  const std::vector<std::uint8_t> message(message_size, 0x42);
+
+  for (auto _ : state) {
+    auto send_future = std::async(std::launch::async, [&sender, &message] {
+      for (std::size_t i = 0; i < kMessagesPerIteration; ++i) sender->SendMessage(message);
+    });
+    for (std::size_t i = 0; i < kMessagesPerIteration; ++i) {
+      auto received_message = receiver->ReceiveMessage();
+      benchmark::DoNotOptimize(received_message->data());
+    }
+    send_future.get();
+  }
+
+  const auto& statistics{receiver->GetStatistics()};
+  state.counters["Messages"] =
+      benchmark::Counter(statistics.number_of_messages_received, benchmark::Counter::kIsRate);
+  state.SetBytesProcessed(statistics.number_of_bytes_received);
+}
+BENCHMARK(BM_SharedMemoryTransport)
+    ->Arg(64)
+    ->Arg(1 << 10)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20)
+    ->ArgName("size")
+    ->UseRealTime();
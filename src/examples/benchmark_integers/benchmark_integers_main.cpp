@@ -22,6 +22,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <chrono>
 #include <cmath>
 #include <fstream>
 #include <iostream>
@@ -35,6 +36,7 @@
 #include "base/party.h"
 #include "common/benchmark_integers.h"
 #include "communication/communication_layer.h"
+#include "communication/shaped_transport.h"
 #include "communication/tcp_transport.h"
 #include "statistics/analysis.h"
 #include "utility/typedefs.h"
@@ -155,7 +157,10 @@ std::pair<program_options::variables_map, bool> ParseProgramOptions(int ac, char
       ("my-id", program_options::value<std::size_t>(), "my party id")
       ("parties", program_options::value<std::vector<std::string>>()->multitoken(), "info (id,IP,port) for each party e.g., --parties 0,127.0.0.1,23000 1,127.0.0.1,23001")
       ("online-after-setup", program_options::value<bool>()->default_value(true), "compute the online phase of the gate evaluations after the setup phase for all of them is completed (true/1 or false/0)")
-      ("repetitions", program_options::value<std::size_t>()->default_value(1), "number of repetitions");
+      ("repetitions", program_options::value<std::size_t>()->default_value(1), "number of repetitions")
+      ("latency", program_options::value<double>()->default_value(0), "emulated one-way latency of the links to the other parties in ms")
+      ("jitter", program_options::value<double>()->default_value(0), "emulated maximum jitter of the links to the other parties in ms")
+      ("bandwidth", program_options::value<double>()->default_value(0), "emulated bandwidth of the links to the other parties in Mbit/s, 0 means unlimited");
   // clang-format on
 
   program_options::variables_map user_options;
@@ -230,8 +235,20 @@ encrypto::motion::PartyPointer CreateParty(const program_options::variables_map&
     parties_configuration.at(party_id) = std::make_pair(host, port);
   }
   encrypto::motion::communication::TcpSetupHelper helper(my_id, parties_configuration);
+  auto transports{helper.SetupConnections()};
+  // emulate a LAN/WAN setting if requested
+  encrypto::motion::communication::LinkShapingConfiguration link_shaping;
+  link_shaping.latency = std::chrono::microseconds(
+      static_cast<std::int64_t>(user_options["latency"].as<double>() * 1000));
+  link_shaping.jitter = std::chrono::microseconds(
+      static_cast<std::int64_t>(user_options["jitter"].as<double>() * 1000));
+  link_shaping.bandwidth = user_options["bandwidth"].as<double>() * 1e6;
+  link_shaping.Validate();
+  if (link_shaping.IsEnabled()) {
+    encrypto::motion::communication::ShapeTransports(transports, link_shaping);
+  }
   auto communication_layer = std::make_unique<encrypto::motion::communication::CommunicationLayer>(
-      my_id, helper.SetupConnections());
+      my_id, std::move(transports));
   auto party = std::make_unique<encrypto::motion::Party>(std::move(communication_layer));
   auto configuration = party->GetConfiguration();
   // disable logging if the corresponding flag was set
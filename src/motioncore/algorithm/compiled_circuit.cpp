@@ -0,0 +1,169 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "compiled_circuit.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "algorithm_description.h"
+#include "utility/typedefs.h"
+
+namespace encrypto::motion {
+
+CompiledCircuit CompiledCircuit::Compile(const AlgorithmDescription& algorithm) {
+  struct Operation {
+    CompiledOperationType type;
+    std::uint32_t input_a, input_b, output;
+    std::size_t layer;
+  };
+
+  CompiledCircuit circuit;
+  circuit.number_of_input_wires = algorithm.number_of_input_wires_parent_a +
+                                  algorithm.number_of_input_wires_parent_b.value_or(0);
+  if (algorithm.number_of_output_wires > algorithm.number_of_wires) {
+    throw std::invalid_argument(
+        fmt::format("CompiledCircuit: {} output wires, but only {} wires",
+                    algorithm.number_of_output_wires, algorithm.number_of_wires));
+  }
+
+  // AND depth of the value in each slot
+  std::vector<std::size_t> depth(algorithm.number_of_wires, 0);
+  std::vector<Operation> operations;
+  operations.reserve(algorithm.gates.size());
+
+  auto check_slot = [&depth](std::size_t slot) {
+    if (slot >= depth.size()) {
+      throw std::invalid_argument(
+          fmt::format("CompiledCircuit: wire {} out of range of {} wires", slot, depth.size()));
+    }
+    if (slot > std::numeric_limits<std::uint32_t>::max()) {
+      throw std::invalid_argument("CompiledCircuit: too many wires");
+    }
+    return static_cast<std::uint32_t>(slot);
+  };
+  auto new_slot = [&depth, &check_slot] {
+    depth.emplace_back(0);
+    return check_slot(depth.size() - 1);
+  };
+  auto emit = [&depth, &operations](CompiledOperationType type, std::uint32_t input_a,
+                                    std::uint32_t input_b, std::uint32_t output) {
+    const std::size_t layer = std::max(depth[input_a], depth[input_b]);
+    depth[output] = type == CompiledOperationType::kAnd ? layer + 1 : layer;
+    operations.push_back({type, input_a, input_b, output, layer});
+  };
+
+  for (const auto& gate : algorithm.gates) {
+    const auto a = check_slot(gate.parent_a);
+    const auto output = check_slot(gate.output_wire);
+    switch (gate.type) {
+      case PrimitiveOperationType::kXor: {
+        assert(gate.parent_b);
+        emit(CompiledOperationType::kXor, a, check_slot(*gate.parent_b), output);
+        break;
+      }
+      case PrimitiveOperationType::kAnd: {
+        assert(gate.parent_b);
+        emit(CompiledOperationType::kAnd, a, check_slot(*gate.parent_b), output);
+        break;
+      }
+      case PrimitiveOperationType::kInv: {
+        emit(CompiledOperationType::kInv, a, a, output);
+        break;
+      }
+      case PrimitiveOperationType::kOr: {
+        // a | b = ~(~a & ~b)
+        assert(gate.parent_b);
+        const auto b = check_slot(*gate.parent_b);
+        const auto not_a = new_slot(), not_b = new_slot(), not_output = new_slot();
+        emit(CompiledOperationType::kInv, a, a, not_a);
+        emit(CompiledOperationType::kInv, b, b, not_b);
+        emit(CompiledOperationType::kAnd, not_a, not_b, not_output);
+        emit(CompiledOperationType::kInv, not_output, not_output, output);
+        break;
+      }
+      case PrimitiveOperationType::kMux: {
+        // s ? a : b = b ^ (s & (a ^ b))
+        assert(gate.parent_b);
+        assert(gate.selection_bit);
+        const auto b = check_slot(*gate.parent_b);
+        const auto s = check_slot(*gate.selection_bit);
+        const auto a_xor_b = new_slot(), masked = new_slot();
+        emit(CompiledOperationType::kXor, a, b, a_xor_b);
+        emit(CompiledOperationType::kAnd, s, a_xor_b, masked);
+        emit(CompiledOperationType::kXor, b, masked, output);
+        break;
+      }
+      default:
+        throw std::invalid_argument(
+            fmt::format("CompiledCircuit: unsupported operation {}", to_string(gate.type)));
+    }
+  }
+
+  // order by layer, within a layer the linear operations first; stable to keep the dependencies
+  // between linear operations of the same layer intact
+  auto key = [](const Operation& o) {
+    return 2 * o.layer + (o.type == CompiledOperationType::kAnd ? 1 : 0);
+  };
+  std::stable_sort(operations.begin(), operations.end(),
+                   [&key](const auto& lhs, const auto& rhs) { return key(lhs) < key(rhs); });
+
+  const std::size_t number_of_operations = operations.size();
+  circuit.number_of_slots = depth.size();
+  circuit.operation_types.reserve(number_of_operations);
+  circuit.input_a.reserve(number_of_operations);
+  circuit.input_b.reserve(number_of_operations);
+  circuit.output.reserve(number_of_operations);
+  for (std::size_t i = 0; i < number_of_operations; ++i) {
+    const auto& operation = operations[i];
+    while (circuit.layer_offsets.size() <= operation.layer) {
+      circuit.layer_offsets.emplace_back(i);
+      circuit.and_offsets.emplace_back(i);
+    }
+    if (operation.type == CompiledOperationType::kAnd) {
+      ++circuit.number_of_and_operations;
+    } else {
+      // the AND operations of a layer start after its last linear operation
+      circuit.and_offsets.back() = i + 1;
+    }
+    circuit.operation_types.emplace_back(operation.type);
+    circuit.input_a.emplace_back(operation.input_a);
+    circuit.input_b.emplace_back(operation.input_b);
+    circuit.output.emplace_back(operation.output);
+  }
+  circuit.layer_offsets.emplace_back(number_of_operations);
+
+  circuit.output_slots.reserve(algorithm.number_of_output_wires);
+  for (std::size_t i = algorithm.number_of_wires - algorithm.number_of_output_wires;
+       i < algorithm.number_of_wires; ++i) {
+    circuit.output_slots.emplace_back(static_cast<std::uint32_t>(i));
+  }
+
+  return circuit;
+}
+
+}  // namespace encrypto::motion
@@ -0,0 +1,71 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace encrypto::motion {
+
+struct AlgorithmDescription;
+
+enum class CompiledOperationType : std::uint8_t { kXor, kInv, kAnd };
+
+/// \brief Flat struct-of-arrays representation of a Boolean circuit that is evaluated by a single
+/// gate instead of one gate object per operation.
+///
+/// All values live in one buffer of number_of_slots slots. Slots [0, number_of_input_wires) hold
+/// the inputs, output_slots lists the slots that hold the outputs. Operation i reads the slots
+/// input_a[i] (and input_b[i] for kXor and kAnd) and writes the slot output[i].
+/// OR and MUX operations are lowered to XOR, INV and AND.
+///
+/// The operations are ordered by layers of AND depth: the operations of layer l are
+/// [layer_offsets[l], layer_offsets[l + 1]), where the linear operations come first and the AND
+/// operations start at and_offsets[l]. The AND operations of a layer only depend on previous
+/// layers and the linear operations of their layer, so they can be evaluated in one round.
+struct CompiledCircuit {
+  /// \brief Lowers a Boolean AlgorithmDescription. Throws on unsupported operations.
+  static CompiledCircuit Compile(const AlgorithmDescription& algorithm);
+
+  std::size_t GetNumberOfOperations() const { return operation_types.size(); }
+
+  std::size_t GetNumberOfLayers() const { return and_offsets.size(); }
+
+  std::size_t number_of_input_wires{0};
+  std::size_t number_of_slots{0};
+  std::size_t number_of_and_operations{0};
+
+  std::vector<CompiledOperationType> operation_types;
+  std::vector<std::uint32_t> input_a;
+  std::vector<std::uint32_t> input_b;
+  std::vector<std::uint32_t> output;
+
+  std::vector<std::size_t> layer_offsets;
+  std::vector<std::size_t> and_offsets;
+
+  std::vector<std::uint32_t> output_slots;
+};
+
+}  // namespace encrypto::motion
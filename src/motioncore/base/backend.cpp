@@ -33,6 +33,7 @@
 #include <future>
 #include <iterator>
 #include <span>
+#include <stdexcept>
 
 #include <fmt/format.h>
 
@@ -62,6 +63,7 @@
 #include "register.h"
 #include "statistics/run_time_statistics.h"
 #include "utility/constants.h"
+#include "utility/fiber_thread_pool/fiber_thread_pool.hpp"
 
 using namespace std::chrono_literals;
 
@@ -75,14 +77,34 @@ Backend::Backend(std::unique_ptr<communication::CommunicationLayer> communicatio
       configuration_(configuration),
       register_(std::make_shared<Register>(logger_)),
       gate_executor_(std::make_unique<GateExecutor>(
-          *register_, [this] { RunPreprocessing(); }, logger_)) {
+          *register_, [this] { RunPreprocessing(); },
+          [this] {
+            communication_layer_->SetCommunicationPhase(communication::CommunicationPhase::kOnline);
+          },
+          logger_)) {
+  if (const auto& seed = configuration_->GetRandomSeed()) {
+    random_seed_ = SeededRandomStream::DeriveSeed(
+        *seed, fmt::format("party {}", communication_layer_->GetMyId()));
+  }
+  // the providers sample their keys on construction
+  auto random_stream{MakeRandomStream("backend")};
   motion_base_provider_ = std::make_unique<BaseProvider>(*communication_layer_);
   base_ot_provider_ = std::make_unique<BaseOtProvider>(*communication_layer_);
   communication_layer_->SetLogger(logger_);
+  run_time_statistics_.back().Record<RunTimeStatistics::StatisticsId::kConnectionSetup>(
+      communication_layer_->GetConnectionSetupTime());
   auto my_id = communication_layer_->GetMyId();
 
+  auto ot_extension_protocol{OtExtensionProtocol::kIknp};
+  if (configuration_->GetSilentOt()) {
+    ot_extension_protocol = OtExtensionProtocol::kSilent;
+  } else if (configuration_->GetSoftSpokenOtFieldBits() > 0) {
+    ot_extension_protocol = OtExtensionProtocol::kSoftSpoken;
+  }
   ot_provider_manager_ = std::make_unique<OtProviderManager>(
-      *communication_layer_, *base_ot_provider_, *motion_base_provider_);
+      *communication_layer_, *base_ot_provider_, *motion_base_provider_, ot_extension_protocol,
+      configuration_->GetSoftSpokenOtFieldBits(), configuration_->GetOtStoreDirectory(),
+      configuration_->GetOtStoreKey());
 
   kk13_ot_provider_manager_ = std::make_unique<Kk13OtProviderManager>(
       *communication_layer_, *base_ot_provider_, *motion_base_provider_);
@@ -109,6 +131,8 @@ const LoggerPointer& Backend::GetLogger() const noexcept { return logger_; }
 
 void Backend::RunPreprocessing() {
   logger_->LogInfo("Start preprocessing");
+  auto random_stream{MakeRandomStream(fmt::format("preprocessing {}", number_of_evaluations_))};
+  const auto random_seed{SeededRandomStream::GetCurrentSeed()};
   run_time_statistics_.back().RecordStart<RunTimeStatistics::StatisticsId::kPreprocessing>();
 
   // TODO: should this be measured?
@@ -122,6 +146,7 @@ void Backend::RunPreprocessing() {
 
   const bool needs_mts = mt_provider_->NeedMts();
   if (needs_mts) {
+    mt_provider_->SetBinaryChunkSize(configuration_->GetSimdChunkSize());
     mt_provider_->PreSetup();
   }
   const bool needs_sbs = sb_provider_->NeedSbs();
@@ -138,6 +163,7 @@ void Backend::RunPreprocessing() {
   }
 
   if (ot_provider_manager_->HasWork()) {
+    ot_provider_manager_->SetChunkSize(configuration_->GetSimdChunkSize());
     ot_provider_manager_->PreSetup();
   }
 
@@ -151,18 +177,39 @@ void Backend::RunPreprocessing() {
     base_ot_provider_->ComputeBaseOts();
   }
 
-  if (ot_provider_manager_->HasWork() || kk13_ot_provider_manager_->HasWork()) {
+  // with chunking, the OTs of each chunk are published as soon as they are extended, so the
+  // providers and thereby the gates can already use the first chunks
+  const bool needs_ot_extension =
+      ot_provider_manager_->HasWork() || kk13_ot_provider_manager_->HasWork();
+  const bool overlap_ot_extension = configuration_->GetSimdChunkSize() > 0;
+  std::vector<std::future<void>> futures;
+  futures.reserve(5);
+  if (needs_ot_extension && overlap_ot_extension) {
+    futures.emplace_back(std::async(std::launch::async, [this, &random_seed] {
+      auto random_stream{MakeSeededRandomStream(random_seed, "ot extension")};
+      OtExtensionSetup();
+    }));
+  } else if (needs_ot_extension) {
     OtExtensionSetup();
   }
 
-  std::vector<std::future<void>> futures;
-  futures.reserve(4);
-  futures.emplace_back(std::async(std::launch::async, [this] { mt_provider_->Setup(); }));
-  futures.emplace_back(std::async(std::launch::async, [this] { sp_provider_->Setup(); }));
-  futures.emplace_back(std::async(std::launch::async, [this] { sb_provider_->Setup(); }));
+  futures.emplace_back(std::async(std::launch::async, [this, &random_seed] {
+    auto random_stream{MakeSeededRandomStream(random_seed, "mt setup")};
+    mt_provider_->Setup();
+  }));
+  futures.emplace_back(std::async(std::launch::async, [this, &random_seed] {
+    auto random_stream{MakeSeededRandomStream(random_seed, "sp setup")};
+    sp_provider_->Setup();
+  }));
+  futures.emplace_back(std::async(std::launch::async, [this, &random_seed] {
+    auto random_stream{MakeSeededRandomStream(random_seed, "sb setup")};
+    sb_provider_->Setup();
+  }));
   if (garbled_circuit_provider_ && garbled_circuit_provider_->HasWork()) {
-    futures.emplace_back(
-        std::async(std::launch::async, [this] { garbled_circuit_provider_->Setup(); }));
+    futures.emplace_back(std::async(std::launch::async, [this, &random_seed] {
+      auto random_stream{MakeSeededRandomStream(random_seed, "garbled circuit setup")};
+      garbled_circuit_provider_->Setup();
+    }));
   }
 
   for (auto& f : futures) {
@@ -174,10 +221,37 @@ void Backend::RunPreprocessing() {
 }
 
 void Backend::EvaluateSequential() {
-  gate_executor_->EvaluateSetupOnline(run_time_statistics_.back());
+  communication_layer_->SetCommunicationPhase(communication::CommunicationPhase::kSetup);
+  auto random_stream{MakeRandomStream(fmt::format("evaluation {}", ++number_of_evaluations_))};
+  gate_executor_->EvaluateSetupOnline(run_time_statistics_.back(), GetFiberThreadPool(),
+                                      configuration_->GetPrioritizedScheduling());
+}
+
+void Backend::EvaluateParallel() {
+  communication_layer_->SetCommunicationPhase(communication::CommunicationPhase::kSetup);
+  auto random_stream{MakeRandomStream(fmt::format("evaluation {}", ++number_of_evaluations_))};
+  gate_executor_->Evaluate(run_time_statistics_.back(), GetFiberThreadPool(),
+                           configuration_->GetPrioritizedScheduling());
+}
+
+void Backend::EvaluateLevelSynchronous() {
+  communication_layer_->SetCommunicationPhase(communication::CommunicationPhase::kSetup);
+  auto random_stream{MakeRandomStream(fmt::format("evaluation {}", ++number_of_evaluations_))};
+  gate_executor_->EvaluateLevelSynchronous(run_time_statistics_.back(), GetFiberThreadPool(),
+                                           configuration_->GetLevelChunkSize());
 }
 
-void Backend::EvaluateParallel() { gate_executor_->Evaluate(run_time_statistics_.back()); }
+std::optional<SeededRandomStream> Backend::MakeRandomStream(std::string_view label) const {
+  return MakeSeededRandomStream(random_seed_, label);
+}
+
+FiberThreadPool& Backend::GetFiberThreadPool() {
+  if (!fiber_thread_pool_) {
+    fiber_thread_pool_ =
+        std::make_unique<FiberThreadPool>(configuration_->GetNumberOfFiberWorkers());
+  }
+  return *fiber_thread_pool_;
+}
 
 const GatePointer& Backend::GetGate(std::size_t gate_id) const {
   return register_->GetGate(gate_id);
@@ -185,7 +259,12 @@ const GatePointer& Backend::GetGate(std::size_t gate_id) const {
 
 void Backend::Reset() { register_->Reset(); }
 
-void Backend::Clear() { register_->Clear(); }
+void Backend::Clear() {
+  register_->Clear();
+  motion_base_provider_->ResetSetupIsReady();
+  mt_provider_->Clear();
+  ot_provider_manager_->Clear();
+}
 
 SharePointer Backend::BooleanGmwInput(std::size_t party_id, bool input) {
   return BooleanGmwInput(party_id, BitVector(1, input));
@@ -211,6 +290,17 @@ SharePointer Backend::BooleanGmwInput(std::size_t party_id, std::vector<BitVecto
   return std::static_pointer_cast<Share>(input_gate->GetOutputAsGmwShare());
 }
 
+std::pair<SharePointer, ReusableFiberPromise<std::vector<BitVector<>>>*>
+Backend::BooleanGmwInput(std::size_t party_id, std::size_t number_of_wires,
+                         std::size_t number_of_simd) {
+  const auto input_gate = register_->EmplaceGate<proto::boolean_gmw::InputGate>(
+      party_id, number_of_wires, number_of_simd, *this);
+  bool my_input{party_id == GetCommunicationLayer().GetMyId()};
+  auto input_promise_ptr = my_input ? &input_gate->GetInputPromise() : nullptr;
+  return std::pair(std::static_pointer_cast<Share>(input_gate->GetOutputAsGmwShare()),
+                   input_promise_ptr);
+}
+
 SharePointer Backend::BooleanGmwOutput(const SharePointer& parent, std::size_t output_owner) {
   assert(parent);
   const auto output_gate =
@@ -448,6 +538,15 @@ void Backend::ComputeBaseOts() {
   run_time_statistics_.back().RecordEnd<RunTimeStatistics::StatisticsId::kBaseOts>();
 }
 
+void Backend::DeriveBaseOts(Backend& source) {
+  const auto session_id{communication_layer_->GetSessionId()};
+  if (source.communication_layer_->GetSessionId() == session_id) {
+    throw std::invalid_argument(
+        fmt::format("Cannot derive the base OTs of session {} from the same session", session_id));
+  }
+  base_ot_provider_->DeriveBaseOts(*source.base_ot_provider_, session_id);
+}
+
 // TODO: move to OtProviderManager::Setup()
 void Backend::OtExtensionSetup() {
   if constexpr (kDebug) {
@@ -458,22 +557,31 @@ void Backend::OtExtensionSetup() {
 
   std::vector<std::future<void>> task_futures;
   task_futures.reserve(2 * (communication_layer_->GetNumberOfParties() - 1));
+  const auto random_seed{SeededRandomStream::GetCurrentSeed()};
 
   for (auto i = 0ull; i < communication_layer_->GetNumberOfParties(); ++i) {
     if (i == communication_layer_->GetMyId()) {
       continue;
     }
     if (ot_provider_manager_->GetProvider(i).HasWork()) {
-      task_futures.emplace_back(std::async(
-          std::launch::async, [this, i] { ot_provider_manager_->GetProvider(i).SendSetup(); }));
-      task_futures.emplace_back(std::async(
-          std::launch::async, [this, i] { ot_provider_manager_->GetProvider(i).ReceiveSetup(); }));
+      task_futures.emplace_back(std::async(std::launch::async, [this, i, &random_seed] {
+        auto random_stream{MakeSeededRandomStream(random_seed, fmt::format("ot sender {}", i))};
+        ot_provider_manager_->GetProvider(i).SendSetup();
+      }));
+      task_futures.emplace_back(std::async(std::launch::async, [this, i, &random_seed] {
+        auto random_stream{MakeSeededRandomStream(random_seed, fmt::format("ot receiver {}", i))};
+        ot_provider_manager_->GetProvider(i).ReceiveSetup();
+      }));
     }
     if (kk13_ot_provider_manager_->GetProvider(i).HasWork()) {
-      task_futures.emplace_back(std::async(std::launch::async, [this, i] {
+      task_futures.emplace_back(std::async(std::launch::async, [this, i, &random_seed] {
+        auto random_stream{
+            MakeSeededRandomStream(random_seed, fmt::format("kk13 ot sender {}", i))};
         kk13_ot_provider_manager_->GetProvider(i).SendSetup();
       }));
-      task_futures.emplace_back(std::async(std::launch::async, [this, i] {
+      task_futures.emplace_back(std::async(std::launch::async, [this, i, &random_seed] {
+        auto random_stream{
+            MakeSeededRandomStream(random_seed, fmt::format("kk13 ot receiver {}", i))};
         kk13_ot_provider_manager_->GetProvider(i).ReceiveSetup();
       }));
     }
@@ -24,11 +24,15 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
+#include <optional>
+#include <string_view>
 
 #include <flatbuffers/flatbuffers.h>
 #include <span>
 
+#include "primitives/random/seeded_random_stream.h"
 #include "protocols/arithmetic_gmw/arithmetic_gmw_gate.h"
 #include "protocols/constant/constant_gate.h"
 
@@ -100,6 +104,7 @@ using ConfigurationPointer = std::shared_ptr<Configuration>;
 class Register;
 using RegisterPointer = std::shared_ptr<Register>;
 
+class FiberThreadPool;
 class GateExecutor;
 
 class Backend : public std::enable_shared_from_this<Backend> {
@@ -124,12 +129,21 @@ class Backend : public std::enable_shared_from_this<Backend> {
 
   void EvaluateParallel();
 
+  void EvaluateLevelSynchronous();
+
+  /// \brief Returns the pool that runs the gate fibers. It is created on first use with
+  /// Configuration::GetNumberOfFiberWorkers() workers and reused by all later evaluations.
+  FiberThreadPool& GetFiberThreadPool();
+
   const GatePointer& GetGate(std::size_t gate_id) const;
 
   const std::vector<GatePointer>& GetInputGates() const;
 
   void Reset();
 
+  /// \brief Prepares the constructed circuit for another evaluation. The preprocessing requests
+  /// of the gates are kept and re-issued, i.e., fresh seeds, OTs, and MTs are generated in the
+  /// next evaluation. Throws if the circuit contains gates that cannot be evaluated again.
   void Clear();
 
   SharePointer BooleanGmwInput(std::size_t party_id, bool input = false);
@@ -142,6 +156,9 @@ class Backend : public std::enable_shared_from_this<Backend> {
 
   SharePointer BooleanGmwInput(std::size_t party_id, std::vector<BitVector<>>&& input);
 
+  std::pair<SharePointer, ReusableFiberPromise<std::vector<BitVector<>>>*> BooleanGmwInput(
+      std::size_t party_id, std::size_t number_of_wires, std::size_t number_of_simd);
+
   SharePointer BooleanGmwOutput(const SharePointer& parent, std::size_t output_owner);
 
   SharePointer BmrInput(std::size_t party_id, bool input = false);
@@ -224,6 +241,14 @@ class Backend : public std::enable_shared_from_this<Backend> {
 
   void ComputeBaseOts();
 
+  /// \brief Derives the base OTs of this backend from those of a backend on another session of
+  /// the same connections, usually session 0, see BaseOtProvider::DeriveBaseOts, so that the OT
+  /// extensions of the session do not need base OTs of their own. The base OTs of source have to
+  /// be computed already, e.g., by a previous evaluation. Has to be called by all parties before
+  /// the first evaluation of this backend.
+  /// Throws a std::invalid_argument if source belongs to the same session.
+  void DeriveBaseOts(Backend& source);
+
   void OtExtensionSetup();
 
   communication::CommunicationLayer& GetCommunicationLayer() { return *communication_layer_; }
@@ -255,6 +280,9 @@ class Backend : public std::enable_shared_from_this<Backend> {
   auto& GetMutableRunTimeStatistics() { return run_time_statistics_; }
 
  private:
+  // a SeededRandomStream for label derived from the random seed of the configuration, if set
+  std::optional<SeededRandomStream> MakeRandomStream(std::string_view label) const;
+
   std::list<RunTimeStatistics> run_time_statistics_;
 
   std::unique_ptr<communication::CommunicationLayer> communication_layer_;
@@ -262,6 +290,7 @@ class Backend : public std::enable_shared_from_this<Backend> {
   ConfigurationPointer configuration_;
   RegisterPointer register_;
   std::unique_ptr<GateExecutor> gate_executor_;
+  std::unique_ptr<FiberThreadPool> fiber_thread_pool_;
 
   std::unique_ptr<BaseProvider> motion_base_provider_;
   std::unique_ptr<BaseOtProvider> base_ot_provider_;
@@ -272,6 +301,10 @@ class Backend : public std::enable_shared_from_this<Backend> {
   std::shared_ptr<SpProvider> sp_provider_;
   std::shared_ptr<SbProvider> sb_provider_;
   std::unique_ptr<proto::bmr::Provider> bmr_provider_;
+
+  // the random seed of the configuration combined with the id of the party
+  std::optional<std::array<std::byte, 16>> random_seed_;
+  std::size_t number_of_evaluations_{0};
 };
 
 using BackendPointer = std::shared_ptr<Backend>;
@@ -24,8 +24,12 @@
 
 #include "configuration.h"
 
+#include <stdexcept>
 #include <thread>
 
+#include <fmt/format.h>
+
+#include "oblivious_transfer/softspoken_ot_provider.h"
 #include "utility/constants.h"
 
 namespace encrypto::motion {
@@ -43,4 +47,16 @@ Configuration::Configuration(std::size_t my_id, std::size_t number_of_parties)
 
 void Configuration::SetOnlineAfterSetup(bool value) { online_after_setup_ = value; }
 
+void Configuration::SetSoftSpokenOtFieldBits(std::size_t value) {
+  // validated here, s.t. a wrong value does not only surface once the backend is created
+  if (value != 0 && (value < OtProviderFromSoftSpokenOt::kMinimumFieldBits ||
+                     value > OtProviderFromSoftSpokenOt::kMaximumFieldBits)) {
+    throw std::invalid_argument(fmt::format(
+        "SoftSpokenOT supports fields of {} to {} bits or 0 to disable it, but got {}",
+        OtProviderFromSoftSpokenOt::kMinimumFieldBits,
+        OtProviderFromSoftSpokenOt::kMaximumFieldBits, value));
+  }
+  softspoken_ot_field_bits_ = value;
+}
+
 }  // namespace encrypto::motion
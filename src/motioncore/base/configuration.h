@@ -24,8 +24,12 @@
 
 #pragma once
 
+#include <array>
 #include <boost/log/trivial.hpp>
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <string>
 
 namespace encrypto::motion {
 
@@ -47,6 +51,88 @@ class Configuration {
 
   void SetOnlineAfterSetup(bool value);
 
+  bool GetLevelSynchronousEvaluation() const noexcept { return level_synchronous_evaluation_; }
+
+  void SetLevelSynchronousEvaluation(bool value) { level_synchronous_evaluation_ = value; }
+
+  std::size_t GetLevelChunkSize() const noexcept { return level_chunk_size_; }
+
+  void SetLevelChunkSize(std::size_t value) { level_chunk_size_ = value; }
+
+  bool GetPrioritizedScheduling() const noexcept { return prioritized_scheduling_; }
+
+  /// \brief Starts the gates on the critical path of the circuit first and resumes their fibers
+  /// before others, s.t. the messages of the next round are sent earlier. Has no effect on the
+  /// level-synchronous evaluation, which evaluates the circuit level by level anyway.
+  void SetPrioritizedScheduling(bool value) { prioritized_scheduling_ = value; }
+
+  std::size_t GetNumberOfFiberWorkers() const noexcept { return number_of_fiber_workers_; }
+
+  /// \brief Sets the number of worker threads of the fiber pool that evaluates the gates.
+  /// Only has an effect before the first evaluation, since the pool is reused afterwards.
+  /// 0 means std::thread::hardware_concurrency(), otherwise it must be at least 2.
+  void SetNumberOfFiberWorkers(std::size_t value) { number_of_fiber_workers_ = value; }
+
+  bool GetWireReclamation() const noexcept { return wire_reclamation_; }
+
+  /// \brief Frees the values of a wire as soon as all gates reading the wire finished their online
+  /// phase, which reduces the peak memory of large circuits. The values of intermediate wires can
+  /// then not be read after the evaluation anymore, only the values of wires without consuming
+  /// gates, e.g., the outputs of output gates, are kept.
+  void SetWireReclamation(bool value) { wire_reclamation_ = value; }
+
+  std::size_t GetSimdChunkSize() const noexcept { return simd_chunk_size_; }
+
+  /// \brief Splits the preprocessing and the Boolean GMW AND gates into chunks of about this many
+  /// bits. The IKNP OT extension and the binary MTs are generated in chunks of this many OTs and
+  /// MTs, each of which is published as soon as it is ready, and AND gates open their SIMD values
+  /// in chunks of value / number_of_wires values as soon as the MTs of the chunk are ready. The
+  /// online phase of the first chunks then overlaps with the OT extension and MT generation of the
+  /// later ones. 0 disables chunking. Has to be the same for all parties and set before the
+  /// circuit is built.
+  void SetSimdChunkSize(std::size_t value) { simd_chunk_size_ = value; }
+
+  bool GetSilentOt() const noexcept { return silent_ot_; }
+
+  /// \brief Generates the OTs with silent OT extension instead of IKNP, which sends about 110 KB
+  /// per 420k OTs instead of 16 B per OT, see OtProviderFromSilentOt. Only has an effect if set
+  /// before the backend is created.
+  void SetSilentOt(bool value) { silent_ot_ = value; }
+
+  std::size_t GetSoftSpokenOtFieldBits() const noexcept { return softspoken_ot_field_bits_; }
+
+  /// \brief Generates the OTs with SoftSpokenOT over F_{2^value} instead of IKNP, which sends
+  /// ceil(128 / value) instead of 128 bits per OT at the cost of more local computation, see
+  /// OtProviderFromSoftSpokenOt. value has to be in [2, 8], 0 disables SoftSpokenOT. Silent OT
+  /// takes precedence if both are enabled. Only has an effect if set before the backend is
+  /// created.
+  /// Throws a std::invalid_argument if value is neither 0 nor in [2, 8].
+  void SetSoftSpokenOtFieldBits(std::size_t value);
+
+  const std::string& GetOtStoreDirectory() const noexcept { return ot_store_directory_; }
+
+  const std::array<std::byte, 16>& GetOtStoreKey() const noexcept { return ot_store_key_; }
+
+  /// \brief Keeps the base OTs and the IKNP state with each peer in a file in directory, which is
+  /// encrypted under key, such that later processes skip the base OTs, see OtProviderFromFile. An
+  /// empty directory disables the store. Not supported together with silent OT or SoftSpokenOT.
+  /// Only has an effect if set before the backend is created.
+  void SetOtStore(std::string directory, const std::array<std::byte, 16>& key) {
+    ot_store_directory_ = std::move(directory);
+    ot_store_key_ = key;
+  }
+
+  const std::optional<std::array<std::byte, 16>>& GetRandomSeed() const noexcept {
+    return random_seed_;
+  }
+
+  /// \brief Draws all local randomness of the party from SeededRandomStreams derived from seed
+  /// and the id of the party instead of the system's randomness, s.t. an evaluation of the same
+  /// circuit on the same inputs is reproducible, e.g., replayed from the messages recorded by
+  /// RecordingTransports. This is insecure and only meant for profiling and testing. Only has an
+  /// effect if set before the backend is created, see Party(communication_layer, configuration).
+  void SetRandomSeed(const std::array<std::byte, 16>& seed) { random_seed_ = seed; }
+
   void SetLoggingEnabled(bool value = true) { logging_enabled_ = value; }
 
   bool GetLoggingEnabled() const noexcept { return logging_enabled_; }
@@ -71,6 +157,32 @@ class Configuration {
   /// until proceeding to the online phase
   bool online_after_setup_ = false;
 
+  /// @param level_synchronous_evaluation_ if set true, the gates are evaluated level by level in
+  /// chunks of level_chunk_size_ gates instead of creating one fiber per gate. Takes precedence over
+  /// online_after_setup_.
+  bool level_synchronous_evaluation_ = false;
+
+  std::size_t level_chunk_size_ = 1024;
+
+  bool prioritized_scheduling_ = false;
+
+  // number of worker threads of the fiber pool evaluating the gates, 0 for hardware concurrency
+  std::size_t number_of_fiber_workers_ = 0;
+
+  bool wire_reclamation_ = false;
+
+  std::size_t simd_chunk_size_ = 0;
+
+  bool silent_ot_ = false;
+
+  std::size_t softspoken_ot_field_bits_ = 0;
+
+  std::string ot_store_directory_;
+
+  std::array<std::byte, 16> ot_store_key_{};
+
+  std::optional<std::array<std::byte, 16>> random_seed_;
+
   // determines how many worker threads are used in openmp, but not in
   // communication handlers! the latter always use at least 2 threads for each
   // communication channel to send and receive data to prevent the communication
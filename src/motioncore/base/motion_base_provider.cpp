@@ -26,6 +26,7 @@
 #include "communication/fbs_headers/hello_message_generated.h"
 #include "communication/fbs_headers/message_generated.h"
 #include "communication/hello_message.h"
+#include "communication/message.h"
 #include "communication/message_manager.h"
 #include "primitives/sharing_randomness_generator.h"
 #include "utility/fiber_condition.h"
@@ -90,7 +91,7 @@ void BaseProvider::Setup() {
     }
     auto& f{hello_message_futures_[party_id > my_id_ ? party_id - 1 : party_id]};
     auto bytes{f.get()};
-    auto message{communication::GetMessage(bytes.data())};
+    auto message{communication::GetMessage(bytes)};
     auto hello_message{communication::GetHelloMessage(message->payload()->data())};
     auto global_sharing_seed = hello_message->global_sharing_seed();
     auto aes_key = hello_message->fixed_key_aes_seed();
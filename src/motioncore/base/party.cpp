@@ -24,6 +24,8 @@
 
 #include "party.h"
 
+#include <stdexcept>
+
 #include "base/backend.h"
 #include "base/configuration.h"
 #include "base/register.h"
@@ -34,9 +36,30 @@
 
 namespace encrypto::motion {
 
+// the given configuration if it matches the communication layer, or a default one
+static ConfigurationPointer MakeConfiguration(
+    const communication::CommunicationLayer& communication_layer,
+    ConfigurationPointer configuration) {
+  if (!configuration) {
+    return std::make_shared<Configuration>(communication_layer.GetMyId(),
+                                           communication_layer.GetNumberOfParties());
+  }
+  if (configuration->GetMyId() != communication_layer.GetMyId() ||
+      configuration->GetNumOfParties() != communication_layer.GetNumberOfParties()) {
+    throw std::invalid_argument(fmt::format(
+        "Configuration of party {} of {} does not match the communication layer of party {} of {}",
+        configuration->GetMyId(), configuration->GetNumOfParties(), communication_layer.GetMyId(),
+        communication_layer.GetNumberOfParties()));
+  }
+  return configuration;
+}
+
 Party::Party(std::unique_ptr<communication::CommunicationLayer> communication_layer)
-    : configuration_(std::make_shared<Configuration>(communication_layer->GetMyId(),
-                                                     communication_layer->GetNumberOfParties())),
+    : Party(std::move(communication_layer), nullptr) {}
+
+Party::Party(std::unique_ptr<communication::CommunicationLayer> communication_layer,
+             ConfigurationPointer configuration)
+    : configuration_(MakeConfiguration(*communication_layer, std::move(configuration))),
       logger_(std::make_shared<Logger>(communication_layer->GetMyId(),
                                        configuration_->GetLoggingSeverityLevel())),
       backend_(std::make_shared<Backend>(std::move(communication_layer), configuration_, logger_)) {
@@ -86,9 +109,6 @@ SharePointer Party::Out(SharePointer parent, std::size_t output_owner) {
 
 void Party::Run(std::size_t repetitions) {
   logger_->LogDebug("Party run");
-  if(repetitions != 1){
-    throw std::runtime_error("This functionality is not yet implemented");
-  }
 
   // TODO: fix check if work exists s.t. it does not require knowledge about OT
   // internals etc.
@@ -120,9 +140,6 @@ void Party::Reset() {
 }
 
 void Party::Clear() {
-  logger_->LogDebug(
-      "Warning: the ::Clear() functionality is not fully implemented yet and may be buggy or not "
-      "working properly");
   backend_->Synchronize();
   logger_->LogDebug("Party clear");
   backend_->Clear();
@@ -131,7 +148,10 @@ void Party::Clear() {
 }
 
 void Party::EvaluateCircuit() {
-  if (configuration_->GetOnlineAfterSetup()) {
+  backend_->GetRegister()->SetWireReclamation(configuration_->GetWireReclamation());
+  if (configuration_->GetLevelSynchronousEvaluation()) {
+    backend_->EvaluateLevelSynchronous();
+  } else if (configuration_->GetOnlineAfterSetup()) {
     backend_->EvaluateSequential();
   } else {
     backend_->EvaluateParallel();
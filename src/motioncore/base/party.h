@@ -36,6 +36,7 @@
 #include "protocols/boolean_gmw/boolean_gmw_share.h"
 #include "protocols/boolean_gmw/boolean_gmw_wire.h"
 #include "protocols/share.h"
+#include "statistics/circuit_cost.h"
 #include "utility/typedefs.h"
 
 namespace encrypto::motion::communication {
@@ -57,6 +58,13 @@ class Party {
 
   Party(std::unique_ptr<communication::CommunicationLayer> communication_layer);
 
+  // Create a party with the given configuration, e.g., with options which only have an effect if
+  // set before the backend is created.
+  // Throws a std::invalid_argument if the id or the number of parties of the configuration differ
+  // from the communication layer.
+  Party(std::unique_ptr<communication::CommunicationLayer> communication_layer,
+        ConfigurationPointer configuration);
+
   ~Party();
 
   ConfigurationPointer GetConfiguration() { return configuration_; }
@@ -99,9 +107,7 @@ class Party {
         // return backend_->BooleanGmwInput(party_id, input);
       }
       case MpcProtocol::kBooleanGmw: {
-        // TODO implement
-        static_assert(P != MpcProtocol::kBooleanGmw, "Not implemented yet");
-        // return backend_->BooleanGmwInput(party_id, input);
+        return backend_->BooleanGmwInput(input_owner_id, number_of_wires, number_of_simd);
       }
       case MpcProtocol::kBmr: {
         // TODO implement
@@ -398,6 +404,8 @@ class Party {
   /// \brief Evaluates the constructed gates a predefined number of times.
   /// This is realized via repeatedly calling Party::Clear() after each evaluation.
   /// If Connect() was not called yet, it is called automatically at the beginning of this method.
+  /// Inputs that were passed by value are reused in each repetition, inputs that are passed via
+  /// a ReusableFiberPromise need to be set for each repetition.
   /// @param repetitions Number of iterations.
   void Run(std::size_t repetitions = 1);
 
@@ -405,9 +413,16 @@ class Party {
   void Reset();
 
   /// \brief Interprets the gates and wires as newly created, i.e., Party::Run()
-  /// can be executed again.
+  /// can be executed again on the same circuit, e.g., with new inputs set via the promises
+  /// returned by Party::In(input_owner_id, number_of_wires, number_of_simd).
+  /// Preprocessing is re-issued automatically. Currently supported for Boolean GMW circuits,
+  /// throws if the circuit contains gates that cannot be evaluated again.
   void Clear();
 
+  /// \brief Estimates the cost of the gates constructed until now without evaluating them.
+  /// Needs to be called before Party::Run(), see EstimateCircuitCost.
+  CircuitCost EstimateCost() { return EstimateCircuitCost(*backend_); }
+
   const auto& GetLogger() { return logger_; }
 
   /// \brief Sends a termination message to all of the connected parties.
@@ -24,7 +24,9 @@
 
 #include "register.h"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 #include <fmt/format.h>
 
@@ -37,6 +39,8 @@
 
 namespace encrypto::motion {
 
+constexpr auto kNoProducer{std::numeric_limits<std::size_t>::max()};
+
 Register::Register(std::shared_ptr<Logger> logger) : logger_(std::move(logger)) {
   gates_setup_done_condition_ =
       std::make_shared<FiberCondition>([this]() { return gates_setup_done_flag_; });
@@ -54,6 +58,12 @@ std::size_t Register::NextGateId() noexcept {
   return global_gate_id_++;
 }
 
+std::size_t Register::ReserveGateIds(std::size_t number_of_ids) noexcept {
+  auto old_id = global_gate_id_;
+  global_gate_id_ += number_of_ids;
+  return old_id;
+}
+
 std::size_t Register::NextWireId() noexcept {
   // TODO the return value is old global_wire_id, not the increased one. Check if that is intended.
   return global_wire_id_++;
@@ -81,7 +91,154 @@ void Register::RegisterGate(const GatePointer& gate) {
   if (gate->NeedsOnline()) {
     gates_online_++;
   }
+  for (const auto& wire : gate->GetParentWires()) {
+    wire->AddConsumer();
+  }
+  const std::size_t gate_index = gates_.size();
   gates_.push_back(gate);
+  gate_nesting_depth_.push_back(gate_construction_depth_);
+  gate_owner_.push_back(gate_index);
+
+  // the gates registered while this gate was under construction belong to it
+  if (pending_sub_gates_.size() > gate_construction_depth_ + 1) {
+    for (auto sub_gate_index : pending_sub_gates_[gate_construction_depth_ + 1]) {
+      gate_owner_[sub_gate_index] = gate_index;
+    }
+    pending_sub_gates_[gate_construction_depth_ + 1].clear();
+  }
+  if (gate_construction_depth_ > 0) {
+    if (pending_sub_gates_.size() <= gate_construction_depth_) {
+      pending_sub_gates_.resize(gate_construction_depth_ + 1);
+    }
+    pending_sub_gates_[gate_construction_depth_].push_back(gate_index);
+  }
+
+  gate_levels_valid_ = false;
+  gate_priorities_valid_ = false;
+}
+
+const std::vector<Register::GateLevel>& Register::GetGateLevels() {
+  if (!gate_levels_valid_) {
+    ComputeGateLevels();
+    gate_levels_valid_ = true;
+  }
+  return gate_levels_;
+}
+
+const std::vector<GatePointer>& Register::GetGatesByPriority() {
+  if (!gate_priorities_valid_) {
+    ComputeGatePriorities();
+    gate_priorities_valid_ = true;
+  }
+  return gates_by_priority_;
+}
+
+std::vector<std::size_t> Register::ComputeWireProducers() const {
+  const std::size_t number_of_wires = global_wire_id_ - wire_id_offset_;
+  std::vector<std::size_t> wire_producer(number_of_wires, kNoProducer);
+  for (std::size_t gate_index = 0; gate_index < gates_.size(); ++gate_index) {
+    for (const auto& wire : gates_[gate_index]->GetOutputWires()) {
+      const auto wire_index = wire->GetWireId() - wire_id_offset_;
+      if (wire->GetWireId() >= wire_id_offset_ && wire_index < number_of_wires) {
+        wire_producer[wire_index] = gate_index;
+      }
+    }
+  }
+  return wire_producer;
+}
+
+void Register::ComputeGateLevels() {
+  const std::size_t number_of_wires = global_wire_id_ - wire_id_offset_;
+  const auto wire_producer = ComputeWireProducers();
+
+  const auto get_root_owner = [this](std::size_t gate_index) {
+    while (gate_owner_[gate_index] != gate_index) gate_index = gate_owner_[gate_index];
+    return gate_index;
+  };
+
+  // gates are registered in topological order, except for sub-gates, which are registered before
+  // their owner => compute the levels of top-level gates first
+  gate_level_.assign(gates_.size(), 0);
+  std::size_t number_of_levels = gates_.empty() ? 0 : 1;
+  std::size_t maximum_nesting_depth = 0;
+  for (std::size_t gate_index = 0; gate_index < gates_.size(); ++gate_index) {
+    maximum_nesting_depth = std::max(maximum_nesting_depth, gate_nesting_depth_[gate_index]);
+    if (gate_owner_[gate_index] != gate_index) continue;
+    std::size_t level = 0;
+    for (const auto& wire : gates_[gate_index]->GetParentWires()) {
+      const auto wire_index = wire->GetWireId() - wire_id_offset_;
+      if (wire->GetWireId() < wire_id_offset_ || wire_index >= number_of_wires) continue;
+      const auto producer = wire_producer[wire_index];
+      if (producer == kNoProducer) continue;
+      level = std::max(level, gate_level_[get_root_owner(producer)] + 1);
+    }
+    gate_level_[gate_index] = level;
+    number_of_levels = std::max(number_of_levels, level + 1);
+  }
+
+  gate_levels_.assign(number_of_levels, GateLevel(maximum_nesting_depth + 1));
+  for (std::size_t gate_index = 0; gate_index < gates_.size(); ++gate_index) {
+    if (gate_owner_[gate_index] != gate_index) {
+      gate_level_[gate_index] = gate_level_[get_root_owner(gate_index)];
+    }
+    gate_levels_[gate_level_[gate_index]][gate_nesting_depth_[gate_index]].push_back(
+        gates_[gate_index]);
+  }
+}
+
+void Register::ComputeGatePriorities() {
+  const std::size_t number_of_wires = global_wire_id_ - wire_id_offset_;
+  const auto wire_producer = ComputeWireProducers();
+
+  // gates are registered after the gates they read from, so traversing them backwards visits all
+  // successors of a gate before the gate itself. Sub-gates are registered before their owner and
+  // get at least the priority of their owner, since they are evaluated concurrently with it.
+  std::vector<std::size_t> priority(gates_.size(), 0);
+  std::size_t maximum_priority = 0;
+  for (std::size_t gate_index = gates_.size(); gate_index-- > 0;) {
+    const auto owner = gate_owner_[gate_index];
+    if (owner != gate_index) {
+      priority[gate_index] = std::max(priority[gate_index], priority[owner]);
+    }
+    for (const auto& wire : gates_[gate_index]->GetParentWires()) {
+      const auto wire_index = wire->GetWireId() - wire_id_offset_;
+      if (wire->GetWireId() < wire_id_offset_ || wire_index >= number_of_wires) continue;
+      const auto producer = wire_producer[wire_index];
+      if (producer == kNoProducer || producer == gate_index) continue;
+      priority[producer] = std::max(priority[producer], priority[gate_index] + 1);
+    }
+    gates_[gate_index]->SetPriority(priority[gate_index]);
+    maximum_priority = std::max(maximum_priority, priority[gate_index]);
+  }
+
+  // counting sort by decreasing priority, which keeps the registration order of equal priorities
+  std::vector<std::size_t> offsets(maximum_priority + 2, 0);
+  for (auto p : priority) ++offsets[maximum_priority - p + 1];
+  for (std::size_t i = 1; i < offsets.size(); ++i) offsets[i] += offsets[i - 1];
+  gates_by_priority_.resize(gates_.size());
+  for (std::size_t gate_index = 0; gate_index < gates_.size(); ++gate_index) {
+    gates_by_priority_[offsets[maximum_priority - priority[gate_index]]++] = gates_[gate_index];
+  }
+}
+
+void Register::UpdateWireLiveness(const Gate& gate) {
+  if (!wire_reclamation_) return;
+
+  std::size_t allocated_bytes = 0;
+  for (const auto& wire : gate.GetOutputWires()) {
+    if (!wire->IsConstant()) allocated_bytes += wire->GetPayloadSize();
+  }
+  total_wire_memory_ += allocated_bytes;
+  const std::size_t in_use = wire_memory_in_use_ += allocated_bytes;
+  std::size_t peak = peak_wire_memory_;
+  while (in_use > peak && !peak_wire_memory_.compare_exchange_weak(peak, in_use)) {
+  }
+
+  for (const auto& wire : gate.GetParentWires()) {
+    if (wire->IsConstant() || !wire->RemoveConsumer()) continue;
+    wire_memory_in_use_ -= wire->GetPayloadSize();
+    wire->ReleasePayload();
+  }
 }
 
 void Register::IncrementEvaluatedGatesSetupCounter() {
@@ -131,21 +288,37 @@ void Register::Reset() {
 
   wires_.clear();
   gates_.clear();
+  // objects that are still referenced, e.g., by shares of the user, keep the old arena alive
+  arena_ = std::make_shared<Arena>();
+
+  gate_nesting_depth_.clear();
+  gate_owner_.clear();
+  pending_sub_gates_.clear();
+  gate_level_.clear();
+  gate_levels_.clear();
+  gate_levels_valid_ = false;
+  gates_by_priority_.clear();
+  gate_priorities_valid_ = false;
 
   evaluated_gates_setup_ = 0;
   evaluated_gates_online_ = 0;
   gates_setup_done_flag_ = false;
   gates_online_done_flag_ = false;
-  
-  
+  ResetWireMemory();
 }
 
 void Register::Clear() {
   if (evaluated_gates_setup_ != gates_setup_ || evaluated_gates_online_ != gates_online_) {
-    throw(std::runtime_error("Register::Reset evaluated_gates_ != gates_.size()"));
+    throw(std::runtime_error("Register::Clear evaluated_gates_ != gates_.size()"));
   }
   assert(evaluated_gates_setup_ == gates_setup_);
   assert(evaluated_gates_online_ == gates_online_);
+  for (auto& gate : gates_) {
+    if (!gate->IsReusable()) {
+      throw std::runtime_error(
+          fmt::format("Gate#{} does not support being evaluated again", gate->GetId()));
+    }
+  }
   for (auto& gate : gates_) {
     gate->Clear();
   }
@@ -158,6 +331,13 @@ void Register::Clear() {
   evaluated_gates_online_ = 0;
   gates_setup_done_flag_ = false;
   gates_online_done_flag_ = false;
+  ResetWireMemory();
+}
+
+void Register::ResetWireMemory() {
+  wire_memory_in_use_ = 0;
+  peak_wire_memory_ = 0;
+  total_wire_memory_ = 0;
 }
 
 bool Register::AddCachedAlgorithmDescription(
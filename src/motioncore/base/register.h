@@ -29,6 +29,9 @@
 #include <mutex>
 #include <queue>
 #include <unordered_map>
+#include <vector>
+
+#include "utility/arena.h"
 
 namespace encrypto::motion {
 
@@ -56,6 +59,10 @@ class Register {
 
   std::size_t NextGateId() noexcept;
 
+  /// \brief Reserves \p number_of_ids consecutive gate ids, e.g., to be used as message ids or
+  /// tweaks by a gate that evaluates many operations, and returns the first one.
+  std::size_t ReserveGateIds(std::size_t number_of_ids) noexcept;
+
   std::size_t NextWireId() noexcept;
 
   std::size_t NextArithmeticSharingId(std::size_t number_of_parallel_values);
@@ -64,7 +71,12 @@ class Register {
 
   template <typename T, typename... Args>
   std::shared_ptr<T> EmplaceGate(Args&&... args) {
-    auto gate = std::make_shared<T>(std::forward<Args&&>(args)...);
+    std::shared_ptr<T> gate;
+    {
+      // gates emplaced while this gate is constructed become its sub-gates
+      GateConstructionScope scope(gate_construction_depth_);
+      gate = std::allocate_shared<T>(ArenaAllocator<T>(arena_), std::forward<Args&&>(args)...);
+    }
     RegisterGate(gate);
     return gate;
   }
@@ -73,11 +85,18 @@ class Register {
 
   template <typename T, typename... Args>
   std::shared_ptr<T> EmplaceWire(Args&&... args) {
-    auto wire = std::make_shared<T>(std::forward<Args&&>(args)...);
+    auto wire = std::allocate_shared<T>(ArenaAllocator<T>(arena_), std::forward<Args&&>(args)...);
     RegisterWire(wire);
     return wire;
   }
 
+  /// \brief Creates a share in the arena of this register. Shares are not registered, since they
+  /// are only views on wires.
+  template <typename T, typename... Args>
+  std::shared_ptr<T> EmplaceShare(Args&&... args) {
+    return std::allocate_shared<T>(ArenaAllocator<T>(arena_), std::forward<Args&&>(args)...);
+  }
+
   void RegisterWire(const WirePointer& wire) { wires_.push_back(wire); }
 
   const GatePointer& GetGate(std::size_t gate_id) const {
@@ -108,10 +127,52 @@ class Register {
   
   std::size_t GetGateIdOffset() const { return gate_id_offset_; }
 
+  /// \brief A level is a set of gates that only depend on gates of previous levels.
+  /// The gates of a level are grouped by their nesting depth: groups[0] contains gates constructed
+  /// by the user, groups[i] contains gates that were emplaced while constructing a gate of
+  /// nesting depth i - 1, e.g., the OutputGate opening ts in a Boolean GMW to arithmetic GMW
+  /// conversion gate.
+  /// Sub-gates are assigned to the level of their owner, since they are evaluated concurrently
+  /// with it.
+  using GateLevel = std::vector<std::vector<GatePointer>>;
+
+  /// \brief Topologically sorts the registered gates into levels.
+  /// The levels are computed once and cached until further gates are registered.
+  const std::vector<GateLevel>& GetGateLevels();
+
+  /// \brief Sets the priority of each gate to its remaining depth to the outputs, see
+  /// Gate::GetPriority, and returns the gates in order of decreasing priority. Gates with the same
+  /// priority keep their registration order. The order is cached until further gates are
+  /// registered.
+  const std::vector<GatePointer>& GetGatesByPriority();
+
+  /// \brief Gets the level of the gate with index gate_index in GetGates().
+  /// \pre GetGateLevels() was called after the last gate was registered.
+  std::size_t GetGateLevel(std::size_t gate_index) const { return gate_level_.at(gate_index); }
+
   void Reset();
 
   void Clear();
 
+  /// \brief If enabled, the values of a wire are freed as soon as all gates that read the wire
+  /// finished their online phase, see Configuration::SetWireReclamation.
+  void SetWireReclamation(bool value) { wire_reclamation_ = value; }
+
+  bool GetWireReclamation() const { return wire_reclamation_; }
+
+  /// \brief Is called after the online phase of gate finished. Accounts the values of the output
+  /// wires of gate and frees the values of its parent wires that are not read by other gates.
+  /// Does nothing if wire reclamation is disabled.
+  void UpdateWireLiveness(const Gate& gate);
+
+  /// \brief Maximal number of bytes held by wires at the same time during the last evaluation.
+  /// Only recorded if wire reclamation is enabled.
+  std::size_t GetPeakWireMemory() const { return peak_wire_memory_; }
+
+  /// \brief Number of bytes that would be held by the wires without wire reclamation.
+  /// Only recorded if wire reclamation is enabled.
+  std::size_t GetTotalWireMemory() const { return total_wire_memory_; }
+
   std::shared_ptr<FiberCondition> GetGatesSetupDoneCondition() {
     return gates_setup_done_condition_;
   };
@@ -132,8 +193,29 @@ class Register {
   std::shared_ptr<AlgorithmDescription> GetCachedAlgorithmDescription(const std::string& path);
 
  private:
+  // increments the construction depth for the lifetime of the object, also if the constructor of
+  // the gate throws
+  struct GateConstructionScope {
+    GateConstructionScope(std::size_t& depth) : depth_(depth) { ++depth_; }
+    ~GateConstructionScope() { --depth_; }
+    std::size_t& depth_;
+  };
+
+  // index in gates_ of the gate that outputs each wire of the circuit
+  std::vector<std::size_t> ComputeWireProducers() const;
+
+  void ComputeGateLevels();
+
+  void ComputeGatePriorities();
+
+  void ResetWireMemory();
+
   std::shared_ptr<Logger> logger_;
 
+  // gates, wires and shares are allocated from this arena, which is replaced in Reset and released
+  // as soon as the last object allocated from it is destroyed
+  std::shared_ptr<Arena> arena_ = std::make_shared<Arena>();
+
   // don't need atomic here, since only the master thread has access to these
   std::size_t global_gate_id_ = 0, global_wire_id_ = 0;
   std::size_t global_arithmetic_gmw_sharing_id_ = 0, global_boolean_gmw_sharing_id_ = 0;
@@ -152,10 +234,31 @@ class Register {
   std::shared_ptr<FiberCondition> gates_setup_done_condition_;
   std::shared_ptr<FiberCondition> gates_online_done_condition_;
 
+  bool wire_reclamation_ = false;
+  // bytes currently held by the wires, the maximum thereof and the sum over all wires
+  std::atomic<std::size_t> wire_memory_in_use_ = 0;
+  std::atomic<std::size_t> peak_wire_memory_ = 0;
+  std::atomic<std::size_t> total_wire_memory_ = 0;
+
   std::vector<GatePointer> gates_;
 
   std::vector<WirePointer> wires_;
 
+  // number of gates that are currently under construction
+  std::size_t gate_construction_depth_ = 0;
+  // nesting depth and owner (index in gates_) of each gate, top-level gates own themselves
+  std::vector<std::size_t> gate_nesting_depth_;
+  std::vector<std::size_t> gate_owner_;
+  // sub-gates whose owner is still under construction, indexed by nesting depth
+  std::vector<std::vector<std::size_t>> pending_sub_gates_;
+
+  std::vector<std::size_t> gate_level_;
+  std::vector<GateLevel> gate_levels_;
+  bool gate_levels_valid_ = false;
+
+  std::vector<GatePointer> gates_by_priority_;
+  bool gate_priorities_valid_ = false;
+
   std::unordered_map<std::string, std::shared_ptr<AlgorithmDescription>> cached_algos_;
   std::mutex cached_algos_mutex_;
 };
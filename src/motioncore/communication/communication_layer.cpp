@@ -22,21 +22,36 @@
 
 #include "communication_layer.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <future>
 #include <limits>
+#include <mutex>
+#include <optional>
+#include <queue>
 #include <shared_mutex>
 #include <stdexcept>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <variant>
 
+#include <unistd.h>
+
 #include <flatbuffers/flatbuffers.h>
 #include <fmt/format.h>
 
 #include "dummy_transport.h"
 #include "message.h"
 #include "message_manager.h"
+#include "receive_buffer_pool.h"
+#include "shared_memory_transport.h"
 #include "tcp_transport.h"
 #include "utility/constants.h"
 #include "utility/logger.h"
@@ -45,19 +60,151 @@
 
 namespace encrypto::motion::communication {
 
+namespace {
+
+// Bulk messages larger than the fragment size are split into fragments, which carry consecutive
+// parts of the message after a MessageFragmentHeader. The marker distinguishes them from fast
+// messages and flatbuffers.
+constexpr std::uint32_t kMessageFragmentMarker = 0xFFFFFFFE;
+
+struct MessageFragmentHeader {
+  std::uint32_t marker;
+  std::uint32_t reserved;
+  // size of the whole message
+  std::uint64_t message_size;
+};
+
+std::optional<MessageFragmentHeader> GetMessageFragmentHeader(
+    std::span<const std::uint8_t> message) {
+  if (message.size() < sizeof(MessageFragmentHeader)) return std::nullopt;
+  MessageFragmentHeader header;
+  std::memcpy(&header, message.data(), sizeof(header));
+  if (header.marker != kMessageFragmentMarker) return std::nullopt;
+  return header;
+}
+
+template <typename T>
+std::span<const std::uint8_t> AsBytes(const T& value) {
+  return std::span(reinterpret_cast<const std::uint8_t*>(&value), sizeof(value));
+}
+
+}  // namespace
+
+// the state of a session which is shared by its CommunicationLayer and the send queues
+struct CommunicationLayer::Session {
+  Session(std::uint32_t session_id, std::size_t number_of_parties,
+          std::shared_ptr<MessageManager> session_message_manager)
+      : id(session_id),
+        message_manager(std::move(session_message_manager)),
+        aggregation_mutexes(number_of_parties),
+        aggregation_buffers(number_of_parties) {}
+
+  const std::uint32_t id;
+  std::shared_ptr<MessageManager> message_manager;
+  std::atomic<CommunicationPhase> phase = CommunicationPhase::kSetup;
+  std::vector<std::mutex> aggregation_mutexes;
+  std::vector<std::vector<std::uint8_t>> aggregation_buffers;
+};
+
 struct CommunicationLayer::CommunicationLayerImplementation {
   CommunicationLayerImplementation(std::size_t my_id,
                                    std::vector<std::unique_ptr<Transport>>&& transports,
-                                   MessageManager& message_manager, std::shared_ptr<Logger> logger);
+                                   std::shared_ptr<Session> root_session,
+                                   std::shared_ptr<Logger> logger);
   // run in a thread for each party
-  void ReceiveTask(std::size_t party_id, MessageManager& message_manager);
+  void ReceiveTask(std::size_t party_id);
   void SendTask(std::size_t party_id);
 
+  // deliver the messages of the transports to the receive handlers, called when session 0 starts
+  void StartReceiving();
+  // the receive handler of the transport of a party, runs on its I/O threads
+  void OnReceivedMessage(std::size_t party_id, std::optional<std::vector<std::uint8_t>>&& message);
+
+  // reassemble fragments and dispatch the message to its session, returns false if it is a
+  // termination message
+  bool ReceivedMessage(std::size_t party_id, std::vector<std::uint8_t>&& raw_message,
+                       std::vector<std::uint8_t>& fragmented_message);
+
+  // verify a received message and forward it to the MessageManager of its session, returns false
+  // if it is a termination message
+  bool HandleMessage(std::size_t party_id, Session& session,
+                     std::vector<std::uint8_t>&& raw_message);
+
+  // keep a message of a session which has not been started yet, or drop it if the session has
+  // been stopped or too many messages are held back, requires the lock on sessions_mutex_
+  void HoldBackMessage(std::size_t party_id, std::uint32_t session_id,
+                       std::vector<std::uint8_t>&& raw_message);
+  // deliver the messages of the session from now on, including those which have been held back
+  void StartSession(std::shared_ptr<Session> session);
+  void StopSession(std::uint32_t session_id);
+
   // setup threads and data structures
   void Initialize(std::size_t my_id, std::size_t number_of_parties);
   void SendTerminationMessages();
   void Shutdown();
 
+  // append an entry to the aggregation buffer of the session for a party and schedule a flush if
+  // necessary
+  void AggregateMessage(const std::shared_ptr<Session>& session, std::size_t party_id,
+                        std::size_t message_id, std::span<const std::uint8_t> payload);
+  // take the aggregation buffer of a party, which is sent as the payload of a single message
+  static std::vector<std::uint8_t> TakeAggregationBuffer(Session& session, std::size_t party_id);
+
+  // write the header and the payload of a fast message with a single transport call
+  void SendFastMessage(std::size_t party_id, const Session& session,
+                       const FastMessageHeader& header, std::span<const std::uint8_t> payload);
+
+  // a fast message whose payload is kept alive by owner until it has been sent
+  struct FastMessage {
+    FastMessageHeader header;
+    std::span<const std::uint8_t> payload;
+    std::shared_ptr<const void> owner;
+  };
+
+  // message type
+  using message_t = std::variant<std::monostate, std::shared_ptr<flatbuffers::DetachedBuffer>,
+                                 std::shared_ptr<FastMessage>>;
+
+  // entry of the send queues
+  struct OutgoingMessage {
+    std::shared_ptr<Session> session;
+    message_t message;
+  };
+
+  // the messages of a party which are not sent yet
+  struct SendState {
+    std::queue<OutgoingMessage> online_messages;
+    std::queue<OutgoingMessage> bulk_messages;
+    // number of bytes of the first bulk message which have already been sent
+    std::size_t bulk_message_offset = 0;
+    bool finished = false;
+  };
+
+  // run in a single thread for all parties if the transports have receive handlers
+  void SendAllTask();
+
+  // take the new messages from the send queue and send the next message or fragment of a bulk
+  // message, only blocks while there is nothing to send if block is set, returns false if nothing
+  // was done and sets state.finished once the queue is closed and all messages are sent
+  bool SendNext(std::size_t party_id, SendState& state, bool block);
+  // add a message to the send queue of a party and wake up the send thread
+  void EnqueueMessage(std::size_t party_id, OutgoingMessage&& message);
+  void NotifySendThread();
+
+  static MessageType GetMessageType(const message_t& message);
+  // send a message of the send queue as a whole
+  void SendQueuedMessage(std::size_t party_id, const OutgoingMessage& outgoing_message);
+  // send the fragment of a bulk message starting at offset, or the whole message if it does not
+  // need to be fragmented, and advance offset, returns true once the message has been sent
+  bool SendBulkMessageFragment(std::size_t party_id, const OutgoingMessage& outgoing_message,
+                               std::size_t& offset);
+
+  // count a message in the traffic of the current phase of its session
+  void CountSentMessage(std::size_t party_id, const Session& session, MessageType message_type,
+                        std::size_t size);
+  void CountReceivedMessage(std::size_t party_id, const Session& session,
+                            MessageType message_type, std::size_t size);
+
   std::size_t my_id_;
   std::size_t number_of_parties_;
 
@@ -66,34 +213,94 @@ struct CommunicationLayer::CommunicationLayerImplementation {
   std::atomic<bool> continue_communication_ = true;
 
   std::vector<std::unique_ptr<Transport>> transports_;
+  // all transports have receive handlers, e.g., AsyncTcpTransports on a shared TcpIoService, so
+  // the messages are received on their I/O threads and sent by a single thread for all parties
+  bool use_receive_handlers_;
 
-  // message type
-  using message_t = std::shared_ptr<flatbuffers::DetachedBuffer>;
-
-  std::vector<SynchronizedFiberQueue<message_t>> send_queues_;
+  // a std::monostate in the send queue marks that the aggregation buffer of the session needs to
+  // be flushed
+  std::vector<SynchronizedFiberQueue<OutgoingMessage>> send_queues_;
   std::vector<std::thread> receive_threads_;
   std::vector<std::thread> send_threads_;
+  std::thread send_all_thread_;
+  // incremented for each enqueued message, so that the send thread does not miss any
+  std::mutex send_notification_mutex_;
+  std::condition_variable send_notification_condition_;
+  std::size_t number_of_send_notifications_ = 0;
+  // state of the receive handlers, each entry is only accessed by the handler of its party
+  std::vector<std::vector<std::uint8_t>> fragmented_messages_;
+  std::vector<bool> receiving_finished_;
+  std::vector<std::promise<void>> receiving_finished_promises_;
+
+  std::atomic<bool> prioritized_sending_ = true;
+  std::atomic<std::size_t> fragment_size_ = kDefaultFragmentSize;
+
+  // session 0, whose messages do not have a SessionMessageHeader
+  std::shared_ptr<Session> root_session_;
+  std::mutex sessions_mutex_;
+  // ids of all sessions which have been created
+  std::unordered_set<std::uint32_t> session_ids_;
+  // the started sessions
+  std::unordered_map<std::uint32_t, std::shared_ptr<Session>> sessions_;
+  // ids of the sessions which have been shut down, their messages are dropped
+  std::unordered_set<std::uint32_t> stopped_session_ids_;
+  // held_back_messages_[session_id] = [(party_id, message)], the messages received for a session
+  // before it has been started
+  std::unordered_map<std::uint32_t, std::vector<std::pair<std::size_t, std::vector<std::uint8_t>>>>
+      held_back_messages_;
+  // total size of the held back messages, which is limited by kMaximumHeldBackBytes
+  std::size_t number_of_held_back_bytes_ = 0;
+  // counters of the traffic with each party by phase and message type
+  enum TrafficCounter : std::size_t {
+    kMessagesSent,
+    kMessagesReceived,
+    kBytesSent,
+    kBytesReceived,
+    kNumberOfTrafficCounters
+  };
+  static constexpr std::size_t kNumberOfPhases = 2;
+  static constexpr std::size_t kNumberOfMessageTypes = std::numeric_limits<std::uint8_t>::max() + 1;
+  using TrafficCounters = std::array<
+      std::array<std::array<std::atomic<std::size_t>, kNumberOfTrafficCounters>,
+                 kNumberOfMessageTypes>,
+      kNumberOfPhases>;
+  std::vector<TrafficCounters> traffic_counters_;
 
   std::shared_ptr<Logger> logger_;
 };
 
 CommunicationLayer::CommunicationLayerImplementation::CommunicationLayerImplementation(
     std::size_t my_id, std::vector<std::unique_ptr<Transport>>&& transports,
-    MessageManager& message_manager, std::shared_ptr<Logger> logger)
+    std::shared_ptr<Session> root_session, std::shared_ptr<Logger> logger)
     : my_id_(my_id),
       number_of_parties_(transports.size()),
       start_sfuture_(start_promise_.get_future().share()),
       transports_(std::move(transports)),
+      use_receive_handlers_(true),
       send_queues_(number_of_parties_),
+      fragmented_messages_(number_of_parties_),
+      receiving_finished_(number_of_parties_, false),
+      receiving_finished_promises_(number_of_parties_),
+      root_session_(std::move(root_session)),
+      traffic_counters_(number_of_parties_),
       logger_(std::move(logger)) {
+  for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
+    if (party_id != my_id && !transports_.at(party_id)->SupportsReceiveHandler()) {
+      use_receive_handlers_ = false;
+    }
+  }
+  if (use_receive_handlers_) {
+    send_all_thread_ = std::thread([this] { SendAllTask(); });
+    ThreadSetName(send_all_thread_, fmt::format("send-{}", my_id_));
+    return;
+  }
   for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
     if (party_id == my_id) {
       receive_threads_.emplace_back();
       send_threads_.emplace_back();
       continue;
     }
-    receive_threads_.emplace_back(
-        [this, &message_manager, party_id] { ReceiveTask(party_id, message_manager); });
+    receive_threads_.emplace_back([this, party_id] { ReceiveTask(party_id); });
     send_threads_.emplace_back([this, party_id] { SendTask(party_id); });
 
     ThreadSetName(receive_threads_.at(party_id), fmt::format("recv-{}<->{}", my_id_, party_id));
@@ -101,27 +308,65 @@ CommunicationLayer::CommunicationLayerImplementation::CommunicationLayerImplemen
   }
 }
 
-void CommunicationLayer::CommunicationLayerImplementation::SendTask(std::size_t party_id) {
+bool CommunicationLayer::CommunicationLayerImplementation::SendNext(std::size_t party_id,
+                                                                    SendState& state, bool block) {
   auto& queue = send_queues_.at(party_id);
-  auto& transport = *transports_.at(party_id);
-
-  auto my_start_sfuture = start_sfuture_;
-  my_start_sfuture.get();
-
-  while (!queue.IsClosedAndEmpty()) {
+  // The messages are taken from the send queue in batches and sent by priority, i.e., a bulk
+  // message is only sent, or continued with its next fragment, if no online message is waiting.
+  auto& [online_messages, bulk_messages, bulk_message_offset, finished] = state;
+  const bool is_idle = online_messages.empty() && bulk_messages.empty();
+  bool progress = false;
+  // only block if there is nothing left to send, BatchDequeue returns immediately if the queue is
+  // not empty or closed
+  if ((is_idle && (block || queue.IsClosed())) || !queue.empty()) {
     auto tmp_queue = queue.BatchDequeue();
     if (!tmp_queue.has_value()) {
       assert(queue.IsClosed());
-      break;
-    }
-    while (!tmp_queue->empty()) {
-      auto& message = tmp_queue->front();
-      transport.SendMessage(std::span(message->data(), message->size()));
-      tmp_queue->pop();
-      if (logger_) {
-        logger_->LogDebug(fmt::format("Sent message to party {}", party_id));
+      if (is_idle) {
+        finished = true;
+        return false;
       }
+    } else {
+      progress = true;
+      const bool prioritized_sending = prioritized_sending_.load(std::memory_order_relaxed);
+      for (; !tmp_queue->empty(); tmp_queue->pop()) {
+        auto& message = tmp_queue->front();
+        if (prioritized_sending &&
+            GetMessagePriority(GetMessageType(message.message)) == MessagePriority::kBulk) {
+          bulk_messages.push(std::move(message));
+        } else {
+          online_messages.push(std::move(message));
+        }
+      }
+    }
+  }
+  if (!online_messages.empty()) {
+    SendQueuedMessage(party_id, online_messages.front());
+    online_messages.pop();
+  } else if (!bulk_messages.empty()) {
+    if (!SendBulkMessageFragment(party_id, bulk_messages.front(), bulk_message_offset)) {
+      return true;
     }
+    bulk_messages.pop();
+    bulk_message_offset = 0;
+  } else {
+    return progress;
+  }
+  if (logger_) {
+    logger_->LogDebug(fmt::format("Sent message to party {}", party_id));
+  }
+  return true;
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::SendTask(std::size_t party_id) {
+  auto& transport = *transports_.at(party_id);
+
+  auto my_start_sfuture = start_sfuture_;
+  my_start_sfuture.get();
+
+  SendState state;
+  while (!state.finished) {
+    SendNext(party_id, state, true);
   }
 
   transport.ShutdownSend();
@@ -131,13 +376,156 @@ void CommunicationLayer::CommunicationLayerImplementation::SendTask(std::size_t
   }
 }
 
-void CommunicationLayer::CommunicationLayerImplementation::ReceiveTask(
-    std::size_t party_id, MessageManager& message_manager) {
+void CommunicationLayer::CommunicationLayerImplementation::SendAllTask() {
+  auto my_start_sfuture = start_sfuture_;
+  my_start_sfuture.get();
+
+  // the parties are served in turns, so that a large message to one party does not delay the
+  // messages to the others by more than one fragment
+  std::vector<SendState> states(number_of_parties_);
+  states.at(my_id_).finished = true;
+  std::size_t number_of_active_parties = number_of_parties_ - 1;
+  while (number_of_active_parties > 0) {
+    std::size_t number_of_send_notifications;
+    {
+      std::scoped_lock lock(send_notification_mutex_);
+      number_of_send_notifications = number_of_send_notifications_;
+    }
+    bool progress = false;
+    for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
+      auto& state = states.at(party_id);
+      if (state.finished) continue;
+      progress |= SendNext(party_id, state, false);
+      if (state.finished) {
+        transports_.at(party_id)->ShutdownSend();
+        --number_of_active_parties;
+        progress = true;
+      }
+    }
+    if (!progress) {
+      // wait until a message is enqueued or a queue is closed after the queues were checked
+      std::unique_lock lock(send_notification_mutex_);
+      send_notification_condition_.wait(lock, [this, number_of_send_notifications] {
+        return number_of_send_notifications_ != number_of_send_notifications;
+      });
+    }
+  }
+
+  if (logger_) {
+    logger_->LogDebug("SendAllTask finished");
+  }
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::EnqueueMessage(
+    std::size_t party_id, OutgoingMessage&& message) {
+  send_queues_.at(party_id).enqueue(std::move(message));
+  if (use_receive_handlers_) {
+    NotifySendThread();
+  }
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::NotifySendThread() {
+  {
+    std::scoped_lock lock(send_notification_mutex_);
+    ++number_of_send_notifications_;
+  }
+  send_notification_condition_.notify_one();
+}
+
+MessageType CommunicationLayer::CommunicationLayerImplementation::GetMessageType(
+    const message_t& message) {
+  if (std::holds_alternative<std::monostate>(message)) {
+    return MessageType::kAggregatedMessage;
+  } else if (const auto* fast_message = std::get_if<std::shared_ptr<FastMessage>>(&message)) {
+    return (*fast_message)->header.message_type;
+  }
+  const auto& buffer{std::get<std::shared_ptr<flatbuffers::DetachedBuffer>>(message)};
+  return GetMessage(buffer->data())->message_type();
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::SendQueuedMessage(
+    std::size_t party_id, const OutgoingMessage& outgoing_message) {
+  const auto& [session, message] = outgoing_message;
+  if (std::holds_alternative<std::monostate>(message)) {
+    // everything aggregated until now is sent as one message
+    const auto buffer{TakeAggregationBuffer(*session, party_id)};
+    SendFastMessage(party_id, *session,
+                    BuildFastMessageHeader(MessageType::kAggregatedMessage, 0, buffer.size()),
+                    buffer);
+  } else if (const auto* fast_message = std::get_if<std::shared_ptr<FastMessage>>(&message)) {
+    SendFastMessage(party_id, *session, (*fast_message)->header, (*fast_message)->payload);
+  } else {
+    const auto& buffer{std::get<std::shared_ptr<flatbuffers::DetachedBuffer>>(message)};
+    const std::span<const std::uint8_t> bytes(buffer->data(), buffer->size());
+    if (session->id == 0) {
+      CountSentMessage(party_id, *session, GetMessage(buffer->data())->message_type(),
+                       bytes.size());
+      transports_.at(party_id)->SendMessage(bytes);
+    } else {
+      const SessionMessageHeader session_header{kSessionMessageMarker, session->id};
+      const std::array fragments{AsBytes(session_header), bytes};
+      CountSentMessage(party_id, *session, GetMessage(buffer->data())->message_type(),
+                       sizeof(session_header) + bytes.size());
+      transports_.at(party_id)->SendMessageFragments(fragments);
+    }
+  }
+}
+
+bool CommunicationLayer::CommunicationLayerImplementation::SendBulkMessageFragment(
+    std::size_t party_id, const OutgoingMessage& outgoing_message, std::size_t& offset) {
+  const auto& [session, message] = outgoing_message;
+  // the parts of the message which are concatenated on the wire
+  const SessionMessageHeader session_header{kSessionMessageMarker, session->id};
+  std::array<std::span<const std::uint8_t>, 3> parts;
+  if (session->id != 0) {
+    parts[0] = AsBytes(session_header);
+  }
+  if (const auto* fast_message = std::get_if<std::shared_ptr<FastMessage>>(&message)) {
+    parts[1] = AsBytes((*fast_message)->header);
+    parts[2] = (*fast_message)->payload;
+  } else {
+    const auto& buffer{std::get<std::shared_ptr<flatbuffers::DetachedBuffer>>(message)};
+    parts[1] = std::span<const std::uint8_t>(buffer->data(), buffer->size());
+  }
+  const std::size_t message_size = parts[0].size() + parts[1].size() + parts[2].size();
+  const std::size_t fragment_size = fragment_size_.load(std::memory_order_relaxed);
+  if (offset == 0 && message_size <= fragment_size) {
+    SendQueuedMessage(party_id, outgoing_message);
+    return true;
+  }
+  if (offset == 0) {
+    CountSentMessage(party_id, *session, GetMessageType(message), message_size);
+  }
+
+  const MessageFragmentHeader header{
+      .marker = kMessageFragmentMarker, .reserved = 0, .message_size = message_size};
+  const std::size_t end = std::min(offset + fragment_size, message_size);
+  std::array<std::span<const std::uint8_t>, 4> buffers{AsBytes(header)};
+  std::size_t number_of_buffers = 1;
+  std::size_t part_begin = 0;
+  for (const auto& part : parts) {
+    const auto part_end = part_begin + part.size();
+    const auto begin = std::clamp(offset, part_begin, part_end);
+    const auto size = std::clamp(end, part_begin, part_end) - begin;
+    if (size > 0) {
+      buffers[number_of_buffers++] = part.subspan(begin - part_begin, size);
+    }
+    part_begin = part_end;
+  }
+  transports_.at(party_id)->SendMessageFragments(std::span(buffers.data(), number_of_buffers));
+  offset = end;
+  return offset == message_size;
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::ReceiveTask(std::size_t party_id) {
   auto& transport = *transports_.at(party_id);
 
   auto my_start_sfuture = start_sfuture_;
   my_start_sfuture.get();
 
+  // the fragments of a bulk message which have been received so far
+  std::vector<std::uint8_t> fragmented_message;
+
   while (continue_communication_) {
     std::optional<std::vector<std::uint8_t>> raw_message_opt;
     try {
@@ -157,50 +545,277 @@ void CommunicationLayer::CommunicationLayerImplementation::ReceiveTask(
       }
       break;
     }
-    auto raw_message = std::move(*raw_message_opt);
-    flatbuffers::Verifier verifier(reinterpret_cast<std::uint8_t*>(raw_message.data()),
-                                   raw_message.size());
-    if (!VerifyMessageBuffer(verifier)) {
+    if (!ReceivedMessage(party_id, std::move(*raw_message_opt), fragmented_message)) {
+      break;
+    }
+  }
+
+  if constexpr (kDebug) {
+    if (logger_) {
+      logger_->LogDebug(fmt::format("ReceiveTask finished for party {}", party_id));
+    }
+  }
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::StartReceiving() {
+  for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
+    if (party_id == my_id_) {
+      receiving_finished_promises_.at(party_id).set_value();
+      continue;
+    }
+    transports_.at(party_id)->SetReceiveHandler(
+        [this, party_id](std::optional<std::vector<std::uint8_t>>&& message) {
+          OnReceivedMessage(party_id, std::move(message));
+        });
+  }
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::OnReceivedMessage(
+    std::size_t party_id, std::optional<std::vector<std::uint8_t>>&& message) {
+  // messages after the termination message are ignored like by ReceiveTask
+  if (receiving_finished_.at(party_id)) {
+    if (message.has_value()) {
+      root_session_->message_manager->ReleaseMessage(std::move(*message));
+    }
+    return;
+  }
+  if (!message.has_value()) {
+    if (logger_) {
+      logger_->LogError(
+          fmt::format("underlying transport was closed unexpectedly from party {}", party_id));
+    }
+  } else if (ReceivedMessage(party_id, std::move(*message), fragmented_messages_.at(party_id))) {
+    return;
+  }
+  receiving_finished_.at(party_id) = true;
+  receiving_finished_promises_.at(party_id).set_value();
+}
+
+bool CommunicationLayer::CommunicationLayerImplementation::ReceivedMessage(
+    std::size_t party_id, std::vector<std::uint8_t>&& raw_message,
+    std::vector<std::uint8_t>& fragmented_message) {
+  auto& root_message_manager = *root_session_->message_manager;
+  if (const auto fragment_header{GetMessageFragmentHeader(raw_message)}) {
+    // the bulk message is handled once all its fragments have been received
+    const auto fragment{std::span(raw_message).subspan(sizeof(MessageFragmentHeader))};
+    if (fragmented_message.size() + fragment.size() > fragment_header->message_size) {
       if (logger_) {
-        logger_->LogError(fmt::format("received corrupt message from party {}", party_id));
+        logger_->LogError(fmt::format("received corrupt fragment from party {}", party_id));
       }
-      continue;
+      fragmented_message.clear();
+      root_message_manager.ReleaseMessage(std::move(raw_message));
+      return true;
+    }
+    fragmented_message.reserve(fragment_header->message_size);
+    fragmented_message.insert(fragmented_message.end(), fragment.begin(), fragment.end());
+    root_message_manager.ReleaseMessage(std::move(raw_message));
+    if (fragmented_message.size() < fragment_header->message_size) {
+      return true;
+    }
+    raw_message = std::exchange(fragmented_message, {});
+  }
+  if (const auto session_header{GetSessionMessageHeader(raw_message)}) {
+    // the session header stays in front of the message, which is parsed at an offset
+    std::shared_ptr<Session> session;
+    {
+      std::scoped_lock lock(sessions_mutex_);
+      auto iterator = sessions_.find(session_header->session_id);
+      if (iterator == sessions_.end()) {
+        HoldBackMessage(party_id, session_header->session_id, std::move(raw_message));
+        return true;
+      }
+      session = iterator->second;
     }
+    HandleMessage(party_id, *session, std::move(raw_message));
+    return true;
+  }
+  return HandleMessage(party_id, *root_session_, std::move(raw_message));
+}
 
-    // XXX: maybe use a separate thread for this
-    auto message = GetMessage(raw_message.data());
+bool CommunicationLayer::CommunicationLayerImplementation::HandleMessage(
+    std::size_t party_id, Session& session, std::vector<std::uint8_t>&& raw_message) {
+  auto& message_manager = *session.message_manager;
+  // fast messages and flatbuffers are distinguished by the marker at the beginning
+  const auto message_bytes{SkipSessionMessageHeader(raw_message)};
+  const bool is_fast_message = IsFastMessage(message_bytes);
+  flatbuffers::Verifier verifier(message_bytes.data(), message_bytes.size());
+  if (is_fast_message ? !VerifyFastMessage(message_bytes) : !VerifyMessageBuffer(verifier)) {
+    if (logger_) {
+      logger_->LogError(fmt::format("received corrupt message from party {}", party_id));
+    }
+    message_manager.ReleaseMessage(std::move(raw_message));
+    return true;
+  }
 
-    auto message_id = message->message_id();
-    auto message_type = message->message_type();
+  // XXX: maybe use a separate thread for this
+  MessageType message_type;
+  std::uint64_t message_id;
+  std::span<const std::uint8_t> payload;
+  if (is_fast_message) {
+    const auto header{GetFastMessageHeader(message_bytes)};
+    message_type = header.message_type;
+    message_id = header.message_id;
+    payload = GetFastMessagePayload(message_bytes);
+  } else {
+    const auto message{GetMessage(message_bytes.data())};
+    message_type = message->message_type();
+    message_id = message->message_id();
+    if (message->payload()) {
+      payload = std::span(message->payload()->data(), message->payload()->size());
+    }
+  }
+  CountReceivedMessage(party_id, session, message_type, raw_message.size());
+  if constexpr (kDebug) {
+    if (logger_) {
+      logger_->LogDebug(fmt::format(
+          "received message of type {} with id {} in session {} from party {}",
+          EnumNameMessageType(message_type), message_id, session.id, party_id));
+    }
+  }
+  if (message_type == MessageType::kTerminationMessage) {
     if constexpr (kDebug) {
       if (logger_) {
-        logger_->LogDebug(fmt::format("received message of type {} with id {} from party {}",
-                                      EnumNameMessageType(message_type), message_id, party_id));
+        logger_->LogDebug(fmt::format("received termination message from party {}", party_id));
       }
     }
-    if (message_type == MessageType::kTerminationMessage) {
-      if constexpr (kDebug) {
-        if (logger_) {
-          logger_->LogDebug(fmt::format("received termination message from party {}", party_id));
-        }
+    return false;
+  } else if (message_type == MessageType::kSynchronizationMessage) {
+    message_manager.GetSyncStates(party_id).enqueue(std::move(raw_message));
+  } else if (message_type == MessageType::kAggregatedMessage) {
+    try {
+      message_manager.ReceivedAggregatedMessage(party_id, payload);
+    } catch (std::runtime_error& e) {
+      if (logger_) {
+        logger_->LogError(e.what());
       }
-      break;
-    } else if (message_type == MessageType::kSynchronizationMessage) {
-      message_manager.GetSyncStates(party_id).enqueue(std::move(raw_message));
-    } else {
-      assert(!message_manager.GetMessagePromises(party_id).empty());
-      assert(message_manager.GetMessagePromises(party_id).contains(message_type));
-      assert(message_manager.GetMessagePromises(party_id)[message_type].contains(message_id));
-      message_manager.GetMessagePromises(party_id)[message_type][message_id]->set_value(
-          std::move(raw_message));
     }
+    // the entries were copied out of the aggregated message
+    message_manager.ReleaseMessage(std::move(raw_message));
+  } else {
+    message_manager.Fulfill(party_id, message_type, message_id, std::move(raw_message));
   }
+  return true;
+}
 
-  if constexpr (kDebug) {
+void CommunicationLayer::CommunicationLayerImplementation::HoldBackMessage(
+    std::size_t party_id, std::uint32_t session_id, std::vector<std::uint8_t>&& raw_message) {
+  auto& root_message_manager = *root_session_->message_manager;
+  if (stopped_session_ids_.contains(session_id)) {
     if (logger_) {
-      logger_->LogDebug(fmt::format("ReceiveTask finished for party {}", party_id));
+      logger_->LogError(fmt::format("dropped message from party {} for stopped session {}",
+                                    party_id, session_id));
+    }
+    root_message_manager.ReleaseMessage(std::move(raw_message));
+    return;
+  }
+  if (number_of_held_back_bytes_ + raw_message.size() > kMaximumHeldBackBytes) {
+    if (logger_) {
+      logger_->LogError(fmt::format(
+          "dropped message from party {} for session {}, which has not been started, since the "
+          "held back messages exceed {} bytes",
+          party_id, session_id, kMaximumHeldBackBytes));
     }
+    root_message_manager.ReleaseMessage(std::move(raw_message));
+    return;
   }
+  number_of_held_back_bytes_ += raw_message.size();
+  held_back_messages_[session_id].emplace_back(party_id, std::move(raw_message));
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::StartSession(
+    std::shared_ptr<Session> session) {
+  // the lock keeps the receive threads from delivering newer messages of the session before the
+  // held back ones
+  std::scoped_lock lock(sessions_mutex_);
+  if (auto iterator = held_back_messages_.find(session->id);
+      iterator != held_back_messages_.end()) {
+    for (auto& [party_id, raw_message] : iterator->second) {
+      number_of_held_back_bytes_ -= raw_message.size();
+      HandleMessage(party_id, *session, std::move(raw_message));
+    }
+    held_back_messages_.erase(iterator);
+  }
+  sessions_.emplace(session->id, std::move(session));
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::StopSession(std::uint32_t session_id) {
+  std::scoped_lock lock(sessions_mutex_);
+  sessions_.erase(session_id);
+  stopped_session_ids_.insert(session_id);
+  // a session which is shut down before it has been started does not need its messages anymore
+  if (auto iterator = held_back_messages_.find(session_id); iterator != held_back_messages_.end()) {
+    for (auto& [party_id, raw_message] : iterator->second) {
+      number_of_held_back_bytes_ -= raw_message.size();
+      root_session_->message_manager->ReleaseMessage(std::move(raw_message));
+    }
+    held_back_messages_.erase(iterator);
+  }
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::AggregateMessage(
+    const std::shared_ptr<Session>& session, std::size_t party_id, std::size_t message_id,
+    std::span<const std::uint8_t> payload) {
+  assert(payload.size() <= std::numeric_limits<std::uint32_t>::max());
+  const std::uint64_t id = message_id;
+  const std::uint32_t size = payload.size();
+  bool schedule_flush;
+  {
+    std::scoped_lock lock(session->aggregation_mutexes.at(party_id));
+    auto& buffer = session->aggregation_buffers.at(party_id);
+    // only the first entry after a flush needs to enqueue the flush marker
+    schedule_flush = buffer.empty();
+    buffer.insert(buffer.end(), reinterpret_cast<const std::uint8_t*>(&id),
+                  reinterpret_cast<const std::uint8_t*>(&id) + sizeof(id));
+    buffer.insert(buffer.end(), reinterpret_cast<const std::uint8_t*>(&size),
+                  reinterpret_cast<const std::uint8_t*>(&size) + sizeof(size));
+    buffer.insert(buffer.end(), payload.begin(), payload.end());
+  }
+  if (schedule_flush) {
+    EnqueueMessage(party_id, {session, std::monostate()});
+  }
+}
+
+std::vector<std::uint8_t>
+CommunicationLayer::CommunicationLayerImplementation::TakeAggregationBuffer(Session& session,
+                                                                            std::size_t party_id) {
+  std::vector<std::uint8_t> buffer;
+  {
+    std::scoped_lock lock(session.aggregation_mutexes.at(party_id));
+    std::swap(buffer, session.aggregation_buffers.at(party_id));
+  }
+  return buffer;
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::SendFastMessage(
+    std::size_t party_id, const Session& session, const FastMessageHeader& header,
+    std::span<const std::uint8_t> payload) {
+  if (session.id == 0) {
+    const std::array fragments{AsBytes(header), payload};
+    CountSentMessage(party_id, session, header.message_type, sizeof(header) + payload.size());
+    transports_.at(party_id)->SendMessageFragments(fragments);
+  } else {
+    const SessionMessageHeader session_header{kSessionMessageMarker, session.id};
+    const std::array fragments{AsBytes(session_header), AsBytes(header), payload};
+    CountSentMessage(party_id, session, header.message_type,
+                     sizeof(session_header) + sizeof(header) + payload.size());
+    transports_.at(party_id)->SendMessageFragments(fragments);
+  }
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::CountSentMessage(
+    std::size_t party_id, const Session& session, MessageType message_type, std::size_t size) {
+  auto& counters{traffic_counters_.at(party_id)[static_cast<std::size_t>(
+      session.phase.load(std::memory_order_relaxed))][static_cast<std::size_t>(message_type)]};
+  counters[kMessagesSent].fetch_add(1, std::memory_order_relaxed);
+  counters[kBytesSent].fetch_add(size, std::memory_order_relaxed);
+}
+
+void CommunicationLayer::CommunicationLayerImplementation::CountReceivedMessage(
+    std::size_t party_id, const Session& session, MessageType message_type, std::size_t size) {
+  auto& counters{traffic_counters_.at(party_id)[static_cast<std::size_t>(
+      session.phase.load(std::memory_order_relaxed))][static_cast<std::size_t>(message_type)]};
+  counters[kMessagesReceived].fetch_add(1, std::memory_order_relaxed);
+  counters[kBytesReceived].fetch_add(size, std::memory_order_relaxed);
 }
 
 void CommunicationLayer::CommunicationLayerImplementation::Shutdown() {
@@ -210,6 +825,18 @@ void CommunicationLayer::CommunicationLayerImplementation::Shutdown() {
     }
     send_queues_.at(party_id).close();
   }
+  if (use_receive_handlers_) {
+    NotifySendThread();
+    send_all_thread_.join();
+    // the connections are closed once the termination messages of all parties were received
+    for (auto& promise : receiving_finished_promises_) {
+      promise.get_future().wait();
+    }
+    for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
+      if (party_id != my_id_) transports_.at(party_id)->Shutdown();
+    }
+    return;
+  }
   for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
     if (party_id == my_id_) {
       continue;
@@ -229,6 +856,7 @@ CommunicationLayer::CommunicationLayer(std::size_t my_id,
                                        std::shared_ptr<Logger> logger)
     : my_id_(my_id),
       number_of_parties_(transports.size()),
+      session_id_(0),
       is_started_(false),
       is_shutdown_(false),
       logger_(std::move(logger)),
@@ -241,17 +869,59 @@ CommunicationLayer::CommunicationLayer(std::size_t my_id,
     throw std::invalid_argument(
         fmt::format("speficied invalid party id: {} >= {}", my_id, number_of_parties_));
   }
-  implementation_ = std::make_unique<CommunicationLayerImplementation>(my_id, std::move(transports),
-                                                                       *message_manager_, logger);
+  for (auto& transport : transports) {
+    if (transport) transport->SetReceiveBufferPool(message_manager_->GetReceiveBufferPool());
+  }
+  session_ = std::make_shared<Session>(0, number_of_parties_, message_manager_);
+  implementation_ = std::make_shared<CommunicationLayerImplementation>(
+      my_id, std::move(transports), session_, logger_);
 }
 
+CommunicationLayer::CommunicationLayer(
+    std::shared_ptr<CommunicationLayerImplementation> implementation,
+    std::shared_ptr<Session> session, std::shared_ptr<Logger> logger)
+    : my_id_(implementation->my_id_),
+      number_of_parties_(implementation->number_of_parties_),
+      session_id_(session->id),
+      implementation_(std::move(implementation)),
+      session_(std::move(session)),
+      is_started_(false),
+      is_shutdown_(false),
+      logger_(std::move(logger)),
+      message_manager_(session_->message_manager) {}
+
 CommunicationLayer::~CommunicationLayer() { Shutdown(); }
 
+std::unique_ptr<CommunicationLayer> CommunicationLayer::CreateSession(std::uint32_t session_id) {
+  if (session_id == 0) {
+    throw std::invalid_argument("session id 0 is reserved for the initial communication layer");
+  }
+  {
+    std::scoped_lock lock(implementation_->sessions_mutex_);
+    if (!implementation_->session_ids_.insert(session_id).second) {
+      throw std::invalid_argument(fmt::format("session id {} is already in use", session_id));
+    }
+  }
+  // the messages of all sessions are received into the buffers of the same pool
+  auto message_manager{std::make_shared<MessageManager>(number_of_parties_, my_id_,
+                                                        message_manager_->GetReceiveBufferPool())};
+  auto session{std::make_shared<Session>(session_id, number_of_parties_, message_manager)};
+  return std::unique_ptr<CommunicationLayer>(
+      new CommunicationLayer(implementation_, std::move(session), logger_));
+}
+
 void CommunicationLayer::Start() {
   if (is_started_) {
     return;
   }
-  implementation_->start_promise_.set_value();
+  if (session_id_ == 0) {
+    implementation_->start_promise_.set_value();
+    if (implementation_->use_receive_handlers_) {
+      implementation_->StartReceiving();
+    }
+  } else {
+    implementation_->StartSession(session_);
+  }
   is_started_ = true;
 }
 
@@ -273,7 +943,7 @@ void CommunicationLayer::Synchronize() {
     if constexpr (kDebug) {
       auto bytes{*q.dequeue()};
       std::size_t other_state;
-      std::copy_n(GetMessage(bytes.data())->payload()->data(), sizeof(other_state),
+      std::copy_n(GetMessage(bytes)->payload()->data(), sizeof(other_state),
                   reinterpret_cast<uint8_t*>(&other_state));
       assert(sync_state_ == other_state);
     } else {
@@ -290,8 +960,8 @@ void CommunicationLayer::Synchronize() {
 }
 
 void CommunicationLayer::SendMessage(std::size_t party_id, flatbuffers::DetachedBuffer&& message) {
-  implementation_->send_queues_[party_id].enqueue(
-      std::make_shared<flatbuffers::DetachedBuffer>(std::move(message)));
+  implementation_->EnqueueMessage(
+      party_id, {session_, std::make_shared<flatbuffers::DetachedBuffer>(std::move(message))});
 }
 
 void CommunicationLayer::BroadcastMessage(flatbuffers::DetachedBuffer&& message) {
@@ -302,7 +972,43 @@ void CommunicationLayer::BroadcastMessage(flatbuffers::DetachedBuffer&& message)
   auto shared_message = std::make_shared<flatbuffers::DetachedBuffer>(std::move(message));
 
   for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
-    if (party_id != my_id_) implementation_->send_queues_[party_id].enqueue(shared_message);
+    if (party_id != my_id_) {
+      implementation_->EnqueueMessage(party_id, {session_, shared_message});
+    }
+  }
+}
+
+void CommunicationLayer::BroadcastAggregatedMessage(std::size_t message_id,
+                                                    std::span<const std::uint8_t> payload) {
+  for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
+    if (party_id != my_id_) {
+      implementation_->AggregateMessage(session_, party_id, message_id, payload);
+    }
+  }
+}
+
+void CommunicationLayer::SendFastMessage(std::size_t party_id, MessageType message_type,
+                                         std::size_t message_id,
+                                         std::span<const std::uint8_t> payload,
+                                         std::shared_ptr<const void> owner) {
+  using FastMessage = CommunicationLayerImplementation::FastMessage;
+  implementation_->EnqueueMessage(
+      party_id, {session_, std::make_shared<FastMessage>(
+                               BuildFastMessageHeader(message_type, message_id, payload.size()),
+                               payload, std::move(owner))});
+}
+
+void CommunicationLayer::BroadcastFastMessage(MessageType message_type, std::size_t message_id,
+                                              std::span<const std::uint8_t> payload,
+                                              std::shared_ptr<const void> owner) {
+  using FastMessage = CommunicationLayerImplementation::FastMessage;
+  auto shared_message{std::make_shared<FastMessage>(
+      BuildFastMessageHeader(message_type, message_id, payload.size()), payload,
+      std::move(owner))};
+  for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
+    if (party_id != my_id_) {
+      implementation_->EnqueueMessage(party_id, {session_, shared_message});
+    }
   }
 }
 
@@ -310,6 +1016,12 @@ void CommunicationLayer::Shutdown() {
   if (is_shutdown_) {
     return;
   }
+  if (session_id_ != 0) {
+    // the connections are only terminated by session 0
+    implementation_->StopSession(session_id_);
+    is_shutdown_ = true;
+    return;
+  }
   auto message_builder = BuildMessage(MessageType::kTerminationMessage);
   BroadcastMessage(message_builder.Release());
   if constexpr (kDebug) {
@@ -321,6 +1033,27 @@ void CommunicationLayer::Shutdown() {
   is_shutdown_ = true;
 }
 
+std::pair<std::chrono::steady_clock::time_point, std::chrono::steady_clock::time_point>
+CommunicationLayer::GetConnectionSetupTime() const noexcept {
+  std::pair<std::chrono::steady_clock::time_point, std::chrono::steady_clock::time_point> result;
+  for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
+    if (party_id == my_id_) {
+      continue;
+    }
+    const auto& statistics{implementation_->transports_.at(party_id)->GetStatistics()};
+    if (statistics.connection_setup_end == std::chrono::steady_clock::time_point{}) {
+      continue;
+    }
+    if (result.second == std::chrono::steady_clock::time_point{}) {
+      result = {statistics.connection_setup_start, statistics.connection_setup_end};
+    } else {
+      result.first = std::min(result.first, statistics.connection_setup_start);
+      result.second = std::max(result.second, statistics.connection_setup_end);
+    }
+  }
+  return result;
+}
+
 std::vector<TransportStatistics> CommunicationLayer::GetTransportStatistics() const noexcept {
   std::vector<TransportStatistics> statistics;
   statistics.reserve(number_of_parties_);
@@ -328,18 +1061,58 @@ std::vector<TransportStatistics> CommunicationLayer::GetTransportStatistics() co
     if (party_id == my_id_) {
       continue;
     }
-    statistics.emplace_back(implementation_->transports_.at(party_id)->GetStatistics());
+    auto& party_statistics{
+        statistics.emplace_back(implementation_->transports_.at(party_id)->GetStatistics())};
+    const auto& traffic_counters{implementation_->traffic_counters_.at(party_id)};
+    for (std::size_t phase = 0; phase < traffic_counters.size(); ++phase) {
+      for (std::size_t message_type = 0; message_type < traffic_counters[phase].size();
+           ++message_type) {
+        const auto& counters{traffic_counters[phase][message_type]};
+        using Implementation = CommunicationLayerImplementation;
+        MessageTypeStatistics message_type_statistics{
+            .number_of_messages_sent = counters[Implementation::kMessagesSent].load(),
+            .number_of_messages_received = counters[Implementation::kMessagesReceived].load(),
+            .number_of_bytes_sent = counters[Implementation::kBytesSent].load(),
+            .number_of_bytes_received = counters[Implementation::kBytesReceived].load()};
+        if (message_type_statistics.number_of_messages_sent > 0 ||
+            message_type_statistics.number_of_messages_received > 0) {
+          party_statistics.message_type_statistics.emplace(
+              std::make_pair(static_cast<CommunicationPhase>(phase),
+                             static_cast<std::uint8_t>(message_type)),
+              message_type_statistics);
+        }
+      }
+    }
   }
   return statistics;
 }
 
+void CommunicationLayer::SetPrioritizedSending(bool value, std::size_t fragment_size) {
+  if (fragment_size == 0) {
+    throw std::invalid_argument("the fragment size must not be 0");
+  }
+  implementation_->fragment_size_ = fragment_size;
+  implementation_->prioritized_sending_ = value;
+}
+
+bool CommunicationLayer::GetPrioritizedSending() const {
+  return implementation_->prioritized_sending_;
+}
+
+void CommunicationLayer::SetCommunicationPhase(CommunicationPhase phase) {
+  session_->phase = phase;
+}
+
+CommunicationPhase CommunicationLayer::GetCommunicationPhase() const { return session_->phase; }
+
 void CommunicationLayer::SetLogger(std::shared_ptr<Logger> logger) {
   if (is_started_) {
     throw std::logic_error(
         "changing the logger is not allowed after the CommunicationLayer has been started");
   }
   logger_ = logger;
-  implementation_->logger_ = logger;
+  // the threads of the communication layer log to the logger of session 0
+  if (session_id_ == 0) implementation_->logger_ = logger;
 }
 
 std::vector<std::unique_ptr<CommunicationLayer>> MakeDummyCommunicationLayers(
@@ -366,7 +1139,7 @@ std::vector<std::unique_ptr<CommunicationLayer>> MakeDummyCommunicationLayers(
 }
 
 std::vector<std::unique_ptr<CommunicationLayer>> MakeLocalTcpCommunicationLayers(
-    std::size_t number_of_parties, bool ipv6) {
+    std::size_t number_of_parties, bool ipv6, std::shared_ptr<TcpIoService> io_service) {
   constexpr uint16_t kPort = 10000;
   const auto localhost = ipv6 ? "::1" : "127.0.0.1";
   TcpPartiesConfiguration configuration;
@@ -377,8 +1150,31 @@ std::vector<std::unique_ptr<CommunicationLayer>> MakeLocalTcpCommunicationLayers
   }
   std::vector<std::future<std::vector<std::unique_ptr<Transport>>>> futures;
   for (std::size_t party_id = 0; party_id < number_of_parties; ++party_id) {
-    futures.emplace_back(std::async(std::launch::async, [party_id, &configuration] {
+    futures.emplace_back(std::async(std::launch::async, [party_id, &configuration, io_service] {
       TcpSetupHelper helper(party_id, configuration);
+      if (io_service) helper.SetIoService(io_service);
+      return helper.SetupConnections();
+    }));
+  }
+  std::vector<std::unique_ptr<CommunicationLayer>> communication_layers;
+  communication_layers.reserve(number_of_parties);
+  for (std::size_t party_id = 0; party_id < number_of_parties; ++party_id) {
+    auto transports = futures.at(party_id).get();
+    communication_layers.emplace_back(
+        std::make_unique<CommunicationLayer>(party_id, std::move(transports)));
+  }
+  return communication_layers;
+}
+
+std::vector<std::unique_ptr<CommunicationLayer>> MakeLocalSharedMemoryCommunicationLayers(
+    std::size_t number_of_parties) {
+  // a name that is unique among the concurrent runs on this host
+  static std::atomic<std::size_t> counter = 0;
+  const auto name{fmt::format("/motion-{}-{}", getpid(), counter++)};
+  std::vector<std::future<std::vector<std::unique_ptr<Transport>>>> futures;
+  for (std::size_t party_id = 0; party_id < number_of_parties; ++party_id) {
+    futures.emplace_back(std::async(std::launch::async, [party_id, number_of_parties, &name] {
+      SharedMemorySetupHelper helper(party_id, number_of_parties, name);
       return helper.SetupConnections();
     }));
   }
@@ -23,10 +23,14 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <span>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 // Undefine Windows macros that collide with function names in MOTION.
@@ -51,14 +55,23 @@ class Logger;
 namespace encrypto::motion::communication {
 
 class MessageManager;
-struct TransportStatistics;
+class TcpIoService;
 
 // Central interface for all communication related functionality
 //
 // Allows to send messages to other parties and to register handlers for
 // specific message types.
+//
+// By default, a send and a receive thread is started for each other party. If all transports
+// support receive handlers, e.g., AsyncTcpTransports on a shared TcpIoService, the messages are
+// received on the I/O threads of the transports and a single thread sends to all parties.
 class CommunicationLayer {
  public:
+  // default size of the fragments of bulk messages
+  static constexpr std::size_t kDefaultFragmentSize = 64 * 1024;
+  // maximum total size of the messages which are held back for sessions that have not been started
+  static constexpr std::size_t kMaximumHeldBackBytes = 256 * 1024 * 1024;
+
   CommunicationLayer(std::size_t my_id, std::vector<std::unique_ptr<Transport>>&& transports);
   CommunicationLayer(std::size_t my_id, std::vector<std::unique_ptr<Transport>>&& transports,
                      std::shared_ptr<Logger> logger);
@@ -70,7 +83,22 @@ class CommunicationLayer {
   std::size_t GetNumberOfParties() const { return number_of_parties_; }
   std::size_t GetMyId() const { return my_id_; }
 
-  // Start communication
+  // Create a communication layer for another session, which shares the transports, threads and
+  // settings of this one, but has its own MessageManager. The messages of a session are only
+  // delivered to the session with the same id at the other parties, so that a Backend can be
+  // created on each session to evaluate independent circuits concurrently over one set of
+  // connections. Messages which arrive before the session has been started at this party are held
+  // back until then, up to kMaximumHeldBackBytes in total, and those of sessions which have been
+  // shut down are dropped. Session ids must be unique among the sessions of this party and must not
+  // be reused, the layer created by the constructor has session id 0. Only shutting down the latter
+  // terminates the communication with the other parties, so it needs to be started and has to
+  // outlive all sessions.
+  // Throws a std::invalid_argument if session_id is 0 or already in use.
+  std::unique_ptr<CommunicationLayer> CreateSession(std::uint32_t session_id);
+
+  std::uint32_t GetSessionId() const { return session_id_; }
+
+  // Start communication, or start delivering the messages of the session
   void Start();
   void Synchronize();
 
@@ -80,11 +108,65 @@ class CommunicationLayer {
   // Send a message to all other parties
   void BroadcastMessage(flatbuffers::DetachedBuffer&& message);
 
-  // shutdown the communication layer
+  // Send a payload to all other parties packed together with all other payloads that are
+  // aggregated before the send thread gets to them, i.e., one message per party and round.
+  // The receiver obtains the bare payload by registering (kAggregatedMessage, message_id)
+  // in the MessageManager.
+  void BroadcastAggregatedMessage(std::size_t message_id, std::span<const std::uint8_t> payload);
+
+  // Send a payload as a fast message, i.e., with a fixed binary header instead of a flatbuffer.
+  // The payload is written directly from its buffer, which owner keeps alive until the message
+  // has been sent. The receiver obtains the message from the future registered for
+  // (message_type, message_id) and accesses the payload with GetFastMessagePayload.
+  void SendFastMessage(std::size_t party_id, MessageType message_type, std::size_t message_id,
+                       std::span<const std::uint8_t> payload, std::shared_ptr<const void> owner);
+
+  // Send the payload as a fast message to all other parties
+  void BroadcastFastMessage(MessageType message_type, std::size_t message_id,
+                            std::span<const std::uint8_t> payload,
+                            std::shared_ptr<const void> owner);
+
+  // Send the values of a contiguous container, e.g., the std::vector of a BitVector, as a fast
+  // message without copying them
+  template <typename Container>
+    requires(!std::is_lvalue_reference_v<Container>)
+  void SendFastMessage(std::size_t party_id, MessageType message_type, std::size_t message_id,
+                       Container&& payload) {
+    auto [bytes, owner] = TakePayload(std::move(payload));
+    SendFastMessage(party_id, message_type, message_id, bytes, std::move(owner));
+  }
+
+  template <typename Container>
+    requires(!std::is_lvalue_reference_v<Container>)
+  void BroadcastFastMessage(MessageType message_type, std::size_t message_id,
+                            Container&& payload) {
+    auto [bytes, owner] = TakePayload(std::move(payload));
+    BroadcastFastMessage(message_type, message_id, bytes, std::move(owner));
+  }
+
+  // shutdown the communication layer, or stop delivering the messages of the session
   void Shutdown();
 
+  // the statistics of the transports to the other parties, including the traffic of each phase and
+  // message type
   std::vector<TransportStatistics> GetTransportStatistics() const noexcept;
 
+  // earliest start and latest end of the connection setup of the transports, both are the epoch of
+  // the clock if no transport reports them
+  std::pair<std::chrono::steady_clock::time_point, std::chrono::steady_clock::time_point>
+  GetConnectionSetupTime() const noexcept;
+
+  // Send the messages with bulk priority, e.g., of the OT extensions, only if no online message is
+  // waiting for the same party, and split those larger than fragment_size, s.t. online messages
+  // preempt them at the boundaries of the fragments. Enabled by default, otherwise all messages
+  // are sent in the order of the calls.
+  void SetPrioritizedSending(bool value, std::size_t fragment_size = kDefaultFragmentSize);
+  bool GetPrioritizedSending() const;
+
+  // attribute the following traffic of this session to the given phase
+  void SetCommunicationPhase(CommunicationPhase phase);
+  CommunicationPhase GetCommunicationPhase() const;
+
   auto GetLogger() { return logger_; }
 
   void SetLogger(std::shared_ptr<Logger> logger);
@@ -93,10 +175,26 @@ class CommunicationLayer {
 
  private:
   struct CommunicationLayerImplementation;
+  struct Session;
+
+  // constructor of a session
+  CommunicationLayer(std::shared_ptr<CommunicationLayerImplementation> implementation,
+                     std::shared_ptr<Session> session, std::shared_ptr<Logger> logger);
+
+  template <typename Container>
+  static std::pair<std::span<const std::uint8_t>, std::shared_ptr<const void>> TakePayload(
+      Container&& payload) {
+    auto owner = std::make_shared<const Container>(std::move(payload));
+    std::span<const std::uint8_t> bytes(reinterpret_cast<const std::uint8_t*>(owner->data()),
+                                        owner->size() * sizeof(typename Container::value_type));
+    return {bytes, std::move(owner)};
+  }
 
   std::size_t my_id_;
   std::size_t number_of_parties_;
-  std::unique_ptr<CommunicationLayerImplementation> implementation_;
+  std::uint32_t session_id_;
+  std::shared_ptr<CommunicationLayerImplementation> implementation_;
+  std::shared_ptr<Session> session_;
   bool is_started_;
   bool is_shutdown_;
   std::shared_ptr<Logger> logger_;
@@ -109,8 +207,14 @@ class CommunicationLayer {
 std::vector<std::unique_ptr<CommunicationLayer>> MakeDummyCommunicationLayers(
     std::size_t number_of_parties);
 
-// Create a set of communication layers connected by local TCP connections
+// Create a set of communication layers connected by local TCP connections, which are
+// AsyncTcpTransports on io_service if it is given
 std::vector<std::unique_ptr<CommunicationLayer>> MakeLocalTcpCommunicationLayers(
-    std::size_t number_of_parties, bool ipv6 = true);
+    std::size_t number_of_parties, bool ipv6 = true,
+    std::shared_ptr<TcpIoService> io_service = nullptr);
+
+// Create a set of communication layers connected by shared memory transports
+std::vector<std::unique_ptr<CommunicationLayer>> MakeLocalSharedMemoryCommunicationLayers(
+    std::size_t number_of_parties);
 
 }  // namespace encrypto::motion::communication
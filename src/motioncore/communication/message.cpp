@@ -24,6 +24,9 @@
 
 #include "message.h"
 
+#include <cassert>
+#include <cstring>
+
 #include "fbs_headers/message_generated.h"
 #include "utility/typedefs.h"
 
@@ -72,6 +75,87 @@ flatbuffers::FlatBufferBuilder BuildMessage(MessageType message_type,
   return BuildMessage(message_type, std::span(*payload));
 }
 
+FastMessageHeader BuildFastMessageHeader(MessageType message_type, std::size_t message_id,
+                                         std::size_t payload_size) {
+  return {.marker = kFastMessageMarker,
+          .message_type = message_type,
+          .reserved = {},
+          .message_id = message_id,
+          .payload_size = payload_size};
+}
+
+std::optional<SessionMessageHeader> GetSessionMessageHeader(
+    std::span<const std::uint8_t> message) {
+  if (message.size() < sizeof(SessionMessageHeader)) return std::nullopt;
+  SessionMessageHeader header;
+  std::memcpy(&header, message.data(), sizeof(header));
+  if (header.marker != kSessionMessageMarker) return std::nullopt;
+  return header;
+}
+
+std::span<const std::uint8_t> SkipSessionMessageHeader(std::span<const std::uint8_t> message) {
+  // the marker is neither a valid root offset of a flatbuffer nor the marker of a fast message
+  if (GetSessionMessageHeader(message)) return message.subspan(sizeof(SessionMessageHeader));
+  return message;
+}
+
+const Message* GetMessage(std::span<const std::uint8_t> message) {
+  return GetMessage(SkipSessionMessageHeader(message).data());
+}
+
+bool IsFastMessage(std::span<const std::uint8_t> message) {
+  message = SkipSessionMessageHeader(message);
+  if (message.size() < sizeof(kFastMessageMarker)) return false;
+  std::uint32_t marker;
+  std::memcpy(&marker, message.data(), sizeof(marker));
+  return marker == kFastMessageMarker;
+}
+
+bool VerifyFastMessage(std::span<const std::uint8_t> message) {
+  message = SkipSessionMessageHeader(message);
+  if (message.size() < sizeof(FastMessageHeader) || !IsFastMessage(message)) return false;
+  return GetFastMessageHeader(message).payload_size == message.size() - sizeof(FastMessageHeader);
+}
+
+FastMessageHeader GetFastMessageHeader(std::span<const std::uint8_t> message) {
+  message = SkipSessionMessageHeader(message);
+  assert(message.size() >= sizeof(FastMessageHeader));
+  // the receive buffer is not necessarily aligned for the header
+  FastMessageHeader header;
+  std::memcpy(&header, message.data(), sizeof(header));
+  return header;
+}
+
+std::span<const std::uint8_t> GetFastMessagePayload(std::span<const std::uint8_t> message) {
+  message = SkipSessionMessageHeader(message);
+  assert(message.size() >= sizeof(FastMessageHeader));
+  return message.subspan(sizeof(FastMessageHeader));
+}
+
+MessagePriority GetMessagePriority(MessageType message_type) {
+  switch (message_type) {
+    case MessageType::kBaseROtMessageSender:
+    case MessageType::kBaseROtMessageReceiver:
+    case MessageType::kOtExtensionReceiverMasks:
+    case MessageType::kOtExtensionReceiverCorrections:
+    case MessageType::kOtExtensionSender:
+    case MessageType::kKK13OtExtensionReceiverMasks:
+    case MessageType::kKK13OtExtensionReceiverCorrections:
+    case MessageType::kKK13OtExtensionSender:
+    case MessageType::kKK13OtExtensionMaskSeed:
+    case MessageType::kSharedBitsMask:
+    case MessageType::kSharedBitsReconstruct:
+    case MessageType::kAstraSetupMultiplyGate:
+    case MessageType::kAstraSetupDotProductGate:
+    case MessageType::kGarbledCircuitGarbledTables:
+    // the termination message has to be sent after all other messages
+    case MessageType::kTerminationMessage:
+      return MessagePriority::kBulk;
+    default:
+      return MessagePriority::kOnline;
+  }
+}
+
 using namespace std::string_literals;
 
 std::string to_string(MessageType message_type) {
@@ -25,7 +25,11 @@
 #pragma once
 
 #include <flatbuffers/flatbuffers.h>
+#include <array>
+#include <cstdint>
+#include <optional>
 #include <span>
+#include <vector>
 
 #include "fbs_headers/message_generated.h"
 
@@ -42,6 +46,65 @@ flatbuffers::FlatBufferBuilder BuildMessage(MessageType message_type,
 flatbuffers::FlatBufferBuilder BuildMessage(MessageType message_type,
                                             const std::vector<uint8_t>* payload);
 
+// Messages of the sessions other than session 0 are preceded by a SessionMessageHeader, which is
+// part of the message if it is split into fragments. The receiver keeps the header in front of the
+// message, the functions below which parse a received message skip it.
+constexpr std::uint32_t kSessionMessageMarker = 0xFFFFFFFD;
+
+struct SessionMessageHeader {
+  std::uint32_t marker;
+  std::uint32_t session_id;
+};
+
+static_assert(sizeof(SessionMessageHeader) == 8);
+
+// the session header of a message of a session other than session 0
+std::optional<SessionMessageHeader> GetSessionMessageHeader(std::span<const std::uint8_t> message);
+
+// the message without its session header, if any
+std::span<const std::uint8_t> SkipSessionMessageHeader(std::span<const std::uint8_t> message);
+
+// the root of a received Message flatbuffer, which replaces GetMessage(message.data()) for
+// messages which may have a session header
+const Message* GetMessage(std::span<const std::uint8_t> message);
+
+// Hot messages, e.g., openings and output shares, skip the FlatBufferBuilder: a fast message is a
+// FastMessageHeader followed by the bare payload, which the transport writes directly from the
+// buffer of the sender. The marker is never a valid root offset of a Message flatbuffer, so that
+// both formats can be mixed on the same transport.
+constexpr std::uint32_t kFastMessageMarker = 0xFFFFFFFF;
+
+struct FastMessageHeader {
+  std::uint32_t marker;
+  MessageType message_type;
+  std::array<std::uint8_t, 3> reserved;
+  std::uint64_t message_id;
+  std::uint64_t payload_size;
+};
+
+static_assert(sizeof(FastMessageHeader) == 24);
+
+FastMessageHeader BuildFastMessageHeader(MessageType message_type, std::size_t message_id,
+                                         std::size_t payload_size);
+
+// check if the message starts with the marker of a fast message
+bool IsFastMessage(std::span<const std::uint8_t> message);
+
+// check if the message is a fast message whose size matches its header
+bool VerifyFastMessage(std::span<const std::uint8_t> message);
+
+// the header of a verified fast message
+FastMessageHeader GetFastMessageHeader(std::span<const std::uint8_t> message);
+
+// the payload of a verified fast message
+std::span<const std::uint8_t> GetFastMessagePayload(std::span<const std::uint8_t> message);
+
+// Messages of the preprocessing, e.g., of the OT extensions, are sent with bulk priority, i.e.,
+// only if no online message is waiting to be sent to the same party
+enum class MessagePriority : std::uint8_t { kOnline, kBulk };
+
+MessagePriority GetMessagePriority(MessageType message_type);
+
 // Give a human readable representation of MessageType values
 std::string to_string(MessageType message_type);
 
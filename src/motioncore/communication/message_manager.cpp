@@ -22,23 +22,82 @@
 
 #include "message_manager.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
 #include "fbs_headers/message_generated.h"
+#include "message.h"
+#include "receive_buffer_pool.h"
 
 namespace encrypto::motion::communication {
 
-MessageManager::MessageManager(std::size_t number_of_parties, std::size_t my_id) : my_id_(my_id) {
+MessageManager::MessageManager(std::size_t number_of_parties, std::size_t my_id)
+    : MessageManager(number_of_parties, my_id, std::make_shared<ReceiveBufferPool>()) {}
+
+MessageManager::MessageManager(std::size_t number_of_parties, std::size_t my_id,
+                               std::shared_ptr<ReceiveBufferPool> receive_buffer_pool)
+    : receive_buffer_pool_(std::move(receive_buffer_pool)), my_id_(my_id) {
   incoming_message_promises_.resize(number_of_parties - 1);
+  // the indices are neither copyable nor movable
+  incoming_message_slots_ = std::vector<slots_type>(number_of_parties - 1);
   incoming_sync_states_ =
       std::vector<SynchronizedFiberQueue<container_type>>(number_of_parties - 1);
 }
 
 void MessageManager::ReceivedMessage(std::size_t sender_id,
                                      std::vector<std::uint8_t>&& message) {
-  auto fb_message{GetMessage(message.data())};
+  auto fb_message{GetMessage(message)};
   MessageType message_type{fb_message->message_type()};
   std::size_t message_id{fb_message->message_id()};
-  incoming_message_promises_[ComputeId(sender_id)][message_type][message_id]->set_value(
-      std::move(message));
+  Fulfill(sender_id, message_type, message_id, std::move(message));
+}
+
+void MessageManager::Fulfill(std::size_t sender_id, MessageType message_type,
+                             std::size_t message_id, container_type&& message) {
+  const std::size_t party_index{ComputeId(sender_id)};
+  if (auto [promises, index] = FindSlot(party_index, message_type, message_id); promises) {
+    promises->set_value(index, std::move(message));
+    return;
+  }
+  auto& submap{incoming_message_promises_[party_index][message_type]};
+  assert(submap.contains(message_id));
+  submap[message_id]->set_value(std::move(message));
+}
+
+void MessageManager::ReceivedAggregatedMessage(std::size_t sender_id,
+                                               std::span<const std::uint8_t> payload) {
+  std::size_t offset{0};
+  while (offset < payload.size()) {
+    std::uint64_t message_id;
+    std::uint32_t size;
+    if (payload.size() - offset < sizeof(message_id) + sizeof(size)) {
+      throw std::runtime_error(
+          fmt::format("truncated aggregated message from party {}", sender_id));
+    }
+    std::copy_n(payload.data() + offset, sizeof(message_id),
+                reinterpret_cast<std::uint8_t*>(&message_id));
+    offset += sizeof(message_id);
+    std::copy_n(payload.data() + offset, sizeof(size), reinterpret_cast<std::uint8_t*>(&size));
+    offset += sizeof(size);
+    if (payload.size() - offset < size) {
+      throw std::runtime_error(
+          fmt::format("truncated aggregated message from party {}", sender_id));
+    }
+    auto message{receive_buffer_pool_->Acquire(size)};
+    std::copy_n(payload.data() + offset, size, message.data());
+    Fulfill(sender_id, MessageType::kAggregatedMessage, message_id, std::move(message));
+    offset += size;
+  }
+}
+
+void MessageManager::ReleaseMessage(container_type&& message) {
+  receive_buffer_pool_->Release(std::move(message));
 }
 
 MessageManager::future_type MessageManager::RegisterReceive(std::size_t sender_id,
@@ -63,4 +122,91 @@ std::vector<MessageManager::future_type> MessageManager::RegisterReceiveAll(
   return futures;
 }
 
+std::vector<MessageManager::future_type> MessageManager::RegisterReceiveRange(
+    std::size_t sender_id, MessageType message_type, std::size_t first_message_id,
+    std::size_t number_of_messages) {
+  if (number_of_messages == 0 || first_message_id + number_of_messages < first_message_id) {
+    throw std::invalid_argument(fmt::format(
+        "cannot register message ids [{}, {}) of party {} as a range", first_message_id,
+        first_message_id + number_of_messages, sender_id));
+  }
+  std::vector<future_type> futures;
+  futures.reserve(number_of_messages);
+  // too sparse for the pages of the index
+  if (first_message_id + number_of_messages > kMaximumSlotMessageId) {
+    for (std::size_t i = 0; i < number_of_messages; ++i) {
+      futures.emplace_back(RegisterReceive(sender_id, message_type, first_message_id + i));
+    }
+    return futures;
+  }
+  std::scoped_lock lock(slots_mutex_);
+  auto& index{
+      incoming_message_slots_[ComputeId(sender_id)][static_cast<std::uint8_t>(message_type)]};
+  if (index.Contains(first_message_id, number_of_messages)) {
+    throw std::invalid_argument(fmt::format(
+        "cannot register message ids [{}, {}) of party {} as a range", first_message_id,
+        first_message_id + number_of_messages, sender_id));
+  }
+  auto range{std::make_unique<SlotRange>(first_message_id, promise_array_type(number_of_messages))};
+  for (std::size_t i = 0; i < number_of_messages; ++i) {
+    futures.emplace_back(range->promises.get_future(i));
+  }
+  index.Insert(std::move(range));
+  return futures;
+}
+
+std::pair<MessageManager::promise_array_type*, std::size_t> MessageManager::FindSlot(
+    std::size_t party_index, MessageType message_type, std::size_t message_id) {
+  auto* range{incoming_message_slots_[party_index][static_cast<std::uint8_t>(message_type)].Find(
+      message_id)};
+  if (range == nullptr) return {nullptr, 0};
+  return {&range->promises, message_id - range->first_message_id};
+}
+
+MessageManager::SlotRange* MessageManager::SlotIndex::Find(std::size_t message_id) const {
+  const auto* directory{directory_.load(std::memory_order_acquire)};
+  const std::size_t page_index{message_id / kSlotPageSize};
+  if (directory == nullptr || page_index >= directory->size) return nullptr;
+  const auto* page{directory->pages[page_index].load(std::memory_order_acquire)};
+  if (page == nullptr) return nullptr;
+  return (*page)[message_id % kSlotPageSize].load(std::memory_order_acquire);
+}
+
+bool MessageManager::SlotIndex::Contains(std::size_t first_message_id,
+                                         std::size_t number_of_messages) const {
+  for (std::size_t i = 0; i < number_of_messages; ++i) {
+    if (Find(first_message_id + i) != nullptr) return true;
+  }
+  return false;
+}
+
+void MessageManager::SlotIndex::Insert(std::unique_ptr<SlotRange> range) {
+  const std::size_t first_message_id{range->first_message_id};
+  const std::size_t end_message_id{first_message_id + range->promises.size()};
+  const std::size_t number_of_pages{(end_message_id + kSlotPageSize - 1) / kSlotPageSize};
+  auto* directory{directory_.load(std::memory_order_relaxed)};
+  if (directory == nullptr || directory->size < number_of_pages) {
+    // the readers of the previous directory keep using it until they load the new one
+    const std::size_t size{std::max(number_of_pages, directory ? 2 * directory->size : 1)};
+    auto new_directory{std::make_unique<SlotDirectory>(size)};
+    for (std::size_t i = 0; directory && i < directory->size; ++i) {
+      new_directory->pages[i].store(directory->pages[i].load(std::memory_order_relaxed),
+                                    std::memory_order_relaxed);
+    }
+    directory = new_directory.get();
+    directories_.emplace_back(std::move(new_directory));
+    directory_.store(directory, std::memory_order_release);
+  }
+  for (std::size_t message_id = first_message_id; message_id < end_message_id; ++message_id) {
+    auto& page_pointer{directory->pages[message_id / kSlotPageSize]};
+    auto* page{page_pointer.load(std::memory_order_relaxed)};
+    if (page == nullptr) {
+      page = pages_.emplace_back(std::make_unique<SlotPage>()).get();
+      page_pointer.store(page, std::memory_order_release);
+    }
+    (*page)[message_id % kSlotPageSize].store(range.get(), std::memory_order_release);
+  }
+  ranges_.emplace_back(std::move(range));
+}
+
 }  // namespace encrypto::motion::communication
\ No newline at end of file
@@ -22,8 +22,15 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "utility/reusable_future.h"
 #include "utility/synchronized_queue.h"
@@ -31,6 +38,7 @@
 namespace encrypto::motion::communication {
 
 enum class MessageType : uint8_t;
+class ReceiveBufferPool;
 
 /// \brief Manages future/promise based communication channels in the following way:
 /// In a pre-setup phase, a callee calls some Register* function eg RegisterReceive for
@@ -41,7 +49,15 @@ enum class MessageType : uint8_t;
 /// parameters. The message gets moved to the promise as a whole ie all further actions such as
 /// parsing the message depend on the code calling the get() function. Consequently, a message
 /// obtained from the future should be obtained via
-/// communication::GetMessage(raw_message_pointer)->payload() interface from flatbuffers.
+/// communication::GetMessage(raw_message)->payload() or communication::GetFastMessagePayload,
+/// which skip the session header that messages of sessions other than 0 start with.
+/// Callers expecting many messages with consecutive ids, eg one per gate of a large batch, should
+/// use RegisterReceiveRange, which preallocates the promises of the whole id range in a single
+/// contiguous slot array. A message for such a range is matched by indexing into the array
+/// instead of walking the hash maps and no per-message allocation takes place.
+/// Registration must happen before the matching messages can arrive, so the receive path reads
+/// the promise structures without taking any lock. The ranges are kept in a SlotIndex, which
+/// allows registering further ranges while messages of earlier ones are received.
 class MessageManager {
  public:
   // byte type
@@ -56,21 +72,102 @@ class MessageManager {
   using submap_type = std::unordered_map<std::size_t, std::unique_ptr<promise_type>>;
   // map[message_type] -> submap
   using map_type = std::unordered_map<MessageType, submap_type>;
+  // contiguous promises for a range of message ids
+  using promise_array_type = ReusableFiberPromiseArray<container_type>;
+
+  // promises of the message ids [first_message_id, first_message_id + promises.size())
+  struct SlotRange {
+    std::size_t first_message_id;
+    promise_array_type promises;
+  };
+
+  // number of message ids per page of a SlotIndex
+  static constexpr std::size_t kSlotPageSize = 1024;
+  // ranges are only indexed below this id, larger ids are registered in the maps
+  static constexpr std::size_t kMaximumSlotMessageId = std::size_t(1) << 32;
+
+  // Maps the message ids of a message type to their registered ranges, s.t. the receive thread
+  // finds the range of a message without a lock while further ranges are registered. The ids are
+  // mapped in pages of kSlotPageSize entries, which are never moved, and the directory of the
+  // pages is replaced by a larger copy if a range beyond it is registered. The ranges, pages and
+  // replaced directories are only freed together with the index.
+  class SlotIndex {
+   public:
+    // the range containing message_id or nullptr, may be called concurrently with Insert
+    SlotRange* Find(std::size_t message_id) const;
+
+    // checks if any of the message ids [first_message_id, first_message_id + number_of_messages)
+    // is in a range already
+    bool Contains(std::size_t first_message_id, std::size_t number_of_messages) const;
+
+    // adds a range, which must not overlap the registered ones
+    void Insert(std::unique_ptr<SlotRange> range);
+
+   private:
+    using SlotPage = std::array<std::atomic<SlotRange*>, kSlotPageSize>;
+
+    struct SlotDirectory {
+      explicit SlotDirectory(std::size_t number_of_pages)
+          : size(number_of_pages), pages(new std::atomic<SlotPage*>[number_of_pages]()) {}
+
+      const std::size_t size;
+      std::unique_ptr<std::atomic<SlotPage*>[]> pages;
+    };
+
+    std::atomic<SlotDirectory*> directory_{nullptr};
+    // owners of the structures above, only accessed while registering
+    std::vector<std::unique_ptr<SlotDirectory>> directories_;
+    std::vector<std::unique_ptr<SlotPage>> pages_;
+    std::vector<std::unique_ptr<SlotRange>> ranges_;
+  };
+
+  // slots[message_type] -> index of the registered ranges
+  using slots_type = std::array<SlotIndex, std::numeric_limits<std::uint8_t>::max() + 1>;
 
   MessageManager() = delete;
   MessageManager(const MessageManager&) = delete;
 
   MessageManager(std::size_t number_of_parties, std::size_t my_id);
 
+  // take the buffers of the received messages from a pool shared with other MessageManagers
+  MessageManager(std::size_t number_of_parties, std::size_t my_id,
+                 std::shared_ptr<ReceiveBufferPool> receive_buffer_pool);
+
   // This method is called to forward a received message to the corresponding future.
   void ReceivedMessage(std::size_t sender_id, std::vector<std::uint8_t>&& message);
 
+  // Forwards a message whose header was already parsed to the future registered for
+  // (sender_id, message_type, message_id) by RegisterReceive or RegisterReceiveRange.
+  void Fulfill(std::size_t sender_id, MessageType message_type, std::size_t message_id,
+               container_type&& message);
+
+  // Demultiplexes the payload of a kAggregatedMessage and forwards the bare payload of each entry
+  // to the future registered for (kAggregatedMessage, message_id of the entry).
+  void ReceivedAggregatedMessage(std::size_t sender_id, std::span<const std::uint8_t> payload);
+
+  // Returns the buffer of a message obtained from a future after it was parsed, so that it can
+  // be reused for a later message. Calling this is optional.
+  void ReleaseMessage(container_type&& message);
+
+  const std::shared_ptr<ReceiveBufferPool>& GetReceiveBufferPool() const {
+    return receive_buffer_pool_;
+  }
+
   [[nodiscard]] future_type RegisterReceive(std::size_t sender_id, MessageType message_type,
                                             std::size_t message_id);
 
   [[nodiscard]] std::vector<future_type> RegisterReceiveAll(MessageType message_type,
                                                             std::size_t message_id);
 
+  // Registers the message ids [first_message_id, first_message_id + number_of_messages) of
+  // sender_id at once and returns the futures in the order of the ids. Ranges may be registered
+  // while messages of other ranges are received. Throws std::invalid_argument if the range
+  // overlaps a range registered before.
+  [[nodiscard]] std::vector<future_type> RegisterReceiveRange(std::size_t sender_id,
+                                                              MessageType message_type,
+                                                              std::size_t first_message_id,
+                                                              std::size_t number_of_messages);
+
   auto& GetMessagePromises(std::size_t party_id) {
     return incoming_message_promises_[ComputeId(party_id)];
   }
@@ -84,11 +181,23 @@ class MessageManager {
  private:
   std::size_t ComputeId(std::size_t id) { return id < my_id_ ? id : id - 1; }
 
+  // returns the promise array containing message_id and the index in it, or nullptr
+  std::pair<promise_array_type*, std::size_t> FindSlot(std::size_t party_index,
+                                                       MessageType message_type,
+                                                       std::size_t message_id);
+
   // incoming_message_promises_[sender_id][message_type][message_id]
   std::vector<map_type> incoming_message_promises_;
+  // incoming_message_slots_[sender_id][message_type] -> preallocated ranges
+  std::vector<slots_type> incoming_message_slots_;
+  // serializes the registration of ranges, the receive thread reads them without a lock
+  std::mutex slots_mutex_;
   // sync states need to be handled differently because it may happen that 2 sync states arrive
   // sequentially, which would break the promise-future logic.
   std::vector<SynchronizedFiberQueue<container_type>> incoming_sync_states_;
+  // buffers of received messages, which are filled by the transports and by
+  // ReceivedAggregatedMessage
+  std::shared_ptr<ReceiveBufferPool> receive_buffer_pool_;
   std::size_t my_id_;
 };
 
@@ -0,0 +1,88 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "receive_buffer_pool.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace encrypto::motion::communication {
+
+ReceiveBufferPool::ReceiveBufferPool(std::size_t maximum_buffers_per_size_class,
+                                     std::size_t maximum_pooled_bytes)
+    : maximum_buffers_per_size_class_(maximum_buffers_per_size_class),
+      maximum_pooled_bytes_(maximum_pooled_bytes) {}
+
+ReceiveBufferPool::buffer_type ReceiveBufferPool::Acquire(std::size_t size) {
+  // smallest class whose buffers can hold size bytes
+  const std::size_t size_class =
+      std::max<std::size_t>(kMinimumSizeClass, size <= 1 ? 0 : std::bit_width(size - 1));
+  if (size_class > kMaximumSizeClass) {
+    ++number_of_allocations_;
+    return buffer_type(size);
+  }
+
+  buffer_type buffer;
+  {
+    auto& pool{size_classes_[size_class - kMinimumSizeClass]};
+    std::scoped_lock lock(pool.mutex);
+    if (!pool.buffers.empty()) {
+      buffer = std::move(pool.buffers.back());
+      pool.buffers.pop_back();
+      number_of_pooled_bytes_ -= buffer.capacity();
+    }
+  }
+  if (buffer.capacity() == 0) {
+    ++number_of_allocations_;
+    buffer.reserve(std::size_t(1) << size_class);
+  } else {
+    ++number_of_reuses_;
+  }
+  // a recycled buffer keeps its previous size, so only a growing buffer is zero-filled
+  buffer.resize(size);
+  return buffer;
+}
+
+void ReceiveBufferPool::Release(buffer_type&& buffer) {
+  const std::size_t capacity{buffer.capacity()};
+  if (capacity < (std::size_t(1) << kMinimumSizeClass)) return;
+  // largest class whose messages fit into the buffer
+  const std::size_t size_class{static_cast<std::size_t>(std::bit_width(capacity)) - 1};
+  if (size_class > kMaximumSizeClass) return;
+
+  // reserve the capacity before taking the lock of the size class, so the limit holds across
+  // concurrent releases into different classes
+  if (number_of_pooled_bytes_.fetch_add(capacity) + capacity > maximum_pooled_bytes_) {
+    number_of_pooled_bytes_ -= capacity;
+    return;
+  }
+  auto& pool{size_classes_[size_class - kMinimumSizeClass]};
+  std::scoped_lock lock(pool.mutex);
+  if (pool.buffers.size() < maximum_buffers_per_size_class_) {
+    pool.buffers.emplace_back(std::move(buffer));
+  } else {
+    number_of_pooled_bytes_ -= capacity;
+  }
+}
+
+}  // namespace encrypto::motion::communication
@@ -0,0 +1,83 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace encrypto::motion::communication {
+
+// Pool of receive buffers that are recycled instead of being freed after a message was parsed.
+// Buffers are grouped in size classes of powers of two, so a buffer taken from a class can hold
+// any message of that class without reallocation. Messages larger than the largest size class
+// are allocated as usual and dropped when released. The pool holds at most
+// maximum_buffers_per_size_class buffers per size class and maximum_pooled_bytes bytes of buffer
+// capacity in total, released buffers beyond these limits are freed. All methods are thread-safe.
+class ReceiveBufferPool {
+ public:
+  using buffer_type = std::vector<std::uint8_t>;
+
+  // size classes are 2^kMinimumSizeClass B = 64 B to 2^kMaximumSizeClass B = 64 MiB
+  static constexpr std::size_t kMinimumSizeClass = 6;
+  static constexpr std::size_t kMaximumSizeClass = 26;
+
+  // by default at most 256 MiB are held in the pool, e.g., four buffers of the largest class
+  static constexpr std::size_t kDefaultMaximumPooledBytes = std::size_t(1) << 28;
+
+  explicit ReceiveBufferPool(std::size_t maximum_buffers_per_size_class = 64,
+                             std::size_t maximum_pooled_bytes = kDefaultMaximumPooledBytes);
+
+  // get a buffer of the given size, its contents are unspecified
+  buffer_type Acquire(std::size_t size);
+
+  // return a buffer to the pool, it is dropped if its size class is full or if it would exceed
+  // the maximum number of pooled bytes
+  void Release(buffer_type&& buffer);
+
+  // number of buffers that had to be allocated or were taken from the pool in Acquire
+  std::size_t GetNumberOfAllocations() const { return number_of_allocations_; }
+  std::size_t GetNumberOfReuses() const { return number_of_reuses_; }
+
+  // capacity of all buffers that are currently held in the pool
+  std::size_t GetNumberOfPooledBytes() const { return number_of_pooled_bytes_; }
+
+ private:
+  struct SizeClass {
+    std::mutex mutex;
+    std::vector<buffer_type> buffers;
+  };
+
+  std::array<SizeClass, kMaximumSizeClass - kMinimumSizeClass + 1> size_classes_;
+  std::size_t maximum_buffers_per_size_class_;
+  std::size_t maximum_pooled_bytes_;
+  std::atomic<std::size_t> number_of_pooled_bytes_ = 0;
+  std::atomic<std::size_t> number_of_allocations_ = 0;
+  std::atomic<std::size_t> number_of_reuses_ = 0;
+};
+
+}  // namespace encrypto::motion::communication
@@ -0,0 +1,289 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "recording_transport.h"
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <flatbuffers/flatbuffers.h>
+#include <fmt/format.h>
+
+#include "message.h"
+
+// Undefine Windows macros that collide with function names in MOTION.
+#ifdef SendMessage
+#undef SendMessage
+#endif
+
+namespace encrypto::motion::communication {
+
+namespace {
+
+// a recording starts with this magic value, followed by one record per message consisting of the
+// nanoseconds since the start of the recording and the size of the message as std::uint64_t, and
+// the message itself, all in host byte order
+constexpr std::array<char, 8> kRecordingMagic = {'M', 'O', 'T', 'I', 'O', 'N', 'R', 'C'};
+
+struct RecordHeader {
+  std::uint64_t time;
+  std::uint64_t size;
+};
+
+// synchronization messages only consist of the header and the 8 byte counter
+constexpr std::size_t kMaximumSynchronizationMessageSize = 64;
+
+// check if a message is a synchronization message of session 0, which is a flatbuffer without
+// session header
+bool IsSynchronizationMessage(std::span<const std::uint8_t> message) {
+  if (message.size() > kMaximumSynchronizationMessageSize || IsFastMessage(message)) return false;
+  flatbuffers::Verifier verifier(message.data(), message.size());
+  return VerifyMessageBuffer(verifier) &&
+         GetMessage(message)->message_type() == MessageType::kSynchronizationMessage;
+}
+
+}  // namespace
+
+struct RecordingTransport::RecordingTransportImplementation {
+  RecordingTransportImplementation(const std::string& path)
+      : file_(path, std::ios::binary | std::ios::trunc), start_(std::chrono::steady_clock::now()) {
+    if (!file_) {
+      throw std::runtime_error(fmt::format("cannot create recording {}", path));
+    }
+    file_.write(kRecordingMagic.data(), kRecordingMagic.size());
+  }
+
+  void Record(const std::vector<std::uint8_t>& message) {
+    const std::chrono::nanoseconds time = std::chrono::steady_clock::now() - start_;
+    const RecordHeader header{static_cast<std::uint64_t>(time.count()), message.size()};
+    std::scoped_lock lock(mutex_);
+    if (!file_.is_open()) return;
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file_.write(reinterpret_cast<const char*>(message.data()), message.size());
+  }
+
+  void Close() {
+    std::scoped_lock lock(mutex_);
+    file_.close();
+  }
+
+  std::mutex mutex_;
+  std::ofstream file_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+RecordingTransport::RecordingTransport(std::unique_ptr<Transport> transport,
+                                       const std::string& path)
+    : transport_(std::move(transport)),
+      implementation_(std::make_unique<RecordingTransportImplementation>(path)) {
+  if (!transport_) {
+    throw std::invalid_argument("RecordingTransport needs a transport to wrap");
+  }
+  const auto& statistics = transport_->GetStatistics();
+  SetConnectionSetupTime(statistics.connection_setup_start, statistics.connection_setup_end);
+}
+
+RecordingTransport::~RecordingTransport() = default;
+
+void RecordingTransport::SendMessage(std::span<const std::uint8_t> message) {
+  transport_->SendMessage(message);
+  statistics_.number_of_bytes_sent += message.size() + sizeof(std::uint32_t);
+  statistics_.number_of_messages_sent += 1;
+}
+
+void RecordingTransport::SendMessageFragments(
+    std::span<const std::span<const std::uint8_t>> fragments) {
+  transport_->SendMessageFragments(fragments);
+  for (const auto& fragment : fragments) statistics_.number_of_bytes_sent += fragment.size();
+  statistics_.number_of_bytes_sent += sizeof(std::uint32_t);
+  statistics_.number_of_messages_sent += 1;
+}
+
+bool RecordingTransport::Available() const { return transport_->Available(); }
+
+std::optional<std::vector<std::uint8_t>> RecordingTransport::ReceiveMessage() {
+  auto message{transport_->ReceiveMessage()};
+  if (message.has_value()) {
+    implementation_->Record(*message);
+    statistics_.number_of_bytes_received += message->size() + sizeof(std::uint32_t);
+    statistics_.number_of_messages_received += 1;
+  }
+  return message;
+}
+
+void RecordingTransport::ShutdownSend() { transport_->ShutdownSend(); }
+
+void RecordingTransport::Shutdown() {
+  transport_->Shutdown();
+  implementation_->Close();
+}
+
+void RecordingTransport::SetReceiveBufferPool(std::shared_ptr<ReceiveBufferPool> pool) {
+  transport_->SetReceiveBufferPool(pool);
+  Transport::SetReceiveBufferPool(std::move(pool));
+}
+
+struct ReplayTransport::ReplayTransportImplementation {
+  struct RecordedMessage {
+    std::chrono::nanoseconds time;
+    // number of synchronization messages the peer had sent before this message, i.e., it was sent
+    // after the peer received as many synchronization messages of the party
+    std::size_t number_of_synchronizations;
+    std::vector<std::uint8_t> message;
+  };
+
+  // check if the next message may be delivered, requires the lock on mutex_
+  bool IsNextMessageReleased() const {
+    return released_all_ || messages_.at(next_message_).number_of_synchronizations <=
+                                number_of_synchronizations_sent_;
+  }
+
+  std::vector<RecordedMessage> messages_;
+  std::size_t next_message_ = 0;
+  bool preserve_timing_;
+  std::chrono::steady_clock::time_point start_;
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  std::size_t number_of_synchronizations_sent_ = 0;
+  // set once the party stops sending, s.t. the remaining messages do not wait for it
+  bool released_all_ = false;
+};
+
+ReplayTransport::ReplayTransport(const std::string& path, bool preserve_timing)
+    : implementation_(std::make_unique<ReplayTransportImplementation>()) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error(fmt::format("cannot open recording {}", path));
+  }
+  std::array<char, kRecordingMagic.size()> magic;
+  if (!file.read(magic.data(), magic.size()) || magic != kRecordingMagic) {
+    throw std::runtime_error(fmt::format("{} is no recording", path));
+  }
+  RecordHeader header;
+  std::size_t number_of_synchronizations = 0;
+  while (file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+    std::vector<std::uint8_t> message(header.size);
+    if (!file.read(reinterpret_cast<char*>(message.data()), message.size())) {
+      throw std::runtime_error(fmt::format("recording {} is truncated", path));
+    }
+    const bool is_synchronization_message{IsSynchronizationMessage(message)};
+    implementation_->messages_.push_back(
+        {std::chrono::nanoseconds(header.time), number_of_synchronizations, std::move(message)});
+    number_of_synchronizations += is_synchronization_message;
+  }
+  if (file.gcount() != 0) {
+    throw std::runtime_error(fmt::format("recording {} is truncated", path));
+  }
+  implementation_->preserve_timing_ = preserve_timing;
+  implementation_->start_ = std::chrono::steady_clock::now();
+}
+
+ReplayTransport::~ReplayTransport() = default;
+
+void ReplayTransport::SendMessage(std::span<const std::uint8_t> message) {
+  statistics_.number_of_bytes_sent += message.size() + sizeof(std::uint32_t);
+  statistics_.number_of_messages_sent += 1;
+  if (IsSynchronizationMessage(message)) {
+    {
+      std::scoped_lock lock(implementation_->mutex_);
+      ++implementation_->number_of_synchronizations_sent_;
+    }
+    implementation_->condition_.notify_all();
+  }
+}
+
+void ReplayTransport::ShutdownSend() {
+  {
+    std::scoped_lock lock(implementation_->mutex_);
+    implementation_->released_all_ = true;
+  }
+  implementation_->condition_.notify_all();
+}
+
+void ReplayTransport::Shutdown() { ShutdownSend(); }
+
+bool ReplayTransport::Available() const {
+  std::scoped_lock lock(implementation_->mutex_);
+  const auto& messages = implementation_->messages_;
+  const auto next_message = implementation_->next_message_;
+  if (next_message == messages.size() || !implementation_->IsNextMessageReleased()) return false;
+  return !implementation_->preserve_timing_ ||
+         std::chrono::steady_clock::now() >=
+             implementation_->start_ + messages.at(next_message).time;
+}
+
+std::optional<std::vector<std::uint8_t>> ReplayTransport::ReceiveMessage() {
+  std::unique_lock lock(implementation_->mutex_);
+  auto& messages = implementation_->messages_;
+  auto& next_message = implementation_->next_message_;
+  if (next_message == messages.size()) return std::nullopt;
+  implementation_->condition_.wait(lock,
+                                   [this] { return implementation_->IsNextMessageReleased(); });
+  auto& [time, number_of_synchronizations, message] = messages.at(next_message++);
+  lock.unlock();
+  if (implementation_->preserve_timing_) {
+    std::this_thread::sleep_until(implementation_->start_ + time);
+  }
+  statistics_.number_of_bytes_received += message.size() + sizeof(std::uint32_t);
+  statistics_.number_of_messages_received += 1;
+  return std::move(message);
+}
+
+std::size_t ReplayTransport::GetNumberOfRemainingMessages() const {
+  std::scoped_lock lock(implementation_->mutex_);
+  return implementation_->messages_.size() - implementation_->next_message_;
+}
+
+static std::string GetRecordingPath(const std::string& path_prefix, std::size_t party_id) {
+  return fmt::format("{}.{}", path_prefix, party_id);
+}
+
+void RecordTransports(std::vector<std::unique_ptr<Transport>>& transports,
+                      const std::string& path_prefix) {
+  for (std::size_t party_id = 0; party_id < transports.size(); ++party_id) {
+    if (!transports.at(party_id)) continue;
+    transports.at(party_id) = std::make_unique<RecordingTransport>(
+        std::move(transports.at(party_id)), GetRecordingPath(path_prefix, party_id));
+  }
+}
+
+std::vector<std::unique_ptr<Transport>> MakeReplayTransports(std::size_t my_id,
+                                                             std::size_t number_of_parties,
+                                                             const std::string& path_prefix,
+                                                             bool preserve_timing) {
+  std::vector<std::unique_ptr<Transport>> transports(number_of_parties);
+  for (std::size_t party_id = 0; party_id < number_of_parties; ++party_id) {
+    if (party_id == my_id) continue;
+    transports.at(party_id) = std::make_unique<ReplayTransport>(
+        GetRecordingPath(path_prefix, party_id), preserve_timing);
+  }
+  return transports;
+}
+
+}  // namespace encrypto::motion::communication
@@ -0,0 +1,112 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "transport.h"
+
+namespace encrypto::motion::communication {
+
+// Wraps another transport and appends every received message together with the time since the
+// creation of the transport at which it was received to a file. The recording can be fed back by a
+// ReplayTransport, e.g., to run and profile a single party without the other parties.
+class RecordingTransport : public Transport {
+ public:
+  // Throws a std::runtime_error if the file cannot be created.
+  RecordingTransport(std::unique_ptr<Transport> transport, const std::string& path);
+
+  // Destructor needs to be defined in implementation due to pimpl
+  ~RecordingTransport();
+
+  void SendMessage(std::span<const std::uint8_t> message) override;
+  void SendMessageFragments(std::span<const std::span<const std::uint8_t>> fragments) override;
+
+  bool Available() const override;
+  std::optional<std::vector<std::uint8_t>> ReceiveMessage() override;
+  void ShutdownSend() override;
+  // shuts down the wrapped transport and closes the file
+  void Shutdown() override;
+
+  void SetReceiveBufferPool(std::shared_ptr<ReceiveBufferPool> pool) override;
+
+ private:
+  struct RecordingTransportImplementation;
+
+  std::unique_ptr<Transport> transport_;
+  std::unique_ptr<RecordingTransportImplementation> implementation_;
+};
+
+// Transport without a peer which returns the messages of a recording made by a RecordingTransport
+// in the same order, and discards the sent messages. By default, the messages are available
+// immediately, s.t. the evaluation of the party runs as fast as possible. With preserve_timing, a
+// message is only available at the time at which it was recorded. ReceiveMessage returns
+// std::nullopt at the end of the recording, as if the peer had closed the connection. The messages
+// which the peer sent after its k-th synchronization message are only available once the party has
+// sent its k-th synchronization message, as the peer could only have sent them afterwards, s.t.
+// the party registers for the messages before they arrive like in the recorded run.
+//
+// The messages of the recording are only consistent with the computation of the party if it
+// evaluates the same circuit on the same inputs and with the same local randomness as during the
+// recording, i.e., if both runs use the same Configuration::SetRandomSeed. Otherwise, the outputs
+// of a replayed evaluation are meaningless, but the work done is the same.
+class ReplayTransport : public Transport {
+ public:
+  // Reads the whole recording into memory.
+  // Throws a std::runtime_error if the file cannot be read or is no recording.
+  explicit ReplayTransport(const std::string& path, bool preserve_timing = false);
+
+  // Destructor needs to be defined in implementation due to pimpl
+  ~ReplayTransport();
+
+  void SendMessage(std::span<const std::uint8_t> message) override;
+
+  bool Available() const override;
+  std::optional<std::vector<std::uint8_t>> ReceiveMessage() override;
+  // the remaining messages do not wait for synchronization messages of the party anymore
+  void ShutdownSend() override;
+  void Shutdown() override;
+
+  std::size_t GetNumberOfRemainingMessages() const;
+
+ private:
+  struct ReplayTransportImplementation;
+
+  std::unique_ptr<ReplayTransportImplementation> implementation_;
+};
+
+// Wrap all transports of a party in RecordingTransports. The messages received from party i are
+// recorded in the file "<path_prefix>.<i>".
+void RecordTransports(std::vector<std::unique_ptr<Transport>>& transports,
+                      const std::string& path_prefix);
+
+// Create the ReplayTransports of party my_id from the recordings made by RecordTransports.
+std::vector<std::unique_ptr<Transport>> MakeReplayTransports(std::size_t my_id,
+                                                             std::size_t number_of_parties,
+                                                             const std::string& path_prefix,
+                                                             bool preserve_timing = false);
+
+}  // namespace encrypto::motion::communication
@@ -0,0 +1,196 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "shaped_transport.h"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "utility/synchronized_queue.h"
+
+// Undefine Windows macros that collide with function names in MOTION.
+#ifdef SendMessage
+#undef SendMessage
+#endif
+
+namespace encrypto::motion::communication {
+
+struct ShapedTransport::ShapedTransportImplementation {
+  using Clock = std::chrono::steady_clock;
+
+  ShapedTransportImplementation(const LinkShapingConfiguration& configuration)
+      : configuration_(configuration),
+        random_generator_(configuration.seed),
+        tokens_(configuration.burst_size),
+        last_update_(Clock::now()) {}
+
+  // time at which a message of message_size bytes, which is sent now, arrives at the other party
+  Clock::time_point GetDeliveryTime(std::size_t message_size) {
+    const auto now = Clock::now();
+    auto departure_time = now;
+    if (configuration_.bandwidth > 0) {
+      const double bytes_per_second = configuration_.bandwidth / 8;
+      const std::chrono::duration<double> elapsed = now - last_update_;
+      tokens_ = std::min<double>(configuration_.burst_size,
+                                 tokens_ + elapsed.count() * bytes_per_second);
+      last_update_ = now;
+      // the tokens become negative if the link is busy with earlier messages
+      tokens_ -= message_size;
+      if (tokens_ < 0) {
+        departure_time += std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(-tokens_ / bytes_per_second));
+      }
+    }
+    auto delivery_time = departure_time + configuration_.latency;
+    if (configuration_.jitter.count() > 0) {
+      std::uniform_int_distribution<std::chrono::microseconds::rep> distribution(
+          0, configuration_.jitter.count());
+      delivery_time += std::chrono::microseconds(distribution(random_generator_));
+    }
+    // messages are not reordered
+    delivery_time = std::max(delivery_time, last_delivery_time_);
+    last_delivery_time_ = delivery_time;
+    return delivery_time;
+  }
+
+  void DeliveryTask(Transport& transport) {
+    while (auto item = queue_.dequeue()) {
+      std::this_thread::sleep_until(item->first);
+      try {
+        transport.SendMessage(item->second);
+      } catch (...) {
+        std::scoped_lock lock(error_mutex_);
+        if (!error_) error_ = std::current_exception();
+      }
+    }
+    transport.ShutdownSend();
+  }
+
+  void RethrowError() {
+    std::scoped_lock lock(error_mutex_);
+    if (error_) std::rethrow_exception(error_);
+  }
+
+  LinkShapingConfiguration configuration_;
+  std::mt19937_64 random_generator_;
+  // state of the token bucket in bytes
+  double tokens_;
+  Clock::time_point last_update_;
+  Clock::time_point last_delivery_time_;
+  SynchronizedQueue<std::pair<Clock::time_point, std::vector<std::uint8_t>>> queue_;
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+  std::thread delivery_thread_;
+};
+
+void LinkShapingConfiguration::Validate() const {
+  if (latency.count() < 0) {
+    throw std::invalid_argument(
+        fmt::format("the latency of a link must not be negative, got {} us", latency.count()));
+  }
+  if (jitter.count() < 0) {
+    throw std::invalid_argument(
+        fmt::format("the jitter of a link must not be negative, got {} us", jitter.count()));
+  }
+  if (bandwidth < 0) {
+    throw std::invalid_argument(
+        fmt::format("the bandwidth of a link must not be negative, got {} bit/s", bandwidth));
+  }
+}
+
+ShapedTransport::ShapedTransport(std::unique_ptr<Transport> transport,
+                                 const LinkShapingConfiguration& configuration)
+    : transport_(std::move(transport)),
+      implementation_(std::make_unique<ShapedTransportImplementation>(configuration)) {
+  if (!transport_) {
+    throw std::invalid_argument("ShapedTransport needs a transport to wrap");
+  }
+  configuration.Validate();
+  const auto& statistics = transport_->GetStatistics();
+  SetConnectionSetupTime(statistics.connection_setup_start, statistics.connection_setup_end);
+  implementation_->delivery_thread_ =
+      std::thread([this] { implementation_->DeliveryTask(*transport_); });
+}
+
+ShapedTransport::~ShapedTransport() {
+  implementation_->queue_.close();
+  if (implementation_->delivery_thread_.joinable()) {
+    implementation_->delivery_thread_.join();
+  }
+}
+
+void ShapedTransport::SendMessage(std::span<const std::uint8_t> message) {
+  implementation_->RethrowError();
+  const auto delivery_time = implementation_->GetDeliveryTime(message.size());
+  implementation_->queue_.enqueue(
+      {delivery_time, std::vector<std::uint8_t>(message.begin(), message.end())});
+  statistics_.number_of_bytes_sent += message.size() + sizeof(std::uint32_t);
+  statistics_.number_of_messages_sent += 1;
+}
+
+bool ShapedTransport::Available() const { return transport_->Available(); }
+
+std::optional<std::vector<std::uint8_t>> ShapedTransport::ReceiveMessage() {
+  auto message{transport_->ReceiveMessage()};
+  if (message.has_value()) {
+    statistics_.number_of_bytes_received += message->size() + sizeof(std::uint32_t);
+    statistics_.number_of_messages_received += 1;
+  }
+  return message;
+}
+
+void ShapedTransport::ShutdownSend() { implementation_->queue_.close(); }
+
+void ShapedTransport::Shutdown() {
+  implementation_->queue_.close();
+  if (implementation_->delivery_thread_.joinable()) {
+    implementation_->delivery_thread_.join();
+  }
+  transport_->Shutdown();
+}
+
+void ShapedTransport::SetReceiveBufferPool(std::shared_ptr<ReceiveBufferPool> pool) {
+  transport_->SetReceiveBufferPool(pool);
+  Transport::SetReceiveBufferPool(std::move(pool));
+}
+
+void ShapeTransports(std::vector<std::unique_ptr<Transport>>& transports,
+                     const LinkShapingConfiguration& configuration) {
+  configuration.Validate();
+  for (std::size_t party_id = 0; party_id < transports.size(); ++party_id) {
+    if (!transports.at(party_id)) continue;
+    auto link_configuration{configuration};
+    link_configuration.seed += party_id;
+    transports.at(party_id) =
+        std::make_unique<ShapedTransport>(std::move(transports.at(party_id)), link_configuration);
+  }
+}
+
+}  // namespace encrypto::motion::communication
@@ -0,0 +1,90 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "transport.h"
+
+namespace encrypto::motion::communication {
+
+// Properties of an emulated network link, e.g., to benchmark WAN settings in-process without
+// tools like tc which require root access.
+struct LinkShapingConfiguration {
+  // one-way delay of every message
+  std::chrono::microseconds latency{0};
+  // maximum additional delay of a message, drawn uniformly from [0, jitter]
+  std::chrono::microseconds jitter{0};
+  // bandwidth in bits per second, 0 means unlimited
+  double bandwidth = 0;
+  // number of bytes which can be sent without delay over an idle link
+  std::size_t burst_size = 64 * 1024;
+  // seed for the jitter
+  std::uint64_t seed = 0;
+
+  bool IsEnabled() const {
+    return latency.count() > 0 || jitter.count() > 0 || bandwidth > 0;
+  }
+
+  // Throws a std::invalid_argument if the latency, the jitter or the bandwidth is negative
+  void Validate() const;
+};
+
+// Wraps another transport and delays the outgoing messages as if they were sent over a link with
+// the given latency, jitter and bandwidth. The bandwidth is limited by a token bucket of
+// burst_size bytes. Messages are passed to the wrapped transport by a separate thread at their
+// delivery time and keep their order, so SendMessage does not block.
+class ShapedTransport : public Transport {
+ public:
+  ShapedTransport(std::unique_ptr<Transport> transport,
+                  const LinkShapingConfiguration& configuration);
+
+  // Destructor needs to be defined in implementation due to pimpl
+  ~ShapedTransport();
+
+  void SendMessage(std::span<const std::uint8_t> message) override;
+
+  bool Available() const override;
+  std::optional<std::vector<std::uint8_t>> ReceiveMessage() override;
+  // shuts down the wrapped transport after all delayed messages have been delivered
+  void ShutdownSend() override;
+  void Shutdown() override;
+
+  void SetReceiveBufferPool(std::shared_ptr<ReceiveBufferPool> pool) override;
+
+ private:
+  struct ShapedTransportImplementation;
+
+  std::unique_ptr<Transport> transport_;
+  std::unique_ptr<ShapedTransportImplementation> implementation_;
+};
+
+// Wrap all transports of a party in ShapedTransports with the same configuration. The seed of the
+// jitter is varied per link.
+void ShapeTransports(std::vector<std::unique_ptr<Transport>>& transports,
+                     const LinkShapingConfiguration& configuration);
+
+}  // namespace encrypto::motion::communication
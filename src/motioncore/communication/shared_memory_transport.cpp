@@ -0,0 +1,413 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "shared_memory_transport.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include "receive_buffer_pool.h"
+
+// Undefine Windows macros that collide with function names in MOTION.
+#ifdef SendMessage
+#undef SendMessage
+#endif
+
+namespace encrypto::motion::communication {
+
+namespace detail {
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "atomics in shared memory need to be lock-free");
+
+constexpr std::size_t kCacheLineSize = 64;
+constexpr std::uint64_t kSegmentMagic = 0x4d4f54494f4e534d;  // "MOTIONSM"
+
+// State of one direction, head and tail count the bytes written and read in total
+struct RingHeader {
+  alignas(kCacheLineSize) std::atomic<std::uint64_t> head;
+  alignas(kCacheLineSize) std::atomic<std::uint64_t> tail;
+  alignas(kCacheLineSize) std::atomic<std::uint64_t> sender_closed;
+  std::atomic<std::uint64_t> receiver_closed;
+};
+
+// Layout of a segment: this header followed by the data of ring 0 and ring 1. Ring 0 carries
+// the messages from the party with the smaller ID to the party with the larger ID.
+struct SegmentHeader {
+  std::atomic<std::uint64_t> magic;
+  std::atomic<std::uint64_t> attached;
+  std::uint64_t ring_size;
+  RingHeader rings[2];
+};
+
+constexpr std::size_t kDataOffset =
+    (sizeof(SegmentHeader) + kCacheLineSize - 1) / kCacheLineSize * kCacheLineSize;
+
+constexpr std::size_t GetSegmentSize(std::size_t ring_size) { return kDataOffset + 2 * ring_size; }
+
+struct SharedMemorySegment {
+  SharedMemorySegment(void* address, std::size_t size) : address_(address), size_(size) {}
+  ~SharedMemorySegment() { munmap(address_, size_); }
+
+  SegmentHeader& GetHeader() { return *static_cast<SegmentHeader*>(address_); }
+  std::uint8_t* GetData(std::size_t ring_index) {
+    return static_cast<std::uint8_t*>(address_) + kDataOffset +
+           ring_index * GetHeader().ring_size;
+  }
+
+  void* address_;
+  std::size_t size_;
+  // the sender and the receiver side are each used by a single thread at a time
+  std::mutex send_mutex_;
+  std::mutex receive_mutex_;
+};
+
+// Spins for a while before sleeping, since a message is usually on its way when we wait
+class Backoff {
+ public:
+  void Wait() {
+    if (iterations_ < kYieldIterations) {
+      ++iterations_;
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+  }
+  void Reset() { iterations_ = 0; }
+
+ private:
+  static constexpr std::size_t kYieldIterations = 1000;
+  std::size_t iterations_ = 0;
+};
+
+}  // namespace detail
+
+using detail::Backoff;
+using detail::RingHeader;
+
+// copies data into the ring, waiting for the receiver whenever the ring is full
+static void WriteToRing(RingHeader& ring, std::uint8_t* ring_data, std::size_t ring_size,
+                        std::span<const std::uint8_t> data) {
+  Backoff backoff;
+  while (!data.empty()) {
+    const std::uint64_t head = ring.head.load(std::memory_order_relaxed);
+    const std::uint64_t tail = ring.tail.load(std::memory_order_acquire);
+    const std::size_t free_space = ring_size - static_cast<std::size_t>(head - tail);
+    if (free_space == 0) {
+      if (ring.receiver_closed.load(std::memory_order_acquire)) {
+        throw std::runtime_error("SharedMemoryTransport: receiver closed the connection");
+      }
+      backoff.Wait();
+      continue;
+    }
+    const std::size_t size = std::min(free_space, data.size());
+    const std::size_t position = head & (ring_size - 1);
+    const std::size_t first_part = std::min(size, ring_size - position);
+    std::copy_n(data.data(), first_part, ring_data + position);
+    std::copy_n(data.data() + first_part, size - first_part, ring_data);
+    ring.head.store(head + size, std::memory_order_release);
+    data = data.subspan(size);
+    backoff.Reset();
+  }
+}
+
+// copies data out of the ring, returns false if the sender closed the ring before any data
+// arrived
+static bool ReadFromRing(RingHeader& ring, const std::uint8_t* ring_data, std::size_t ring_size,
+                         std::span<std::uint8_t> data) {
+  Backoff backoff;
+  bool started = false;
+  while (!data.empty()) {
+    const std::uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    const std::uint64_t head = ring.head.load(std::memory_order_acquire);
+    const std::size_t available = static_cast<std::size_t>(head - tail);
+    if (available == 0) {
+      if (ring.sender_closed.load(std::memory_order_acquire) &&
+          ring.head.load(std::memory_order_acquire) == tail) {
+        if (!started) return false;
+        throw std::runtime_error("SharedMemoryTransport: sender closed the connection");
+      }
+      backoff.Wait();
+      continue;
+    }
+    const std::size_t size = std::min(available, data.size());
+    const std::size_t position = tail & (ring_size - 1);
+    const std::size_t first_part = std::min(size, ring_size - position);
+    std::copy_n(ring_data + position, first_part, data.data());
+    std::copy_n(ring_data, size - first_part, data.data() + first_part);
+    ring.tail.store(tail + size, std::memory_order_release);
+    data = data.subspan(size);
+    started = true;
+    backoff.Reset();
+  }
+  return true;
+}
+
+SharedMemoryTransport::SharedMemoryTransport(std::unique_ptr<detail::SharedMemorySegment> segment,
+                                             std::size_t send_ring_index)
+    : segment_(std::move(segment)), send_ring_index_(send_ring_index) {}
+
+SharedMemoryTransport::SharedMemoryTransport(SharedMemoryTransport&& other)
+    : segment_(std::move(other.segment_)), send_ring_index_(other.send_ring_index_) {}
+
+SharedMemoryTransport::~SharedMemoryTransport() = default;
+
+void SharedMemoryTransport::SendMessage(std::span<const std::uint8_t> message) {
+  const std::array fragments{message};
+  SendMessageFragments(fragments);
+}
+
+void SharedMemoryTransport::SendMessageFragments(
+    std::span<const std::span<const std::uint8_t>> fragments) {
+  std::size_t size = 0;
+  for (const auto& fragment : fragments) size += fragment.size();
+  if (size > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::runtime_error(fmt::format("Max message size is {} B but tried to send {} B",
+                                         std::numeric_limits<std::uint32_t>::max(), size));
+  }
+  auto& header{segment_->GetHeader()};
+  auto& ring{header.rings[send_ring_index_]};
+  auto* ring_data{segment_->GetData(send_ring_index_)};
+  const std::uint32_t message_size = size;
+
+  std::scoped_lock lock(segment_->send_mutex_);
+  WriteToRing(
+      ring, ring_data, header.ring_size,
+      std::span(reinterpret_cast<const std::uint8_t*>(&message_size), sizeof(message_size)));
+  for (const auto& fragment : fragments) {
+    WriteToRing(ring, ring_data, header.ring_size, fragment);
+  }
+  statistics_.number_of_bytes_sent += size + sizeof(std::uint32_t);
+  statistics_.number_of_messages_sent += 1;
+}
+
+bool SharedMemoryTransport::Available() const {
+  auto& ring{segment_->GetHeader().rings[1 - send_ring_index_]};
+  return ring.head.load(std::memory_order_acquire) != ring.tail.load(std::memory_order_relaxed);
+}
+
+std::optional<std::vector<std::uint8_t>> SharedMemoryTransport::ReceiveMessage() {
+  auto& header{segment_->GetHeader()};
+  const std::size_t receive_ring_index{1 - send_ring_index_};
+  auto& ring{header.rings[receive_ring_index]};
+  const auto* ring_data{segment_->GetData(receive_ring_index)};
+
+  std::scoped_lock lock(segment_->receive_mutex_);
+  std::uint32_t message_size;
+  if (!ReadFromRing(ring, ring_data, header.ring_size,
+                    std::span(reinterpret_cast<std::uint8_t*>(&message_size),
+                              sizeof(message_size)))) {
+    // connection has been closed
+    return std::nullopt;
+  }
+  auto message_buffer{receive_buffer_pool_ ? receive_buffer_pool_->Acquire(message_size)
+                                            : std::vector<std::uint8_t>(message_size)};
+  if (!ReadFromRing(ring, ring_data, header.ring_size, message_buffer)) {
+    throw std::runtime_error("SharedMemoryTransport: sender closed the connection");
+  }
+  statistics_.number_of_bytes_received += message_size + sizeof(std::uint32_t);
+  statistics_.number_of_messages_received += 1;
+  return message_buffer;
+}
+
+void SharedMemoryTransport::ShutdownSend() {
+  segment_->GetHeader().rings[send_ring_index_].sender_closed.store(1, std::memory_order_release);
+}
+
+void SharedMemoryTransport::Shutdown() {
+  auto& header{segment_->GetHeader()};
+  header.rings[send_ring_index_].sender_closed.store(1, std::memory_order_release);
+  header.rings[1 - send_ring_index_].receiver_closed.store(1, std::memory_order_release);
+}
+
+using namespace std::chrono_literals;
+
+// how long to wait for the other party while setting up the segments
+constexpr auto kSetupTimeout = 30s;
+constexpr auto kSetupPollInterval = 1ms;
+
+SharedMemorySetupHelper::SharedMemorySetupHelper(std::size_t my_id, std::size_t number_of_parties,
+                                                 std::string name, std::size_t ring_size)
+    : my_id_(my_id),
+      number_of_parties_(number_of_parties),
+      name_(std::move(name)),
+      ring_size_(std::bit_ceil(std::max<std::size_t>(ring_size, detail::kCacheLineSize))) {
+  // check arguments
+  if (number_of_parties_ <= 1) {
+    throw std::invalid_argument("specified number of parties: number_of_parties <= 1");
+  }
+  if (my_id_ >= number_of_parties_) {
+    throw std::invalid_argument("specified invalid party id: my_id >= number_of_parties");
+  }
+  if (name_.empty() || name_.front() != '/' ||
+      std::find(std::next(name_.begin()), name_.end(), '/') != name_.end()) {
+    throw std::invalid_argument(fmt::format(
+        "shared memory name ({}) needs to start with '/' and contain no other '/'", name_));
+  }
+}
+
+std::string SharedMemorySetupHelper::GetSegmentName(std::size_t other_id) const {
+  return fmt::format("{}-{}-{}", name_, std::min(my_id_, other_id), std::max(my_id_, other_id));
+}
+
+static std::unique_ptr<detail::SharedMemorySegment> MapSegment(int file_descriptor,
+                                                               std::size_t size,
+                                                               const std::string& name) {
+  void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+  close(file_descriptor);
+  if (address == MAP_FAILED) {
+    throw std::runtime_error(
+        fmt::format("cannot map shared memory {}: {}", name, std::strerror(errno)));
+  }
+  return std::make_unique<detail::SharedMemorySegment>(address, size);
+}
+
+std::unique_ptr<detail::SharedMemorySegment> SharedMemorySetupHelper::CreateSegment(
+    std::size_t other_id) const {
+  const auto name{GetSegmentName(other_id)};
+  const std::size_t size{detail::GetSegmentSize(ring_size_)};
+  // remove a segment that was left behind by a crashed run
+  shm_unlink(name.c_str());
+  const int file_descriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (file_descriptor < 0) {
+    throw std::runtime_error(
+        fmt::format("cannot create shared memory {}: {}", name, std::strerror(errno)));
+  }
+  if (ftruncate(file_descriptor, size) != 0) {
+    const int error = errno;
+    close(file_descriptor);
+    shm_unlink(name.c_str());
+    throw std::runtime_error(
+        fmt::format("cannot resize shared memory {}: {}", name, std::strerror(error)));
+  }
+  std::unique_ptr<detail::SharedMemorySegment> segment;
+  try {
+    segment = MapSegment(file_descriptor, size, name);
+  } catch (std::runtime_error&) {
+    shm_unlink(name.c_str());
+    throw;
+  }
+
+  // the memory is zero-initialized by ftruncate
+  auto& header{*new (segment->address_) detail::SegmentHeader};
+  header.ring_size = ring_size_;
+  header.magic.store(detail::kSegmentMagic, std::memory_order_release);
+
+  const auto deadline{std::chrono::steady_clock::now() + kSetupTimeout};
+  while (header.attached.load(std::memory_order_acquire) == 0) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      shm_unlink(name.c_str());
+      throw std::runtime_error(
+          fmt::format("party {} did not open shared memory {} in time", other_id, name));
+    }
+    std::this_thread::sleep_for(kSetupPollInterval);
+  }
+  shm_unlink(name.c_str());
+  return segment;
+}
+
+std::unique_ptr<detail::SharedMemorySegment> SharedMemorySetupHelper::OpenSegment(
+    std::size_t other_id) const {
+  const auto name{GetSegmentName(other_id)};
+  const std::size_t size{detail::GetSegmentSize(ring_size_)};
+  const auto deadline{std::chrono::steady_clock::now() + kSetupTimeout};
+  auto check_deadline = [&] {
+    if (std::chrono::steady_clock::now() > deadline) {
+      throw std::runtime_error(
+          fmt::format("party {} did not create shared memory {} in time", other_id, name));
+    }
+    std::this_thread::sleep_for(kSetupPollInterval);
+  };
+
+  int file_descriptor;
+  while (true) {
+    file_descriptor = shm_open(name.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+    if (file_descriptor >= 0) {
+      // wait until the creator has resized the segment
+      struct stat status;
+      if (fstat(file_descriptor, &status) == 0 &&
+          static_cast<std::size_t>(status.st_size) == size) {
+        break;
+      }
+      close(file_descriptor);
+    } else if (errno != ENOENT) {
+      throw std::runtime_error(
+          fmt::format("cannot open shared memory {}: {}", name, std::strerror(errno)));
+    }
+    check_deadline();
+  }
+  auto segment{MapSegment(file_descriptor, size, name)};
+  auto& header{segment->GetHeader()};
+  while (header.magic.load(std::memory_order_acquire) != detail::kSegmentMagic) check_deadline();
+  if (header.ring_size != ring_size_) {
+    throw std::runtime_error(fmt::format("shared memory {} has ring size {} instead of {}", name,
+                                         header.ring_size, ring_size_));
+  }
+  header.attached.store(1, std::memory_order_release);
+  return segment;
+}
+
+std::vector<std::unique_ptr<Transport>> SharedMemorySetupHelper::SetupConnections() {
+  std::vector<std::future<std::unique_ptr<detail::SharedMemorySegment>>> futures(
+      number_of_parties_);
+  for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
+    if (party_id == my_id_) continue;
+    futures.at(party_id) = std::async(std::launch::async, [this, party_id] {
+      return party_id > my_id_ ? CreateSegment(party_id) : OpenSegment(party_id);
+    });
+  }
+  // wait for all futures before rethrowing, since they access this helper
+  std::vector<std::unique_ptr<Transport>> result(number_of_parties_);
+  std::exception_ptr error;
+  for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
+    if (party_id == my_id_) continue;
+    try {
+      // ring 0 carries the messages of the party with the smaller ID
+      result.at(party_id) = std::make_unique<SharedMemoryTransport>(futures.at(party_id).get(),
+                                                                    party_id > my_id_ ? 0 : 1);
+    } catch (...) {
+      if (!error) error = std::current_exception();
+    }
+  }
+  if (error) std::rethrow_exception(error);
+  return result;
+}
+
+}  // namespace encrypto::motion::communication
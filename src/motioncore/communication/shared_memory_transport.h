@@ -0,0 +1,94 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "transport.h"
+
+namespace encrypto::motion::communication {
+
+namespace detail {
+
+struct SharedMemorySegment;
+
+}  // namespace detail
+
+// Transport between two parties on the same host over a pair of single-producer/single-consumer
+// ring buffers in POSIX shared memory, one for each direction. Messages are copied directly into
+// and out of the ring by the sending and receiving threads without involving the kernel, and
+// messages larger than a ring are streamed through it.
+class SharedMemoryTransport : public Transport {
+ public:
+  SharedMemoryTransport(std::unique_ptr<detail::SharedMemorySegment> segment,
+                        std::size_t send_ring_index);
+  SharedMemoryTransport(SharedMemoryTransport&& other);
+
+  // Destructor needs to be defined in implementation due to pimpl
+  ~SharedMemoryTransport();
+
+  void SendMessage(std::span<const std::uint8_t> message) override;
+  void SendMessageFragments(std::span<const std::span<const std::uint8_t>> fragments) override;
+
+  bool Available() const override;
+  std::optional<std::vector<std::uint8_t>> ReceiveMessage() override;
+  void ShutdownSend() override;
+  void Shutdown() override;
+
+ private:
+  std::unique_ptr<detail::SharedMemorySegment> segment_;
+  std::size_t send_ring_index_;
+};
+
+// Helper class to establish SharedMemoryTransports among a set of parties on the same host.
+// For each pair of parties, the party with the smaller ID creates a shared memory segment named
+// "<name>-<smaller id>-<larger id>" and the other party opens it. The name is removed as soon as
+// both parties mapped the segment, so that nothing is left behind after the transports are
+// destroyed. name needs to start with a '/' and must not contain any other '/'.
+class SharedMemorySetupHelper {
+ public:
+  // capacity of each ring buffer in bytes, rounded up to a power of two
+  static constexpr std::size_t kDefaultRingSize = 16 * 1024 * 1024;
+
+  SharedMemorySetupHelper(std::size_t my_id, std::size_t number_of_parties, std::string name,
+                          std::size_t ring_size = kDefaultRingSize);
+
+  // Try to establish connections as described above.
+  // Throws a std::runtime_error if something goes wrong.
+  std::vector<std::unique_ptr<Transport>> SetupConnections();
+
+ private:
+  std::unique_ptr<detail::SharedMemorySegment> CreateSegment(std::size_t other_id) const;
+  std::unique_ptr<detail::SharedMemorySegment> OpenSegment(std::size_t other_id) const;
+  std::string GetSegmentName(std::size_t other_id) const;
+
+  std::size_t my_id_;
+  std::size_t number_of_parties_;
+  std::string name_;
+  std::size_t ring_size_;
+};
+
+}  // namespace encrypto::motion::communication
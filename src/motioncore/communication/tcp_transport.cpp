@@ -22,19 +22,35 @@
 
 #include "tcp_transport.h"
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
 #include <future>
+#include <mutex>
 #include <shared_mutex>
+#include <thread>
 
 #include <fmt/format.h>
+#include <boost/asio/bind_executor.hpp>
 #include <boost/asio/connect.hpp>
 #include <boost/asio/error.hpp>
+#include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/read.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/system/error_code.hpp>
 
+#include "receive_buffer_pool.h"
+#include "utility/synchronized_queue.h"
+#include "utility/thread.h"
+
 // Undefine Windows macros that collide with function names in MOTION.
 #ifdef SendMessage
 #undef SendMessage
@@ -91,16 +107,28 @@ static void u32tou8(std::uint32_t v, std::uint8_t* result) {
 }
 
 void TcpTransport::SendMessage(std::span<const std::uint8_t> message) {
-  if (message.size() > std::numeric_limits<std::uint32_t>::max()) {
+  const std::array fragments{message};
+  SendMessageFragments(fragments);
+}
+
+void TcpTransport::SendMessageFragments(
+    std::span<const std::span<const std::uint8_t>> fragments) {
+  std::size_t size = 0;
+  for (const auto& fragment : fragments) size += fragment.size();
+  if (size > std::numeric_limits<std::uint32_t>::max()) {
     throw std::runtime_error(fmt::format("Max message size is {} B but tried to send {} B",
-                                         std::numeric_limits<std::uint32_t>::max(),
-                                         message.size()));
+                                         std::numeric_limits<std::uint32_t>::max(), size));
   }
   std::array<std::uint8_t, sizeof(std::uint32_t)> message_size;
-  u32tou8(message.size(), message_size.data());
+  u32tou8(size, message_size.data());
 
-  std::array<boost::asio::const_buffer, 2> buffers = {
-      boost::asio::buffer(message_size), boost::asio::buffer(message.data(), message.size())};
+  // the size and the fragments are written with a single gather write
+  std::vector<boost::asio::const_buffer> buffers;
+  buffers.reserve(fragments.size() + 1);
+  buffers.emplace_back(boost::asio::buffer(message_size));
+  for (const auto& fragment : fragments) {
+    buffers.emplace_back(boost::asio::buffer(fragment.data(), fragment.size()));
+  }
 
   boost::system::error_code ec;
   std::shared_lock lock(implementation_->socket_mutex_);
@@ -108,7 +136,7 @@ void TcpTransport::SendMessage(std::span<const std::uint8_t> message) {
   if (ec) {
     throw std::runtime_error(fmt::format("Error while writing to socket: {}", ec.message()));
   }
-  statistics_.number_of_bytes_sent += message.size() + sizeof(uint32_t);
+  statistics_.number_of_bytes_sent += size + sizeof(uint32_t);
   statistics_.number_of_messages_sent += 1;
 }
 
@@ -140,7 +168,8 @@ std::optional<std::vector<std::uint8_t>> TcpTransport::ReceiveMessage() {
                                          ec.message(), ec.value()));
   }
   std::uint32_t message_size = u8tou32(message_size_buffer);
-  std::vector<std::uint8_t> message_buffer(message_size);
+  auto message_buffer{receive_buffer_pool_ ? receive_buffer_pool_->Acquire(message_size)
+                                            : std::vector<std::uint8_t>(message_size)};
   boost::asio::read(implementation_->socket_, boost::asio::buffer(message_buffer),
                     boost::asio::transfer_exactly(message_buffer.size()), ec);
   if (ec) {
@@ -152,27 +181,901 @@ std::optional<std::vector<std::uint8_t>> TcpTransport::ReceiveMessage() {
   return message_buffer;
 }
 
-using namespace std::chrono_literals;
+namespace detail {
 
-struct TcpSetupHelper::TcpSetupImplementation {
-  [[nodiscard]] std::map<std::size_t, tcp::socket> accept_task();
-  [[nodiscard]] tcp::socket connect_task(std::size_t other_id, std::string host,
-                                         std::uint16_t port);
+// Runs the blocking reads or writes on one of the additional connections of a
+// StripedTcpTransport, so that all connections of a message are used concurrently.
+class StripeWorker {
+ public:
+  StripeWorker() : thread_([this] { Run(); }) {}
+
+  ~StripeWorker() {
+    {
+      std::scoped_lock lock(mutex_);
+      stop_ = true;
+    }
+    condition_variable_.notify_all();
+    thread_.join();
+  }
+
+  void Post(std::function<void()> job) {
+    {
+      std::scoped_lock lock(mutex_);
+      job_ = std::move(job);
+    }
+    condition_variable_.notify_all();
+  }
+
+  // blocks until the posted job has finished and rethrows its exception
+  void Wait() {
+    std::unique_lock lock(mutex_);
+    condition_variable_.wait(lock, [this] { return !job_; });
+    if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+  }
+
+ private:
+  void Run() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+      condition_variable_.wait(lock, [this] { return stop_ || job_; });
+      if (stop_) return;
+      auto job{job_};
+      lock.unlock();
+      std::exception_ptr error;
+      try {
+        job();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      lock.lock();
+      error_ = error;
+      job_ = nullptr;
+      condition_variable_.notify_all();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable condition_variable_;
+  std::function<void()> job_;
+  std::exception_ptr error_;
+  bool stop_ = false;
+  std::thread thread_;
+};
+
+struct StripedTcpTransportImplementation {
+  StripedTcpTransportImplementation(
+      std::vector<std::unique_ptr<TcpTransportImplementation>>&& connections)
+      : connections_(std::move(connections)) {
+    for (std::size_t i = 1; i < connections_.size(); ++i) {
+      send_workers_.emplace_back(std::make_unique<StripeWorker>());
+      receive_workers_.emplace_back(std::make_unique<StripeWorker>());
+    }
+  }
+
+  std::size_t GetNumberOfStripes(std::size_t message_size) const {
+    return message_size < StripedTcpTransport::kMinimumStripedMessageSize ? 1
+                                                                          : connections_.size();
+  }
+
+  // part of a message of message_size bytes that is transferred over the connection with index i
+  static std::pair<std::size_t, std::size_t> GetStripe(std::size_t message_size,
+                                                       std::size_t number_of_stripes,
+                                                       std::size_t i) {
+    const std::size_t stripe_size = (message_size + number_of_stripes - 1) / number_of_stripes;
+    const std::size_t begin = std::min(i * stripe_size, message_size);
+    return {begin, std::min(stripe_size, message_size - begin)};
+  }
+
+  std::vector<std::unique_ptr<TcpTransportImplementation>> connections_;
+  // serialize the messages, such that all connections carry their stripes in the same order
+  std::mutex send_mutex_;
+  std::mutex receive_mutex_;
+  // workers for the connections 1, ..., K - 1
+  std::vector<std::unique_ptr<StripeWorker>> send_workers_;
+  std::vector<std::unique_ptr<StripeWorker>> receive_workers_;
+};
+
+}  // namespace detail
+
+template <typename BufferSequence>
+static void WriteToConnection(detail::TcpTransportImplementation& connection,
+                              const BufferSequence& buffers) {
+  boost::system::error_code ec;
+  std::shared_lock lock(connection.socket_mutex_);
+  boost::asio::write(connection.socket_, buffers, boost::asio::transfer_all(), ec);
+  if (ec) {
+    throw std::runtime_error(fmt::format("Error while writing to socket: {}", ec.message()));
+  }
+}
+
+static void ReadFromConnection(detail::TcpTransportImplementation& connection,
+                               std::span<std::uint8_t> buffer) {
+  boost::system::error_code ec;
+  std::shared_lock lock(connection.socket_mutex_);
+  boost::asio::read(connection.socket_, boost::asio::buffer(buffer.data(), buffer.size()),
+                    boost::asio::transfer_exactly(buffer.size()), ec);
+  if (ec) {
+    throw std::runtime_error(
+        fmt::format("Error while reading message from socket: {} ({})", ec.message(), ec.value()));
+  }
+}
+
+// waits for the workers even if the part of the calling thread failed, since the workers access
+// the message
+static void WaitForWorkers(std::vector<std::unique_ptr<detail::StripeWorker>>& workers,
+                           std::size_t number_of_stripes, std::exception_ptr error) {
+  for (std::size_t i = 1; i < number_of_stripes; ++i) {
+    try {
+      workers[i - 1]->Wait();
+    } catch (...) {
+      if (!error) error = std::current_exception();
+    }
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+StripedTcpTransport::StripedTcpTransport(
+    std::vector<std::unique_ptr<detail::TcpTransportImplementation>>&& implementations)
+    : implementation_(
+          std::make_unique<detail::StripedTcpTransportImplementation>(std::move(implementations))) {
+  if (implementation_->connections_.empty()) {
+    throw std::invalid_argument("StripedTcpTransport needs at least one connection");
+  }
+}
+
+StripedTcpTransport::StripedTcpTransport(StripedTcpTransport&& other)
+    : implementation_(std::move(other.implementation_)) {}
+
+StripedTcpTransport::~StripedTcpTransport() = default;
+
+std::size_t StripedTcpTransport::GetNumberOfConnections() const {
+  return implementation_->connections_.size();
+}
+
+bool StripedTcpTransport::Available() const {
+  auto& connection{*implementation_->connections_.front()};
+  std::scoped_lock lock(connection.socket_mutex_);
+  return connection.socket_.available() > 0;
+}
+
+void StripedTcpTransport::ShutdownSend() {
+  for (auto& connection : implementation_->connections_) {
+    std::scoped_lock lock(connection->socket_mutex_);
+    boost::system::error_code ec;
+    connection->socket_.shutdown(tcp::socket::shutdown_send, ec);
+  }
+}
+
+void StripedTcpTransport::Shutdown() {
+  for (auto& connection : implementation_->connections_) {
+    std::scoped_lock lock(connection->socket_mutex_);
+    boost::system::error_code ec;
+    connection->socket_.shutdown(tcp::socket::shutdown_both, ec);
+    connection->socket_.close(ec);
+  }
+}
+
+void StripedTcpTransport::SendMessage(std::span<const std::uint8_t> message) {
+  if (message.size() > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::runtime_error(fmt::format("Max message size is {} B but tried to send {} B",
+                                         std::numeric_limits<std::uint32_t>::max(),
+                                         message.size()));
+  }
+  auto& implementation{*implementation_};
+  std::array<std::uint8_t, sizeof(std::uint32_t)> message_size;
+  u32tou8(message.size(), message_size.data());
+
+  std::scoped_lock lock(implementation.send_mutex_);
+  const std::size_t number_of_stripes = implementation.GetNumberOfStripes(message.size());
+  for (std::size_t i = 1; i < number_of_stripes; ++i) {
+    const auto [begin, size] = implementation.GetStripe(message.size(), number_of_stripes, i);
+    implementation.send_workers_[i - 1]->Post(
+        [&connection = *implementation.connections_[i], stripe = message.subspan(begin, size)] {
+          WriteToConnection(connection, boost::asio::buffer(stripe.data(), stripe.size()));
+        });
+  }
+  // the size and the first stripe are sent over the first connection
+  std::exception_ptr error;
+  try {
+    const auto [begin, size] = implementation.GetStripe(message.size(), number_of_stripes, 0);
+    std::array<boost::asio::const_buffer, 2> buffers = {
+        boost::asio::buffer(message_size), boost::asio::buffer(message.data() + begin, size)};
+    WriteToConnection(*implementation.connections_.front(), buffers);
+  } catch (...) {
+    error = std::current_exception();
+  }
+  WaitForWorkers(implementation.send_workers_, number_of_stripes, error);
+
+  statistics_.number_of_bytes_sent += message.size() + sizeof(uint32_t);
+  statistics_.number_of_messages_sent += 1;
+}
+
+std::optional<std::vector<std::uint8_t>> StripedTcpTransport::ReceiveMessage() {
+  auto& implementation{*implementation_};
+  auto& first_connection{*implementation.connections_.front()};
+  std::scoped_lock lock(implementation.receive_mutex_);
+
+  std::array<std::uint8_t, sizeof(std::uint32_t)> message_size_buffer;
+  {
+    boost::system::error_code ec;
+    std::shared_lock socket_lock(first_connection.socket_mutex_);
+    first_connection.socket_.wait(tcp::socket::wait_read, ec);
+    if (ec) {
+      throw std::runtime_error(
+          fmt::format("Error while wait read on socket: {} ({})", ec.message(), ec.value()));
+    }
+    boost::asio::read(first_connection.socket_, boost::asio::buffer(message_size_buffer),
+                      boost::asio::transfer_exactly(message_size_buffer.size()), ec);
+    if (ec) {
+      if (ec.value() == boost::asio::error::misc_errors::eof) {
+        // connection has been closed
+        return std::nullopt;
+      }
+      throw std::runtime_error(fmt::format("Error while reading message size from socket: {} ({})",
+                                           ec.message(), ec.value()));
+    }
+  }
+  std::uint32_t message_size = u8tou32(message_size_buffer);
+  auto message_buffer{receive_buffer_pool_ ? receive_buffer_pool_->Acquire(message_size)
+                                            : std::vector<std::uint8_t>(message_size)};
+
+  const std::size_t number_of_stripes = implementation.GetNumberOfStripes(message_size);
+  const std::span<std::uint8_t> message(message_buffer);
+  for (std::size_t i = 1; i < number_of_stripes; ++i) {
+    const auto [begin, size] = implementation.GetStripe(message_size, number_of_stripes, i);
+    implementation.receive_workers_[i - 1]->Post(
+        [&connection = *implementation.connections_[i], stripe = message.subspan(begin, size)] {
+          ReadFromConnection(connection, stripe);
+        });
+  }
+  std::exception_ptr error;
+  try {
+    const auto [begin, size] = implementation.GetStripe(message_size, number_of_stripes, 0);
+    ReadFromConnection(first_connection, message.subspan(begin, size));
+  } catch (...) {
+    error = std::current_exception();
+  }
+  WaitForWorkers(implementation.receive_workers_, number_of_stripes, error);
+
+  statistics_.number_of_bytes_received += message_size + sizeof(uint32_t);
+  statistics_.number_of_messages_received += 1;
+  return message_buffer;
+}
+
+struct TcpIoService::WorkGuard {
+  WorkGuard(boost::asio::io_context& io_context)
+      : guard_(boost::asio::make_work_guard(io_context)) {}
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type> guard_;
+};
+
+TcpIoService::TcpIoService(std::size_t number_of_threads) {
+  if (number_of_threads == 0) {
+    throw std::invalid_argument("TcpIoService needs at least one thread");
+  }
+  // the concurrency hint allows the io_context to skip locking if only one thread runs it
+  io_context_ = std::make_shared<boost::asio::io_context>(static_cast<int>(number_of_threads));
+  work_guard_ = std::make_unique<WorkGuard>(*io_context_);
+  for (std::size_t i = 0; i < number_of_threads; ++i) {
+    threads_.emplace_back([this] { io_context_->run(); });
+    ThreadSetName(threads_.back(), fmt::format("tcp-io-{}", i));
+  }
+}
+
+TcpIoService::~TcpIoService() {
+  work_guard_.reset();
+  io_context_->stop();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+namespace detail {
+
+// State of an AsyncTcpTransport which is shared with the handlers of the pending operations. All
+// handlers run on the strand of the connection, so that at most one I/O thread accesses it.
+struct AsyncTcpConnection : public std::enable_shared_from_this<AsyncTcpConnection> {
+  static constexpr std::size_t kReadBufferSize = 64 * 1024;
+  // Send blocks while this many bytes are waiting to be written
+  static constexpr std::size_t kMaximumSendBufferSize = 4 * 1024 * 1024;
+
+  explicit AsyncTcpConnection(tcp::socket&& socket)
+      : socket_(std::move(socket)),
+        strand_(boost::asio::make_strand(socket_.get_executor())),
+        read_buffer_(kReadBufferSize) {}
+
+  void Send(std::span<const std::span<const std::uint8_t>> fragments, std::uint32_t size) {
+    std::array<std::uint8_t, sizeof(std::uint32_t)> message_size;
+    u32tou8(size, message_size.data());
+    bool schedule_write;
+    {
+      std::unique_lock lock(send_mutex_);
+      send_condition_variable_.wait(lock, [this] {
+        return send_buffer_.size() < kMaximumSendBufferSize || send_error_;
+      });
+      if (send_error_) {
+        throw std::runtime_error(
+            fmt::format("Error while writing to socket: {}", send_error_.message()));
+      }
+      send_buffer_.insert(send_buffer_.end(), message_size.begin(), message_size.end());
+      for (const auto& fragment : fragments) {
+        send_buffer_.insert(send_buffer_.end(), fragment.begin(), fragment.end());
+      }
+      // messages sent while a write is scheduled are written together with the next call
+      schedule_write = !std::exchange(write_scheduled_, true);
+    }
+    if (schedule_write) {
+      boost::asio::post(strand_, [self = shared_from_this()] { self->StartWrite(); });
+    }
+  }
+
+  void ShutdownSend() {
+    bool schedule_write;
+    {
+      std::scoped_lock lock(send_mutex_);
+      shutdown_send_requested_ = true;
+      schedule_write = !std::exchange(write_scheduled_, true);
+    }
+    if (schedule_write) {
+      boost::asio::post(strand_, [self = shared_from_this()] { self->StartWrite(); });
+    }
+  }
+
+  void WaitUntilWritten() {
+    std::unique_lock lock(send_mutex_);
+    send_condition_variable_.wait(lock, [this] { return !write_scheduled_; });
+  }
+
+  void StartReceiving(std::shared_ptr<ReceiveBufferPool> receive_buffer_pool,
+                      Transport::ReceiveHandler receive_handler = nullptr) {
+    boost::asio::post(strand_, [self = shared_from_this(),
+                                receive_buffer_pool = std::move(receive_buffer_pool),
+                                receive_handler = std::move(receive_handler)]() mutable {
+      self->receive_buffer_pool_ = std::move(receive_buffer_pool);
+      self->receive_handler_ = std::move(receive_handler);
+      self->Read();
+    });
+  }
+
+  // the handlers of pending operations return without touching the connection afterwards
+  void Close() {
+    std::promise<void> closed_promise;
+    boost::asio::post(strand_, [this, &closed_promise] {
+      closed_ = true;
+      boost::system::error_code ec;
+      socket_.shutdown(tcp::socket::shutdown_both, ec);
+      socket_.close(ec);
+      received_messages_.close();
+      closed_promise.set_value();
+    });
+    closed_promise.get_future().get();
+  }
+
+  // runs on the strand
+  void StartWrite() {
+    if (closed_) {
+      return;
+    }
+    {
+      std::scoped_lock lock(send_mutex_);
+      if (send_buffer_.empty()) {
+        write_scheduled_ = false;
+        if (shutdown_send_requested_) {
+          boost::system::error_code ec;
+          socket_.shutdown(tcp::socket::shutdown_send, ec);
+        }
+        send_condition_variable_.notify_all();
+        return;
+      }
+      // keep the capacity of the buffers
+      write_buffer_.clear();
+      std::swap(write_buffer_, send_buffer_);
+      write_offset_ = 0;
+    }
+    send_condition_variable_.notify_all();
+    Write();
+  }
+
+  void Write() {
+    socket_.async_write_some(
+        boost::asio::buffer(write_buffer_.data() + write_offset_,
+                            write_buffer_.size() - write_offset_),
+        boost::asio::bind_executor(
+            strand_, [self = shared_from_this()](const boost::system::error_code& ec,
+                                                 std::size_t number_of_bytes) {
+              self->OnWrite(ec, number_of_bytes);
+            }));
+  }
+
+  void OnWrite(const boost::system::error_code& ec, std::size_t number_of_bytes) {
+    if (closed_) {
+      return;
+    }
+    ++number_of_write_calls_;
+    if (ec) {
+      std::scoped_lock lock(send_mutex_);
+      send_error_ = ec;
+      send_buffer_.clear();
+      write_scheduled_ = false;
+      send_condition_variable_.notify_all();
+      return;
+    }
+    write_offset_ += number_of_bytes;
+    if (write_offset_ < write_buffer_.size()) {
+      Write();
+    } else {
+      StartWrite();
+    }
+  }
+
+  void Read() {
+    auto self = shared_from_this();
+    if (message_ && message_->size() - message_offset_ >= kReadBufferSize) {
+      // the remainder of large messages is read directly into their buffer
+      socket_.async_read_some(
+          boost::asio::buffer(message_->data() + message_offset_,
+                              message_->size() - message_offset_),
+          boost::asio::bind_executor(
+              strand_, [self](const boost::system::error_code& ec, std::size_t number_of_bytes) {
+                self->OnRead(ec, number_of_bytes, true);
+              }));
+      return;
+    }
+    socket_.async_read_some(
+        boost::asio::buffer(read_buffer_),
+        boost::asio::bind_executor(
+            strand_, [self](const boost::system::error_code& ec, std::size_t number_of_bytes) {
+              self->OnRead(ec, number_of_bytes, false);
+            }));
+  }
+
+  void OnRead(const boost::system::error_code& ec, std::size_t number_of_bytes,
+              bool read_into_message) {
+    if (closed_) {
+      return;
+    }
+    ++number_of_read_calls_;
+    if (ec) {
+      if (ec != boost::asio::error::eof) {
+        receive_error_ = fmt::format("{} ({})", ec.message(), ec.value());
+      } else if (message_ || message_size_offset_ > 0) {
+        receive_error_ = "connection was closed in the middle of a message";
+      }
+      received_messages_.close();
+      if (receive_handler_) {
+        receive_handler_(std::nullopt);
+      }
+      return;
+    }
+    if (read_into_message) {
+      message_offset_ += number_of_bytes;
+      if (message_offset_ == message_->size()) {
+        CompleteMessage();
+      }
+    } else {
+      Parse(std::span<const std::uint8_t>(read_buffer_.data(), number_of_bytes));
+    }
+    Read();
+  }
+
+  // split the read bytes into messages
+  void Parse(std::span<const std::uint8_t> data) {
+    while (!data.empty()) {
+      if (!message_) {
+        const auto n =
+            std::min(message_size_buffer_.size() - message_size_offset_, data.size());
+        std::copy_n(data.begin(), n, message_size_buffer_.begin() + message_size_offset_);
+        message_size_offset_ += n;
+        data = data.subspan(n);
+        if (message_size_offset_ < message_size_buffer_.size()) {
+          break;
+        }
+        const std::uint32_t message_size = u8tou32(message_size_buffer_);
+        message_size_offset_ = 0;
+        message_.emplace(receive_buffer_pool_ ? receive_buffer_pool_->Acquire(message_size)
+                                              : std::vector<std::uint8_t>(message_size));
+        message_offset_ = 0;
+      }
+      const auto n = std::min(message_->size() - message_offset_, data.size());
+      std::copy_n(data.begin(), n, message_->begin() + message_offset_);
+      message_offset_ += n;
+      data = data.subspan(n);
+      if (message_offset_ == message_->size()) {
+        CompleteMessage();
+      }
+    }
+  }
+
+  void CompleteMessage() {
+    if (receive_handler_) {
+      ++number_of_messages_received_;
+      number_of_bytes_received_ += message_->size() + sizeof(std::uint32_t);
+      receive_handler_(std::move(*message_));
+    } else {
+      received_messages_.enqueue(std::move(*message_));
+    }
+    message_.reset();
+  }
+
+  tcp::socket socket_;
+  boost::asio::strand<tcp::socket::executor_type> strand_;
+  bool closed_ = false;
+  // counted by the handlers and read by the threads of the transport
+  std::atomic<std::size_t> number_of_write_calls_ = 0;
+  std::atomic<std::size_t> number_of_read_calls_ = 0;
+  // only counted for the messages which are handed to receive_handler_
+  std::atomic<std::size_t> number_of_messages_received_ = 0;
+  std::atomic<std::size_t> number_of_bytes_received_ = 0;
+
+  // messages which are not yet written, guarded by send_mutex_
+  std::mutex send_mutex_;
+  std::condition_variable send_condition_variable_;
+  std::vector<std::uint8_t> send_buffer_;
+  bool write_scheduled_ = false;
+  bool shutdown_send_requested_ = false;
+  boost::system::error_code send_error_;
+  // messages which are currently written
+  std::vector<std::uint8_t> write_buffer_;
+  std::size_t write_offset_ = 0;
+
+  std::shared_ptr<ReceiveBufferPool> receive_buffer_pool_;
+  std::vector<std::uint8_t> read_buffer_;
+  std::array<std::uint8_t, sizeof(std::uint32_t)> message_size_buffer_;
+  std::size_t message_size_offset_ = 0;
+  std::optional<std::vector<std::uint8_t>> message_;
+  std::size_t message_offset_ = 0;
+  // is only read after received_messages_ has been closed
+  std::string receive_error_;
+  SynchronizedQueue<std::vector<std::uint8_t>> received_messages_;
+  Transport::ReceiveHandler receive_handler_;
+};
+
+}  // namespace detail
+
+AsyncTcpTransport::AsyncTcpTransport(
+    std::shared_ptr<TcpIoService> io_service,
+    std::unique_ptr<detail::TcpTransportImplementation> implementation)
+    : io_service_(std::move(io_service)),
+      connection_(
+          std::make_shared<detail::AsyncTcpConnection>(std::move(implementation->socket_))) {
+  statistics_.number_of_io_threads = io_service_->GetNumberOfThreads();
+}
+
+AsyncTcpTransport::~AsyncTcpTransport() { connection_->Close(); }
+
+void AsyncTcpTransport::StartReceiving() const {
+  // the receive buffer pool is set after the construction, but before the first receive
+  std::call_once(receiving_started_,
+                 [this] { connection_->StartReceiving(receive_buffer_pool_); });
+}
+
+void AsyncTcpTransport::SendMessage(std::span<const std::uint8_t> message) {
+  const std::array fragments{message};
+  SendMessageFragments(fragments);
+}
+
+void AsyncTcpTransport::SendMessageFragments(
+    std::span<const std::span<const std::uint8_t>> fragments) {
+  std::size_t size = 0;
+  for (const auto& fragment : fragments) size += fragment.size();
+  if (size > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::runtime_error(fmt::format("Max message size is {} B but tried to send {} B",
+                                         std::numeric_limits<std::uint32_t>::max(), size));
+  }
+  connection_->Send(fragments, size);
+  statistics_.number_of_bytes_sent += size + sizeof(uint32_t);
+  statistics_.number_of_messages_sent += 1;
+}
+
+bool AsyncTcpTransport::Available() const {
+  StartReceiving();
+  return !connection_->received_messages_.empty();
+}
+
+std::optional<std::vector<std::uint8_t>> AsyncTcpTransport::ReceiveMessage() {
+  StartReceiving();
+  auto message{connection_->received_messages_.dequeue()};
+  if (!message.has_value()) {
+    if (!connection_->receive_error_.empty()) {
+      throw std::runtime_error(
+          fmt::format("Error while reading from socket: {}", connection_->receive_error_));
+    }
+    // connection has been closed
+    return std::nullopt;
+  }
+  statistics_.number_of_bytes_received += message->size() + sizeof(uint32_t);
+  statistics_.number_of_messages_received += 1;
+  return message;
+}
+
+void AsyncTcpTransport::ShutdownSend() { connection_->ShutdownSend(); }
+
+void AsyncTcpTransport::SetReceiveHandler(ReceiveHandler handler) {
+  bool is_set = false;
+  std::call_once(receiving_started_, [this, &handler, &is_set] {
+    connection_->StartReceiving(receive_buffer_pool_, std::move(handler));
+    is_set = true;
+  });
+  if (!is_set) {
+    throw std::logic_error("the receive handler must be set before the first receive");
+  }
+}
+
+TransportStatistics AsyncTcpTransport::GetStatistics() const {
+  auto statistics{Transport::GetStatistics()};
+  statistics.number_of_write_calls = connection_->number_of_write_calls_;
+  statistics.number_of_read_calls = connection_->number_of_read_calls_;
+  statistics.number_of_messages_received += connection_->number_of_messages_received_;
+  statistics.number_of_bytes_received += connection_->number_of_bytes_received_;
+  return statistics;
+}
+
+void AsyncTcpTransport::ResetStatistics() {
+  Transport::ResetStatistics();
+  connection_->number_of_write_calls_ = 0;
+  connection_->number_of_read_calls_ = 0;
+  connection_->number_of_messages_received_ = 0;
+  connection_->number_of_bytes_received_ = 0;
+}
+
+void AsyncTcpTransport::Shutdown() {
+  connection_->WaitUntilWritten();
+  connection_->Close();
+}
+
+namespace {
+
+// Establishes the connections of a TcpSetupHelper on a private io_context, which is run by the
+// thread calling Run. All accepts, connects and handshakes are asynchronous, so that a slow or late
+// peer does not delay the connections to the other peers.
+class TcpConnectionSetup {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  TcpConnectionSetup(std::size_t my_id, std::size_t number_of_parties,
+                     std::size_t number_of_connections,
+                     std::chrono::milliseconds initial_retry_delay,
+                     std::chrono::milliseconds maximum_retry_delay)
+      : my_id_(my_id),
+        number_of_parties_(number_of_parties),
+        number_of_connections_(number_of_connections),
+        initial_retry_delay_(initial_retry_delay),
+        maximum_retry_delay_(maximum_retry_delay),
+        acceptor_(io_context_) {}
+
+  // Establishes all connections and moves the sockets to io_context, ordered by party and
+  // connection id. Throws a std::runtime_error if an error occurs or if not all connections are
+  // established before the deadline.
+  std::map<std::size_t, std::vector<tcp::socket>> Run(
+      const TcpPartiesConfiguration& parties_configuration, const tcp::endpoint& bind_endpoint,
+      Clock::time_point deadline, boost::asio::io_context& io_context);
+
+ private:
+  void Accept();
+  void ReceiveIds(std::shared_ptr<tcp::socket> socket);
+  void Connect(std::size_t other_id, std::size_t connection_id,
+               std::chrono::milliseconds retry_delay);
+  void SendIds(std::shared_ptr<tcp::socket> socket, std::size_t other_id,
+               std::size_t connection_id, std::chrono::milliseconds retry_delay);
+  void RetryConnect(std::size_t other_id, std::size_t connection_id,
+                    std::chrono::milliseconds retry_delay, const boost::system::error_code& ec);
+  void AddSocket(std::size_t other_id, std::size_t connection_id, tcp::socket&& socket);
+  void Fail(std::string error_message);
+
+  std::size_t GetNumberOfExpectedConnections() const {
+    return (number_of_parties_ - 1) * number_of_connections_;
+  }
 
   std::size_t my_id_;
   std::size_t number_of_parties_;
-  int number_of_connection_retries_ = 10;
-  decltype(1s) retry_delay_ = 3s;
+  std::size_t number_of_connections_;
+  std::chrono::milliseconds initial_retry_delay_;
+  std::chrono::milliseconds maximum_retry_delay_;
+  // declared first s.t. the pending handlers, which own the sockets and timers in flight, are
+  // destroyed last
+  boost::asio::io_context io_context_;
+  tcp::acceptor acceptor_;
+  std::vector<tcp::resolver::results_type> endpoints_;
+  // last connect error per party, reported on timeout
+  std::map<std::size_t, boost::system::error_code> connect_errors_;
+  // sockets_[(other_id, connection_id)]
+  std::map<std::pair<std::size_t, std::size_t>, tcp::socket> sockets_;
+  std::string error_message_;
+};
+
+std::map<std::size_t, std::vector<tcp::socket>> TcpConnectionSetup::Run(
+    const TcpPartiesConfiguration& parties_configuration, const tcp::endpoint& bind_endpoint,
+    Clock::time_point deadline, boost::asio::io_context& io_context) {
+  boost::system::error_code ec;
+  if (my_id_ < number_of_parties_ - 1) {
+    acceptor_.open(bind_endpoint.protocol(), ec);
+    if (!ec) acceptor_.set_option(tcp::acceptor::reuse_address(true), ec);
+    if (!ec) acceptor_.bind(bind_endpoint, ec);
+    if (!ec) acceptor_.listen(boost::asio::socket_base::max_listen_connections, ec);
+    if (ec) {
+      throw std::runtime_error(fmt::format("error occurred on listen: {}\n", ec.message()));
+    }
+    Accept();
+  }
+  tcp::resolver resolver(io_context_);
+  for (std::size_t party_id = 0; party_id < my_id_; ++party_id) {
+    const auto& [host, port] = parties_configuration.at(party_id);
+    endpoints_.emplace_back(resolver.resolve(host, std::to_string(port), ec));
+    if (ec) {
+      throw std::runtime_error(
+          fmt::format("cannot resolve {}:{}, {}\n", host, port, ec.message()));
+    }
+    for (std::size_t connection_id = 0; connection_id < number_of_connections_; ++connection_id) {
+      Connect(party_id, connection_id, initial_retry_delay_);
+    }
+  }
+
+  // returns when all connections are established, when an error occurred, or at the deadline
+  io_context_.run_until(deadline);
+
+  if (!error_message_.empty()) {
+    throw std::runtime_error(error_message_);
+  }
+  if (sockets_.size() < GetNumberOfExpectedConnections()) {
+    std::string missing_connections;
+    for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
+      if (party_id == my_id_) continue;
+      for (std::size_t connection_id = 0; connection_id < number_of_connections_;
+           ++connection_id) {
+        if (sockets_.contains({party_id, connection_id})) continue;
+        missing_connections += fmt::format(" {}.{}", party_id, connection_id);
+        if (auto iterator = connect_errors_.find(party_id); iterator != connect_errors_.end()) {
+          missing_connections += fmt::format(" ({})", iterator->second.message());
+        }
+      }
+    }
+    throw std::runtime_error(fmt::format(
+        "timeout while establishing the connections, missing party.connection:{}",
+        missing_connections));
+  }
+
+  // the map is ordered by party and connection id
+  std::map<std::size_t, std::vector<tcp::socket>> result;
+  for (auto& [ids, socket] : sockets_) {
+    const auto protocol = socket.local_endpoint().protocol();
+    result[ids.first].emplace_back(io_context, protocol, socket.release());
+  }
+  return result;
+}
+
+void TcpConnectionSetup::Accept() {
+  auto socket = std::make_shared<tcp::socket>(io_context_);
+  acceptor_.async_accept(*socket, [this, socket](const boost::system::error_code& ec) {
+    if (ec == boost::asio::error::operation_aborted) {
+      return;
+    } else if (ec) {
+      Fail(fmt::format("error occurred on accept: {}\n", ec.message()));
+      return;
+    }
+    ReceiveIds(socket);
+    Accept();
+  });
+}
+
+void TcpConnectionSetup::ReceiveIds(std::shared_ptr<tcp::socket> socket) {
+  // receive other id and the index of this connection
+  auto ids = std::make_shared<std::array<std::uint64_t, 2>>();
+  boost::asio::async_read(
+      *socket, boost::asio::buffer(*ids),
+      [this, socket, ids](const boost::system::error_code& ec, std::size_t) {
+        // the socket is closed when the last handler owning it is destroyed
+        if (ec) return;
+        const auto other_id = static_cast<std::size_t>((*ids)[0]);
+        const auto connection_id = static_cast<std::size_t>((*ids)[1]);
+        // validate received ids
+        if (other_id <= my_id_ || other_id >= number_of_parties_ ||
+            connection_id >= number_of_connections_) {
+          return;
+        }
+        // send my party id
+        (*ids)[0] = static_cast<std::uint64_t>(my_id_);
+        boost::asio::async_write(
+            *socket, boost::asio::buffer(ids->data(), sizeof(std::uint64_t)),
+            [this, socket, ids, other_id, connection_id](const boost::system::error_code& ec,
+                                                         std::size_t) {
+              if (ec) return;
+              // a peer only reconnects if its previous attempt failed, so the new connection
+              // replaces an already accepted one
+              AddSocket(other_id, connection_id, std::move(*socket));
+            });
+      });
+}
+
+void TcpConnectionSetup::Connect(std::size_t other_id, std::size_t connection_id,
+                                 std::chrono::milliseconds retry_delay) {
+  auto socket = std::make_shared<tcp::socket>(io_context_);
+  boost::asio::async_connect(
+      *socket, endpoints_.at(other_id),
+      [this, socket, other_id, connection_id, retry_delay](const boost::system::error_code& ec,
+                                                           const tcp::endpoint&) {
+        if (ec) {
+          RetryConnect(other_id, connection_id, retry_delay, ec);
+          return;
+        }
+        SendIds(socket, other_id, connection_id, retry_delay);
+      });
+}
+
+void TcpConnectionSetup::SendIds(std::shared_ptr<tcp::socket> socket, std::size_t other_id,
+                                 std::size_t connection_id,
+                                 std::chrono::milliseconds retry_delay) {
+  // send my id and the index of this connection to the peer
+  auto ids = std::make_shared<std::array<std::uint64_t, 2>>(std::array<std::uint64_t, 2>{
+      static_cast<std::uint64_t>(my_id_), static_cast<std::uint64_t>(connection_id)});
+  boost::asio::async_write(
+      *socket, boost::asio::buffer(*ids),
+      [this, socket, ids, other_id, connection_id, retry_delay](
+          const boost::system::error_code& ec, std::size_t) {
+        if (ec) {
+          RetryConnect(other_id, connection_id, retry_delay, ec);
+          return;
+        }
+        // receive id of the peer
+        boost::asio::async_read(
+            *socket, boost::asio::buffer(ids->data(), sizeof(std::uint64_t)),
+            [this, socket, ids, other_id, connection_id, retry_delay](
+                const boost::system::error_code& ec, std::size_t) {
+              if (ec) {
+                RetryConnect(other_id, connection_id, retry_delay, ec);
+                return;
+              }
+              if (static_cast<std::size_t>((*ids)[0]) != other_id) {
+                Fail(fmt::format("received unexpected party id {} of party {}\n", (*ids)[0],
+                                 other_id));
+                return;
+              }
+              AddSocket(other_id, connection_id, std::move(*socket));
+            });
+      });
+}
+
+void TcpConnectionSetup::RetryConnect(std::size_t other_id, std::size_t connection_id,
+                                      std::chrono::milliseconds retry_delay,
+                                      const boost::system::error_code& ec) {
+  connect_errors_[other_id] = ec;
+  auto timer = std::make_shared<boost::asio::steady_timer>(io_context_, retry_delay);
+  timer->async_wait([this, timer, other_id, connection_id,
+                     retry_delay](const boost::system::error_code& ec) {
+    if (ec) return;
+    Connect(other_id, connection_id, std::min(2 * retry_delay, maximum_retry_delay_));
+  });
+}
+
+void TcpConnectionSetup::AddSocket(std::size_t other_id, std::size_t connection_id,
+                                   tcp::socket&& socket) {
+  sockets_.insert_or_assign({other_id, connection_id}, std::move(socket));
+  if (sockets_.size() == GetNumberOfExpectedConnections()) {
+    io_context_.stop();
+  }
+}
+
+void TcpConnectionSetup::Fail(std::string error_message) {
+  error_message_ = std::move(error_message);
+  io_context_.stop();
+}
+
+}  // namespace
+
+struct TcpSetupHelper::TcpSetupImplementation {
+  std::chrono::milliseconds timeout_ = kDefaultTimeout;
+  std::chrono::milliseconds initial_retry_delay_ = kDefaultInitialRetryDelay;
+  std::chrono::milliseconds maximum_retry_delay_ = kDefaultMaximumRetryDelay;
   boost::asio::ip::address bind_address_;
   std::uint16_t bind_port_;
   std::shared_ptr<boost::asio::io_context> io_context_;
-  std::map<std::size_t, tcp::socket> sockets_;
+  std::shared_ptr<TcpIoService> io_service_;
 };
 
 TcpSetupHelper::TcpSetupHelper(std::size_t my_id,
-                               const TcpPartiesConfiguration& parties_configuration)
+                               const TcpPartiesConfiguration& parties_configuration,
+                               std::size_t number_of_connections)
     : my_id_(my_id),
       number_of_parties_(parties_configuration.size()),
+      number_of_connections_(number_of_connections),
       parties_configuration_(parties_configuration),
       implementation_(std::make_unique<TcpSetupImplementation>()) {
   // check arguments
@@ -183,10 +1086,11 @@ TcpSetupHelper::TcpSetupHelper(std::size_t my_id,
     throw std::invalid_argument(
         "specified invalid party id: my_id >= parties_configuration.size()");
   }
+  if (number_of_connections_ == 0) {
+    throw std::invalid_argument("specified invalid number of connections: 0");
+  }
   boost::system::error_code ec;
   auto my_configuration = parties_configuration_[my_id_];
-  implementation_->my_id_ = my_id_;
-  implementation_->number_of_parties_ = number_of_parties_;
   implementation_->bind_port_ = std::get<1>(my_configuration);
   implementation_->bind_address_ = boost::asio::ip::make_address(std::get<0>(my_configuration), ec);
   if (ec) {
@@ -198,158 +1102,65 @@ TcpSetupHelper::TcpSetupHelper(std::size_t my_id,
 
 TcpSetupHelper::~TcpSetupHelper() = default;
 
-std::vector<std::unique_ptr<Transport>> TcpSetupHelper::SetupConnections() {
-  auto accept_future =
-      std::async(std::launch::async, [this] { return implementation_->accept_task(); });
-  std::vector<std::future<tcp::socket>> futures;
-  for (std::size_t party_id = 0; party_id < my_id_; ++party_id) {
-    auto party_configuration = parties_configuration_.at(party_id);
-    futures.emplace_back(std::async(std::launch::async, [this, party_id, party_configuration] {
-      return implementation_->connect_task(party_id, std::get<0>(party_configuration),
-                                           std::get<1>(party_configuration));
-    }));
+void TcpSetupHelper::SetIoService(std::shared_ptr<TcpIoService> io_service) {
+  if (number_of_connections_ > 1) {
+    throw std::invalid_argument("AsyncTcpTransport supports only one connection per party");
   }
-  try {
-    implementation_->sockets_ = accept_future.get();
-    for (std::size_t party_id = 0; party_id < my_id_; ++party_id) {
-      implementation_->sockets_.emplace(party_id, futures.at(party_id).get());
-    }
-  } catch (std::runtime_error& e) {
-    // an error happened => close all other sockets
-    std::for_each(std::begin(implementation_->sockets_), std::end(implementation_->sockets_),
-                  [](auto& iterator) {
-                    auto& socket = iterator.second;
-                    if (socket.is_open()) {
-                      boost::system::error_code ec;
-                      socket.shutdown(tcp::socket::shutdown_type::shutdown_both, ec);
-                      socket.close(ec);
-                      // socket is closed even if error occures
-                    }
-                  });
-    throw;
-  }
-
-  std::vector<std::unique_ptr<Transport>> result(number_of_parties_);
-  std::for_each(std::begin(implementation_->sockets_), std::end(implementation_->sockets_),
-                [this, &result](auto& iterator) {
-                  auto transport_implementation =
-                      std::make_unique<detail::TcpTransportImplementation>(
-                          implementation_->io_context_, std::move(iterator.second));
-                  result.at(iterator.first) =
-                      std::make_unique<TcpTransport>(std::move(transport_implementation));
-                });
-  return result;
+  // the sockets are created on the io_context of the service
+  implementation_->io_context_ = io_service->GetIoContext();
+  implementation_->io_service_ = std::move(io_service);
 }
 
-std::map<std::size_t, tcp::socket> TcpSetupHelper::TcpSetupImplementation::accept_task() {
-  if (my_id_ == number_of_parties_ - 1) {
-    return {};
-  }
-  std::map<std::size_t, tcp::socket> sockets;
-  std::size_t number_of_accepted_connections = 0;
-  std::size_t expected_connections = number_of_parties_ - my_id_ - 1;
-  boost::system::error_code ec;
-  tcp::acceptor acceptor(*io_context_, tcp::endpoint(bind_address_, bind_port_),
-                         /* reuse_addr = */ true);
-  acceptor.listen(boost::asio::socket_base::max_listen_connections, ec);
-  if (ec) {
-    throw std::runtime_error(fmt::format("error occurred on listen: {}\n", ec.message()));
-  }
-  while (number_of_accepted_connections < expected_connections) {
-    tcp::socket socket(*io_context_);
-    acceptor.accept(socket, ec);
-    if (ec) {
-      throw std::runtime_error(fmt::format("error occurred on accept: {}\n", ec.message()));
-    }
-    std::size_t other_id;
-    // receive other id
-    {
-      std::uint64_t received_id;
-      boost::asio::read(socket, boost::asio::mutable_buffer(&received_id, sizeof(received_id)), ec);
-      if (ec) {
-        socket.close();
-        continue;
-      }
-      other_id = static_cast<std::size_t>(received_id);
-    }
-    // validate received id
-    if (other_id <= my_id_ || other_id >= number_of_parties_) {
-      // invalid_id
-      socket.close();
-      continue;
-    }
-    // check if we are already connected to this party
-    if (auto iterator = sockets.find(static_cast<std::size_t>(other_id));
-        iterator != sockets.end()) {
-      socket.close();
-      continue;
-    }
-    // send my party id
-    {
-      std::uint64_t my_id = static_cast<std::uint64_t>(my_id_);
-      boost::asio::write(socket, boost::asio::const_buffer(&my_id, sizeof(my_id)), ec);
-      if (ec) {
-        socket.close();
-        continue;
-      }
-    }
-    // success
-    sockets.emplace(std::make_pair(other_id, std::move(socket)));
-    ++number_of_accepted_connections;
+void TcpSetupHelper::SetTimeout(std::chrono::milliseconds timeout) {
+  if (timeout <= std::chrono::milliseconds::zero()) {
+    throw std::invalid_argument("specified invalid timeout: timeout <= 0");
   }
-  return sockets;
+  implementation_->timeout_ = timeout;
 }
 
-tcp::socket TcpSetupHelper::TcpSetupImplementation::connect_task(std::size_t other_id,
-                                                                 std::string host,
-                                                                 std::uint16_t port) {
-  boost::system::error_code ec;
-  tcp::socket socket(*io_context_);
-  tcp::resolver resolver(*io_context_);
-  auto endpoints = resolver.resolve(host, std::to_string(port), ec);
-  if (ec) {
-    throw std::runtime_error(fmt::format("cannot resolve {}:{}, {}\n", host, port, ec.message()));
+void TcpSetupHelper::SetRetryDelays(std::chrono::milliseconds initial_delay,
+                                    std::chrono::milliseconds maximum_delay) {
+  if (initial_delay <= std::chrono::milliseconds::zero() || initial_delay > maximum_delay) {
+    throw std::invalid_argument(
+        "specified invalid retry delays: initial_delay <= 0 or initial_delay > maximum_delay");
   }
-  int connect_retry_i = 0;
-  for (; connect_retry_i < number_of_connection_retries_; ++connect_retry_i) {
-    boost::asio::connect(socket, endpoints, ec);
-    if (ec) {
-      std::this_thread::sleep_for(retry_delay_);
-      continue;
-    }
+  implementation_->initial_retry_delay_ = initial_delay;
+  implementation_->maximum_retry_delay_ = maximum_delay;
+}
 
-    // send my id to the peer
-    {
-      std::uint64_t own_id = static_cast<std::uint64_t>(my_id_);
-      boost::asio::write(socket, boost::asio::const_buffer(&own_id, sizeof(own_id)), ec);
-      if (ec) {
-        socket.close();
-        continue;
-      }
-    }
+std::vector<std::unique_ptr<Transport>> TcpSetupHelper::SetupConnections() {
+  const auto start = std::chrono::steady_clock::now();
+  TcpConnectionSetup connection_setup(my_id_, number_of_parties_, number_of_connections_,
+                                      implementation_->initial_retry_delay_,
+                                      implementation_->maximum_retry_delay_);
+  auto sockets = connection_setup.Run(
+      parties_configuration_, tcp::endpoint(implementation_->bind_address_,
+                                            implementation_->bind_port_),
+      start + implementation_->timeout_, *implementation_->io_context_);
+  const auto end = std::chrono::steady_clock::now();
 
-    // receive id of the peer
-    {
-      std::uint64_t received_id;
-      boost::asio::read(socket, boost::asio::mutable_buffer(&received_id, sizeof(received_id)), ec);
-      if (ec) {
-        socket.close();
-        continue;
-      }
-      if (static_cast<std::size_t>(received_id) != other_id) {
-        throw std::runtime_error(fmt::format("received unexpected party id {} of peer {}:{}\n",
-                                             received_id, host, port));
-      }
+  std::vector<std::unique_ptr<Transport>> result(number_of_parties_);
+  std::for_each(std::begin(sockets), std::end(sockets), [this, &result](auto& iterator) {
+    std::vector<std::unique_ptr<detail::TcpTransportImplementation>> transport_implementations;
+    for (auto& socket : iterator.second) {
+      transport_implementations.emplace_back(std::make_unique<detail::TcpTransportImplementation>(
+          implementation_->io_context_, std::move(socket)));
     }
-    // success
-    break;
-  }
-  if (connect_retry_i == number_of_connection_retries_) {
-    throw std::runtime_error(fmt::format(
-        "too many errors while trying to connect to party {} at {}:{}, last error message: {}",
-        other_id, host, port, ec.message()));
+    if (implementation_->io_service_) {
+      result.at(iterator.first) = std::make_unique<AsyncTcpTransport>(
+          implementation_->io_service_, std::move(transport_implementations.front()));
+    } else if (transport_implementations.size() == 1) {
+      result.at(iterator.first) =
+          std::make_unique<TcpTransport>(std::move(transport_implementations.front()));
+    } else {
+      result.at(iterator.first) =
+          std::make_unique<StripedTcpTransport>(std::move(transport_implementations));
+    }
+  });
+  for (auto& transport : result) {
+    if (transport) transport->SetConnectionSetupTime(start, end);
   }
-  return socket;
+  return result;
 }
 
 }  // namespace encrypto::motion::communication
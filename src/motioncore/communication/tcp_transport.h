@@ -22,18 +22,29 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 #include "transport.h"
 
+namespace boost::asio {
+
+class io_context;
+
+}  // namespace boost::asio
+
 namespace encrypto::motion::communication {
 
 namespace detail {
 
 struct TcpTransportImplementation;
+struct StripedTcpTransportImplementation;
+struct AsyncTcpConnection;
 
 }  // namespace detail
 
@@ -46,6 +57,7 @@ class TcpTransport : public Transport {
   ~TcpTransport();
 
   void SendMessage(std::span<const std::uint8_t> message) override;
+  void SendMessageFragments(std::span<const std::span<const std::uint8_t>> fragments) override;
 
   bool Available() const override;
   std::optional<std::vector<std::uint8_t>> ReceiveMessage() override;
@@ -57,6 +69,99 @@ class TcpTransport : public Transport {
   std::unique_ptr<detail::TcpTransportImplementation> implementation_;
 };
 
+// Transport over several TCP connections to the same party. Messages of at least
+// kMinimumStripedMessageSize bytes are split into one contiguous part per connection, which are
+// written and read concurrently. Smaller messages only use the first connection. Since all
+// connections carry the parts of the large messages in the same order, messages are received in
+// the order they were sent.
+class StripedTcpTransport : public Transport {
+ public:
+  static constexpr std::size_t kMinimumStripedMessageSize = 1024 * 1024;
+
+  StripedTcpTransport(
+      std::vector<std::unique_ptr<detail::TcpTransportImplementation>>&& implementations);
+  StripedTcpTransport(StripedTcpTransport&& other);
+
+  // Destructor needs to be defined in implementation due to pimpl
+  ~StripedTcpTransport();
+
+  void SendMessage(std::span<const std::uint8_t> message) override;
+
+  bool Available() const override;
+  std::optional<std::vector<std::uint8_t>> ReceiveMessage() override;
+  void ShutdownSend() override;
+  void Shutdown() override;
+
+  std::size_t GetNumberOfConnections() const;
+
+ private:
+  std::unique_ptr<detail::StripedTcpTransportImplementation> implementation_;
+};
+
+// Runs the I/O of AsyncTcpTransports on a fixed number of threads. All connections of a party
+// share one service, i.e., the sockets of all peers are multiplexed on these threads by the reactor
+// of Boost.Asio, which uses epoll on Linux, or io_uring if MOTION_USE_IO_URING is enabled.
+class TcpIoService {
+ public:
+  explicit TcpIoService(std::size_t number_of_threads = 1);
+
+  // stops and joins the I/O threads
+  ~TcpIoService();
+
+  TcpIoService(const TcpIoService&) = delete;
+
+  std::size_t GetNumberOfThreads() const { return threads_.size(); }
+
+  std::shared_ptr<boost::asio::io_context> GetIoContext() const { return io_context_; }
+
+ private:
+  struct WorkGuard;
+
+  std::shared_ptr<boost::asio::io_context> io_context_;
+  std::unique_ptr<WorkGuard> work_guard_;
+  std::vector<std::thread> threads_;
+};
+
+// Transport over a TCP connection whose reads and writes are done asynchronously by the threads of
+// a TcpIoService instead of the threads calling SendMessage and ReceiveMessage. Sent messages are
+// appended to a buffer which is written with a single call once the previous write has completed,
+// so that many small messages are batched. The socket is read in large chunks which can contain
+// several messages. The numbers of issued read and write calls are reported in the statistics. With
+// a receive handler, the messages are handed to it on the I/O threads.
+class AsyncTcpTransport : public Transport {
+ public:
+  AsyncTcpTransport(std::shared_ptr<TcpIoService> io_service,
+                    std::unique_ptr<detail::TcpTransportImplementation> implementation);
+
+  // closes the socket and waits until the I/O threads do not access this transport any longer
+  ~AsyncTcpTransport();
+
+  void SendMessage(std::span<const std::uint8_t> message) override;
+  void SendMessageFragments(std::span<const std::span<const std::uint8_t>> fragments) override;
+
+  bool Available() const override;
+  std::optional<std::vector<std::uint8_t>> ReceiveMessage() override;
+  // shuts down the outgoing part of the connection once all messages are written
+  void ShutdownSend() override;
+  // waits until all messages are written and closes the connection
+  void Shutdown() override;
+
+  bool SupportsReceiveHandler() const override { return true; }
+  // the handler is called on the strand of the connection, i.e., by one I/O thread at a time
+  void SetReceiveHandler(ReceiveHandler handler) override;
+
+  // adds the calls and the messages counted by the I/O threads
+  TransportStatistics GetStatistics() const override;
+  void ResetStatistics() override;
+
+ private:
+  void StartReceiving() const;
+
+  std::shared_ptr<TcpIoService> io_service_;
+  std::shared_ptr<detail::AsyncTcpConnection> connection_;
+  mutable std::once_flag receiving_started_;
+};
+
 using TcpConnectionConfiguration = std::pair<std::string, std::uint16_t>;
 using TcpPartiesConfiguration = std::vector<TcpConnectionConfiguration>;
 
@@ -64,14 +169,41 @@ using TcpPartiesConfiguration = std::vector<TcpConnectionConfiguration>;
 // parties.  Given the ID of the local party and a collection of host and port
 // for all parties, connections are created as follows: This party tries to
 // connect to all parties with smaller IDs, and it accepts connections from the
-// parties with larger IDs.
+// parties with larger IDs. With number_of_connections > 1, that many connections are established
+// to each party and combined into a StripedTcpTransport. All parties need to use the same
+// number_of_connections. If a TcpIoService is set, AsyncTcpTransports running on it are created
+// instead.
+//
+// All connects and accepts run concurrently. A failed connect, e.g., since the peer is not
+// listening yet, is retried after a delay which doubles after each failure up to a maximum. The
+// setup fails if not all connections are established within the timeout. The time spent is
+// reported in the statistics of the transports.
 class TcpSetupHelper {
  public:
-  TcpSetupHelper(std::size_t my_id, const TcpPartiesConfiguration& parties_configuration);
+  static constexpr std::chrono::milliseconds kDefaultTimeout{30'000};
+  static constexpr std::chrono::milliseconds kDefaultInitialRetryDelay{10};
+  static constexpr std::chrono::milliseconds kDefaultMaximumRetryDelay{1'000};
+
+  TcpSetupHelper(std::size_t my_id, const TcpPartiesConfiguration& parties_configuration,
+                 std::size_t number_of_connections = 1);
 
   // Destructor needs to be defined in implementation due to pimpl
   ~TcpSetupHelper();
 
+  // Create AsyncTcpTransports whose I/O runs on the given service.
+  // Throws a std::invalid_argument if number_of_connections > 1.
+  void SetIoService(std::shared_ptr<TcpIoService> io_service);
+
+  // Give up if not all connections are established after timeout.
+  // Throws a std::invalid_argument if timeout is not positive.
+  void SetTimeout(std::chrono::milliseconds timeout);
+
+  // Retry a failed connect after initial_delay, and double the delay after each further failure
+  // up to maximum_delay.
+  // Throws a std::invalid_argument if initial_delay is not positive or larger than maximum_delay.
+  void SetRetryDelays(std::chrono::milliseconds initial_delay,
+                      std::chrono::milliseconds maximum_delay);
+
   // Try to establish connections as described above.
   // Throws a std::runtime_error if something goes wrong.
   std::vector<std::unique_ptr<Transport>> SetupConnections();
@@ -81,6 +213,7 @@ class TcpSetupHelper {
 
   std::size_t my_id_;
   std::size_t number_of_parties_;
+  std::size_t number_of_connections_;
   const TcpPartiesConfiguration parties_configuration_;
   std::unique_ptr<TcpSetupImplementation> implementation_;
 };
@@ -24,13 +24,32 @@
 
 namespace encrypto::motion::communication {
 
-const TransportStatistics& Transport::GetStatistics() const { return statistics_; }
+void Transport::SendMessageFragments(std::span<const std::span<const std::uint8_t>> fragments) {
+  std::size_t size = 0;
+  for (const auto& fragment : fragments) size += fragment.size();
+  std::vector<std::uint8_t> message;
+  message.reserve(size);
+  for (const auto& fragment : fragments) {
+    message.insert(message.end(), fragment.begin(), fragment.end());
+  }
+  SendMessage(message);
+}
+
+TransportStatistics Transport::GetStatistics() const { return statistics_; }
 
 void Transport::ResetStatistics() {
   statistics_.number_of_messages_sent = 0;
   statistics_.number_of_messages_received = 0;
   statistics_.number_of_bytes_sent = 0;
   statistics_.number_of_bytes_received = 0;
+  statistics_.number_of_write_calls = 0;
+  statistics_.number_of_read_calls = 0;
+}
+
+void Transport::SetConnectionSetupTime(std::chrono::steady_clock::time_point start,
+                                       std::chrono::steady_clock::time_point end) {
+  statistics_.connection_setup_start = start;
+  statistics_.connection_setup_end = end;
 }
 
 }  // namespace encrypto::motion::communication
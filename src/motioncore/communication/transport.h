@@ -22,20 +22,49 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <span>
+#include <utility>
 #include <vector>
 #include <cstdint>
 
 namespace encrypto::motion::communication {
 
+class ReceiveBufferPool;
+
+// phase of the execution in which a message is sent or received
+enum class CommunicationPhase : std::uint8_t { kSetup, kOnline };
+
+struct MessageTypeStatistics {
+  std::size_t number_of_messages_sent = 0;
+  std::size_t number_of_messages_received = 0;
+  std::size_t number_of_bytes_sent = 0;
+  std::size_t number_of_bytes_received = 0;
+};
+
 struct TransportStatistics {
   std::size_t number_of_messages_sent = 0;
   std::size_t number_of_messages_received = 0;
   std::size_t number_of_bytes_sent = 0;
   std::size_t number_of_bytes_received = 0;
+  // only reported by transports which do their I/O on dedicated threads, e.g., AsyncTcpTransport
+  std::size_t number_of_io_threads = 0;
+  std::size_t number_of_write_calls = 0;
+  std::size_t number_of_read_calls = 0;
+  // time at which the setup helper started and finished to establish the connections, only set by
+  // setup helpers which measure it, e.g., TcpSetupHelper, and not affected by ResetStatistics
+  std::chrono::steady_clock::time_point connection_setup_start;
+  std::chrono::steady_clock::time_point connection_setup_end;
+  // traffic by phase and MessageType without the framing of the transport, only filled in by
+  // CommunicationLayer::GetTransportStatistics
+  std::map<std::pair<CommunicationPhase, std::uint8_t>, MessageTypeStatistics>
+      message_type_statistics;
 };
 
 // underlying transport between two parties
@@ -52,6 +81,10 @@ class Transport {
   // send a message
   virtual void SendMessage(std::span<const std::uint8_t> message) = 0;
 
+  // send the concatenation of the fragments as a single message, transports which can write the
+  // fragments directly, e.g., with a scatter-gather write, override this to avoid the copy
+  virtual void SendMessageFragments(std::span<const std::span<const std::uint8_t>> fragments);
+
   // check if a new message is available
   virtual bool Available() const = 0;
 
@@ -64,11 +97,32 @@ class Transport {
   // shutdown this transport
   virtual void Shutdown() = 0;
 
-  const TransportStatistics& GetStatistics() const;
-  void ResetStatistics();
+  // called with each received message, and with std::nullopt once the connection was closed
+  using ReceiveHandler = std::function<void(std::optional<std::vector<std::uint8_t>>&&)>;
+
+  // transports which receive on their own I/O threads can hand the messages directly to a handler
+  // instead of queueing them for ReceiveMessage, so that no thread needs to block on them
+  virtual bool SupportsReceiveHandler() const { return false; }
+
+  // deliver all messages to handler from now on, must be called before the first receive
+  virtual void SetReceiveHandler([[maybe_unused]] ReceiveHandler handler) {
+    throw std::logic_error("this transport does not support receive handlers");
+  }
+
+  // transports whose I/O threads count into their own counters merge them into the copy
+  virtual TransportStatistics GetStatistics() const;
+  virtual void ResetStatistics();
+  void SetConnectionSetupTime(std::chrono::steady_clock::time_point start,
+                              std::chrono::steady_clock::time_point end);
+
+  // take the buffers of received messages from pool if the transport allocates them
+  virtual void SetReceiveBufferPool(std::shared_ptr<ReceiveBufferPool> pool) {
+    receive_buffer_pool_ = std::move(pool);
+  }
 
  protected:
   TransportStatistics statistics_;
+  std::shared_ptr<ReceiveBufferPool> receive_buffer_pool_;
 };
 
 }  // namespace encrypto::motion::communication
@@ -62,7 +62,7 @@ struct OtExtensionReceiverData : public FiberSetupWaitable {
   // random choices from OT precomputation
   std::unique_ptr<AlignedBitVector> random_choices;
 
-  // XXX: unused
+  // number of AES blocks of the base OT PRG streams used by previous OT extensions
   std::atomic<std::size_t> consumed_offset{0};
 };
 
@@ -73,7 +73,9 @@ struct OtExtensionSenderData : public FiberSetupWaitable {
   // width of the bit matrix
   std::atomic<std::size_t> bit_size{0};
 
-  std::array<ReusableFiberFuture<std::vector<std::uint8_t>>, 128> u_futures;
+  // the 128 rows u of each chunk of the OT extension, the row i of chunk c has the message id
+  // c * 128 + i, registered for as many chunks as the largest OT extension needed so far
+  std::vector<ReusableFiberFuture<std::vector<std::uint8_t>>> u_futures;
   // XXX: can't we delete this after setup?
   std::shared_ptr<BitMatrix> V;
 
@@ -84,7 +86,7 @@ struct OtExtensionSenderData : public FiberSetupWaitable {
   // bit length of every OT
   std::vector<std::size_t> bitlengths;
 
-  // XXX: unused
+  // number of AES blocks of the base OT PRG streams used by previous OT extensions
   std::atomic<std::size_t> consumed_offset{0};
 };
 
@@ -105,6 +107,9 @@ struct OtExtensionData {
 
   std::size_t party_id{std::numeric_limits<std::size_t>::max()};
   std::size_t base_ot_offset{std::numeric_limits<std::size_t>::max()};
+  // the OT extension runs in chunks of this many OTs, a multiple of 128, and publishes the OTs of
+  // each chunk as soon as they are ready, 0 runs it as a single batch
+  std::size_t chunk_size{0};
   std::function<void(flatbuffers::FlatBufferBuilder&&)> send_function;
   communication::MessageManager& message_manager;
   std::shared_ptr<Logger> logger;
@@ -22,45 +22,68 @@
 
 #include "gate_executor.h"
 
+#include <algorithm>
+#include <future>
+#include <optional>
+
+#include <fmt/format.h>
+
 #include "base/register.h"
+#include "primitives/random/seeded_random_stream.h"
 #include "protocols/gate.h"
 #include "statistics/run_time_statistics.h"
+#include "utility/fiber_condition.h"
 #include "utility/fiber_thread_pool/fiber_thread_pool.hpp"
 #include "utility/logger.h"
 
 namespace encrypto::motion {
 
+// In seeded evaluations, the fiber evaluating a phase of a gate draws its randomness from a stream
+// derived from the id of the gate, which is independent of the scheduling of the fibers.
+static std::optional<SeededRandomStream> MakeGateRandomStream(
+    const std::optional<SeededRandomStream::Seed>& seed, std::int64_t gate_id,
+    std::string_view phase) {
+  if (!seed) return std::nullopt;
+  return std::optional<SeededRandomStream>(std::in_place, *seed,
+                                           fmt::format("gate {} {}", gate_id, phase));
+}
+
 GateExecutor::GateExecutor(Register& reg, std::function<void(void)> presetup_function,
+                           std::function<void(void)> online_function,
                            std::shared_ptr<Logger> logger)
     : register_(reg),
       presetup_function_(std::move(presetup_function)),
+      online_function_(std::move(online_function)),
       logger_(std::move(logger)) {}
 
-void GateExecutor::EvaluateSetupOnline(RunTimeStatistics& statistics) {
+void GateExecutor::EvaluateSetupOnline(RunTimeStatistics& statistics, FiberThreadPool& fiber_pool,
+                                       bool prioritized) {
   statistics.RecordStart<RunTimeStatistics::StatisticsId::kEvaluate>();
 
   presetup_function_();
+  const auto random_seed{SeededRandomStream::GetCurrentSeed()};
 
   if (logger_) {
     logger_->LogInfo(
         "Start evaluating the circuit gates sequentially (online after all finished setup)");
   }
 
-  // create a pool with std::thread::hardware_concurrency() no. of threads
-  // to execute fibers
-  FiberThreadPool fiber_pool(0, 2 * register_.GetTotalNumberOfGates());
-
   // ------------------------------ setup phase ------------------------------
   statistics.RecordStart<RunTimeStatistics::StatisticsId::kGatesSetup>();
 
+  const auto& gates = prioritized ? register_.GetGatesByPriority() : register_.GetGates();
+
   // Evaluate the setup phase of all the gates
-  for (auto& gate : register_.GetGates()) {
+  for (auto& gate : gates) {
     if (gate->NeedsSetup()) {
-      fiber_pool.post([&] {
-        gate->EvaluateSetup();
-        gate->SetSetupIsReady();
-        register_.IncrementEvaluatedGatesSetupCounter();
-      });
+      fiber_pool.post(
+          [&] {
+            auto random_stream{MakeGateRandomStream(random_seed, gate->GetId(), "setup")};
+            gate->EvaluateSetup();
+            gate->SetSetupIsReady();
+            register_.IncrementEvaluatedGatesSetupCounter();
+          },
+          prioritized ? gate->GetPriority() : 0);
     } else {
       // cannot be done earlier because output wires did not yet exist
       gate->SetSetupIsReady();
@@ -74,19 +97,25 @@ void GateExecutor::EvaluateSetupOnline(RunTimeStatistics& statistics) {
   statistics.RecordEnd<RunTimeStatistics::StatisticsId::kGatesSetup>();
 
   // ------------------------------ online phase ------------------------------
+  online_function_();
   statistics.RecordStart<RunTimeStatistics::StatisticsId::kGatesOnline>();
 
   // Evaluate the online phase of all the gates
-  for (auto& gate : register_.GetGates()) {
+  for (auto& gate : gates) {
     if (gate->NeedsOnline()) {
-      fiber_pool.post([&] {
-        gate->EvaluateOnline();
-        gate->SetOnlineIsReady();
-        register_.IncrementEvaluatedGatesOnlineCounter();
-      });
+      fiber_pool.post(
+          [&] {
+            auto random_stream{MakeGateRandomStream(random_seed, gate->GetId(), "online")};
+            gate->EvaluateOnline();
+            gate->SetOnlineIsReady();
+            register_.UpdateWireLiveness(*gate);
+            register_.IncrementEvaluatedGatesOnlineCounter();
+          },
+          prioritized ? gate->GetPriority() : 0);
     } else {
       // cannot be done earlier because output wires did not yet exist
       gate->SetOnlineIsReady();
+      register_.UpdateWireLiveness(*gate);
     }
   }
 
@@ -98,54 +127,152 @@ void GateExecutor::EvaluateSetupOnline(RunTimeStatistics& statistics) {
 
   // --------------------------------------------------------------------------
 
-  fiber_pool.join();
+  // the fibers may still run after the last counter increment, so wait for them before the pool
+  // is reused or the gates are destroyed
+  fiber_pool.wait();
+
+  statistics.peak_wire_memory = register_.GetPeakWireMemory();
+  statistics.total_wire_memory = register_.GetTotalWireMemory();
 
   statistics.RecordEnd<RunTimeStatistics::StatisticsId::kEvaluate>();
 }
 
-void GateExecutor::Evaluate(RunTimeStatistics& statistics) {
+void GateExecutor::Evaluate(RunTimeStatistics& statistics, FiberThreadPool& fiber_pool,
+                            bool prioritized) {
   logger_->LogInfo(
       "Start evaluating the circuit gates in parallel (online as soon as some finished setup)");
 
   statistics.RecordStart<RunTimeStatistics::StatisticsId::kEvaluate>();
 
-  // Run preprocessing setup in a separate thread
-  auto preprocessing_future = std::async(std::launch::async, [this] { presetup_function_(); });
-
-  // create a pool with std::thread::hardware_concurrency() no. of threads
-  // to execute fibers
-  FiberThreadPool fiber_pool(0, register_.GetTotalNumberOfGates());
+  // Run preprocessing setup in a separate thread, the gates are online as soon as it is finished
+  auto preprocessing_future = std::async(std::launch::async, [this] {
+    presetup_function_();
+    online_function_();
+  });
+  const auto random_seed{SeededRandomStream::GetCurrentSeed()};
 
   // Evaluate all the gates
-  for (auto& gate : register_.GetGates()) {
+  const auto& gates = prioritized ? register_.GetGatesByPriority() : register_.GetGates();
+  for (auto& gate : gates) {
     if (gate->NeedsSetup() || gate->NeedsOnline()) {
-      fiber_pool.post([&] {
-        gate->EvaluateSetup();
-        gate->SetSetupIsReady();
-        if (gate->NeedsSetup()) {
-          register_.IncrementEvaluatedGatesSetupCounter();
-        }
-
-        // XXX: maybe insert a 'yield' here?
-        gate->EvaluateOnline();
-        gate->SetOnlineIsReady();
-        if (gate->NeedsOnline()) {
-          register_.IncrementEvaluatedGatesOnlineCounter();
-        }
-      });
+      fiber_pool.post(
+          [&] {
+            auto random_stream{
+                MakeGateRandomStream(random_seed, gate->GetId(), "setup and online")};
+            gate->EvaluateSetup();
+            gate->SetSetupIsReady();
+            if (gate->NeedsSetup()) {
+              register_.IncrementEvaluatedGatesSetupCounter();
+            }
+
+            // XXX: maybe insert a 'yield' here?
+            gate->EvaluateOnline();
+            gate->SetOnlineIsReady();
+            register_.UpdateWireLiveness(*gate);
+            if (gate->NeedsOnline()) {
+              register_.IncrementEvaluatedGatesOnlineCounter();
+            }
+          },
+          prioritized ? gate->GetPriority() : 0);
     } else {
       // cannot be done earlier because output wires did not yet exist
       gate->SetSetupIsReady();
       gate->SetOnlineIsReady();
+      register_.UpdateWireLiveness(*gate);
+    }
+  }
+
+  preprocessing_future.get();
+
+  // we have to wait until all gates are evaluated before we return
+  register_.CheckOnlineCondition();
+  register_.GetGatesOnlineDoneCondition()->Wait();
+  fiber_pool.wait();
+
+  statistics.peak_wire_memory = register_.GetPeakWireMemory();
+  statistics.total_wire_memory = register_.GetTotalWireMemory();
+
+  statistics.RecordEnd<RunTimeStatistics::StatisticsId::kEvaluate>();
+}
+
+void GateExecutor::EvaluateLevelSynchronous(RunTimeStatistics& statistics,
+                                            FiberThreadPool& fiber_pool, std::size_t chunk_size) {
+  logger_->LogInfo("Start evaluating the circuit gates level by level");
+
+  statistics.RecordStart<RunTimeStatistics::StatisticsId::kEvaluate>();
+
+  // Run preprocessing setup in a separate thread, the gates are online as soon as it is finished
+  auto preprocessing_future = std::async(std::launch::async, [this] {
+    presetup_function_();
+    online_function_();
+  });
+  const auto random_seed{SeededRandomStream::GetCurrentSeed()};
+
+  chunk_size = std::max(chunk_size, std::size_t(1));
+  const auto& levels = register_.GetGateLevels();
+
+  for (const auto& level : levels) {
+    std::size_t number_of_chunks = 0;
+    for (const auto& group : level) {
+      number_of_chunks += (group.size() + chunk_size - 1) / chunk_size;
+    }
+    if (number_of_chunks == 0) continue;
+
+    std::size_t number_of_remaining_chunks = number_of_chunks;
+    FiberCondition level_done_condition(
+        [&number_of_remaining_chunks] { return number_of_remaining_chunks == 0; });
+
+    // Each chunk is evaluated by one fiber, so gates can still block on gates of the same level
+    // that are in other chunks or in other groups, e.g., the multiplication gate on its sub-gates.
+    // The gates of a chunk are evaluated in registration order, which is the same for all parties.
+    for (const auto& group : level) {
+      for (std::size_t begin = 0; begin < group.size(); begin += chunk_size) {
+        const std::size_t end = std::min(begin + chunk_size, group.size());
+        fiber_pool.post([&, begin, end] {
+          for (std::size_t i = begin; i < end; ++i) {
+            auto& gate = group[i];
+            if (gate->NeedsSetup() || gate->NeedsOnline()) {
+              auto random_stream{
+                  MakeGateRandomStream(random_seed, gate->GetId(), "setup and online")};
+              gate->EvaluateSetup();
+              gate->SetSetupIsReady();
+              if (gate->NeedsSetup()) {
+                register_.IncrementEvaluatedGatesSetupCounter();
+              }
+
+              gate->EvaluateOnline();
+              gate->SetOnlineIsReady();
+              register_.UpdateWireLiveness(*gate);
+              if (gate->NeedsOnline()) {
+                register_.IncrementEvaluatedGatesOnlineCounter();
+              }
+            } else {
+              gate->SetSetupIsReady();
+              gate->SetOnlineIsReady();
+              register_.UpdateWireLiveness(*gate);
+            }
+          }
+          {
+            std::scoped_lock lock(level_done_condition.GetMutex());
+            --number_of_remaining_chunks;
+          }
+          level_done_condition.NotifyAll();
+        });
+      }
     }
+
+    // all gates of the next level depend on this level
+    level_done_condition.Wait();
   }
 
   preprocessing_future.get();
 
-  // we have to wait until all gates are evaluated before we close the pool
   register_.CheckOnlineCondition();
   register_.GetGatesOnlineDoneCondition()->Wait();
-  fiber_pool.join();
+  fiber_pool.wait();
+
+  statistics.peak_wire_memory = register_.GetPeakWireMemory();
+  statistics.total_wire_memory = register_.GetTotalWireMemory();
 
   statistics.RecordEnd<RunTimeStatistics::StatisticsId::kEvaluate>();
 }
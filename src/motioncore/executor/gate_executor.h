@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 
@@ -29,19 +30,31 @@ namespace encrypto::motion {
 
 struct RunTimeStatistics;
 
+class FiberThreadPool;
 class Logger;
 class Register;
 
 // Evaluates all registered gates.
+// The fibers are run on a FiberThreadPool that is owned by the caller and is reused for all
+// evaluations.
 class GateExecutor {
  public:
-  GateExecutor(Register&, std::function<void()> presetup_function, std::shared_ptr<Logger>);
+  GateExecutor(Register&, std::function<void()> presetup_function,
+               std::function<void()> online_function, std::shared_ptr<Logger>);
 
   // Run the setup phases first for all gates before starting with the online
   // phases.
-  void EvaluateSetupOnline(RunTimeStatistics& statistics);
+  // If prioritized is set, the gates are started in order of decreasing priority, i.e., remaining
+  // depth to the outputs, and their fibers are scheduled by this priority.
+  void EvaluateSetupOnline(RunTimeStatistics& statistics, FiberThreadPool& fiber_pool,
+                           bool prioritized = false);
   // Run setup and online phase of each gate as soon as possible.
-  void Evaluate(RunTimeStatistics& statistics);
+  void Evaluate(RunTimeStatistics& statistics, FiberThreadPool& fiber_pool,
+                bool prioritized = false);
+  // Evaluate the circuit level by level, where the gates of each level are split into chunks of
+  // chunk_size gates and each chunk is evaluated sequentially by a single fiber.
+  void EvaluateLevelSynchronous(RunTimeStatistics& statistics, FiberThreadPool& fiber_pool,
+                                std::size_t chunk_size);
 
  private:
   Register& register_;
@@ -49,6 +62,9 @@ class GateExecutor {
   // objects that will be used in the setup phase, eg a multiplication triple registers an
   // oblivious transfer object and an OT provider registers base OT objects.
   std::function<void()> presetup_function_;
+  // Online function is run when the online phase starts, i.e., after the setup of all gates if the
+  // phases are evaluated one after another, or after the preprocessing otherwise.
+  std::function<void()> online_function_;
   std::shared_ptr<Logger> logger_;
 };
 
@@ -47,7 +47,7 @@ std::size_t MtProvider::RequestBinaryMts(const std::size_t number_of_mts) noexce
 BinaryMtVector MtProvider::GetBinary(const std::size_t offset, const std::size_t n) const {
   assert(bit_mts_.a.GetSize() == bit_mts_.b.GetSize());
   assert(bit_mts_.b.GetSize() == bit_mts_.c.GetSize());
-  WaitFinished();
+  WaitBinary(offset, n);
   return BinaryMtVector{bit_mts_.a.Subset(offset, offset + n),
                         bit_mts_.b.Subset(offset, offset + n),
                         bit_mts_.c.Subset(offset, offset + n)};
@@ -58,6 +58,11 @@ const BinaryMtVector& MtProvider::GetBinaryAll() const noexcept {
   return bit_mts_;
 }
 
+void MtProvider::WaitBinary(const std::size_t offset, const std::size_t n) const {
+  finished_condition_->Wait(
+      [this, end = offset + n]() { return number_of_ready_bit_mts_.load() >= end; });
+}
+
 MtProvider::MtProvider(const std::size_t my_id, const std::size_t number_of_parties)
     : my_id_(my_id), number_of_parties_(number_of_parties) {
   finished_condition_ = std::make_shared<FiberCondition>([this]() { return finished_.load(); });
@@ -101,7 +106,7 @@ void MtProviderFromOts::PreSetup() {
   }
 }
 
-// needs completed OTExtension
+// needs the OT extension, waits for the OTs of each chunk of binary MTs separately
 void MtProviderFromOts::Setup() {
   if (!NeedMts()) {
     return;
@@ -112,6 +117,9 @@ void MtProviderFromOts::Setup() {
   }
   run_time_statistics_.RecordStart<RunTimeStatistics::StatisticsId::kMtSetup>();
 
+  // the binary MTs come first since their OTs are extended first
+  GenerateBinaryMts();
+
   for (auto i = 0ull; i < number_of_parties_; ++i) {
     if (i == my_id_) {
       continue;
@@ -132,19 +140,13 @@ void MtProviderFromOts::Setup() {
       dynamic_cast<AcOtSender<std::uint64_t>*>(ot.get())->SendMessages();
     }
     for (auto& ot : ots_receiver_64_.at(i)) ot->SendCorrections();
-
-    if (number_of_bit_mts_ > 0) {
-      assert(bit_ots_receiver_.at(i) != nullptr);
-      assert(bit_ots_sender_.at(i) != nullptr);
-      bit_ots_receiver_.at(i)->SendCorrections();
-      bit_ots_sender_.at(i)->SendMessages();
-    }
   }
 
   ParseOutputs();
   {
     std::scoped_lock lock(finished_condition_->GetMutex());
     finished_ = true;
+    number_of_ready_bit_mts_ = number_of_bit_mts_;
   }
 
   finished_condition_->NotifyAll();
@@ -155,6 +157,28 @@ void MtProviderFromOts::Setup() {
   }
 }
 
+void MtProviderFromOts::Clear() {
+  {
+    std::scoped_lock lock(finished_condition_->GetMutex());
+    finished_ = false;
+    number_of_ready_bit_mts_ = 0;
+  }
+
+  // the OTs are registered again in the next PreSetup()
+  for (auto i = 0ull; i < number_of_parties_; ++i) {
+    ots_sender_8_.at(i).clear();
+    ots_receiver_8_.at(i).clear();
+    ots_sender_16_.at(i).clear();
+    ots_receiver_16_.at(i).clear();
+    ots_sender_32_.at(i).clear();
+    ots_receiver_32_.at(i).clear();
+    ots_sender_64_.at(i).clear();
+    ots_receiver_64_.at(i).clear();
+    bit_ots_sender_.at(i).clear();
+    bit_ots_receiver_.at(i).clear();
+  }
+}
+
 static void GenerateRandomTriplesBool(BinaryMtVector& bit_mts, std::size_t number_of_bit_mts) {
   if (number_of_bit_mts > 0u) {
     bit_mts.a = BitVector<>::SecureRandom(number_of_bit_mts);
@@ -174,14 +198,19 @@ static void GenerateRandomTriples(IntegerMtVector<T>& mts, std::size_t number_of
   }
 }
 
-static void RegisterHelperBool(OtProvider& ot_provider, std::unique_ptr<XcOtBitSender>& ots_sender,
-                               std::unique_ptr<XcOtBitReceiver>& ots_receiver,
-                               const BinaryMtVector& bit_mts, std::size_t number_of_bit_mts) {
-  ots_sender = ot_provider.RegisterSendXcOtBit(number_of_bit_mts);
-  ots_receiver = ot_provider.RegisterReceiveXcOtBit(number_of_bit_mts);
-
-  ots_sender->SetCorrelations(bit_mts.a);
-  ots_receiver->SetChoices(bit_mts.b);
+static void RegisterHelperBool(OtProvider& ot_provider,
+                               std::vector<std::unique_ptr<XcOtBitSender>>& ots_sender,
+                               std::vector<std::unique_ptr<XcOtBitReceiver>>& ots_receiver,
+                               const BinaryMtVector& bit_mts, std::size_t number_of_bit_mts,
+                               std::size_t chunk_size) {
+  for (std::size_t mt_id = 0; mt_id < number_of_bit_mts; mt_id += chunk_size) {
+    const auto mt_end = std::min(mt_id + chunk_size, number_of_bit_mts);
+    auto& ot_sender = ots_sender.emplace_back(ot_provider.RegisterSendXcOtBit(mt_end - mt_id));
+    auto& ot_receiver =
+        ots_receiver.emplace_back(ot_provider.RegisterReceiveXcOtBit(mt_end - mt_id));
+    ot_sender->SetCorrelations(bit_mts.a.Subset(mt_id, mt_end));
+    ot_receiver->SetChoices(bit_mts.b.Subset(mt_id, mt_end));
+  }
 }
 
 template <typename T>
@@ -240,7 +269,7 @@ void MtProviderFromOts::RegisterOts() {
     }
     if (number_of_bit_mts_ > 0) {
       RegisterHelperBool(*ot_providers_.at(i), bit_ots_sender_.at(i), bit_ots_receiver_.at(i),
-                         bit_mts_, number_of_bit_mts_);
+                         bit_mts_, number_of_bit_mts_, GetBinaryChunkSize());
     }
     RegisterHelper<std::uint8_t>(*ot_providers_.at(i), ots_sender_8_.at(i), ots_receiver_8_.at(i),
                                  kMaxBatchSize, mts8_, number_of_mts_8_);
@@ -253,15 +282,12 @@ void MtProviderFromOts::RegisterOts() {
   }
 }
 
-static void ParseHelperBool(std::unique_ptr<XcOtBitSender>& ots_sender,
-                            std::unique_ptr<XcOtBitReceiver>& ots_receiver,
-                            BinaryMtVector& bit_mts) {
-  ots_sender->ComputeOutputs();
-  ots_receiver->ComputeOutputs();
-  const auto& output_sender = ots_sender->GetOutputs();
-  const auto& output_receiver = ots_receiver->GetOutputs();
-  bit_mts.c ^= output_sender;
-  bit_mts.c ^= output_receiver;
+static void ParseHelperBool(XcOtBitSender& ot_sender, XcOtBitReceiver& ot_receiver,
+                            BitVector<>& c) {
+  ot_sender.ComputeOutputs();
+  ot_receiver.ComputeOutputs();
+  c ^= ot_sender.GetOutputs();
+  c ^= ot_receiver.GetOutputs();
 }
 
 template <typename T>
@@ -297,9 +323,6 @@ void MtProviderFromOts::ParseOutputs() {
       continue;
     }
 
-    if (number_of_bit_mts_ > 0) {
-      ParseHelperBool(bit_ots_sender_.at(i), bit_ots_receiver_.at(i), bit_mts_);
-    }
     ParseHelper<std::uint8_t>(ots_sender_8_.at(i), ots_receiver_8_.at(i), kMaxBatchSize, mts8_,
                               number_of_mts_8_);
     ParseHelper<std::uint16_t>(ots_sender_16_.at(i), ots_receiver_16_.at(i), kMaxBatchSize, mts16_,
@@ -311,4 +334,52 @@ void MtProviderFromOts::ParseOutputs() {
   }
 }
 
+std::size_t MtProviderFromOts::GetBinaryChunkSize() const noexcept {
+  if (binary_chunk_size_ == 0 || binary_chunk_size_ >= number_of_bit_mts_) {
+    return std::max(number_of_bit_mts_, std::size_t(1));
+  }
+  // chunks of whole blocks s.t. the chunks do not share bytes of bit_mts_.c, which is read by the
+  // online phase while later chunks are written
+  return (binary_chunk_size_ + 127) / 128 * 128;
+}
+
+void MtProviderFromOts::GenerateBinaryMts() {
+  if (number_of_bit_mts_ == 0) return;
+  const auto chunk_size = GetBinaryChunkSize();
+  const auto number_of_chunks = (number_of_bit_mts_ + chunk_size - 1) / chunk_size;
+
+  // the messages of a chunk are sent as soon as its OTs are extended, which may happen before the
+  // OT extension of the later chunks is finished
+  for (std::size_t chunk = 0; chunk < number_of_chunks; ++chunk) {
+    for (auto i = 0ull; i < number_of_parties_; ++i) {
+      if (i == my_id_) continue;
+      assert(bit_ots_receiver_.at(i).size() == bit_ots_sender_.at(i).size());
+      bit_ots_receiver_.at(i).at(chunk)->SendCorrections();
+      bit_ots_sender_.at(i).at(chunk)->SendMessages();
+    }
+
+    if (number_of_chunks == 1) {
+      for (auto i = 0ull; i < number_of_parties_; ++i) {
+        if (i == my_id_) continue;
+        ParseHelperBool(*bit_ots_sender_.at(i).at(0), *bit_ots_receiver_.at(i).at(0), bit_mts_.c);
+      }
+      break;
+    }
+
+    const auto mt_id = chunk * chunk_size;
+    const auto mt_end = std::min(mt_id + chunk_size, number_of_bit_mts_);
+    auto c = bit_mts_.c.Subset(mt_id, mt_end);
+    for (auto i = 0ull; i < number_of_parties_; ++i) {
+      if (i == my_id_) continue;
+      ParseHelperBool(*bit_ots_sender_.at(i).at(chunk), *bit_ots_receiver_.at(i).at(chunk), c);
+    }
+    {
+      std::scoped_lock lock(finished_condition_->GetMutex());
+      bit_mts_.c.Copy(mt_id, mt_end, c);
+      number_of_ready_bit_mts_ = mt_end;
+    }
+    finished_condition_->NotifyAll();
+  }
+}
+
 }  // namespace encrypto::motion
@@ -96,6 +96,15 @@ class MtProvider {
 
   const BinaryMtVector& GetBinaryAll() const noexcept;
 
+  // blocking wait until the bits [offset, offset + n) are ready, which may happen before
+  // WaitFinished() returns if the binary MTs are generated in chunks
+  void WaitBinary(const std::size_t offset, const std::size_t n) const;
+
+  // generate and publish the binary MTs in chunks of at least chunk_size MTs, 0 for a single chunk
+  void SetBinaryChunkSize(const std::size_t chunk_size) noexcept {
+    binary_chunk_size_ = chunk_size;
+  }
+
   template <typename T, typename = std::enable_if_t<std::is_unsigned_v<T>>>
   IntegerMtVector<T> GetInteger(const std::size_t offset, const std::size_t n = 1) const {
     WaitFinished();
@@ -131,6 +140,10 @@ class MtProvider {
   virtual void PreSetup() = 0;
   virtual void Setup() = 0;
 
+  // discards the generated MTs such that the next PreSetup() and Setup() generate fresh MTs for
+  // the same requests, i.e., the offsets returned by Request*Mts() remain valid
+  virtual void Clear() = 0;
+
   // blocking wait
   void WaitFinished() const { finished_condition_->Wait(); }
 
@@ -151,7 +164,11 @@ class MtProvider {
   const std::size_t my_id_;
   const std::size_t number_of_parties_;
 
+  std::size_t binary_chunk_size_{0};
+
   std::atomic<bool> finished_{false};
+  // guarded by the mutex of finished_condition_
+  std::atomic<std::size_t> number_of_ready_bit_mts_{0};
   std::shared_ptr<FiberCondition> finished_condition_;
 
  private:
@@ -176,14 +193,21 @@ class MtProviderFromOts final : public MtProvider {
 
   void PreSetup() final override;
 
-  // needs completed OTExtension
+  // needs the OT extension, waits for the OTs of each chunk of binary MTs separately
   void Setup() final override;
 
+  void Clear() final override;
+
  private:
   void RegisterOts();
 
   void ParseOutputs();
 
+  // generates the binary MTs chunk by chunk and publishes each chunk as soon as it is ready
+  void GenerateBinaryMts();
+
+  std::size_t GetBinaryChunkSize() const noexcept;
+
   std::vector<std::unique_ptr<OtProvider>>& ot_providers_;
 
   // use alternating party roles for load balancing
@@ -199,8 +223,9 @@ class MtProviderFromOts final : public MtProvider {
   std::vector<std::list<std::unique_ptr<BasicOtReceiver>>> ots_receiver_64_;
   std::vector<std::list<std::unique_ptr<BasicOtSender>>> ots_sender_64_;
 
-  std::vector<std::unique_ptr<XcOtBitReceiver>> bit_ots_receiver_;
-  std::vector<std::unique_ptr<XcOtBitSender>> bit_ots_sender_;
+  // one OT per chunk of binary MTs
+  std::vector<std::vector<std::unique_ptr<XcOtBitReceiver>>> bit_ots_receiver_;
+  std::vector<std::vector<std::unique_ptr<XcOtBitSender>>> bit_ots_sender_;
 
   // Should be divisible by 128
   static inline constexpr std::size_t kMaxBatchSize{128 * 128};
@@ -156,10 +156,10 @@ static std::vector<std::uint8_t> Scatter(std::vector<std::uint16_t>& ds_8,
   auto size_32 = GetByteSize(ds_32);
   [[maybe_unused]] auto size_64 = GetByteSize(ds_64);
 
-  assert(communication::GetMessage(buffer.data())->payload()->size() ==
+  assert(communication::GetMessage(buffer)->payload()->size() ==
          size_8 + size_16 + size_32 + size_64);
 
-  const std::uint8_t* pointer{communication::GetMessage(buffer.data())->payload()->data()};
+  const std::uint8_t* pointer{communication::GetMessage(buffer)->payload()->data()};
 
   auto start_8 = reinterpret_cast<const std::uint16_t*>(pointer);
   auto start_16 = reinterpret_cast<const std::uint32_t*>(pointer + size_8);
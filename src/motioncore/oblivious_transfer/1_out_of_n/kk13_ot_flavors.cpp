@@ -171,7 +171,7 @@ void GKk13Ot128Sender::SendMessages() {
 
   assert(corrections_future_.valid());
   auto corrections_msg{corrections_future_.get()};
-  const auto corrections{communication::GetMessage(corrections_msg.data())->payload()->data()};
+  const auto corrections{communication::GetMessage(corrections_msg)->payload()->data()};
 
   for (std::size_t i = 0; i < number_of_ots_; ++i) {
     if (corrections[i]) {
@@ -215,7 +215,7 @@ void GKk13Ot128Receiver::ComputeOutputs() {
   }
   assert(sender_message_future_.valid());
   auto sender_message = sender_message_future_.get();
-  auto payload = communication::GetMessage(sender_message.data())->payload();
+  auto payload = communication::GetMessage(sender_message)->payload();
 
 
   // get subset from random_choices
@@ -246,7 +246,7 @@ void GKk13OtBitSender::SendMessages() {
   std::vector<bool> b(number_of_messages_);
 
   auto corrections_msg{corrections_future_.get()};
-  const auto corrections{communication::GetMessage(corrections_msg.data())->payload()->data()};
+  const auto corrections{communication::GetMessage(corrections_msg)->payload()->data()};
 
   for (std::size_t i = 0; i < number_of_ots_; ++i) {
     for (std::size_t j = 0; j < number_of_messages_; ++j) {
@@ -283,7 +283,7 @@ void GKk13OtBitReceiver::ComputeOutputs() {
     throw std::runtime_error("Choices in OT must be se(n)t before calling ComputeOutputs()");
   }
   auto sender_message = sender_message_future_.get();
-  auto payload = communication::GetMessage(sender_message.data())->payload();
+  auto payload = communication::GetMessage(sender_message)->payload();
 
   // get subset from random_choices
   std::vector<std::uint8_t> random_choices_subset(number_of_ots_);
@@ -312,7 +312,7 @@ void GKk13OtSender::SendMessages() {
 
   assert(corrections_future_.valid());
   auto corrections_msg{corrections_future_.get()};
-  const auto corrections{communication::GetMessage(corrections_msg.data())->payload()->data()};
+  const auto corrections{communication::GetMessage(corrections_msg)->payload()->data()};
 
   BitVector<> buffer;
   buffer.Reserve(number_of_ots_ * bitlen_ * number_of_messages_);
@@ -351,7 +351,7 @@ void GKk13OtReceiver::ComputeOutputs() {
   }
   assert(sender_message_future_.valid());
   auto sender_message = sender_message_future_.get();
-  auto payload = communication::GetMessage(sender_message.data())->payload();
+  auto payload = communication::GetMessage(sender_message)->payload();
 
   // get subset from random_choices
   std::vector<std::uint8_t> random_choices_subset(number_of_ots_);
@@ -25,6 +25,7 @@
 #include "kk13_ot_provider.h"
 #include "kk13_ot_flavors.h"
 
+#include <algorithm>
 #include <cmath>
 #include <span>
 
@@ -92,10 +93,10 @@ Kk13OtProvider::Kk13OtProvider(Kk13OtExtensionData& data, BaseProvider& motion_b
 Kk13OtProviderFromKk13OtExtension::Kk13OtProviderFromKk13OtExtension(
     Kk13OtExtensionData& data, BaseOtProvider& base_ot_provider, BaseProvider& motion_base_provider)
     : Kk13OtProvider(data, motion_base_provider), base_ot_provider_(base_ot_provider) {
-  for (std::size_t i = 0; i < data_.sender_data.u_futures.size(); ++i) {
-    data_.sender_data.u_futures[i] = data_.message_manager.RegisterReceive(
-        data_.party_id, communication::MessageType::kKK13OtExtensionReceiverMasks, i);
-  }
+  auto u_futures{data_.message_manager.RegisterReceiveRange(
+      data_.party_id, communication::MessageType::kKK13OtExtensionReceiverMasks, 0,
+      data_.sender_data.u_futures.size())};
+  std::move(u_futures.begin(), u_futures.end(), data_.sender_data.u_futures.begin());
   data_.receiver_data.key_future = data_.message_manager.RegisterReceive(
       data_.party_id, communication::MessageType::kKK13OtExtensionMaskSeed, 0);
 }
@@ -196,8 +197,7 @@ void Kk13OtProviderFromKk13OtExtension::SendSetup() {
 
   // generate an AES key for mask function
   std::array<std::byte, kKappa> key;
-  encrypto::motion::DefaultRng rng;
-  rng.RandomBytes(key.data(), key.size());
+  encrypto::motion::DefaultRng::GetThreadInstance().RandomBytes(key.data(), key.size());
 
   data_.send_function(communication::BuildMessage(
       communication::MessageType::kKK13OtExtensionMaskSeed,
@@ -232,7 +232,7 @@ void Kk13OtProviderFromKk13OtExtension::SendSetup() {
     auto raw_message{data_.sender_data.u_futures[i].get()};
     if (base_ots_receiver_data.c[data_.base_ot_offset + i]) {
       BitSpan bit_span_u(const_cast<std::uint8_t*>(
-                             communication::GetMessage(raw_message.data())->payload()->data()),
+                             communication::GetMessage(raw_message)->payload()->data()),
                          bit_size);
       BitSpan bit_span_v(v[i].GetMutableData().data(), bit_size, true);
       bit_span_v ^= bit_span_u;
@@ -345,7 +345,7 @@ void Kk13OtProviderFromKk13OtExtension::ReceiveSetup() {
   // prepare PRG for mask function
   primitives::Prg prg_mask;
   auto key = data_.receiver_data.key_future.get();
-  prg_mask.SetKey(communication::GetMessage(key.data())->payload()->data());
+  prg_mask.SetKey(communication::GetMessage(key)->payload()->data());
 
   // mask random choices as X(random_choices)
   auto x_c =
@@ -25,17 +25,41 @@
 #include "base_ot_provider.h"
 #include "ot_hl17.h"
 
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
 #include "base/configuration.h"
 #include "base/register.h"
 #include "communication/communication_layer.h"
 #include "communication/fbs_headers/message_generated.h"
 #include "communication/message_manager.h"
 #include "data_storage/base_ot_data.h"
+#include "primitives/blake2b.h"
+#include "primitives/random/seeded_random_stream.h"
 #include "utility/fiber_condition.h"
 #include "utility/logger.h"
 
 namespace encrypto::motion {
 
+namespace {
+
+// hash of the message of a base OT and the id of the session it is derived for
+std::array<std::byte, 16> DeriveBaseOtMessage(const std::array<std::byte, 16>& message,
+                                              std::uint32_t session_id) {
+  std::array<std::uint8_t, sizeof(message) + sizeof(session_id)> hash_input;
+  std::memcpy(hash_input.data(), message.data(), sizeof(message));
+  std::memcpy(hash_input.data() + sizeof(message), &session_id, sizeof(session_id));
+  std::array<std::uint8_t, EVP_MAX_MD_SIZE> hash_output;
+  Blake2b(hash_input.data(), hash_output.data(), hash_input.size());
+  std::array<std::byte, 16> derived_message;
+  std::memcpy(derived_message.data(), hash_output.data(), derived_message.size());
+  return derived_message;
+}
+
+}  // namespace
+
 // Implementation of BaseOtProvider: -------------------------------------------
 
 BaseOtProvider::BaseOtProvider(communication::CommunicationLayer& communication_layer)
@@ -43,6 +67,8 @@ BaseOtProvider::BaseOtProvider(communication::CommunicationLayer& communication_
       number_of_parties_(communication_layer_.GetNumberOfParties()),
       my_id_(communication_layer_.GetMyId()),
       data_(number_of_parties_),
+      number_of_derived_ots_(number_of_parties_, 0),
+      next_derived_ot_(number_of_parties_, 0),
       logger_(communication_layer_.GetLogger()) {
   number_of_ots_.resize(number_of_parties_ - 1, 0);
 }
@@ -67,6 +93,8 @@ void BaseOtProvider::PreSetup() {
 }
 
 bool BaseOtProvider::HasWork() {
+  // the base OTs are computed once and reused by the OT extensions of later evaluations
+  if (IsOnlineReady()) return false;
   for (auto n : number_of_ots_) {
     if (n != 0) return true;
   }
@@ -80,16 +108,18 @@ std::vector<std::size_t> BaseOtProvider::Request(std::size_t number_of_ots) {
     if (party_id == my_id_) {
       continue;
     }
-    std::size_t remapped_party_id{party_id > my_id_ ? party_id - 1 : party_id};
-    number_of_ots_.at(remapped_party_id) += number_of_ots;
-    offsets.at(party_id) = data_.at(party_id).total_number_ots;
-    data_.at(party_id).Add(number_of_ots);
+    offsets.at(party_id) = Request(number_of_ots, party_id);
   }
   return offsets;
 }
 
 std::size_t BaseOtProvider::Request(std::size_t number_of_ots, std::size_t party_id) {
   assert(party_id < number_of_parties_);
+  if (next_derived_ot_.at(party_id) + number_of_ots <= number_of_derived_ots_.at(party_id)) {
+    const std::size_t offset{next_derived_ot_.at(party_id)};
+    next_derived_ot_.at(party_id) += number_of_ots;
+    return offset;
+  }
   std::size_t remapped_party_id{party_id > my_id_ ? party_id - 1 : party_id};
   number_of_ots_.at(remapped_party_id) += number_of_ots;
   auto offset = data_.at(party_id).total_number_ots;
@@ -106,6 +136,7 @@ void BaseOtProvider::ComputeBaseOts() {
 
   std::vector<std::future<void>> task_futures;
   std::vector<std::unique_ptr<OtHL17>> base_ots;
+  const auto random_seed{SeededRandomStream::GetCurrentSeed()};
 
   task_futures.reserve(2 * (number_of_parties_ - 1));
   base_ots.reserve(number_of_parties_);
@@ -123,30 +154,39 @@ void BaseOtProvider::ComputeBaseOts() {
     auto& base_ots_data = data_.at(i);
     base_ots.emplace_back(std::make_unique<OtHL17>(send_function, base_ots_data));
     std::size_t remapped_party_id{i > my_id_ ? i - 1 : i};
+    // all base OTs with this party were imported
+    if (number_of_ots_.at(remapped_party_id) == 0) continue;
+    // the requested base OTs follow the imported ones
+    const std::size_t offset{base_ots_data.total_number_ots -
+                             number_of_ots_.at(remapped_party_id)};
 
     task_futures.emplace_back(
-        std::async(std::launch::async, [this, &base_ots, i, remapped_party_id] {
+        std::async(std::launch::async, [this, &base_ots, &random_seed, i, remapped_party_id,
+                                        offset] {
+          auto random_stream{
+              MakeSeededRandomStream(random_seed, fmt::format("base ot receiver {}", i))};
           auto choices = BitVector<>::SecureRandom(number_of_ots_.at(remapped_party_id));
           auto chosen_messages = base_ots[i]->Receive(choices);  // sender base ots
           auto& receiver_data = data_[i].GetReceiverData();
-          receiver_data.c = std::move(choices);
+          receiver_data.c.Append(std::move(choices));
           for (std::size_t i = 0; i < chosen_messages.size(); ++i) {
-            auto b = receiver_data.messages_c.at(i).begin();
+            auto b = receiver_data.messages_c.at(offset + i).begin();
             std::copy(chosen_messages.at(i).begin(), chosen_messages.at(i).begin() + 16, b);
           }
         }));
 
-    task_futures.emplace_back(std::async(std::launch::async, [this, &base_ots, i,
-                                                              remapped_party_id] {
+    task_futures.emplace_back(std::async(std::launch::async, [this, &base_ots, &random_seed, i,
+                                                              remapped_party_id, offset] {
+      auto random_stream{MakeSeededRandomStream(random_seed, fmt::format("base ot sender {}", i))};
       auto both_messages =
           base_ots[i]->Send(number_of_ots_.at(remapped_party_id));  // receiver base ots
       auto& sender_data = data_[i].GetSenderData();
       for (std::size_t i = 0; i < both_messages.size(); ++i) {
-        auto b = sender_data.messages_0.at(i).begin();
+        auto b = sender_data.messages_0.at(offset + i).begin();
         std::copy(both_messages.at(i).first.begin(), both_messages.at(i).first.begin() + 16, b);
       }
       for (std::size_t i = 0; i < both_messages.size(); ++i) {
-        auto b = sender_data.messages_1.at(i).begin();
+        auto b = sender_data.messages_1.at(offset + i).begin();
         std::copy(both_messages.at(i).second.begin(), both_messages.at(i).second.begin() + 16, b);
       }
     }));
@@ -162,72 +202,81 @@ void BaseOtProvider::ComputeBaseOts() {
   }
 }
 
-void BaseOtProvider::ImportBaseOts([[maybe_unused]] std::size_t party_id,
-                                   [[maybe_unused]] const ReceiverMessage& messages) {
-  // TODO
-  throw std::runtime_error("Not completely implemented yet"); /*
-   auto& receiver_data = data_.at(party_id).GetReceiverData();
-   if (receiver_data.is_ready)
-     throw std::runtime_error(
-         fmt::format("Found previously computed receiver base OTs for Party#{}", party_id));
-
-   receiver_data.c = messages.c;
-   receiver_data.messages_c = messages.messages_c;
-
-   {
-     std::scoped_lock lock(receiver_data.is_ready_condition->GetMutex());
-     receiver_data.is_ready = true;
-   }
-   receiver_data.is_ready_condition->NotifyAll();*/
+void BaseOtProvider::ImportBaseOts(std::size_t party_id, const ReceiverMessage& messages) {
+  auto& base_ot_data{GetImportTarget(party_id, messages.messages_c.size())};
+  if (messages.c.GetSize() != messages.messages_c.size()) {
+    throw std::invalid_argument(fmt::format("{} choice bits do not match {} receiver base OTs",
+                                            messages.c.GetSize(), messages.messages_c.size()));
+  }
+  auto& receiver_data{base_ot_data.GetReceiverData()};
+  receiver_data.c = messages.c;
+  receiver_data.messages_c = messages.messages_c;
+  base_ot_data.total_number_ots = messages.messages_c.size();
 }
 
-void BaseOtProvider::ImportBaseOts([[maybe_unused]] std::size_t party_id,
-                                   [[maybe_unused]] const SenderMessage& messages) {
-  // TODO
-  throw std::runtime_error("Not completely implemented yet"); /*
-   auto& sender_data = data_.at(party_id).GetSenderData();
-   if (sender_data.is_ready)
-     throw std::runtime_error(
-         fmt::format("Found previously computed sender base OTs for Party#{}", party_id));
-
-   sender_data.messages_0 = messages.messages_0;
-   sender_data.messages_1 = messages.messages_1;
-
-   {
-     std::scoped_lock lock(sender_data.is_ready_condition->GetMutex());
-     sender_data.is_ready = true;
-   }
-   sender_data.is_ready_condition->NotifyAll();*/
+void BaseOtProvider::ImportBaseOts(std::size_t party_id, const SenderMessage& messages) {
+  auto& base_ot_data{GetImportTarget(party_id, messages.messages_0.size())};
+  if (messages.messages_1.size() != messages.messages_0.size()) {
+    throw std::invalid_argument(fmt::format("{} and {} sender base OT messages do not match",
+                                            messages.messages_0.size(),
+                                            messages.messages_1.size()));
+  }
+  auto& sender_data{base_ot_data.GetSenderData()};
+  sender_data.messages_0 = messages.messages_0;
+  sender_data.messages_1 = messages.messages_1;
+  base_ot_data.total_number_ots = messages.messages_0.size();
 }
 
-std::pair<ReceiverMessage, SenderMessage> BaseOtProvider::ExportBaseOts(
-    [[maybe_unused]] std::size_t party_id) {
-  // TODO
-  throw std::runtime_error("Not completely implemented yet"); /*
-   if (party_id == my_id_)
-     throw std::runtime_error("Base OTs export is only possible for other parties");
-
-   auto& base_ot_data = data_.at(party_id);
-   auto& receiver_data = base_ot_data.GetReceiverData();
-   auto& sender_data = base_ot_data.GetSenderData();
-
-   if (!receiver_data.is_ready)
-     throw std::runtime_error(
-         fmt::format("Trying to export non-existing receiver base OTs for Party#{}", party_id));
-
-   if (!sender_data.is_ready)
-     throw std::runtime_error(
-         fmt::format("Trying to export non-existing sender base OTs for Party#{}", party_id));
-
-   std::pair<ReceiverMessage, SenderMessage> base_ots;
-
-   std::get<0>(base_ots).c = receiver_data.c;
-   std::get<0>(base_ots).messages_c = receiver_data.messages_c;
+std::pair<ReceiverMessage, SenderMessage> BaseOtProvider::ExportBaseOts(std::size_t party_id) {
+  if (party_id == my_id_ || party_id >= number_of_parties_) {
+    throw std::invalid_argument(fmt::format("Cannot export base OTs with Party#{}", party_id));
+  }
+  std::size_t remapped_party_id{party_id > my_id_ ? party_id - 1 : party_id};
+  if (!IsOnlineReady() && number_of_ots_.at(remapped_party_id) != 0) {
+    throw std::logic_error(
+        fmt::format("The base OTs with Party#{} have not been computed yet", party_id));
+  }
+  const auto& base_ot_data{data_.at(party_id)};
+  return {ReceiverMessage{base_ot_data.GetReceiverData().messages_c,
+                          base_ot_data.GetReceiverData().c},
+          SenderMessage{base_ot_data.GetSenderData().messages_0,
+                        base_ot_data.GetSenderData().messages_1}};
+}
 
-   std::get<1>(base_ots).messages_0 = sender_data.messages_0;
-   std::get<1>(base_ots).messages_1 = sender_data.messages_1;
+void BaseOtProvider::DeriveBaseOts(BaseOtProvider& source, std::uint32_t session_id) {
+  if (source.number_of_parties_ != number_of_parties_ || source.my_id_ != my_id_) {
+    throw std::invalid_argument("Cannot derive base OTs from the base OTs of another party");
+  }
+  for (std::size_t party_id = 0; party_id < number_of_parties_; ++party_id) {
+    if (party_id == my_id_) continue;
+    auto [receiver_messages, sender_messages] = source.ExportBaseOts(party_id);
+    for (auto* messages : {&receiver_messages.messages_c, &sender_messages.messages_0,
+                           &sender_messages.messages_1}) {
+      for (auto& message : *messages) message = DeriveBaseOtMessage(message, session_id);
+    }
+    ImportBaseOts(party_id, receiver_messages);
+    ImportBaseOts(party_id, sender_messages);
+    number_of_derived_ots_.at(party_id) = receiver_messages.messages_c.size();
+  }
+}
 
-   return base_ots;*/
+BaseOtData& BaseOtProvider::GetImportTarget(std::size_t party_id, std::size_t number_of_ots) {
+  if (party_id == my_id_ || party_id >= number_of_parties_) {
+    throw std::invalid_argument(fmt::format("Cannot import base OTs with Party#{}", party_id));
+  }
+  std::size_t remapped_party_id{party_id > my_id_ ? party_id - 1 : party_id};
+  auto& base_ot_data{data_.at(party_id)};
+  // the imported OTs take the offsets starting at 0, so nothing may have been requested yet
+  if (number_of_ots_.at(remapped_party_id) != 0) {
+    throw std::logic_error(fmt::format(
+        "Base OTs with Party#{} have to be imported before any base OTs are requested", party_id));
+  }
+  if (base_ot_data.total_number_ots != 0 && base_ot_data.total_number_ots != number_of_ots) {
+    throw std::invalid_argument(fmt::format(
+        "Importing {} base OTs with Party#{}, but the other direction has {} base OTs",
+        number_of_ots, party_id, base_ot_data.total_number_ots));
+  }
+  return base_ot_data;
 }
 
 }  // namespace encrypto::motion
@@ -62,9 +62,26 @@ class BaseOtProvider : public FiberOnlineWaitable {
   BaseOtProvider(communication::CommunicationLayer&);
   ~BaseOtProvider();
   void ComputeBaseOts();
+
+  /// \brief Imports base OTs with party_id, e.g., exported by an earlier process, which take the
+  /// offsets [0, number of imported OTs). Both directions have to be imported with the same number
+  /// of OTs before any base OTs with party_id are requested. Base OTs requested later are computed
+  /// by ComputeBaseOts() and follow the imported ones.
   void ImportBaseOts(std::size_t party_id, const ReceiverMessage& messages);
   void ImportBaseOts(std::size_t party_id, const SenderMessage& messages);
+
+  /// \brief Returns copies of all imported and computed base OTs with party_id.
   std::pair<ReceiverMessage, SenderMessage> ExportBaseOts(std::size_t party_id);
+
+  /// \brief Derives base OTs with all other parties from those of source, e.g., of the Backend on
+  /// session 0, whose base OTs have to be computed already. The messages are hashed together with
+  /// session_id, so that the PRG streams of the sessions are independent, while the choice bits
+  /// and thereby the correlation of the OT extension senders are shared like among the OTs of a
+  /// single OT extension. Request() hands out the derived OTs before any new ones are computed, so
+  /// a session whose requests are covered runs no base OTs. All parties have to call it with the
+  /// same session_id before any base OTs are requested.
+  void DeriveBaseOts(BaseOtProvider& source, std::uint32_t session_id);
+
   BaseOtData& GetBaseOtsData(std::size_t party_id) { return data_.at(party_id); }
   const BaseOtData& GetBaseOtsData(std::size_t party_id) const { return data_.at(party_id); }
   void PreSetup();
@@ -82,9 +99,16 @@ class BaseOtProvider : public FiberOnlineWaitable {
   std::size_t number_of_parties_;
   std::size_t my_id_;
   std::vector<BaseOtData> data_;
+  // the base OTs with each party at the offsets [next_derived_ot_, number_of_derived_ots_) were
+  // derived by DeriveBaseOts and not requested yet
+  std::vector<std::size_t> number_of_derived_ots_;
+  std::vector<std::size_t> next_derived_ot_;
   std::shared_ptr<Logger> logger_;
 
   Logger& GetLogger();
+
+  // checks that number_of_ots base OTs can be imported with party_id
+  BaseOtData& GetImportTarget(std::size_t party_id, std::size_t number_of_ots);
 };
 
 }  // namespace encrypto::motion
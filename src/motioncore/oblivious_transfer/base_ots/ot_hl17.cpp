@@ -218,7 +218,7 @@ std::vector<std::pair<std::vector<std::byte>, std::vector<std::byte>>> OtHL17::S
 
   for (std::size_t i = 0; i < number_of_ots; ++i) {
     auto raw_message{base_ots_data_.receiver_futures[i].get()};
-    auto payload{communication::GetMessage(raw_message.data())->payload()};
+    auto payload{communication::GetMessage(raw_message)->payload()};
     output.at(i) = Send2(states.at(i), std::span(payload->data(), payload->size()));
   }
 
@@ -243,7 +243,7 @@ std::vector<std::vector<std::byte>> OtHL17::Receive(const BitVector<>& choices)
 
   for (std::size_t i = 0; i < number_of_ots; ++i) {
     auto raw_message{base_ots_data_.sender_futures[i].get()};
-    auto payload{communication::GetMessage(raw_message.data())->payload()};
+    auto payload{communication::GetMessage(raw_message)->payload()};
     Receive1(states[i], messages_r1[i], std::span(payload->data(), payload->size()));
     std::span s(reinterpret_cast<const std::uint8_t*>(messages_r1[i].data()),
                 messages_r1[i].size());
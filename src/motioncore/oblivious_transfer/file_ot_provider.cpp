@@ -0,0 +1,218 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "file_ot_provider.h"
+#include "base_ots/base_ot_provider.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <fmt/format.h>
+#include <openssl/evp.h>
+
+#include "data_storage/base_ot_data.h"
+#include "data_storage/ot_extension_data.h"
+#include "primitives/random/default_rng.h"
+#include "utility/constants.h"
+
+namespace encrypto::motion {
+
+namespace {
+
+// a file starts with this magic value, which is also authenticated, followed by the nonce, the
+// encrypted state and the tag of AES-128-GCM
+constexpr std::array<char, 8> kFileMagic = {'M', 'O', 'T', 'I', 'O', 'N', 'O', 'T'};
+constexpr std::size_t kNonceSize{12};
+constexpr std::size_t kTagSize{16};
+
+// the state starts with this header in host byte order, followed by the kKappa choice bits of the
+// receiver base OTs and the kKappa messages of messages_c, messages_0 and messages_1 each
+struct StateHeader {
+  std::uint64_t party_id;
+  // positions in the PRG streams of the base OTs at which the next OT extension starts
+  std::uint64_t sender_position;
+  std::uint64_t receiver_position;
+};
+
+constexpr std::size_t kMessagesSize{kKappa * 16};
+constexpr std::size_t kStateSize{sizeof(StateHeader) + kKappa / 8 + 3 * kMessagesSize};
+
+using CipherContextPointer = std::unique_ptr<EVP_CIPHER_CTX, decltype(&EVP_CIPHER_CTX_free)>;
+
+CipherContextPointer MakeCipherContext(bool encrypt, const OtProviderFromFile::Key& key,
+                                       const std::uint8_t* nonce) {
+  CipherContextPointer context(EVP_CIPHER_CTX_new(), &EVP_CIPHER_CTX_free);
+  const auto key_pointer{reinterpret_cast<const unsigned char*>(key.data())};
+  int length;
+  if (!context ||
+      1 != EVP_CipherInit_ex(context.get(), EVP_aes_128_gcm(), nullptr, nullptr, nullptr,
+                             encrypt) ||
+      1 != EVP_CIPHER_CTX_ctrl(context.get(), EVP_CTRL_GCM_SET_IVLEN, kNonceSize, nullptr) ||
+      1 != EVP_CipherInit_ex(context.get(), nullptr, nullptr, key_pointer, nonce, encrypt) ||
+      1 != EVP_CipherUpdate(context.get(), nullptr, &length,
+                            reinterpret_cast<const unsigned char*>(kFileMagic.data()),
+                            kFileMagic.size())) {
+    throw std::runtime_error("Could not initialize AES-128-GCM");
+  }
+  return context;
+}
+
+std::vector<std::uint8_t> Seal(const OtProviderFromFile::Key& key,
+                               const std::vector<std::uint8_t>& state) {
+  std::vector<std::uint8_t> file(kFileMagic.size() + kNonceSize + state.size() + kTagSize);
+  std::memcpy(file.data(), kFileMagic.data(), kFileMagic.size());
+  std::uint8_t* nonce{file.data() + kFileMagic.size()};
+  DefaultRng::GetThreadInstance().RandomBytes(reinterpret_cast<std::byte*>(nonce), kNonceSize);
+  std::uint8_t* ciphertext{nonce + kNonceSize};
+  auto context{MakeCipherContext(true, key, nonce)};
+  int length;
+  if (1 != EVP_CipherUpdate(context.get(), ciphertext, &length, state.data(), state.size()) ||
+      1 != EVP_CipherFinal_ex(context.get(), ciphertext + length, &length) ||
+      1 != EVP_CIPHER_CTX_ctrl(context.get(), EVP_CTRL_GCM_GET_TAG, kTagSize,
+                               ciphertext + state.size())) {
+    throw std::runtime_error("Could not encrypt the OT state");
+  }
+  return file;
+}
+
+std::vector<std::uint8_t> Open(const OtProviderFromFile::Key& key,
+                               const std::vector<std::uint8_t>& file, const std::string& path) {
+  if (file.size() != kFileMagic.size() + kNonceSize + kStateSize + kTagSize ||
+      std::memcmp(file.data(), kFileMagic.data(), kFileMagic.size()) != 0) {
+    throw std::runtime_error(fmt::format("{} contains no OT state", path));
+  }
+  const std::uint8_t* nonce{file.data() + kFileMagic.size()};
+  const std::uint8_t* ciphertext{nonce + kNonceSize};
+  std::vector<std::uint8_t> tag(ciphertext + kStateSize, ciphertext + kStateSize + kTagSize);
+  std::vector<std::uint8_t> state(kStateSize);
+  auto context{MakeCipherContext(false, key, nonce)};
+  int length;
+  if (1 != EVP_CipherUpdate(context.get(), state.data(), &length, ciphertext, kStateSize) ||
+      1 != EVP_CIPHER_CTX_ctrl(context.get(), EVP_CTRL_GCM_SET_TAG, kTagSize, tag.data()) ||
+      1 != EVP_CipherFinal_ex(context.get(), state.data() + length, &length)) {
+    throw std::runtime_error(
+        fmt::format("The OT state in {} is corrupted or encrypted with another key", path));
+  }
+  return state;
+}
+
+}  // namespace
+
+OtProviderFromFile::OtProviderFromFile(OtExtensionData& data, BaseOtProvider& base_ot_provider,
+                                       BaseProvider& motion_base_provider, std::string path,
+                                       const Key& key)
+    : OtProviderFromOtExtension(data, base_ot_provider, motion_base_provider, data.party_id),
+      base_ot_provider_(base_ot_provider),
+      path_(std::move(path)),
+      key_(key) {
+  Load();
+}
+
+void OtProviderFromFile::SendSetup() {
+  Save();
+  OtProviderFromOtExtension::SendSetup();
+}
+
+void OtProviderFromFile::ReceiveSetup() {
+  Save();
+  OtProviderFromOtExtension::ReceiveSetup();
+}
+
+void OtProviderFromFile::Load() {
+  std::ifstream file(path_, std::ios::binary);
+  // nothing was persisted yet, the base OTs are computed and saved before the first OT extension
+  if (!file) return;
+  const std::vector<std::uint8_t> contents{std::istreambuf_iterator<char>(file),
+                                           std::istreambuf_iterator<char>()};
+  const auto state{Open(key_, contents, path_)};
+
+  StateHeader header;
+  std::memcpy(&header, state.data(), sizeof(header));
+  if (header.party_id != data_.party_id) {
+    throw std::runtime_error(fmt::format("{} contains the OT state with Party#{} instead of #{}",
+                                         path_, header.party_id, data_.party_id));
+  }
+  const auto* pointer{reinterpret_cast<const std::byte*>(state.data()) + sizeof(header)};
+  ReceiverMessage receiver_messages{BaseOtMessages(kKappa), BitVector<>(pointer, kKappa)};
+  pointer += kKappa / 8;
+  SenderMessage sender_messages{BaseOtMessages(kKappa), BaseOtMessages(kKappa)};
+  for (auto* messages : {&receiver_messages.messages_c, &sender_messages.messages_0,
+                         &sender_messages.messages_1}) {
+    std::memcpy(messages->data(), pointer, kMessagesSize);
+    pointer += kMessagesSize;
+  }
+  base_ot_provider_.ImportBaseOts(data_.party_id, receiver_messages);
+  base_ot_provider_.ImportBaseOts(data_.party_id, sender_messages);
+
+  // the streams continue at the saved positions, which include the base OT offset
+  data_.base_ot_offset = 0;
+  data_.sender_data.consumed_offset = header.sender_position;
+  data_.receiver_data.consumed_offset = header.receiver_position;
+  loaded_ = true;
+}
+
+void OtProviderFromFile::Save() {
+  // no OT extension with this party
+  if (data_.base_ot_offset == std::numeric_limits<std::size_t>::max()) return;
+  std::scoped_lock lock(save_mutex_);
+
+  const auto [receiver_messages, sender_messages] = base_ot_provider_.ExportBaseOts(data_.party_id);
+  const std::size_t first{data_.base_ot_offset};
+  // reserve the stream blocks of the upcoming OT extensions, which are consumed in Clear()
+  const StateHeader header{
+      data_.party_id,
+      first + data_.sender_data.consumed_offset + (GetNumOtsSender() + kKappa - 1) / kKappa,
+      first + data_.receiver_data.consumed_offset + (GetNumOtsReceiver() + kKappa - 1) / kKappa};
+  std::vector<std::uint8_t> state(kStateSize);
+  std::memcpy(state.data(), &header, sizeof(header));
+  auto* pointer{state.data() + sizeof(header)};
+  const auto choices{receiver_messages.c.Subset(first, first + kKappa)};
+  std::memcpy(pointer, choices.GetData().data(), kKappa / 8);
+  pointer += kKappa / 8;
+  for (const auto* messages : {&receiver_messages.messages_c, &sender_messages.messages_0,
+                               &sender_messages.messages_1}) {
+    std::memcpy(pointer, messages->data() + first, kMessagesSize);
+    pointer += kMessagesSize;
+  }
+  const auto contents{Seal(key_, state)};
+
+  // replace the file atomically, s.t. a crash leaves either the old or the new state
+  const std::string temporary_path{path_ + ".tmp"};
+  {
+    std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+    if (!file.write(reinterpret_cast<const char*>(contents.data()), contents.size()) ||
+        !file.flush()) {
+      throw std::runtime_error(fmt::format("cannot write the OT state to {}", temporary_path));
+    }
+  }
+  std::filesystem::rename(temporary_path, path_);
+}
+
+}  // namespace encrypto::motion
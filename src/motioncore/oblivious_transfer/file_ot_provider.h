@@ -0,0 +1,73 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <string>
+
+#include "ot_provider.h"
+
+namespace encrypto::motion {
+
+// IKNP OT extension whose base OTs and positions in the PRG streams of the base OTs are persisted
+// in a local file, such that later processes skip the base OTs and start with a file read. The
+// file is encrypted and authenticated with AES-128-GCM under a key of the caller and rewritten
+// before every OT extension, so the streams are never reused even if the process crashes.
+//
+// Both parties have to keep their files: if only one of them finds its file, the parties disagree
+// about the base OTs, so the files of both have to be deleted together.
+class OtProviderFromFile final : public OtProviderFromOtExtension {
+ public:
+  using Key = std::array<std::byte, 16>;
+
+  // loads the state from path if the file exists, throws std::runtime_error if it cannot be
+  // decrypted with key or belongs to another peer
+  OtProviderFromFile(OtExtensionData& data, BaseOtProvider& base_ot_provider,
+                     BaseProvider& motion_base_provider, std::string path, const Key& key);
+
+  void SendSetup() final;
+
+  void ReceiveSetup() final;
+
+  // true if the base OTs were loaded from the file instead of being computed
+  bool IsLoaded() const { return loaded_; }
+
+  const std::string& GetPath() const { return path_; }
+
+ private:
+  void Load();
+
+  // writes the base OTs and the stream positions after the upcoming OT extensions
+  void Save();
+
+  BaseOtProvider& base_ot_provider_;
+  const std::string path_;
+  const Key key_;
+  bool loaded_{false};
+  std::mutex save_mutex_;
+};
+
+}  // namespace encrypto::motion
@@ -0,0 +1,91 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ggm_tree.h"
+
+#include <array>
+
+#include "primitives/aes/aesni_primitives.h"
+
+namespace encrypto::motion {
+
+namespace {
+
+// fixed public AES keys of the two halves of the PRG, both parties have to use the same keys
+struct GgmRoundKeys {
+  GgmRoundKeys() {
+    for (std::size_t i = 0; i < kAesKeySize128; ++i) {
+      left[i] = std::byte(i);
+      right[i] = std::byte(kAesKeySize128 + i);
+    }
+    AesniKeyExpansion128(left.data());
+    AesniKeyExpansion128(right.data());
+  }
+
+  alignas(kAesBlockSize) std::array<std::byte, kAesRoundKeysSize128> left;
+  alignas(kAesBlockSize) std::array<std::byte, kAesRoundKeysSize128> right;
+};
+
+// expands the 2^level nodes of a level in place to the next level
+void ExpandLevel(Block128* nodes, std::size_t level) {
+  static const GgmRoundKeys round_keys;
+  AesniGgmExpand(round_keys.left.data(), round_keys.right.data(), nodes, nodes,
+                 std::size_t(1) << level);
+}
+
+// XORs the nodes with index parity `parity` of a level with number_of_nodes nodes
+Block128 XorNodes(const Block128* nodes, std::size_t number_of_nodes, std::size_t parity) {
+  auto sum{Block128::MakeZero()};
+  for (std::size_t i = parity; i < number_of_nodes; i += 2) sum ^= nodes[i];
+  return sum;
+}
+
+}  // namespace
+
+void GgmExpandTree(Block128* nodes, std::size_t depth, Block128* level_sums) {
+  for (std::size_t level = 0; level < depth; ++level) {
+    ExpandLevel(nodes, level);
+    level_sums[2 * level] = XorNodes(nodes, std::size_t(2) << level, 0);
+    level_sums[2 * level + 1] = XorNodes(nodes, std::size_t(2) << level, 1);
+  }
+}
+
+void GgmExpandPuncturedTree(Block128* nodes, std::size_t depth, std::size_t punctured_leaf,
+                            const Block128* sibling_sums) {
+  // the root is unknown
+  nodes[0].SetToZero();
+  std::size_t position{0};
+  for (std::size_t level = 0; level < depth; ++level) {
+    ExpandLevel(nodes, level);
+    const std::size_t path_bit{(punctured_leaf >> (depth - 1 - level)) & 1};
+    const std::size_t sibling_bit{1 - path_bit};
+    // the children of the unknown node are garbage
+    nodes[2 * position].SetToZero();
+    nodes[2 * position + 1].SetToZero();
+    const auto known_sum{XorNodes(nodes, std::size_t(2) << level, sibling_bit)};
+    nodes[2 * position + sibling_bit] = sibling_sums[level] ^ known_sum;
+    position = 2 * position + path_bit;
+  }
+}
+
+}  // namespace encrypto::motion
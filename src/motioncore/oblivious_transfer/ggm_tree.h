@@ -0,0 +1,48 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+
+#include "utility/block.h"
+
+namespace encrypto::motion {
+
+// GGM trees built from the fixed-key PRG G(x) = (pi_0(x) ^ x, pi_1(x) ^ x) with two public AES
+// keys, see AesniGgmExpand. The leaves of a tree with depth d are stored in nodes[0, 2^d) in the
+// order of their paths, i.e., bit d - l of a leaf index is the direction taken at level l.
+
+// Expands the tree with root nodes[0] in place to its leaves and stores the XOR of the left and of
+// the right children of level l = 1, ..., depth in level_sums[2 (l - 1)] and
+// level_sums[2 (l - 1) + 1].
+void GgmExpandTree(Block128* nodes, std::size_t depth, Block128* level_sums);
+
+// Expands the tree punctured at punctured_leaf in place, where sibling_sums[l - 1] is the sum of
+// level l on the other side of the path to the punctured leaf, i.e., the corresponding one of the
+// level_sums of GgmExpandTree. All leaves but the punctured one, which is set to zero, equal the
+// leaves of the full tree.
+void GgmExpandPuncturedTree(Block128* nodes, std::size_t depth, std::size_t punctured_leaf,
+                            const Block128* sibling_sums);
+
+}  // namespace encrypto::motion
@@ -39,7 +39,7 @@ BasicOtSender::BasicOtSender(std::size_t ot_id, std::size_t number_of_ots, std::
                                       bitlength);
 }
 
-void BasicOtSender::WaitSetup() const { data_.sender_data.WaitSetup(); }
+void BasicOtSender::WaitSetup() const { data_.sender_data.WaitSetup(ot_id_ + number_of_ots_); }
 
 // ---------- BasicOtReceiver ----------
 
@@ -50,10 +50,10 @@ BasicOtReceiver::BasicOtReceiver(std::size_t ot_id, std::size_t number_of_ots,
   data_.receiver_data.bitlengths.resize(ot_id + number_of_ots, bitlength);
 }
 
-void BasicOtReceiver::WaitSetup() const { data_.receiver_data.WaitSetup(); }
+void BasicOtReceiver::WaitSetup() const { data_.receiver_data.WaitSetup(ot_id_ + number_of_ots_); }
 
 void BasicOtReceiver::SendCorrections() {
-  assert(data_.receiver_data.IsSetupReady());
+  WaitSetup();
   if (choices_.Empty()) {
     throw std::runtime_error("Choices in must be set before calling SendCorrections()");
   }
@@ -76,7 +76,7 @@ ROtSender::ROtSender(std::size_t ot_id, std::size_t number_of_ots, std::size_t b
                                       bitlength);
 }
 
-void ROtSender::WaitSetup() const { data_.sender_data.WaitSetup(); }
+void ROtSender::WaitSetup() const { data_.sender_data.WaitSetup(ot_id_ + number_of_ots_); }
 
 void ROtSender::ComputeOutputs() {
   if (outputs_computed_) {
@@ -108,7 +108,7 @@ ROtReceiver::ROtReceiver(std::size_t ot_id, std::size_t number_of_ots, std::size
   data_.receiver_data.bitlengths.resize(ot_id + number_of_ots, bitlength);
 }
 
-void ROtReceiver::WaitSetup() const { data_.receiver_data.WaitSetup(); }
+void ROtReceiver::WaitSetup() const { data_.receiver_data.WaitSetup(ot_id_ + number_of_ots_); }
 
 void ROtReceiver::ComputeOutputs() {
   if (outputs_computed_) {
@@ -153,7 +153,7 @@ void XcOtSender::ComputeOutputs() {
   // get the corrections bits
   std::vector<std::uint8_t> raw_corrections{corrections_future_.get()};
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(raw_corrections.data())->payload()->data());
+      communication::GetMessage(raw_corrections)->payload()->data());
   BitSpan corrections_span(pointer, number_of_ots_);
   // take one of the precomputed outputs
   for (std::size_t i = 0; i < number_of_ots_; ++i) {
@@ -172,6 +172,8 @@ void XcOtSender::ComputeOutputs() {
 }
 
 void XcOtSender::SendMessages() const {
+  WaitSetup();
+
   BitVector<> buffer;
   buffer.Reserve(bitlength_ * number_of_ots_);
   for (std::size_t i = 0; i < number_of_ots_; ++i) {
@@ -196,7 +198,6 @@ XcOtReceiver::XcOtReceiver(const std::size_t ot_id, const std::size_t number_of_
 }
 
 void XcOtReceiver::ComputeOutputs() {
-  assert(data_.receiver_data.IsSetupReady());
   if (outputs_computed_) {
     // already done
     return;
@@ -209,7 +210,7 @@ void XcOtReceiver::ComputeOutputs() {
   }
   auto sender_message = sender_message_future_.get();
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(sender_message.data())->payload()->data());
+      communication::GetMessage(sender_message)->payload()->data());
   BitSpan sender_message_span(pointer, bitlength_ * number_of_ots_);
 
   for (std::size_t i = 0; i < number_of_ots_; ++i) {
@@ -245,7 +246,7 @@ void FixedXcOt128Sender::ComputeOutputs() {
   // get the corrections bits
   std::vector<std::uint8_t> corrections_message{corrections_future_.get()};
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(corrections_message.data())->payload()->data());
+      communication::GetMessage(corrections_message)->payload()->data());
   BitSpan corrections_span{pointer, number_of_ots_};
 
   // take one of the precomputed outputs
@@ -263,7 +264,7 @@ void FixedXcOt128Sender::ComputeOutputs() {
 }
 
 void FixedXcOt128Sender::SendMessages() const {
-  assert(data_.sender_data.IsSetupReady());
+  WaitSetup();
   Block128Vector buffer(number_of_ots_, correlation_);
   for (std::size_t i = 0; i < number_of_ots_; ++i) {
     buffer[i] ^= data_.sender_data.y0.at(ot_id_ + i).GetData().data();
@@ -299,7 +300,7 @@ void FixedXcOt128Receiver::ComputeOutputs() {
   }
   auto sender_message = sender_message_future_.get();
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(sender_message.data())->payload()->data());
+      communication::GetMessage(sender_message)->payload()->data());
 
   for (std::size_t i = 0; i < number_of_ots_; ++i) {
     outputs_[i].LoadFromMemory(data_.receiver_data.outputs.at(ot_id_ + i).GetData().data());
@@ -333,7 +334,7 @@ void XcOtBitSender::ComputeOutputs() {
   // get the corrections bits
   std::vector<std::uint8_t> corrections_message{corrections_future_.get()};
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(corrections_message.data())->payload()->data());
+      communication::GetMessage(corrections_message)->payload()->data());
   BitSpan corrections_span{pointer, number_of_ots_};
 
   // take one of the precomputed outputs
@@ -391,7 +392,7 @@ void XcOtBitReceiver::ComputeOutputs() {
 
   std::vector<std::uint8_t> sender_message{sender_message_future_.get()};
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(sender_message.data())->payload()->data());
+      communication::GetMessage(sender_message)->payload()->data());
   outputs_ = choices_ & BitSpan(pointer, choices_.GetSize());
 
   for (std::size_t i = 0; i < number_of_ots_; ++i) {
@@ -428,7 +429,7 @@ void AcOtSender<T>::ComputeOutputs() {
   // get the corrections bits
   std::vector<std::uint8_t> corrections_message{corrections_future_.get()};
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(corrections_message.data())->payload()->data());
+      communication::GetMessage(corrections_message)->payload()->data());
   BitSpan corrections_span{pointer, number_of_ots_};
 
   // take one of the precomputed outputs
@@ -464,7 +465,7 @@ void AcOtSender<T>::ComputeOutputs() {
 
 template <typename T>
 void AcOtSender<T>::SendMessages() const {
-  assert(data_.sender_data.IsSetupReady());
+  WaitSetup();
   auto buffer = correlations_;
   if (vector_size_ == 1) {
     for (std::size_t ot_i = 0; ot_i < number_of_ots_; ++ot_i) {
@@ -521,8 +522,8 @@ void AcOtReceiver<T>::ComputeOutputs() {
 
   auto sender_message = sender_message_future_.get();
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(sender_message.data())->payload()->data());
-  assert(communication::GetMessage(sender_message.data())->payload()->size() ==
+      communication::GetMessage(sender_message)->payload()->data());
+  assert(communication::GetMessage(sender_message)->payload()->size() ==
          number_of_ots_ * vector_size_ * sizeof(T));
 
   if (vector_size_ == 1) {
@@ -572,11 +573,11 @@ GOt128Sender::GOt128Sender(std::size_t ot_id, std::size_t number_of_ots, OtExten
           data_.party_id, communication::MessageType::kOtExtensionReceiverCorrections, ot_id)) {}
 
 void GOt128Sender::SendMessages() const {
-  assert(data_.sender_data.IsSetupReady());
+  WaitSetup();
   Block128Vector buffer = std::move(inputs_);
   std::vector<std::uint8_t> corrections_message{corrections_future_.get()};
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(corrections_message.data())->payload()->data());
+      communication::GetMessage(corrections_message)->payload()->data());
   BitSpan corrections_span(pointer, number_of_ots_);
   for (std::size_t i = 0; i < number_of_ots_; ++i) {
     if (corrections_span[i]) {
@@ -617,7 +618,7 @@ void GOt128Receiver::ComputeOutputs() {
   }
   auto sender_message = sender_message_future_.get();
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(sender_message.data())->payload()->data());
+      communication::GetMessage(sender_message)->payload()->data());
   const auto random_choices =
       data_.receiver_data.random_choices->Subset(ot_id_, ot_id_ + number_of_ots_);
 
@@ -638,12 +639,12 @@ GOtBitSender::GOtBitSender(std::size_t ot_id, std::size_t number_of_ots, OtExten
           data_.party_id, communication::MessageType::kOtExtensionReceiverCorrections, ot_id)) {}
 
 void GOtBitSender::SendMessages() const {
-  assert(data_.sender_data.IsSetupReady());
+  WaitSetup();
   auto buffer = std::move(inputs_);
 
   std::vector<std::uint8_t> corrections_message{corrections_future_.get()};
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(corrections_message.data())->payload()->data());
+      communication::GetMessage(corrections_message)->payload()->data());
   BitSpan corrections_span{pointer, number_of_ots_};
 
   for (std::size_t i = 0; i < number_of_ots_; ++i) {
@@ -684,7 +685,7 @@ void GOtBitReceiver::ComputeOutputs() {
   }
   std::vector<std::uint8_t> sender_message = sender_message_future_.get();
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(sender_message.data())->payload()->data());
+      communication::GetMessage(sender_message)->payload()->data());
   BitSpan sender_message_span(pointer, 2 * number_of_ots_);
   const auto random_choices =
       data_.receiver_data.random_choices->Subset(ot_id_, ot_id_ + number_of_ots_);
@@ -705,12 +706,12 @@ GOtSender::GOtSender(std::size_t ot_id, std::size_t number_of_ots, std::size_t b
           data_.party_id, communication::MessageType::kOtExtensionReceiverCorrections, ot_id)) {}
 
 void GOtSender::SendMessages() const {
-  assert(data_.sender_data.IsSetupReady());
+  WaitSetup();
   auto inputs = std::move(inputs_);
 
   std::vector<std::uint8_t> corrections_message{corrections_future_.get()};
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(corrections_message.data())->payload()->data());
+      communication::GetMessage(corrections_message)->payload()->data());
   BitSpan corrections_span(pointer, number_of_ots_);
 
   BitVector<> buffer;
@@ -759,7 +760,7 @@ void GOtReceiver::ComputeOutputs() {
   }
   std::vector<std::uint8_t> sender_message{sender_message_future_.get()};
   auto pointer = const_cast<std::uint8_t*>(
-      communication::GetMessage(sender_message.data())->payload()->data());
+      communication::GetMessage(sender_message)->payload()->data());
   BitSpan sender_message_span(pointer, 2 * bitlength_ * number_of_ots_);
   const auto random_choices =
       data_.receiver_data.random_choices->Subset(ot_id_, ot_id_ + number_of_ots_);
@@ -24,7 +24,13 @@
 
 #include "ot_provider.h"
 #include "base_ots/base_ot_provider.h"
+#include "file_ot_provider.h"
 #include "ot_flavors.h"
+#include "silent_ot_provider.h"
+#include "softspoken_ot_provider.h"
+
+#include <algorithm>
+#include <iterator>
 
 #include "base/motion_base_provider.h"
 #include "communication/communication_layer.h"
@@ -40,29 +46,35 @@
 
 namespace encrypto::motion {
 
-std::size_t OtProviderFromOtExtension::GetPartyId() { return data_.party_id; }
+OtProviderFromRandomOts::OtProviderFromRandomOts(OtExtensionData& data, std::size_t party_id)
+    : OtProvider(),
+      data_(data),
+      receiver_provider_(data_, party_id),
+      sender_provider_(data_, party_id) {}
+
+std::size_t OtProviderFromRandomOts::GetPartyId() { return data_.party_id; }
 
-[[nodiscard]] std::unique_ptr<ROtSender> OtProviderFromOtExtension::RegisterSendROt(
+[[nodiscard]] std::unique_ptr<ROtSender> OtProviderFromRandomOts::RegisterSendROt(
     std::size_t number_of_ots, std::size_t bitlength) {
   return sender_provider_.RegisterROt(number_of_ots, bitlength);
 }
 
-[[nodiscard]] std::unique_ptr<XcOtSender> OtProviderFromOtExtension::RegisterSendXcOt(
+[[nodiscard]] std::unique_ptr<XcOtSender> OtProviderFromRandomOts::RegisterSendXcOt(
     std::size_t number_of_ots, std::size_t bitlength) {
   return sender_provider_.RegisterXcOt(number_of_ots, bitlength);
 }
 
 [[nodiscard]] std::unique_ptr<FixedXcOt128Sender>
-OtProviderFromOtExtension::RegisterSendFixedXcOt128(std::size_t number_of_ots) {
+OtProviderFromRandomOts::RegisterSendFixedXcOt128(std::size_t number_of_ots) {
   return sender_provider_.RegisterFixedXcOt128s(number_of_ots);
 }
 
-[[nodiscard]] std::unique_ptr<XcOtBitSender> OtProviderFromOtExtension::RegisterSendXcOtBit(
+[[nodiscard]] std::unique_ptr<XcOtBitSender> OtProviderFromRandomOts::RegisterSendXcOtBit(
     std::size_t number_of_ots) {
   return sender_provider_.RegisterXcOtBits(number_of_ots);
 }
 
-[[nodiscard]] std::unique_ptr<BasicOtSender> OtProviderFromOtExtension::RegisterSendAcOt(
+[[nodiscard]] std::unique_ptr<BasicOtSender> OtProviderFromRandomOts::RegisterSendAcOt(
     std::size_t number_of_ots, std::size_t bitlength, std::size_t vector_size) {
   switch (bitlength) {
     case 8:
@@ -80,42 +92,42 @@ OtProviderFromOtExtension::RegisterSendFixedXcOt128(std::size_t number_of_ots) {
   }
 }
 
-[[nodiscard]] std::unique_ptr<GOtSender> OtProviderFromOtExtension::RegisterSendGOt(
+[[nodiscard]] std::unique_ptr<GOtSender> OtProviderFromRandomOts::RegisterSendGOt(
     std::size_t number_of_ots, std::size_t bitlength) {
   return sender_provider_.RegisterGOt(number_of_ots, bitlength);
 }
 
-[[nodiscard]] std::unique_ptr<GOt128Sender> OtProviderFromOtExtension::RegisterSendGOt128(
+[[nodiscard]] std::unique_ptr<GOt128Sender> OtProviderFromRandomOts::RegisterSendGOt128(
     std::size_t number_of_ots) {
   return sender_provider_.RegisterGOt128(number_of_ots);
 }
 
-[[nodiscard]] std::unique_ptr<GOtBitSender> OtProviderFromOtExtension::RegisterSendGOtBit(
+[[nodiscard]] std::unique_ptr<GOtBitSender> OtProviderFromRandomOts::RegisterSendGOtBit(
     std::size_t number_of_ots) {
   return sender_provider_.RegisterGOtBit(number_of_ots);
 }
 
-[[nodiscard]] std::unique_ptr<ROtReceiver> OtProviderFromOtExtension::RegisterReceiveROt(
+[[nodiscard]] std::unique_ptr<ROtReceiver> OtProviderFromRandomOts::RegisterReceiveROt(
     std::size_t number_of_ots, std::size_t bitlength) {
   return receiver_provider_.RegisterROt(number_of_ots, bitlength);
 }
 
-[[nodiscard]] std::unique_ptr<XcOtReceiver> OtProviderFromOtExtension::RegisterReceiveXcOt(
+[[nodiscard]] std::unique_ptr<XcOtReceiver> OtProviderFromRandomOts::RegisterReceiveXcOt(
     std::size_t number_of_ots, std::size_t bitlength) {
   return receiver_provider_.RegisterXcOt(number_of_ots, bitlength);
 }
 
 [[nodiscard]] std::unique_ptr<FixedXcOt128Receiver>
-OtProviderFromOtExtension::RegisterReceiveFixedXcOt128(std::size_t number_of_ots) {
+OtProviderFromRandomOts::RegisterReceiveFixedXcOt128(std::size_t number_of_ots) {
   return receiver_provider_.RegisterFixedXcOt128s(number_of_ots);
 }
 
-[[nodiscard]] std::unique_ptr<XcOtBitReceiver> OtProviderFromOtExtension::RegisterReceiveXcOtBit(
+[[nodiscard]] std::unique_ptr<XcOtBitReceiver> OtProviderFromRandomOts::RegisterReceiveXcOtBit(
     std::size_t number_of_ots) {
   return receiver_provider_.RegisterXcOtBits(number_of_ots);
 }
 
-[[nodiscard]] std::unique_ptr<BasicOtReceiver> OtProviderFromOtExtension::RegisterReceiveAcOt(
+[[nodiscard]] std::unique_ptr<BasicOtReceiver> OtProviderFromRandomOts::RegisterReceiveAcOt(
     std::size_t number_of_ots, std::size_t bitlength, std::size_t vector_size) {
   switch (bitlength) {
     case 8:
@@ -133,17 +145,17 @@ OtProviderFromOtExtension::RegisterReceiveFixedXcOt128(std::size_t number_of_ots
   }
 }
 
-[[nodiscard]] std::unique_ptr<GOt128Receiver> OtProviderFromOtExtension::RegisterReceiveGOt128(
+[[nodiscard]] std::unique_ptr<GOt128Receiver> OtProviderFromRandomOts::RegisterReceiveGOt128(
     std::size_t number_of_ots) {
   return receiver_provider_.RegisterGOt128(number_of_ots);
 }
 
-[[nodiscard]] std::unique_ptr<GOtBitReceiver> OtProviderFromOtExtension::RegisterReceiveGOtBit(
+[[nodiscard]] std::unique_ptr<GOtBitReceiver> OtProviderFromRandomOts::RegisterReceiveGOtBit(
     std::size_t number_of_ots) {
   return receiver_provider_.RegisterGOtBit(number_of_ots);
 }
 
-[[nodiscard]] std::unique_ptr<GOtReceiver> OtProviderFromOtExtension::RegisterReceiveGOt(
+[[nodiscard]] std::unique_ptr<GOtReceiver> OtProviderFromRandomOts::RegisterReceiveGOt(
     std::size_t number_of_ots, std::size_t bitlength) {
   return receiver_provider_.RegisterGOt(number_of_ots, bitlength);
 }
@@ -152,16 +164,11 @@ OtProviderFromOtExtension::OtProviderFromOtExtension(OtExtensionData& data,
                                                      BaseOtProvider& base_ot_provider,
                                                      BaseProvider& motion_base_provider,
                                                      std::size_t party_id)
-    : OtProvider(),
-      data_(data),
+    : OtProviderFromRandomOts(data, party_id),
       base_ot_provider_(base_ot_provider),
-      motion_base_provider_(motion_base_provider),
-      receiver_provider_(data_, party_id),
-      sender_provider_(data_, party_id) {
-  for (std::size_t i = 0; i < data_.sender_data.u_futures.size(); ++i) {
-    data_.sender_data.u_futures[i] = data_.message_manager.RegisterReceive(
-        party_id, communication::MessageType::kOtExtensionReceiverMasks, i);
-  }
+      motion_base_provider_(motion_base_provider) {
+  data_.sender_data.u_futures = data_.message_manager.RegisterReceiveRange(
+      party_id, communication::MessageType::kOtExtensionReceiverMasks, 0, kKappa);
 }
 
 void OtProviderFromOtExtension::SetBaseOtOffset(std::size_t offset) {
@@ -170,6 +177,11 @@ void OtProviderFromOtExtension::SetBaseOtOffset(std::size_t offset) {
 
 std::size_t OtProviderFromOtExtension::GetBaseOtOffset() const { return data_.base_ot_offset; }
 
+std::size_t OtProviderFromOtExtension::GetNumberOfChunks(std::size_t number_of_ots) const {
+  if (data_.chunk_size == 0) return 1;
+  return (number_of_ots + data_.chunk_size - 1) / data_.chunk_size;
+}
+
 void OtProviderFromOtExtension::SendSetup() {
   // security parameter
   constexpr std::size_t kKappa = 128;
@@ -187,65 +199,89 @@ void OtProviderFromOtExtension::SendSetup() {
   // XXX: index variable?
   std::size_t i;
 
-  // bit size of the matrix rounded to bytes
-  // XXX: maybe round to blocks?
-  const std::size_t byte_size = BitsToBytes(bit_size);
-
   // bit size rounded to blocks
   const auto bit_size_padded = bit_size + kKappa - (bit_size % kKappa);
 
-  // vector containing the matrix rows
-  // XXX: note that rows/columns are swapped compared to the ALSZ paper
-  std::vector<AlignedBitVector> v(kKappa);
+  // the chunks write the columns of their OTs into the outputs, which must not be reallocated
+  // while the OTs of the previous chunks are already in use
+  data_.sender_data.y0.resize(bit_size_padded);
+  data_.sender_data.y1.resize(bit_size_padded);
+
+  const auto& fixed_key_aes_key = motion_base_provider_.GetAesFixedKey();
+
+  // for each (extended) OT i
+  primitives::Prg prg_fixed_key;
+  prg_fixed_key.SetKey(fixed_key_aes_key.data());
 
   // PRG which is used to expand the keys we got from the base OTs
   primitives::Prg prgs_variable_key;
 
-  // fill the rows of the matrix, offset to differentiate other providers' base ots
-  for (i = 0; i < kKappa; ++i) {
-    // use the key we got from the base OTs as seed
-    prgs_variable_key.SetKey(base_ots_receiver_data.messages_c.at(data_.base_ot_offset + i).data());
-    // change the offset in the output stream since we might have already used
-    // the same base OTs previously
-    prgs_variable_key.SetOffset(data_.base_ot_offset);
-    // expand the seed such that it fills one row of the matrix
-    auto row(prgs_variable_key.Encrypt(byte_size));
-    v[i] = AlignedBitVector(std::move(row), bit_size_padded);
-  }
+  // vector containing the matrix rows
+  // XXX: note that rows/columns are swapped compared to the ALSZ paper
+  std::vector<AlignedBitVector> v(kKappa);
 
-  // receive the vectors u one by one from the receiver
-  // and xor them to the expanded keys if the corresponding selection bit is 1
-  // transmitted one by one to prevent waiting for finishing all messages to start sending
-  // the vectors can be transmitted in the wrong order
-
-  for (i = 0; i < data_.sender_data.u_futures.size(); ++i) {
-    auto raw_message{data_.sender_data.u_futures[i].get()};
-    if (base_ots_receiver_data.c[data_.base_ot_offset + i]) {
-      BitSpan bit_span_u(const_cast<std::uint8_t*>(
-                             communication::GetMessage(raw_message.data())->payload()->data()),
-                         bit_size);
-      BitSpan bit_span_v(v[i].GetMutableData().data(), bit_size, true);
-      bit_span_v ^= bit_span_u;
+  // the columns of each chunk are computed exactly as in a single batch since the chunks start at
+  // multiples of 128 columns, i.e., at whole blocks of the PRG streams
+  const std::size_t number_of_chunks = GetNumberOfChunks(bit_size);
+  for (std::size_t chunk = 0; chunk < number_of_chunks; ++chunk) {
+    const std::size_t chunk_begin = chunk * data_.chunk_size;
+    const std::size_t chunk_end =
+        chunk + 1 == number_of_chunks ? bit_size : chunk_begin + data_.chunk_size;
+    const std::size_t chunk_bit_size = chunk_end - chunk_begin;
+    const std::size_t chunk_bit_size_padded =
+        chunk + 1 == number_of_chunks ? bit_size_padded - chunk_begin : chunk_bit_size;
+
+    // bit size of the matrix rounded to bytes
+    const std::size_t byte_size = BitsToBytes(chunk_bit_size);
+
+    // fill the rows of the matrix, offset to differentiate other providers' base ots
+    for (i = 0; i < kKappa; ++i) {
+      // use the key we got from the base OTs as seed
+      prgs_variable_key.SetKey(
+          base_ots_receiver_data.messages_c.at(data_.base_ot_offset + i).data());
+      // change the offset in the output stream since we might have already used
+      // the same base OTs previously
+      prgs_variable_key.SetOffset(data_.base_ot_offset + data_.sender_data.consumed_offset +
+                                  chunk_begin / kKappa);
+      // expand the seed such that it fills one row of the matrix
+      auto row(prgs_variable_key.Encrypt(byte_size));
+      v[i] = AlignedBitVector(std::move(row), chunk_bit_size_padded);
     }
-  }
 
-  // array with pointers to each row of the matrix
-  std::array<const std::byte*, kKappa> pointers;
-  for (i = 0u; i < pointers.size(); ++i) {
-    pointers[i] = v[i].GetData().data();
-  }
-  const auto& fixed_key_aes_key = motion_base_provider_.GetAesFixedKey();
+    // receive the vectors u one by one from the receiver
+    // and xor them to the expanded keys if the corresponding selection bit is 1
+    // transmitted one by one to prevent waiting for finishing all messages to start sending
+    // the vectors can be transmitted in the wrong order
+    for (i = 0; i < kKappa; ++i) {
+      auto raw_message{data_.sender_data.u_futures[chunk * kKappa + i].get()};
+      if (base_ots_receiver_data.c[data_.base_ot_offset + i]) {
+        BitSpan bit_span_u(const_cast<std::uint8_t*>(
+                               communication::GetMessage(raw_message)->payload()->data()),
+                           chunk_bit_size);
+        BitSpan bit_span_v(v[i].GetMutableData().data(), chunk_bit_size, true);
+        bit_span_v ^= bit_span_u;
+      }
+    }
 
-  // for each (extended) OT i
-  primitives::Prg prg_fixed_key;
-  prg_fixed_key.SetKey(fixed_key_aes_key.data());
+    // array with pointers to each row of the matrix
+    std::array<const std::byte*, kKappa> pointers;
+    for (i = 0u; i < pointers.size(); ++i) {
+      pointers[i] = v[i].GetData().data();
+    }
 
-  // transpose the bit matrix
-  // XXX: figure out how the result looks like
-  BitMatrix::SenderTranspose128AndEncrypt(
-      pointers, data_.sender_data.y0, data_.sender_data.y1,
-      base_ots_receiver_data.c.Subset(data_.base_ot_offset, data_.base_ot_offset + kKappa),
-      prg_fixed_key, bit_size_padded, data_.sender_data.bitlengths);
+    // transpose the bit matrix
+    // XXX: figure out how the result looks like
+    BitMatrix::SenderTranspose128AndEncrypt(
+        pointers, std::span(data_.sender_data.y0).subspan(chunk_begin, chunk_bit_size_padded),
+        std::span(data_.sender_data.y1).subspan(chunk_begin, chunk_bit_size_padded),
+        base_ots_receiver_data.c.Subset(data_.base_ot_offset, data_.base_ot_offset + kKappa),
+        prg_fixed_key, chunk_bit_size_padded,
+        std::span<const std::size_t>(data_.sender_data.bitlengths)
+            .subspan(chunk_begin, chunk_bit_size));
+
+    // the OTs of this chunk can be used while the next chunks are extended
+    if (chunk + 1 < number_of_chunks) data_.sender_data.SetSetupIsReady(chunk_end);
+  }
 
   // we are done with the setup for the sender side
   data_.sender_data.SetSetupIsReady();
@@ -264,12 +300,6 @@ void OtProviderFromOtExtension::ReceiveSetup() {
   // rounded up to a multiple of the security parameter
   const auto bit_size_padded = bit_size + kKappa - (bit_size % kKappa);
 
-  // convert to bytes
-  const std::size_t byte_size = BitsToBytes(bit_size);
-  // XXX: if byte_size is 0 then bit_size was also zero (or an overflow happened
-  if (byte_size == 0) {
-    return;
-  }
   // storage for receiver and base OT sender data
   const auto& base_ots_sender_data =
       base_ot_provider_.GetBaseOtsData(data_.party_id).GetSenderData();
@@ -278,6 +308,10 @@ void OtProviderFromOtExtension::ReceiveSetup() {
   data_.receiver_data.random_choices =
       std::make_unique<AlignedBitVector>(AlignedBitVector::SecureRandom(bit_size));
 
+  // the chunks write the columns of their OTs into the outputs, which must not be reallocated
+  // while the OTs of the previous chunks are already in use
+  data_.receiver_data.outputs.resize(bit_size_padded);
+
   // create matrix with kKappa rows
   std::vector<AlignedBitVector> v(kKappa);
 
@@ -286,61 +320,106 @@ void OtProviderFromOtExtension::ReceiveSetup() {
   // PRG which is used to expand the keys we got from the base OTs
   primitives::Prg prg_fixed_key, prg_variable_key;
 
-  // fill the rows of the matrix, offset to differentiate other providers' base ots
-  for (i = 0; i < kKappa; ++i) {
-    // generate rows of the matrix using the corresponding 0 key
-    // T[j] = Prg(s_{j,0})
-    prg_variable_key.SetKey(base_ots_sender_data.messages_0.at(data_.base_ot_offset + i).data());
-    // change the offset in the output stream since we might have already used
-    // the same base OTs previously
-    prg_variable_key.SetOffset(data_.base_ot_offset);
-    // expand the seed such that it fills one row of the matrix
-    auto row(prg_variable_key.Encrypt(byte_size));
-    v.at(i) = AlignedBitVector(std::move(row), bit_size);
-    // take a copy of the row and XOR it with our choices
-    auto u = v.at(i);
-    // u_j = T[j] XOR r
-    u ^= *data_.receiver_data.random_choices;
-
-    // now mask the result with random stream expanded from the 1 key
-    // u_j = u_j XOR Prg(s_{j,1})
-    prg_variable_key.SetKey(base_ots_sender_data.messages_1.at(data_.base_ot_offset + i).data());
-    prg_variable_key.SetOffset(data_.base_ot_offset);
-    u ^= AlignedBitVector(prg_variable_key.Encrypt(byte_size), bit_size);
-
-    auto buffer_span{
-        std::span(reinterpret_cast<const std::uint8_t*>(u.GetData().data()), u.GetData().size())};
-    auto msg{communication::BuildMessage(communication::MessageType::kOtExtensionReceiverMasks, i,
-                                         buffer_span)};
-    // send this row
-    data_.send_function(std::move(msg));
-  }
+  const auto& fixed_key_aes_key = motion_base_provider_.GetAesFixedKey();
+  prg_fixed_key.SetKey(fixed_key_aes_key.data());
 
-  // transpose matrix T
-  if (bit_size_padded != bit_size) {
-    for (i = 0u; i < v.size(); ++i) {
-      v.at(i).Resize(bit_size_padded, true);
+  // the rows u of chunk c are sent with the message ids c * kKappa + i, s.t. the sender can
+  // process the chunks independently
+  const std::size_t number_of_chunks = GetNumberOfChunks(bit_size);
+  for (std::size_t chunk = 0; chunk < number_of_chunks; ++chunk) {
+    const std::size_t chunk_begin = chunk * data_.chunk_size;
+    const std::size_t chunk_end =
+        chunk + 1 == number_of_chunks ? bit_size : chunk_begin + data_.chunk_size;
+    const std::size_t chunk_bit_size = chunk_end - chunk_begin;
+    const std::size_t chunk_bit_size_padded =
+        chunk + 1 == number_of_chunks ? bit_size_padded - chunk_begin : chunk_bit_size;
+
+    // convert to bytes
+    const std::size_t byte_size = BitsToBytes(chunk_bit_size);
+    const std::size_t prg_offset =
+        data_.base_ot_offset + data_.receiver_data.consumed_offset + chunk_begin / kKappa;
+    const auto chunk_choices =
+        number_of_chunks == 1 ? *data_.receiver_data.random_choices
+                              : data_.receiver_data.random_choices->Subset(chunk_begin, chunk_end);
+
+    // fill the rows of the matrix, offset to differentiate other providers' base ots
+    for (i = 0; i < kKappa; ++i) {
+      // generate rows of the matrix using the corresponding 0 key
+      // T[j] = Prg(s_{j,0})
+      prg_variable_key.SetKey(base_ots_sender_data.messages_0.at(data_.base_ot_offset + i).data());
+      // change the offset in the output stream since we might have already used
+      // the same base OTs previously
+      prg_variable_key.SetOffset(prg_offset);
+      // expand the seed such that it fills one row of the matrix
+      auto row(prg_variable_key.Encrypt(byte_size));
+      v.at(i) = AlignedBitVector(std::move(row), chunk_bit_size);
+      // take a copy of the row and XOR it with our choices
+      auto u = v.at(i);
+      // u_j = T[j] XOR r
+      u ^= chunk_choices;
+
+      // now mask the result with random stream expanded from the 1 key
+      // u_j = u_j XOR Prg(s_{j,1})
+      prg_variable_key.SetKey(base_ots_sender_data.messages_1.at(data_.base_ot_offset + i).data());
+      prg_variable_key.SetOffset(prg_offset);
+      u ^= AlignedBitVector(prg_variable_key.Encrypt(byte_size), chunk_bit_size);
+
+      auto buffer_span{std::span(reinterpret_cast<const std::uint8_t*>(u.GetData().data()),
+                                 u.GetData().size())};
+      auto msg{communication::BuildMessage(communication::MessageType::kOtExtensionReceiverMasks,
+                                           chunk * kKappa + i, buffer_span)};
+      // send this row
+      data_.send_function(std::move(msg));
     }
-  }
 
-  std::array<const std::byte*, kKappa> pointers;
-  for (j = 0; j < pointers.size(); ++j) {
-    pointers.at(j) = v.at(j).GetMutableData().data();
-  }
+    // transpose matrix T
+    if (chunk_bit_size_padded != chunk_bit_size) {
+      for (i = 0u; i < v.size(); ++i) {
+        v.at(i).Resize(chunk_bit_size_padded, true);
+      }
+    }
 
-  const auto& fixed_key_aes_key = motion_base_provider_.GetAesFixedKey();
-  prg_fixed_key.SetKey(fixed_key_aes_key.data());
-  BitMatrix::ReceiverTranspose128AndEncrypt(pointers, data_.receiver_data.outputs, prg_fixed_key,
-                                            bit_size_padded, data_.receiver_data.bitlengths);
+    std::array<const std::byte*, kKappa> pointers;
+    for (j = 0; j < pointers.size(); ++j) {
+      pointers.at(j) = v.at(j).GetMutableData().data();
+    }
+
+    auto outputs =
+        std::span(data_.receiver_data.outputs).subspan(chunk_begin, chunk_bit_size_padded);
+    BitMatrix::ReceiverTranspose128AndEncrypt(
+        pointers, outputs, prg_fixed_key, chunk_bit_size_padded,
+        std::span<const std::size_t>(data_.receiver_data.bitlengths)
+            .subspan(chunk_begin, chunk_bit_size));
+
+    // the OTs of this chunk can be used while the next chunks are extended
+    if (chunk + 1 < number_of_chunks) data_.receiver_data.SetSetupIsReady(chunk_end);
+  }
 
   data_.receiver_data.SetSetupIsReady();
   SetSetupIsReady();
 }
 
 void OtProviderFromOtExtension::PreSetup() {
-  if (HasWork()) {
+  // the base OTs are requested once and reused by the OT extensions of later evaluations
+  if (HasWork() && data_.base_ot_offset == std::numeric_limits<std::size_t>::max()) {
     data_.base_ot_offset = base_ot_provider_.Request(kKappa, data_.party_id);
   }
+
+  // the rows u of the additional chunks need to be registered before the receiver sends them
+  auto& u_futures = data_.sender_data.u_futures;
+  const std::size_t number_of_u_futures = GetNumberOfChunks(GetNumOtsSender()) * kKappa;
+  if (number_of_u_futures > u_futures.size()) {
+    auto futures{data_.message_manager.RegisterReceiveRange(
+        data_.party_id, communication::MessageType::kOtExtensionReceiverMasks, u_futures.size(),
+        number_of_u_futures - u_futures.size())};
+    std::move(futures.begin(), futures.end(), std::back_inserter(u_futures));
+  }
+}
+
+void OtProviderFromRandomOts::Clear() {
+  receiver_provider_.Clear();
+  sender_provider_.Clear();
+  ResetSetupIsReady();
 }
 
 OtVector::OtVector(const std::size_t ot_id, const std::size_t number_of_ots,
@@ -470,8 +549,14 @@ std::unique_ptr<GOtBitSender> OtProviderSender::RegisterGOtBit(const std::size_t
 }
 
 void OtProviderSender::Clear() {
-  // TODO: move this
-  // data_storage_->GetBaseOTsData()->GetSenderData().consumed_offset += total_ots_count_;
+  // continue the PRG streams of the base OTs in the next OT extension instead of reusing them
+  data_.sender_data.consumed_offset += (total_ots_count_ + kKappa - 1) / kKappa;
+  data_.sender_data.bit_size = 0;
+  data_.sender_data.V.reset();
+  data_.sender_data.y0.clear();
+  data_.sender_data.y1.clear();
+  data_.sender_data.bitlengths.clear();
+  data_.sender_data.ResetSetupIsReady();
 
   total_ots_count_ = 0;
 
@@ -610,9 +695,14 @@ std::unique_ptr<GOtBitReceiver> OtProviderReceiver::RegisterGOtBit(
 }
 
 void OtProviderReceiver::Clear() {
-  // TODO: move this
-  // data_storage_->GetBaseOTsData()->GetReceiverData().consumed_offset += total_ots_count_;
-  //
+  // continue the PRG streams of the base OTs in the next OT extension instead of reusing them
+  data_.receiver_data.consumed_offset += (total_ots_count_ + kKappa - 1) / kKappa;
+  data_.receiver_data.T.reset();
+  data_.receiver_data.outputs.clear();
+  data_.receiver_data.bitlengths.clear();
+  data_.receiver_data.random_choices.reset();
+  data_.receiver_data.ResetSetupIsReady();
+
   total_ots_count_ = 0;
 
   ResetSetupIsReady();
@@ -621,10 +711,17 @@ void OtProviderReceiver::Reset() { Clear(); }
 
 OtProviderManager::OtProviderManager(communication::CommunicationLayer& communication_layer,
                                      BaseOtProvider& base_ot_provider,
-                                     BaseProvider& motion_base_provider)
+                                     BaseProvider& motion_base_provider,
+                                     OtExtensionProtocol protocol,
+                                     std::size_t softspoken_field_bits,
+                                     const std::string& store_directory,
+                                     const std::array<std::byte, 16>& store_key)
     : communication_layer_(communication_layer),
       providers_(communication_layer_.GetNumberOfParties()),
       data_(communication_layer_.GetNumberOfParties()){
+  if (!store_directory.empty() && protocol != OtExtensionProtocol::kIknp) {
+    throw std::invalid_argument("Only the state of IKNP can be kept in a file");
+  }
   auto my_id = communication_layer.GetMyId();
   for (std::size_t party_id = 0; party_id < providers_.size(); ++party_id) {
     if (party_id == my_id) {
@@ -636,13 +733,39 @@ OtProviderManager::OtProviderManager(communication::CommunicationLayer& communic
     data_.at(party_id) = std::make_unique<OtExtensionData>(
         party_id, send_function, communication_layer_.GetMessageManager(), communication_layer_.GetLogger());
     data_.at(party_id)->party_id = party_id;
-    providers_.at(party_id) = std::make_unique<OtProviderFromOtExtension>(
-        *data_.at(party_id), base_ot_provider, motion_base_provider, party_id);
+    if (protocol == OtExtensionProtocol::kSilent) {
+      providers_.at(party_id) = std::make_unique<OtProviderFromSilentOt>(
+          *data_.at(party_id), base_ot_provider, motion_base_provider);
+    } else if (protocol == OtExtensionProtocol::kSoftSpoken) {
+      providers_.at(party_id) = std::make_unique<OtProviderFromSoftSpokenOt>(
+          *data_.at(party_id), base_ot_provider, motion_base_provider, softspoken_field_bits);
+    } else if (!store_directory.empty()) {
+      providers_.at(party_id) = std::make_unique<OtProviderFromFile>(
+          *data_.at(party_id), base_ot_provider, motion_base_provider,
+          fmt::format("{}/ot_state_{}_{}.bin", store_directory, my_id, party_id), store_key);
+    } else {
+      providers_.at(party_id) = std::make_unique<OtProviderFromOtExtension>(
+          *data_.at(party_id), base_ot_provider, motion_base_provider, party_id);
+    }
   }
 }
 
 OtProviderManager::~OtProviderManager() {}
 
+void OtProviderManager::Clear() {
+  for (auto& provider : providers_) {
+    if (provider != nullptr) {
+      provider->Clear();
+    }
+  }
+}
+
+void OtProviderManager::SetChunkSize(std::size_t chunk_size) {
+  for (auto& data : data_) {
+    if (data != nullptr) data->chunk_size = (chunk_size + kKappa - 1) / kKappa * kKappa;
+  }
+}
+
 bool OtProviderManager::HasWork() {
   for (auto& provider : providers_) {
     if (provider != nullptr && (provider->GetPartyId() != communication_layer_.GetMyId()) &&
@@ -27,6 +27,7 @@
 #include <array>
 #include <atomic>
 #include <memory>
+#include <string>
 #include <unordered_map>
 
 #include <flatbuffers/flatbuffers.h>
@@ -277,15 +278,15 @@ class OtProvider : public FiberSetupWaitable {
   OtProvider() = default;
 };
 
-class OtProviderFromFile : public OtProvider {
-  // TODO
-};
-
 class OtProviderFromBaseOTs : public OtProvider {
   // TODO
 };
 
-class OtProviderFromOtExtension final : public OtProvider {
+// Provider of OTs that are registered in an OtExtensionData and derived from random OTs by the
+// flavors in ot_flavors.h. Subclasses compute the random OTs in SendSetup() and ReceiveSetup():
+// the sender fills sender_data.y0/y1 and the receiver fills receiver_data.outputs and
+// receiver_data.random_choices, both according to the registered bit lengths.
+class OtProviderFromRandomOts : public OtProvider {
  public:
   [[nodiscard]] std::unique_ptr<ROtSender> RegisterSendROt(std::size_t number_of_ots,
                                                            std::size_t bitlength) override;
@@ -336,33 +337,46 @@ class OtProviderFromOtExtension final : public OtProvider {
   [[nodiscard]] std::unique_ptr<GOtBitReceiver> RegisterReceiveGOtBit(
       std::size_t number_of_ots) override;
 
-  void SendSetup() final;
+  /// \brief Forgets all registered OTs such that the same OTs can be registered again.
+  void Clear() override;
+
+  std::size_t GetPartyId() final;
+
+  [[nodiscard]] std::size_t GetNumOtsReceiver() const final {
+    return receiver_provider_.GetNumOts();
+  }
 
-  void ReceiveSetup() final;
+  [[nodiscard]] std::size_t GetNumOtsSender() const final { return sender_provider_.GetNumOts(); }
+
+ protected:
+  OtProviderFromRandomOts(OtExtensionData& data, std::size_t party_id);
+
+  OtExtensionData& data_;
+  OtProviderReceiver receiver_provider_;
+  OtProviderSender sender_provider_;
+};
+
+class OtProviderFromOtExtension : public OtProviderFromRandomOts {
+ public:
+  void SendSetup() override;
+
+  void ReceiveSetup() override;
 
   void PreSetup() final;
 
   OtProviderFromOtExtension(OtExtensionData& data, BaseOtProvider& base_ot_provider, BaseProvider&,
                             std::size_t party_id);
 
-  std::size_t GetPartyId() final;
-
   void SetBaseOtOffset(std::size_t offset);
 
   std::size_t GetBaseOtOffset() const;
 
-  [[nodiscard]] std::size_t GetNumOtsReceiver() const final {
-    return receiver_provider_.GetNumOts();
-  }
-
-  [[nodiscard]] std::size_t GetNumOtsSender() const final { return sender_provider_.GetNumOts(); }
-
  private:
-  OtExtensionData& data_;
+  // number of chunks of the OT extension of number_of_ots OTs, see OtExtensionData::chunk_size
+  std::size_t GetNumberOfChunks(std::size_t number_of_ots) const;
+
   BaseOtProvider& base_ot_provider_;
   BaseProvider& motion_base_provider_;
-  OtProviderReceiver receiver_provider_;
-  OtProviderSender sender_provider_;
 };
 
 class OtProviderFromThirdParty : public OtProvider {
@@ -373,9 +387,23 @@ class OtProviderFromMultipleThirdParties : public OtProvider {
   // TODO
 };
 
+// protocol the OtProviderManager uses to generate the random OTs
+enum class OtExtensionProtocol : unsigned int {
+  kIknp = 0,        // IKNP OT extension with 128 bits of communication per OT
+  kSilent = 1,      // silent OT from LPN, see OtProviderFromSilentOt
+  kSoftSpoken = 2,  // small-field VOLE generalizing IKNP, see OtProviderFromSoftSpokenOt
+};
+
 class OtProviderManager {
  public:
-  OtProviderManager(communication::CommunicationLayer&, BaseOtProvider&, BaseProvider&);
+  // softspoken_field_bits is the k of SoftSpokenOT and ignored by the other protocols. If
+  // store_directory is not empty, the IKNP state with each peer is kept in a file in this directory
+  // encrypted under store_key, see OtProviderFromFile, which is not supported by the other
+  // protocols.
+  OtProviderManager(communication::CommunicationLayer&, BaseOtProvider&, BaseProvider&,
+                    OtExtensionProtocol protocol = OtExtensionProtocol::kIknp,
+                    std::size_t softspoken_field_bits = 4, const std::string& store_directory = "",
+                    const std::array<std::byte, 16>& store_key = {});
   ~OtProviderManager();
 
   void PreSetup() {
@@ -384,11 +412,17 @@ class OtProviderManager {
     }
   }
 
+  // runs the IKNP OT extensions in chunks of chunk_size OTs rounded up to a multiple of 128 and
+  // publishes the OTs of each chunk as soon as they are ready, 0 runs them as a single batch
+  void SetChunkSize(std::size_t chunk_size);
+
   std::vector<std::unique_ptr<OtProvider>>& GetProviders() { return providers_; }
   OtProvider& GetProvider(std::size_t party_id) { return *providers_.at(party_id); }
 
   bool HasWork();
 
+  void Clear();
+
  private:
   communication::CommunicationLayer& communication_layer_;
   std::vector<std::unique_ptr<OtProvider>> providers_;
@@ -0,0 +1,375 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "silent_ot_provider.h"
+#include "ggm_tree.h"
+#include "ot_flavors.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "base/motion_base_provider.h"
+#include "communication/message.h"
+#include "communication/message_manager.h"
+#include "data_storage/ot_extension_data.h"
+#include "primitives/aes/aesni_primitives.h"
+#include "primitives/pseudo_random_generator.h"
+#include "primitives/random/default_rng.h"
+#include "utility/block.h"
+#include "utility/helpers.h"
+
+namespace encrypto::motion {
+
+namespace {
+
+// fixed public AES key of the stream that chooses the positions of the compressing code, both
+// parties have to use the same key
+struct CodeRoundKeys {
+  CodeRoundKeys() {
+    for (std::size_t i = 0; i < kAesKeySize128; ++i) {
+      round_keys[i] = std::byte(2 * kAesKeySize128 + i);
+    }
+    AesniKeyExpansion128(round_keys.data());
+  }
+
+  alignas(kAesBlockSize) std::array<std::byte, kAesRoundKeysSize128> round_keys;
+};
+
+// XORs number_of_blocks blocks
+Block128 XorBlocks(const Block128* blocks, std::size_t number_of_blocks) {
+  auto sum{Block128::MakeZero()};
+  for (std::size_t i = 0; i < number_of_blocks; ++i) sum ^= blocks[i];
+  return sum;
+}
+
+// Compresses the noise vector with the transposed expand-accumulate code: the blocks and, if
+// given, the noise bits are accumulated in place and output i is the XOR of expander_weight
+// accumulated positions, which are chosen by a fixed-key AES stream known to both parties.
+void DualEncode(Block128Vector& blocks, std::vector<std::uint8_t>* bits,
+                std::size_t expander_weight, Block128Vector& outputs,
+                std::vector<std::uint8_t>* output_bits) {
+  const std::size_t noise_length{blocks.size()};
+  for (std::size_t i = 1; i < noise_length; ++i) blocks[i] ^= blocks[i - 1];
+  if (bits) {
+    for (std::size_t i = 1; i < noise_length; ++i) (*bits)[i] ^= (*bits)[i - 1];
+  }
+
+  // number of outputs whose positions are generated at once
+  constexpr std::size_t kChunkSize{1024};
+  const std::size_t positions_per_block{kAesBlockSize / sizeof(std::uint32_t)};
+  const std::size_t blocks_per_chunk{
+      (kChunkSize * expander_weight + positions_per_block - 1) / positions_per_block};
+  static const CodeRoundKeys code_round_keys;
+  Block128Vector stream(blocks_per_chunk);
+  std::uint64_t counter{0};
+  for (std::size_t first = 0; first < outputs.size(); first += kChunkSize) {
+    AesniCtrStreamBlocks128(code_round_keys.round_keys.data(), &counter, stream.data(),
+                            blocks_per_chunk);
+    const auto positions{reinterpret_cast<const std::uint32_t*>(stream.data())};
+    const std::size_t chunk_size{std::min(kChunkSize, outputs.size() - first)};
+    for (std::size_t i = 0; i < chunk_size; ++i) {
+      auto sum{Block128::MakeZero()};
+      std::uint8_t bit{0};
+      for (std::size_t k = 0; k < expander_weight; ++k) {
+        // maps the 32-bit value uniformly enough to [0, noise_length)
+        const std::size_t position{
+            (std::uint64_t(positions[i * expander_weight + k]) * noise_length) >> 32};
+        sum ^= blocks[position];
+        if (bits) bit ^= (*bits)[position];
+      }
+      outputs[first + i] = sum;
+      if (output_bits) (*output_bits)[first + i] = bit;
+    }
+  }
+}
+
+// hashes a correlated block to a random OT output of bitlength bits as in IKNP
+BitVector<> HashOutput(Block128 block, std::size_t bitlength, primitives::Prg& prg_fixed_key,
+                       primitives::Prg& prg_variable_key) {
+  prg_fixed_key.Mmo(block.data());
+  if (bitlength <= block.size() * 8) return BitVector<>(block.data(), bitlength);
+  prg_variable_key.SetKey(block.data());
+  return BitVector<>(prg_variable_key.Encrypt(BitsToBytes(bitlength)), bitlength);
+}
+
+}  // namespace
+
+OtProviderFromSilentOt::OtProviderFromSilentOt(OtExtensionData& data,
+                                               BaseOtProvider& base_ot_provider,
+                                               BaseProvider& motion_base_provider,
+                                               const SilentOtParameters& parameters)
+    : OtProviderFromRandomOts(data, data.party_id),
+      motion_base_provider_(motion_base_provider),
+      parameters_(parameters),
+      bootstrap_data_(std::make_unique<OtExtensionData>(data.party_id, data.send_function,
+                                                        data.message_manager, data.logger)),
+      bootstrap_provider_(std::make_unique<OtProviderFromOtExtension>(
+          *bootstrap_data_, base_ot_provider, motion_base_provider, data.party_id)) {
+  if (parameters_.tree_depth == 0 || parameters_.tree_depth >= 32 ||
+      parameters_.number_of_trees == 0 || parameters_.expander_weight == 0 ||
+      parameters_.GetNoiseLength() > std::numeric_limits<std::uint32_t>::max() ||
+      parameters_.GetNumberOfOutputs() <= parameters_.GetNumberOfSeedOts()) {
+    throw std::invalid_argument(fmt::format(
+        "invalid silent OT parameters: tree depth {}, {} trees, expander weight {}",
+        parameters_.tree_depth, parameters_.number_of_trees, parameters_.expander_weight));
+  }
+}
+
+OtProviderFromSilentOt::~OtProviderFromSilentOt() = default;
+
+void OtProviderFromSilentOt::PreSetup() {
+  if (!HasWork()) return;
+  // the seeds of each direction are bootstrapped once with IKNP, the peer decides the same
+  const std::size_t number_of_seeds{parameters_.GetNumberOfSeedOts()};
+  bootstrap_provider_->Clear();
+  bootstrap_sender_.reset();
+  bootstrap_receiver_.reset();
+  if (GetNumOtsSender() > 0 && sender_seeds_0_.empty()) {
+    bootstrap_sender_ = bootstrap_provider_->RegisterSendROt(number_of_seeds, 128);
+  }
+  if (GetNumOtsReceiver() > 0 && receiver_seeds_.empty()) {
+    bootstrap_receiver_ = bootstrap_provider_->RegisterReceiveROt(number_of_seeds, 128);
+  }
+  bootstrap_provider_->PreSetup();
+
+  const std::size_t usable_ots{parameters_.GetNumberOfUsableOts()};
+  const std::size_t sender_iterations{(GetNumOtsSender() + usable_ots - 1) / usable_ots};
+  const std::size_t receiver_iterations{(GetNumOtsReceiver() + usable_ots - 1) / usable_ots};
+  choices_futures_.clear();
+  for (std::size_t i = 0; i < sender_iterations; ++i) {
+    choices_futures_.emplace_back(data_.message_manager.RegisterReceive(
+        data_.party_id, communication::MessageType::kSilentOtReceiverChoices, i));
+  }
+  trees_futures_.clear();
+  for (std::size_t i = 0; i < receiver_iterations; ++i) {
+    trees_futures_.emplace_back(data_.message_manager.RegisterReceive(
+        data_.party_id, communication::MessageType::kSilentOtSenderMessages, i));
+  }
+}
+
+void OtProviderFromSilentOt::SendSetup() {
+  const std::size_t number_of_ots{GetNumOtsSender()};
+  if (number_of_ots == 0) return;
+  data_.sender_data.bit_size = number_of_ots;
+
+  if (bootstrap_sender_) {
+    bootstrap_provider_->SendSetup();
+    bootstrap_sender_->ComputeOutputs();
+    const auto outputs{bootstrap_sender_->GetOutputs()};
+    sender_seeds_0_.resize(outputs.size());
+    sender_seeds_1_.resize(outputs.size());
+    for (std::size_t i = 0; i < outputs.size(); ++i) {
+      // the sender's output of a ROt is the concatenation of both messages
+      const auto* bytes{outputs[i].GetData().data()};
+      std::copy_n(bytes, sender_seeds_0_[i].size(), sender_seeds_0_[i].data());
+      std::copy_n(bytes + sender_seeds_0_[i].size(), sender_seeds_1_[i].size(),
+                  sender_seeds_1_[i].data());
+    }
+    bootstrap_sender_.reset();
+  }
+
+  const std::size_t usable_ots{parameters_.GetNumberOfUsableOts()};
+  for (std::size_t i = 0; i < choices_futures_.size(); ++i) {
+    const std::size_t first_ot{i * usable_ots};
+    SendIteration(i, first_ot, std::min(usable_ots, number_of_ots - first_ot));
+  }
+
+  data_.sender_data.SetSetupIsReady();
+  SetSetupIsReady();
+}
+
+void OtProviderFromSilentOt::ReceiveSetup() {
+  const std::size_t number_of_ots{GetNumOtsReceiver()};
+  if (number_of_ots == 0) return;
+
+  if (bootstrap_receiver_) {
+    bootstrap_provider_->ReceiveSetup();
+    bootstrap_receiver_->ComputeOutputs();
+    const auto outputs{bootstrap_receiver_->GetOutputs()};
+    receiver_seed_choices_ = bootstrap_receiver_->GetChoices();
+    receiver_seeds_.resize(outputs.size());
+    for (std::size_t i = 0; i < outputs.size(); ++i) {
+      std::copy_n(outputs[i].GetData().data(), receiver_seeds_[i].size(),
+                  receiver_seeds_[i].data());
+    }
+    bootstrap_receiver_.reset();
+  }
+
+  data_.receiver_data.random_choices = std::make_unique<AlignedBitVector>(number_of_ots);
+  const std::size_t usable_ots{parameters_.GetNumberOfUsableOts()};
+  for (std::size_t i = 0; i < trees_futures_.size(); ++i) {
+    const std::size_t first_ot{i * usable_ots};
+    ReceiveIteration(i, first_ot, std::min(usable_ots, number_of_ots - first_ot));
+  }
+
+  data_.receiver_data.SetSetupIsReady();
+  SetSetupIsReady();
+}
+
+void OtProviderFromSilentOt::SendIteration(std::size_t iteration, std::size_t first_ot,
+                                           std::size_t number_of_ots) {
+  const std::size_t depth{parameters_.tree_depth};
+  const std::size_t number_of_trees{parameters_.number_of_trees};
+  const std::size_t number_of_leaves{std::size_t(1) << depth};
+  const std::size_t number_of_seeds{parameters_.GetNumberOfSeedOts()};
+
+  // expand the GGM trees from random roots and remember the XOR of the left and right children
+  // of each level, which are the messages of the seed OTs
+  const auto delta{Block128::MakeRandom()};
+  Block128Vector leaves(parameters_.GetNoiseLength());
+  const auto roots{Block128Vector::MakeRandom(number_of_trees)};
+  Block128Vector level_sums(2 * number_of_seeds);
+  for (std::size_t j = 0; j < number_of_trees; ++j) {
+    leaves[j * number_of_leaves] = roots[j];
+    GgmExpandTree(leaves.data() + j * number_of_leaves, depth, level_sums.data() + 2 * j * depth);
+  }
+
+  // the receiver sends the choice bits d that derandomize the seed OTs, s.t. it learns the
+  // sums of the siblings of its path
+  auto choices_message{choices_futures_.at(iteration).get()};
+  const BitVector<> choices(
+      communication::GetMessage(choices_message)->payload()->data(), number_of_seeds);
+
+  // per tree: the two masked sums of each level and the correction Delta ^ XOR of the leaves
+  const std::size_t blocks_per_tree{2 * depth + 1};
+  Block128Vector tree_messages(number_of_trees * blocks_per_tree);
+  for (std::size_t j = 0; j < number_of_trees; ++j) {
+    for (std::size_t level = 0; level < depth; ++level) {
+      const std::size_t seed{j * depth + level};
+      const bool d{choices.Get(seed)};
+      auto& masked_sum_0{tree_messages[j * blocks_per_tree + 2 * level]};
+      auto& masked_sum_1{tree_messages[j * blocks_per_tree + 2 * level + 1]};
+      masked_sum_0 = level_sums[2 * seed];
+      masked_sum_0 ^= (d ? sender_seeds_1_ : sender_seeds_0_)[seed].data();
+      masked_sum_1 = level_sums[2 * seed + 1];
+      masked_sum_1 ^= (d ? sender_seeds_0_ : sender_seeds_1_)[seed].data();
+    }
+    auto& correction{tree_messages[j * blocks_per_tree + 2 * depth]};
+    correction = XorBlocks(leaves.data() + j * number_of_leaves, number_of_leaves);
+    correction ^= delta;
+  }
+  auto buffer_span{std::span(reinterpret_cast<const std::uint8_t*>(tree_messages.data()),
+                             tree_messages.ByteSize())};
+  data_.send_function(communication::BuildMessage(
+      communication::MessageType::kSilentOtSenderMessages, iteration, buffer_span));
+
+  // q = H * v, the receiver gets t = q ^ r * Delta
+  Block128Vector q(parameters_.GetNumberOfOutputs());
+  DualEncode(leaves, nullptr, parameters_.expander_weight, q, nullptr);
+
+  primitives::Prg prg_fixed_key, prg_variable_key;
+  prg_fixed_key.SetKey(motion_base_provider_.GetAesFixedKey().data());
+  for (std::size_t i = 0; i < number_of_seeds; ++i) {
+    auto seed_0{q[i]}, seed_1{q[i] ^ delta};
+    prg_fixed_key.Mmo(seed_0.data());
+    prg_fixed_key.Mmo(seed_1.data());
+    std::copy_n(seed_0.data(), seed_0.size(), sender_seeds_0_[i].data());
+    std::copy_n(seed_1.data(), seed_1.size(), sender_seeds_1_[i].data());
+  }
+  for (std::size_t i = 0; i < number_of_ots; ++i) {
+    const std::size_t bitlength{data_.sender_data.bitlengths[first_ot + i]};
+    const auto& correlated{q[number_of_seeds + i]};
+    data_.sender_data.y0[first_ot + i] =
+        HashOutput(correlated, bitlength, prg_fixed_key, prg_variable_key);
+    data_.sender_data.y1[first_ot + i] =
+        HashOutput(correlated ^ delta, bitlength, prg_fixed_key, prg_variable_key);
+  }
+}
+
+void OtProviderFromSilentOt::ReceiveIteration(std::size_t iteration, std::size_t first_ot,
+                                              std::size_t number_of_ots) {
+  const std::size_t depth{parameters_.tree_depth};
+  const std::size_t number_of_trees{parameters_.number_of_trees};
+  const std::size_t number_of_leaves{std::size_t(1) << depth};
+  const std::size_t number_of_seeds{parameters_.GetNumberOfSeedOts()};
+
+  // choose the punctured leaf of each tree and ask for the sibling of each node on its path
+  std::vector<std::uint32_t> punctured_leaves(number_of_trees);
+  DefaultRng::GetThreadInstance().RandomBytes(
+      reinterpret_cast<std::byte*>(punctured_leaves.data()),
+      punctured_leaves.size() * sizeof(std::uint32_t));
+  BitVector<> choices(number_of_seeds);
+  for (std::size_t j = 0; j < number_of_trees; ++j) {
+    punctured_leaves[j] &= number_of_leaves - 1;
+    for (std::size_t level = 0; level < depth; ++level) {
+      const bool path_bit{((punctured_leaves[j] >> (depth - 1 - level)) & 1) == 1};
+      const std::size_t seed{j * depth + level};
+      choices.Set(receiver_seed_choices_.Get(seed) == path_bit, seed);
+    }
+  }
+  auto choices_span{std::span(reinterpret_cast<const std::uint8_t*>(choices.GetData().data()),
+                              choices.GetData().size())};
+  data_.send_function(communication::BuildMessage(
+      communication::MessageType::kSilentOtReceiverChoices, iteration, choices_span));
+
+  // reconstruct all leaves but the punctured ones level by level
+  auto trees_message{trees_futures_.at(iteration).get()};
+  const auto trees_payload{communication::GetMessage(trees_message)->payload()};
+  const std::size_t blocks_per_tree{2 * depth + 1};
+  const auto tree_messages{Block128Vector(number_of_trees * blocks_per_tree,
+                                          trees_payload->data())};
+  Block128Vector leaves(parameters_.GetNoiseLength());
+  Block128Vector sibling_sums(depth);
+  for (std::size_t j = 0; j < number_of_trees; ++j) {
+    for (std::size_t level = 0; level < depth; ++level) {
+      const std::size_t path_bit{(punctured_leaves[j] >> (depth - 1 - level)) & 1};
+      sibling_sums[level] = tree_messages[j * blocks_per_tree + 2 * level + 1 - path_bit];
+      sibling_sums[level] ^= receiver_seeds_[j * depth + level].data();
+    }
+    Block128* nodes{leaves.data() + j * number_of_leaves};
+    GgmExpandPuncturedTree(nodes, depth, punctured_leaves[j], sibling_sums.data());
+    // w = v ^ Delta at the punctured leaf, which is still zero
+    const auto known_sum{XorBlocks(nodes, number_of_leaves)};
+    nodes[punctured_leaves[j]] = tree_messages[j * blocks_per_tree + 2 * depth] ^ known_sum;
+  }
+
+  // t = H * w and r = H * e for the regular noise vector e
+  std::vector<std::uint8_t> noise(parameters_.GetNoiseLength(), 0);
+  for (std::size_t j = 0; j < number_of_trees; ++j) {
+    noise[j * number_of_leaves + punctured_leaves[j]] = 1;
+  }
+  Block128Vector t(parameters_.GetNumberOfOutputs());
+  std::vector<std::uint8_t> r(parameters_.GetNumberOfOutputs());
+  DualEncode(leaves, &noise, parameters_.expander_weight, t, &r);
+
+  primitives::Prg prg_fixed_key, prg_variable_key;
+  prg_fixed_key.SetKey(motion_base_provider_.GetAesFixedKey().data());
+  for (std::size_t i = 0; i < number_of_seeds; ++i) {
+    auto seed{t[i]};
+    prg_fixed_key.Mmo(seed.data());
+    std::copy_n(seed.data(), seed.size(), receiver_seeds_[i].data());
+    receiver_seed_choices_.Set(r[i] == 1, i);
+  }
+  auto& random_choices{*data_.receiver_data.random_choices};
+  for (std::size_t i = 0; i < number_of_ots; ++i) {
+    const std::size_t bitlength{data_.receiver_data.bitlengths[first_ot + i]};
+    data_.receiver_data.outputs[first_ot + i] =
+        HashOutput(t[number_of_seeds + i], bitlength, prg_fixed_key, prg_variable_key);
+    random_choices.Set(r[number_of_seeds + i] == 1, first_ot + i);
+  }
+}
+
+}  // namespace encrypto::motion
@@ -0,0 +1,118 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ot_provider.h"
+#include "utility/bit_vector.h"
+#include "utility/reusable_future.h"
+
+namespace encrypto::motion {
+
+// Parameters of the silent OT, see OtProviderFromSilentOt. Every iteration of the protocol
+// produces number_of_trees * 2^(tree_depth - 1) random OTs, of which
+// number_of_trees * tree_depth are kept as seeds of the next iteration.
+struct SilentOtParameters {
+  // depth of the GGM trees, each tree has 2^tree_depth leaves
+  std::size_t tree_depth{13};
+  // number of GGM trees == Hamming weight of the regular noise vector
+  std::size_t number_of_trees{256};
+  // number of noise positions XORed into each output by the compressing code
+  std::size_t expander_weight{7};
+
+  std::size_t GetNoiseLength() const { return number_of_trees << tree_depth; }
+
+  std::size_t GetNumberOfOutputs() const { return GetNoiseLength() / 2; }
+
+  std::size_t GetNumberOfSeedOts() const { return number_of_trees * tree_depth; }
+
+  std::size_t GetNumberOfUsableOts() const {
+    return GetNumberOfOutputs() - GetNumberOfSeedOts();
+  }
+};
+
+// Generates the random OTs of the flavors in ot_flavors.h with silent OT extension from the
+// dual-LPN assumption (Boyle et al., https://eprint.iacr.org/2019/1159). The parties share
+// sparse correlations via punctured GGM trees, i.e., the sender knows v and the receiver knows
+// w = v ^ e * Delta for a regular noise vector e with one 1 in each of the number_of_trees
+// blocks, and compress them with a public expand-accumulate code (Boyle et al.,
+// https://eprint.iacr.org/2022/1014) to n = noise length / 2 correlated OTs, which are hashed to
+// random OTs as in IKNP. The communication is (2 * tree_depth + 1) blocks per tree and
+// tree_depth bits per tree for each iteration, i.e., sublinear in the number of OTs.
+//
+// Like IKNP, the protocol is secure against semi-honest adversaries. The seed OTs of the GGM
+// trees are generated once with IKNP from the usual 128 base OTs and taken from the outputs of
+// the previous iteration afterwards (Yang et al., https://eprint.iacr.org/2020/924).
+class OtProviderFromSilentOt final : public OtProviderFromRandomOts {
+ public:
+  OtProviderFromSilentOt(OtExtensionData& data, BaseOtProvider& base_ot_provider,
+                         BaseProvider& motion_base_provider,
+                         const SilentOtParameters& parameters = {});
+
+  ~OtProviderFromSilentOt();
+
+  void SendSetup() final;
+
+  void ReceiveSetup() final;
+
+  void PreSetup() final;
+
+  const SilentOtParameters& GetParameters() const { return parameters_; }
+
+ private:
+  using Block = std::array<std::byte, 16>;
+
+  // runs one iteration as the sender and stores the outputs for the OTs [first_ot, first_ot +
+  // number_of_ots) in sender_data.y0/y1
+  void SendIteration(std::size_t iteration, std::size_t first_ot, std::size_t number_of_ots);
+
+  // runs one iteration as the receiver and stores the outputs for the OTs [first_ot, first_ot +
+  // number_of_ots) in receiver_data.outputs and receiver_data.random_choices
+  void ReceiveIteration(std::size_t iteration, std::size_t first_ot, std::size_t number_of_ots);
+
+  BaseProvider& motion_base_provider_;
+  SilentOtParameters parameters_;
+
+  // IKNP provider for the seed OTs of the first iteration in each direction
+  std::unique_ptr<OtExtensionData> bootstrap_data_;
+  std::unique_ptr<OtProviderFromOtExtension> bootstrap_provider_;
+  std::unique_ptr<ROtSender> bootstrap_sender_;
+  std::unique_ptr<ROtReceiver> bootstrap_receiver_;
+
+  // seed OTs of the next iteration, taken from the bootstrap OTs if the vectors are empty
+  std::vector<Block> sender_seeds_0_, sender_seeds_1_;
+  BitVector<> receiver_seed_choices_;
+  std::vector<Block> receiver_seeds_;
+
+  // futures for the messages of the iterations, registered anew in every PreSetup()
+  std::vector<ReusableFiberFuture<std::vector<std::uint8_t>>> choices_futures_;
+  std::vector<ReusableFiberFuture<std::vector<std::uint8_t>>> trees_futures_;
+};
+
+}  // namespace encrypto::motion
@@ -0,0 +1,291 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "softspoken_ot_provider.h"
+#include "base_ots/base_ot_provider.h"
+#include "ggm_tree.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "base/motion_base_provider.h"
+#include "communication/message.h"
+#include "communication/message_manager.h"
+#include "data_storage/base_ot_data.h"
+#include "data_storage/ot_extension_data.h"
+#include "primitives/aes/aesni_primitives.h"
+#include "primitives/pseudo_random_generator.h"
+#include "utility/bit_matrix.h"
+#include "utility/config.h"
+#include "utility/helpers.h"
+
+namespace encrypto::motion {
+
+namespace {
+
+// number of blocks of an expanded AES key
+constexpr std::size_t kRoundKeyBlocks{kAesRoundKeysSize128 / kAesBlockSize};
+
+// number of blocks of a matrix row that are expanded from all leaves of a tree at once
+constexpr std::size_t kChunkSize{32};
+
+void XorBlocks(Block128* destination, const Block128* source, std::size_t number_of_blocks) {
+  for (std::size_t i = 0; i < number_of_blocks; ++i) destination[i] ^= source[i];
+}
+
+// stores the expanded AES keys of the 2^depth leaves in round_keys
+void ExpandLeafKeys(const Block128* leaves, std::size_t depth, Block128* round_keys) {
+  for (std::size_t x = 0; x < (std::size_t(1) << depth); ++x) {
+    round_keys[x * kRoundKeyBlocks] = leaves[x];
+    AesniKeyExpansion128(round_keys[x * kRoundKeyBlocks].data());
+  }
+}
+
+// Computes the subspace VOLE of a block with the given depth from the leaves' keys: the leaves
+// are expanded to rows r_x, u = XOR_x r_x and column l is XOR_x x_l r_x, where x_l is the bit of
+// x taken at level l of the tree. The punctured leaf, if any, is treated as r_x = 0.
+void ExpandSubspaceVole(const Block128* round_keys, std::size_t depth, std::size_t punctured_leaf,
+                        std::uint64_t first_counter, std::size_t number_of_blocks, Block128* u,
+                        Block128Vector* columns) {
+  const std::size_t number_of_leaves{std::size_t(1) << depth};
+  Block128Vector buffer(number_of_leaves * kChunkSize);
+  for (std::size_t first = 0; first < number_of_blocks; first += kChunkSize) {
+    const std::size_t chunk_size{std::min(kChunkSize, number_of_blocks - first)};
+    for (std::size_t x = 0; x < number_of_leaves; ++x) {
+      Block128* row{buffer.data() + x * kChunkSize};
+      if (x == punctured_leaf) {
+        std::fill(row, row + chunk_size, Block128::MakeZero());
+      } else {
+        std::uint64_t counter{first_counter + first};
+        AesniCtrStreamBlocks128(round_keys[x * kRoundKeyBlocks].data(), &counter, row, chunk_size);
+      }
+    }
+    // sum up the rows bit by bit of the leaf index, i.e., from the last level to the first
+    for (std::size_t bit = 0; bit < depth; ++bit) {
+      const std::size_t stride{std::size_t(1) << bit};
+      Block128* column{columns[depth - 1 - bit].data() + first};
+      std::copy_n(buffer.data() + stride * kChunkSize, chunk_size, column);
+      XorBlocks(buffer.data(), buffer.data() + stride * kChunkSize, chunk_size);
+      for (std::size_t x = 2 * stride; x < number_of_leaves; x += 2 * stride) {
+        XorBlocks(column, buffer.data() + (x + stride) * kChunkSize, chunk_size);
+        XorBlocks(buffer.data() + x * kChunkSize, buffer.data() + (x + stride) * kChunkSize,
+                  chunk_size);
+      }
+    }
+    std::copy_n(buffer.data(), chunk_size, u + first);
+  }
+}
+
+}  // namespace
+
+OtProviderFromSoftSpokenOt::OtProviderFromSoftSpokenOt(OtExtensionData& data,
+                                                       BaseOtProvider& base_ot_provider,
+                                                       BaseProvider& motion_base_provider,
+                                                       std::size_t field_bits)
+    : OtProviderFromRandomOts(data, data.party_id),
+      base_ot_provider_(base_ot_provider),
+      motion_base_provider_(motion_base_provider),
+      field_bits_(field_bits),
+      number_of_blocks_(field_bits == 0 ? 0 : (kKappa + field_bits - 1) / field_bits) {
+  if (field_bits_ < kMinimumFieldBits || field_bits_ > kMaximumFieldBits) {
+    throw std::invalid_argument(
+        fmt::format("SoftSpokenOT supports fields of {} to {} bits, but got {}", kMinimumFieldBits,
+                    kMaximumFieldBits, field_bits_));
+  }
+  seeds_future_ = data_.message_manager.RegisterReceive(
+      data_.party_id, communication::MessageType::kSoftSpokenOtSeedMessages, 0);
+  corrections_futures_ = data_.message_manager.RegisterReceiveRange(
+      data_.party_id, communication::MessageType::kSoftSpokenOtReceiverCorrections, 1,
+      number_of_blocks_ - 1);
+}
+
+std::size_t OtProviderFromSoftSpokenOt::GetBlockDepth(std::size_t block) const {
+  return std::min(field_bits_, kKappa - block * field_bits_);
+}
+
+void OtProviderFromSoftSpokenOt::PreSetup() {
+  // the base OTs are only needed for the GGM trees, which are set up once
+  if (HasWork() && data_.base_ot_offset == std::numeric_limits<std::size_t>::max()) {
+    data_.base_ot_offset = base_ot_provider_.Request(kKappa, data_.party_id);
+  }
+}
+
+void OtProviderFromSoftSpokenOt::SendSeeds() {
+  const auto& base_ots_sender_data =
+      base_ot_provider_.GetBaseOtsData(data_.party_id).GetSenderData();
+
+  // the masked sums of the left and right children of every level of every tree, where the
+  // levels of all trees together correspond to the 128 columns
+  Block128Vector seed_messages(2 * kKappa);
+  Block128Vector level_sums(2 * field_bits_);
+  Block128Vector leaves(std::size_t(1) << field_bits_);
+  receiver_round_keys_.resize(number_of_blocks_ * leaves.size() * kRoundKeyBlocks);
+  for (std::size_t i = 0; i < number_of_blocks_; ++i) {
+    const std::size_t depth{GetBlockDepth(i)};
+    leaves[0] = Block128::MakeRandom();
+    GgmExpandTree(leaves.data(), depth, level_sums.data());
+    ExpandLeafKeys(leaves.data(), depth,
+                   receiver_round_keys_.data() + i * leaves.size() * kRoundKeyBlocks);
+    for (std::size_t level = 0; level < depth; ++level) {
+      const std::size_t base_ot{data_.base_ot_offset + i * field_bits_ + level};
+      // the sender learns the sum of the side it did not choose
+      seed_messages[2 * (i * field_bits_ + level)] =
+          level_sums[2 * level] ^ base_ots_sender_data.messages_1.at(base_ot).data();
+      seed_messages[2 * (i * field_bits_ + level) + 1] =
+          level_sums[2 * level + 1] ^ base_ots_sender_data.messages_0.at(base_ot).data();
+    }
+  }
+  auto message{communication::BuildMessage(
+      communication::MessageType::kSoftSpokenOtSeedMessages, 0,
+      std::span(reinterpret_cast<const std::uint8_t*>(seed_messages.data()),
+                seed_messages.ByteSize()))};
+  data_.send_function(std::move(message));
+}
+
+void OtProviderFromSoftSpokenOt::ReceiveSeeds() {
+  const auto& base_ots_receiver_data =
+      base_ot_provider_.GetBaseOtsData(data_.party_id).GetReceiverData();
+
+  auto raw_message{seeds_future_.get()};
+  const Block128Vector seed_messages(
+      2 * kKappa, communication::GetMessage(raw_message)->payload()->data());
+  Block128Vector sibling_sums(field_bits_);
+  Block128Vector leaves(std::size_t(1) << field_bits_);
+  sender_round_keys_.resize(number_of_blocks_ * leaves.size() * kRoundKeyBlocks);
+  punctured_leaves_.assign(number_of_blocks_, 0);
+  for (std::size_t i = 0; i < number_of_blocks_; ++i) {
+    const std::size_t depth{GetBlockDepth(i)};
+    for (std::size_t level = 0; level < depth; ++level) {
+      const std::size_t base_ot{data_.base_ot_offset + i * field_bits_ + level};
+      const bool choice{base_ots_receiver_data.c.Get(base_ot)};
+      sibling_sums[level] = seed_messages[2 * (i * field_bits_ + level) + !choice] ^
+                            base_ots_receiver_data.messages_c.at(base_ot).data();
+      punctured_leaves_[i] |= std::size_t(choice) << (depth - 1 - level);
+    }
+    GgmExpandPuncturedTree(leaves.data(), depth, punctured_leaves_[i], sibling_sums.data());
+    ExpandLeafKeys(leaves.data(), depth,
+                   sender_round_keys_.data() + i * leaves.size() * kRoundKeyBlocks);
+  }
+}
+
+void OtProviderFromSoftSpokenOt::SendSetup() {
+  const std::size_t bit_size{sender_provider_.GetNumOts()};
+  if (bit_size == 0) return;
+  data_.sender_data.bit_size = bit_size;
+  if (sender_round_keys_.size() == 0) ReceiveSeeds();
+
+  const auto& base_ots_receiver_data =
+      base_ot_provider_.GetBaseOtsData(data_.party_id).GetReceiverData();
+  const std::size_t byte_size{BitsToBytes(bit_size)};
+  const std::size_t number_of_row_blocks{(bit_size + kKappa - 1) / kKappa};
+  // bit size rounded to blocks as in IKNP
+  const auto bit_size_padded{bit_size + kKappa - (bit_size % kKappa)};
+
+  // Q_j = w_j ^ Delta_j * (u' ^ c_i) = v_j ^ Delta_j * u_0 for the columns j of block i, where
+  // w_j and u' are computed without the punctured leaf
+  std::vector<Block128Vector> rows(kKappa, Block128Vector(bit_size_padded / kKappa));
+  Block128Vector u(number_of_row_blocks);
+  const std::size_t leaves_per_block{std::size_t(1) << field_bits_};
+  for (std::size_t i = 0; i < number_of_blocks_; ++i) {
+    const std::size_t depth{GetBlockDepth(i)};
+    ExpandSubspaceVole(sender_round_keys_.data() + i * leaves_per_block * kRoundKeyBlocks, depth,
+                       punctured_leaves_[i], data_.sender_data.consumed_offset,
+                       number_of_row_blocks, u.data(), rows.data() + i * field_bits_);
+    if (i > 0) {
+      auto raw_message{corrections_futures_[i - 1].get()};
+      const auto correction{communication::GetMessage(raw_message)->payload()->data()};
+      auto u_bytes{reinterpret_cast<std::uint8_t*>(u.data())};
+      for (std::size_t b = 0; b < byte_size; ++b) u_bytes[b] ^= correction[b];
+    }
+    for (std::size_t level = 0; level < depth; ++level) {
+      if (base_ots_receiver_data.c.Get(data_.base_ot_offset + i * field_bits_ + level)) {
+        XorBlocks(rows[i * field_bits_ + level].data(), u.data(), number_of_row_blocks);
+      }
+    }
+  }
+
+  std::array<const std::byte*, kKappa> pointers;
+  for (std::size_t j = 0; j < pointers.size(); ++j) {
+    // the padding block is not expanded and cleared here
+    std::fill(rows[j].begin() + number_of_row_blocks, rows[j].end(), Block128::MakeZero());
+    pointers[j] = rows[j].data()->data();
+  }
+  primitives::Prg prg_fixed_key;
+  prg_fixed_key.SetKey(motion_base_provider_.GetAesFixedKey().data());
+  BitMatrix::SenderTranspose128AndEncrypt(
+      pointers, data_.sender_data.y0, data_.sender_data.y1,
+      base_ots_receiver_data.c.Subset(data_.base_ot_offset, data_.base_ot_offset + kKappa),
+      prg_fixed_key, bit_size_padded, data_.sender_data.bitlengths);
+
+  data_.sender_data.SetSetupIsReady();
+  SetSetupIsReady();
+}
+
+void OtProviderFromSoftSpokenOt::ReceiveSetup() {
+  const std::size_t bit_size{receiver_provider_.GetNumOts()};
+  if (bit_size == 0) return;
+  if (receiver_round_keys_.size() == 0) SendSeeds();
+
+  const std::size_t byte_size{BitsToBytes(bit_size)};
+  const std::size_t number_of_row_blocks{(bit_size + kKappa - 1) / kKappa};
+  const auto bit_size_padded{bit_size + kKappa - (bit_size % kKappa)};
+
+  // T_j = v_j and the random choices are u_0, the other blocks are corrected to u_0
+  std::vector<Block128Vector> rows(kKappa, Block128Vector(bit_size_padded / kKappa));
+  Block128Vector u_0(number_of_row_blocks), u_i(number_of_row_blocks);
+  const std::size_t leaves_per_block{std::size_t(1) << field_bits_};
+  for (std::size_t i = 0; i < number_of_blocks_; ++i) {
+    ExpandSubspaceVole(receiver_round_keys_.data() + i * leaves_per_block * kRoundKeyBlocks,
+                       GetBlockDepth(i), std::numeric_limits<std::size_t>::max(),
+                       data_.receiver_data.consumed_offset, number_of_row_blocks,
+                       i == 0 ? u_0.data() : u_i.data(), rows.data() + i * field_bits_);
+    if (i > 0) {
+      XorBlocks(u_i.data(), u_0.data(), number_of_row_blocks);
+      auto message{communication::BuildMessage(
+          communication::MessageType::kSoftSpokenOtReceiverCorrections, i,
+          std::span(reinterpret_cast<const std::uint8_t*>(u_i.data()), byte_size))};
+      data_.send_function(std::move(message));
+    }
+  }
+  data_.receiver_data.random_choices =
+      std::make_unique<AlignedBitVector>(u_0.data()->data(), bit_size);
+
+  std::array<const std::byte*, kKappa> pointers;
+  for (std::size_t j = 0; j < pointers.size(); ++j) {
+    std::fill(rows[j].begin() + number_of_row_blocks, rows[j].end(), Block128::MakeZero());
+    pointers[j] = rows[j].data()->data();
+  }
+  primitives::Prg prg_fixed_key;
+  prg_fixed_key.SetKey(motion_base_provider_.GetAesFixedKey().data());
+  BitMatrix::ReceiverTranspose128AndEncrypt(pointers, data_.receiver_data.outputs, prg_fixed_key,
+                                            bit_size_padded, data_.receiver_data.bitlengths);
+
+  data_.receiver_data.SetSetupIsReady();
+  SetSetupIsReady();
+}
+
+}  // namespace encrypto::motion
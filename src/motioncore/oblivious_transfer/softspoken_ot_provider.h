@@ -0,0 +1,90 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ot_provider.h"
+#include "utility/block.h"
+#include "utility/reusable_future.h"
+
+namespace encrypto::motion {
+
+// Generates the random OTs of the flavors in ot_flavors.h with SoftSpokenOT (Roy,
+// https://eprint.iacr.org/2022/192), which generalizes IKNP from OTs over F_2 to small-field
+// subspace VOLE over F_{2^k}. The 128 columns of the IKNP matrix are split into blocks of k
+// columns. For every block, the receiver knows all 2^k leaves of a GGM tree and the sender
+// knows all leaves but the one at its k bits of Delta. Both expand the leaves with AES in counter
+// mode and reduce them to the k columns of the matrix, such that only one correction per block
+// has to be sent instead of one per column. Thus, the communication is ceil(128 / k) instead of
+// 128 bits per OT, at the cost of 2^k / k times more AES evaluations. The GGM trees are set up
+// once from the usual 128 base OTs and used for all later OT extensions.
+//
+// Like IKNP, the protocol is secure against semi-honest adversaries.
+class OtProviderFromSoftSpokenOt final : public OtProviderFromRandomOts {
+ public:
+  static constexpr std::size_t kMinimumFieldBits{2};
+  static constexpr std::size_t kMaximumFieldBits{8};
+
+  // throws std::invalid_argument if field_bits is not in [kMinimumFieldBits, kMaximumFieldBits]
+  OtProviderFromSoftSpokenOt(OtExtensionData& data, BaseOtProvider& base_ot_provider,
+                             BaseProvider& motion_base_provider, std::size_t field_bits);
+
+  void SendSetup() final;
+
+  void ReceiveSetup() final;
+
+  void PreSetup() final;
+
+  std::size_t GetFieldBits() const { return field_bits_; }
+
+ private:
+  // number of columns of block i, i.e., the depth of its GGM tree
+  std::size_t GetBlockDepth(std::size_t block) const;
+
+  // builds the GGM trees and sends the sums of their levels to the sender
+  void SendSeeds();
+
+  // receives the sums of the levels and reconstructs the punctured GGM trees
+  void ReceiveSeeds();
+
+  BaseOtProvider& base_ot_provider_;
+  BaseProvider& motion_base_provider_;
+  const std::size_t field_bits_;
+  const std::size_t number_of_blocks_;
+
+  // expanded AES keys of the leaves of all blocks' GGM trees, empty until the first OT extension
+  // of the respective direction
+  Block128Vector sender_round_keys_, receiver_round_keys_;
+  // the leaves of the sender's tree of block i that are unknown to it, i.e., its bits of Delta
+  std::vector<std::size_t> punctured_leaves_;
+
+  ReusableFiberFuture<std::vector<std::uint8_t>> seeds_future_;
+  // corrections of the blocks 1, ..., number_of_blocks_ - 1
+  std::vector<ReusableFiberFuture<std::vector<std::uint8_t>>> corrections_futures_;
+};
+
+}  // namespace encrypto::motion
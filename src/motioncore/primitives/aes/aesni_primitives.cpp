@@ -457,3 +457,57 @@ void AesniBmrDkc(const void* round_keys_input, const void* key_a, const void* ke
     out[party_id] ^= AesniXorEncrypt(round_keys, tmp);
   }
 }
+
+void AesniGgmExpand(const void* round_keys_0_input, const void* round_keys_1_input,
+                    const void* parents_input, void* children_input,
+                    std::size_t number_of_parents) {
+  alignas(16) std::array<__m128i, kAesNumRoundKeys128> round_keys_0, round_keys_1;
+  alignas(16) std::array<__m128i, 4> parents_batch;
+  alignas(16) std::array<__m128i, 8> wb;
+  auto parents =
+      reinterpret_cast<const __m128i*>(__builtin_assume_aligned(parents_input, kAesBlockSize));
+  auto children =
+      reinterpret_cast<__m128i*>(__builtin_assume_aligned(children_input, kAesBlockSize));
+
+  // copy the round keys onto the stack
+  // -> compiler will put them into registers
+  std::copy_n(reinterpret_cast<const __m128i*>(
+                  __builtin_assume_aligned(round_keys_0_input, kAesBlockSize)),
+              kAesNumRoundKeys128, round_keys_0.data());
+  std::copy_n(reinterpret_cast<const __m128i*>(
+                  __builtin_assume_aligned(round_keys_1_input, kAesBlockSize)),
+              kAesNumRoundKeys128, round_keys_1.data());
+
+  // the last parents that do not fill a batch of 4
+  std::size_t i = number_of_parents;
+  while (i % 4 != 0) {
+    --i;
+    const __m128i parent = parents[i];
+    children[2 * i] = AesniXorEncrypt(round_keys_0.data(), parent);
+    children[2 * i + 1] = AesniXorEncrypt(round_keys_1.data(), parent);
+  }
+
+  // 4er batches of parents, i.e., 8 interleaved AES invocations to hide the latency of aesenc
+  while (i != 0) {
+    i -= 4;
+    // load all parents of the batch before any of their children overwrite them
+    for (std::size_t j = 0; j < 4; ++j) parents_batch[j] = parents[i + j];
+    for (std::size_t j = 0; j < 4; ++j) {
+      wb[2 * j] = _mm_xor_si128(parents_batch[j], round_keys_0[0]);
+      wb[2 * j + 1] = _mm_xor_si128(parents_batch[j], round_keys_1[0]);
+    }
+    for (std::size_t r = 1; r < kAesNumRoundKeys128 - 1; ++r) {
+      for (std::size_t j = 0; j < 4; ++j) {
+        wb[2 * j] = _mm_aesenc_si128(wb[2 * j], round_keys_0[r]);
+        wb[2 * j + 1] = _mm_aesenc_si128(wb[2 * j + 1], round_keys_1[r]);
+      }
+    }
+    for (std::size_t j = 0; j < 4; ++j) {
+      wb[2 * j] = _mm_aesenclast_si128(wb[2 * j], round_keys_0[kAesNumRoundKeys128 - 1]);
+      wb[2 * j + 1] = _mm_aesenclast_si128(wb[2 * j + 1], round_keys_1[kAesNumRoundKeys128 - 1]);
+    }
+    for (std::size_t j = 0; j < 8; ++j) {
+      children[2 * i + j] = _mm_xor_si128(wb[j], parents_batch[j / 2]);
+    }
+  }
+}
@@ -97,3 +97,13 @@ void AesniMmoSingle(const void* round_keys, void* input);
 // The output is xored into `output`.
 void AesniBmrDkc(const void* round_keys, const void* key_a, const void* key_b,
                  std::uint64_t gate_id, std::size_t number_of_parties, void* output);
+
+// Expand one level of a GGM tree to the next level with the fixed-key construction
+//    children[2 i]     = \pi_0(parents[i]) ^ parents[i]
+//    children[2 i + 1] = \pi_1(parents[i]) ^ parents[i]
+// where \pi_0 and \pi_1 are AES with the expanded keys from `round_keys_0` and `round_keys_1`.
+// The parents are processed from the last to the first, so `children` may equal `parents`.
+//
+// * round_keys, parents and children are 16B aligned
+void AesniGgmExpand(const void* round_keys_0, const void* round_keys_1, const void* parents,
+                    void* children, std::size_t number_of_parents);
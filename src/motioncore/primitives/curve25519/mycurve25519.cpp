@@ -38,6 +38,8 @@
 #include <cstdlib>
 #include <cstring>
 
+#include "primitives/random/aes128_ctr_rng.h"
+
 namespace encrypto::motion::curve25519 {
 #include "mycurve25519_tables.h"  // Various pre-computed constants.
 //#include "util.h"
@@ -5227,6 +5229,11 @@ static void x25519_scalar_mult
 #include "stdio.h"
 
 void RandomBytes(void* buf, size_t nbytes) {
+  // in reproducible runs, the randomness is drawn from the seeded stream of the fiber
+  if (auto* generator = encrypto::motion::SeededRandomStream::GetCurrentGenerator()) {
+    generator->RandomBytes(reinterpret_cast<std::byte*>(buf), nbytes);
+    return;
+  }
   int random = RAND_bytes(reinterpret_cast<unsigned char*>(buf), nbytes);
   if (random != 1) {
     fprintf(stderr, "RAND_bytes failed");
@@ -22,6 +22,7 @@
 
 #include "aes128_ctr_rng.h"
 
+#include <algorithm>
 #include <array>
 #include <fstream>
 #include <openssl/rand.h>
@@ -39,6 +40,13 @@ struct Aes128CtrRng::Aes128CtrRngState {
 
 Aes128CtrRng::Aes128CtrRng() : state_(std::make_unique<Aes128CtrRngState>()) { SampleKey(); }
 
+Aes128CtrRng::Aes128CtrRng(const std::array<std::byte, kBlockSize>& key)
+    : state_(std::make_unique<Aes128CtrRngState>()) {
+  std::copy(key.begin(), key.end(), state_->round_keys.begin());
+  AesniKeyExpansion128(state_->round_keys.data());
+  state_->counter = 0;
+}
+
 Aes128CtrRng::~Aes128CtrRng() = default;
 
 void Aes128CtrRng::SampleKey() {
@@ -22,9 +22,11 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <memory>
 #include "rng.h"
+#include "seeded_random_stream.h"
 
 namespace encrypto::motion {
 
@@ -32,6 +34,8 @@ namespace encrypto::motion {
 class Aes128CtrRng : public Rng {
  public:
   Aes128CtrRng();
+  // initialize the PRG with the given key, s.t. it outputs a reproducible stream
+  explicit Aes128CtrRng(const std::array<std::byte, kBlockSize>& key);
   virtual ~Aes128CtrRng();
 
   // delete copy/move constructors/assignment operators
@@ -53,7 +57,12 @@ class Aes128CtrRng : public Rng {
   // where the buffer needs to be aligned at a multiple of kBlockSize
   virtual void RandomBlocksAligned(std::byte* output, std::size_t number_of_blocks) override;
 
-  static Aes128CtrRng& GetThreadInstance() { return thread_instance_; }
+  // the generator of the SeededRandomStream of the current fiber if there is one, otherwise the
+  // generator of the current thread
+  static Aes128CtrRng& GetThreadInstance() {
+    if (auto* generator = SeededRandomStream::GetCurrentGenerator()) return *generator;
+    return thread_instance_;
+  }
 
   static constexpr std::size_t kBlockSize = 16;
 
@@ -24,7 +24,9 @@
 
 #include <cstddef>
 #include <memory>
+#include "aes128_ctr_rng.h"
 #include "rng.h"
+#include "seeded_random_stream.h"
 
 namespace encrypto::motion {
 
@@ -60,7 +62,12 @@ class OpenSslRng : public Rng {
 
   static constexpr std::size_t kBlockSize = 16;
 
-  static Rng& GetThreadInstance() { return instance_; }
+  // the generator of the SeededRandomStream of the current fiber if there is one, otherwise the
+  // global instance
+  static Rng& GetThreadInstance() {
+    if (auto* generator = SeededRandomStream::GetCurrentGenerator()) return *generator;
+    return instance_;
+  }
 
  private:
   static OpenSslRng instance_;
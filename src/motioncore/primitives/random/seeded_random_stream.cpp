@@ -0,0 +1,91 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "seeded_random_stream.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/fiber/fss.hpp>
+
+#include "aes128_ctr_rng.h"
+#include "primitives/blake2b.h"
+
+namespace encrypto::motion {
+
+std::atomic<std::size_t> SeededRandomStream::number_of_streams_{0};
+
+// the innermost stream of each fiber, which is not deleted by the storage, since the streams are
+// owned by their creators
+static boost::fibers::fiber_specific_ptr<SeededRandomStream>& GetFiberStream() {
+  static boost::fibers::fiber_specific_ptr<SeededRandomStream> stream([](SeededRandomStream*) {});
+  return stream;
+}
+
+SeededRandomStream::SeededRandomStream(const Seed& seed, std::string_view label)
+    : seed_(DeriveSeed(seed, label)),
+      generator_(std::make_unique<Aes128CtrRng>(seed_)),
+      previous_stream_(GetFiberStream().release()) {
+  GetFiberStream().reset(this);
+  number_of_streams_.fetch_add(1, std::memory_order_relaxed);
+}
+
+SeededRandomStream::~SeededRandomStream() {
+  GetFiberStream().reset(previous_stream_);
+  number_of_streams_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+const SeededRandomStream::Seed& SeededRandomStream::GetSeed() const { return seed_; }
+
+std::optional<SeededRandomStream::Seed> SeededRandomStream::GetCurrentSeed() {
+  if (number_of_streams_.load(std::memory_order_relaxed) == 0) return std::nullopt;
+  const auto* stream{GetFiberStream().get()};
+  if (stream == nullptr) return std::nullopt;
+  return stream->seed_;
+}
+
+Aes128CtrRng* SeededRandomStream::GetCurrentGeneratorOfFiber() {
+  auto* stream{GetFiberStream().get()};
+  return stream == nullptr ? nullptr : stream->generator_.get();
+}
+
+SeededRandomStream::Seed SeededRandomStream::DeriveSeed(const Seed& seed, std::string_view label) {
+  std::vector<std::uint8_t> hash_input(seed.size() + label.size());
+  std::transform(seed.begin(), seed.end(), hash_input.begin(),
+                 [](std::byte b) { return std::to_integer<std::uint8_t>(b); });
+  std::copy(label.begin(), label.end(), hash_input.begin() + seed.size());
+  std::array<std::uint8_t, EVP_MAX_MD_SIZE> hash_output;
+  Blake2b(hash_input.data(), hash_output.data(), hash_input.size());
+  Seed derived_seed;
+  std::transform(hash_output.begin(), hash_output.begin() + derived_seed.size(),
+                 derived_seed.begin(), [](std::uint8_t b) { return std::byte(b); });
+  return derived_seed;
+}
+
+std::optional<SeededRandomStream> MakeSeededRandomStream(
+    const std::optional<SeededRandomStream::Seed>& seed, std::string_view label) {
+  if (!seed) return std::nullopt;
+  return std::optional<SeededRandomStream>(std::in_place, *seed, label);
+}
+
+}  // namespace encrypto::motion
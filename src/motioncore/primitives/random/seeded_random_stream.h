@@ -0,0 +1,92 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace encrypto::motion {
+
+class Aes128CtrRng;
+
+// A SeededRandomStream makes DefaultRng::GetThreadInstance() return a generator keyed with a key
+// derived from a seed and a label in the current fiber, or the current thread outside of fibers,
+// until the stream is destroyed. If the draws of a fiber or thread only depend on its label, e.g.,
+// the id of the gate it evaluates, the local randomness of a party and thereby its whole evaluation
+// can be reproduced independent of the scheduling of the fibers and threads, e.g., to replay it
+// from the messages recorded by RecordingTransports.
+//
+// Streams are for profiling and testing only, since the randomness is only as secret as the seed.
+// A stream restores the one it replaced on destruction, and thus has to be destroyed in the fiber
+// which created it.
+class SeededRandomStream {
+ public:
+  using Seed = std::array<std::byte, 16>;
+
+  SeededRandomStream(const Seed& seed, std::string_view label);
+  ~SeededRandomStream();
+
+  SeededRandomStream(const SeededRandomStream&) = delete;
+  SeededRandomStream(SeededRandomStream&&) = delete;
+  SeededRandomStream& operator=(const SeededRandomStream&) = delete;
+  SeededRandomStream& operator=(SeededRandomStream&&) = delete;
+
+  // the seed for the streams of the tasks started by this one, i.e., the seed derived from the seed
+  // and label of this stream
+  const Seed& GetSeed() const;
+
+  // the seed of the innermost stream of the current fiber, std::nullopt if there is none
+  static std::optional<Seed> GetCurrentSeed();
+
+  // the generator of the innermost stream of the current fiber, nullptr if there is none
+  static Aes128CtrRng* GetCurrentGenerator() {
+    if (number_of_streams_.load(std::memory_order_relaxed) == 0) return nullptr;
+    return GetCurrentGeneratorOfFiber();
+  }
+
+  // Blake2b(seed || label) truncated to the size of a seed
+  static Seed DeriveSeed(const Seed& seed, std::string_view label);
+
+ private:
+  static Aes128CtrRng* GetCurrentGeneratorOfFiber();
+
+  // number of streams in all fibers, s.t. the fiber-specific storage is only accessed if a stream
+  // exists
+  static std::atomic<std::size_t> number_of_streams_;
+
+  Seed seed_;
+  std::unique_ptr<Aes128CtrRng> generator_;
+  SeededRandomStream* previous_stream_;
+};
+
+// Create a stream for seed and label if there is a seed, s.t. code can seed the randomness of a
+// task in the same way for runs with and without a seed
+std::optional<SeededRandomStream> MakeSeededRandomStream(
+    const std::optional<SeededRandomStream::Seed>& seed, std::string_view label);
+
+}  // namespace encrypto::motion
@@ -142,7 +142,7 @@ void InputGate<T>::EvaluateOnline() {
 template <typename T>
 arithmetic_gmw::SharePointer<T> InputGate<T>::GetOutputAsArithmeticShare() {
   auto arithmetic_wire = GetOutputArithmeticWire();
-  auto result = std::make_shared<arithmetic_gmw::Share<T>>(arithmetic_wire);
+  auto result = backend_.GetRegister()->EmplaceShare<arithmetic_gmw::Share<T>>(arithmetic_wire);
   return result;
 }
 
@@ -243,17 +243,13 @@ void OutputGate<T>::EvaluateOnline() {
 
   // we need to send shares to one other party:
   if (!is_my_output_) {
-    auto payload = ToByteVector<T>(output);
-    auto msg{
-        communication::BuildMessage(communication::MessageType::kOutputMessage, gate_id_, payload)};
-    communication_layer.SendMessage(output_owner_, msg.Release());
+    communication_layer.SendFastMessage(output_owner_, communication::MessageType::kOutputMessage,
+                                        gate_id_, std::vector<T>(output));
   }
   // we need to send shares to all other parties:
   else if (output_owner_ == kAll) {
-    auto payload = ToByteVector<T>(output);
-    auto msg{
-        communication::BuildMessage(communication::MessageType::kOutputMessage, gate_id_, payload)};
-    communication_layer.BroadcastMessage(msg.Release());
+    communication_layer.BroadcastFastMessage(communication::MessageType::kOutputMessage, gate_id_,
+                                             std::vector<T>(output));
   }
 
   // we receive shares from other parties
@@ -267,11 +263,10 @@ void OutputGate<T>::EvaluateOnline() {
         shared_outputs.push_back(output);
         continue;
       }
-      const auto output_message = output_message_futures_.at(i > my_id ? i - 1 : i).get();
-      auto message = communication::GetMessage(output_message.data());
-
-      const auto& fb_vector{*message->payload()};
-      shared_outputs.push_back(FromByteVector<T>(std::span(fb_vector.Data(), fb_vector.size())));
+      auto output_message = output_message_futures_.at(i > my_id ? i - 1 : i).get();
+      shared_outputs.push_back(
+          FromByteVector<T>(communication::GetFastMessagePayload(output_message)));
+      communication_layer.GetMessageManager().ReleaseMessage(std::move(output_message));
       assert(shared_outputs[i].size() == parent_[0]->GetNumberOfSimdValues());
     }
 
@@ -309,11 +304,25 @@ void OutputGate<T>::EvaluateOnline() {
   }
 }
 
+template <typename T>
+GateCost OutputGate<T>::GetCost() const {
+  const auto number_of_parties = backend_.GetCommunicationLayer().GetNumberOfParties();
+  const auto payload_size = parent_.at(0)->GetNumberOfSimdValues() * sizeof(T);
+  GateCost cost;
+  cost.online_rounds = 1;
+  if (static_cast<std::size_t>(output_owner_) == kAll) {
+    cost.online_bytes_sent = (number_of_parties - 1) * payload_size;
+  } else if (!is_my_output_) {
+    cost.online_bytes_sent = payload_size;
+  }
+  return cost;
+}
+
 template <typename T>
 arithmetic_gmw::SharePointer<T> OutputGate<T>::GetOutputAsArithmeticShare() {
   auto arithmetic_wire = std::dynamic_pointer_cast<arithmetic_gmw::Wire<T>>(output_wires_.at(0));
   assert(arithmetic_wire);
-  auto result = std::make_shared<arithmetic_gmw::Share<T>>(arithmetic_wire);
+  auto result = backend_.GetRegister()->EmplaceShare<arithmetic_gmw::Share<T>>(arithmetic_wire);
   return result;
 }
 
@@ -370,7 +379,7 @@ template <typename T>
 arithmetic_gmw::SharePointer<T> AdditionGate<T>::GetOutputAsArithmeticShare() {
   auto arithmetic_wire = std::dynamic_pointer_cast<arithmetic_gmw::Wire<T>>(output_wires_.at(0));
   assert(arithmetic_wire);
-  auto result = std::make_shared<arithmetic_gmw::Share<T>>(arithmetic_wire);
+  auto result = backend_.GetRegister()->EmplaceShare<arithmetic_gmw::Share<T>>(arithmetic_wire);
   return result;
 }
 
@@ -427,7 +436,7 @@ template <typename T>
 arithmetic_gmw::SharePointer<T> SubtractionGate<T>::GetOutputAsArithmeticShare() {
   auto arithmetic_wire = std::dynamic_pointer_cast<arithmetic_gmw::Wire<T>>(output_wires_.at(0));
   assert(arithmetic_wire);
-  auto result = std::make_shared<arithmetic_gmw::Share<T>>(arithmetic_wire);
+  auto result = backend_.GetRegister()->EmplaceShare<arithmetic_gmw::Share<T>>(arithmetic_wire);
   return result;
 }
 
@@ -549,11 +558,21 @@ void MultiplicationGate<T>::EvaluateOnline() {
       fmt::format("Evaluated arithmetic_gmw::MultiplicationGate with id#{}", gate_id_));
 }
 
+template <typename T>
+GateCost MultiplicationGate<T>::GetCost() const {
+  GateCost cost;
+  cost.number_of_multiplications = number_of_mts_;
+  cost.multiplicative_depth = 1;
+  // d and e are opened by the output sub-gates, which account the communication
+  cost.online_rounds = 1;
+  return cost;
+}
+
 template <typename T>
 arithmetic_gmw::SharePointer<T> MultiplicationGate<T>::GetOutputAsArithmeticShare() {
   auto arithmetic_wire = std::dynamic_pointer_cast<arithmetic_gmw::Wire<T>>(output_wires_.at(0));
   assert(arithmetic_wire);
-  auto result = std::make_shared<arithmetic_gmw::Share<T>>(arithmetic_wire);
+  auto result = backend_.GetRegister()->EmplaceShare<arithmetic_gmw::Share<T>>(arithmetic_wire);
   return result;
 }
 
@@ -658,11 +677,23 @@ void HybridMultiplicationGate<T>::EvaluateOnline() {
       fmt::format("Evaluated arithmetic_gmw::HybridMultiplicationGate with id#{}", gate_id_));
 }
 
+template <typename T>
+GateCost HybridMultiplicationGate<T>::GetCost() const {
+  const auto number_of_simd = parent_a_.at(0)->GetNumberOfSimdValues();
+  GateCost cost;
+  cost.number_of_multiplications = number_of_simd;
+  cost.multiplicative_depth = 1;
+  // the OT senders wait for the corrections of the receivers
+  cost.online_rounds = 2;
+  cost.online_bytes_sent = BitsToBytes(number_of_simd) + number_of_simd * sizeof(T);
+  return cost;
+}
+
 template <typename T>
 arithmetic_gmw::SharePointer<T> HybridMultiplicationGate<T>::GetOutputAsArithmeticShare() {
   auto arithmetic_wire = std::dynamic_pointer_cast<arithmetic_gmw::Wire<T>>(output_wires_.at(0));
   assert(arithmetic_wire);
-  auto result = std::make_shared<arithmetic_gmw::Share<T>>(arithmetic_wire);
+  auto result = backend_.GetRegister()->EmplaceShare<arithmetic_gmw::Share<T>>(arithmetic_wire);
   return result;
 }
 
@@ -751,11 +782,21 @@ void SquareGate<T>::EvaluateOnline() {
   GetLogger().LogDebug(fmt::format("Evaluated arithmetic_gmw::SquareGate with id#{}", gate_id_));
 }
 
+template <typename T>
+GateCost SquareGate<T>::GetCost() const {
+  GateCost cost;
+  cost.number_of_multiplications = number_of_sps_;
+  cost.multiplicative_depth = 1;
+  // d is opened by the output sub-gate, which accounts the communication
+  cost.online_rounds = 1;
+  return cost;
+}
+
 template <typename T>
 arithmetic_gmw::SharePointer<T> SquareGate<T>::GetOutputAsArithmeticShare() {
   auto arithmetic_wire = std::dynamic_pointer_cast<arithmetic_gmw::Wire<T>>(output_wires_.at(0));
   assert(arithmetic_wire);
-  auto result = std::make_shared<arithmetic_gmw::Share<T>>(arithmetic_wire);
+  auto result = backend_.GetRegister()->EmplaceShare<arithmetic_gmw::Share<T>>(arithmetic_wire);
   return result;
 }
 
@@ -1013,7 +1054,7 @@ void GreaterThanGate<T>::EvaluateOnline() {
 
 template <typename T>
 const boolean_gmw::SharePointer GreaterThanGate<T>::GetOutputAsGmwShare() {
-  auto result = std::make_shared<boolean_gmw::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<boolean_gmw::Share>(output_wires_);
   assert(result);
   return result;
 }
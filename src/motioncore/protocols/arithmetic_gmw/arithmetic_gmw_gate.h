@@ -105,6 +105,8 @@ class OutputGate final : public motion::OutputGate {
 
   bool NeedsSetup() const override { return false; }
 
+  GateCost GetCost() const override;
+
   // perhaps, we should return a copy of the pointer and not move it for the  case we need it
   // multiple times
   arithmetic_gmw::SharePointer<T> GetOutputAsArithmeticShare();
@@ -168,6 +170,8 @@ class MultiplicationGate final : public motion::TwoGate {
 
   bool NeedsSetup() const override { return false; }
 
+  GateCost GetCost() const override;
+
   // perhaps, we should return a copy of the pointer and not move it for the case we need it
   // multiple times
   arithmetic_gmw::SharePointer<T> GetOutputAsArithmeticShare();
@@ -197,6 +201,8 @@ class HybridMultiplicationGate final : public motion::TwoGate {
 
   bool NeedsSetup() const override { return false; }
 
+  GateCost GetCost() const override;
+
   // perhaps, we should return a copy of the pointer and not move it for the
   // case we need it multiple times
   arithmetic_gmw::SharePointer<T> GetOutputAsArithmeticShare();
@@ -221,6 +227,8 @@ class SquareGate final : public motion::OneGate {
 
   bool NeedsSetup() const override { return false; }
 
+  GateCost GetCost() const override;
+
   // perhaps, we should return a copy of the pointer and not move it for the case we need it
   // multiple times
   arithmetic_gmw::SharePointer<T> GetOutputAsArithmeticShare();
@@ -58,6 +58,10 @@ class Wire final : public motion::Wire {
 
   bool IsConstant() const noexcept final { return false; }
 
+  std::size_t GetPayloadSize() const noexcept final { return values_.size() * sizeof(T); }
+
+  void ReleasePayload() final { values_ = std::vector<T>(); }
+
  private:
   std::vector<T> values_;
 };
@@ -248,7 +248,7 @@ void InputGate<T>::EvaluateOnline() {
 
   } else if (my_id != 0) {
     auto input_message{input_future_.get()};
-    auto payload{communication::GetMessage(input_message.data())->payload()};
+    auto payload{communication::GetMessage(input_message)->payload()};
     auto buffer = FromByteVector<T>({payload->Data(), payload->size()});
     assert(buffer.size() == values.size());
     for (auto i = 0u; i != buffer.size(); ++i) {
@@ -265,7 +265,7 @@ template <typename T>
 astra::SharePointer<T> InputGate<T>::GetOutputAsAstraShare() {
   auto wire = std::dynamic_pointer_cast<astra::Wire<T>>(output_wires_.at(0));
   assert(wire);
-  return std::make_shared<astra::Share<T>>(wire);
+  return backend_.GetRegister()->EmplaceShare<astra::Share<T>>(wire);
 }
 
 template class InputGate<std::uint8_t>;
@@ -341,16 +341,13 @@ void OutputGate<T>::EvaluateOnline() {
 
       // send output message
       if (output_owner_ == 2 || output_owner_ == kAll) {
-        auto payload = ToByteVector<T>(message_lambda1s);
-
-        auto message{communication::BuildMessage(communication::MessageType::kAstraOutputGate,
-                                                 gate_id_, payload)};
-        communication_layer.SendMessage(2, message.Release());
+        communication_layer.SendFastMessage(2, communication::MessageType::kAstraOutputGate,
+                                            gate_id_, std::move(message_lambda1s));
       }
 
       const auto output_message{output_future_.get()};
-      const auto payload{communication::GetMessage(output_message.data())->payload()};
-      auto received_values = FromByteVector<T>({payload->Data(), payload->size()});
+      auto received_values =
+          FromByteVector<T>(communication::GetFastMessagePayload(output_message));
       assert(received_values.size() == in_values.size());
       for (auto i = 0u; i != received_values.size(); ++i) {
         auto& in = in_values[i];
@@ -365,16 +362,13 @@ void OutputGate<T>::EvaluateOnline() {
       }
 
       if (output_owner_ == 0 || output_owner_ == kAll) {
-        auto payload = ToByteVector<T>(message_values);
-        auto message{communication::BuildMessage(communication::MessageType::kAstraOutputGate,
-                                                 gate_id_, payload)};
-        communication_layer.SendMessage(0, message.Release());
+        communication_layer.SendFastMessage(0, communication::MessageType::kAstraOutputGate,
+                                            gate_id_, std::move(message_values));
       }
 
       if (output_owner_ == my_id || output_owner_ == kAll) {
         const auto message{output_future_.get()};
-        const auto payload{communication::GetMessage(message.data())->payload()};
-        auto received_lambda2s = FromByteVector<T>({payload->Data(), payload->size()});
+        auto received_lambda2s = FromByteVector<T>(communication::GetFastMessagePayload(message));
         assert(received_lambda2s.size() == in_values.size());
         for (auto i = 0u; i != received_lambda2s.size(); ++i) {
           auto& in = in_values[i];
@@ -390,16 +384,13 @@ void OutputGate<T>::EvaluateOnline() {
       }
 
       if (output_owner_ == 1 || output_owner_ == kAll) {
-        auto payload = ToByteVector<T>(message_lambda2s);
-        auto message{communication::BuildMessage(communication::MessageType::kAstraOutputGate,
-                                                 gate_id_, payload)};
-        communication_layer.SendMessage(1, message.Release());
+        communication_layer.SendFastMessage(1, communication::MessageType::kAstraOutputGate,
+                                            gate_id_, std::move(message_lambda2s));
       }
 
       if (output_owner_ == my_id || output_owner_ == kAll) {
         const auto message{output_future_.get()};
-        const auto payload{communication::GetMessage(message.data())->payload()};
-        auto received_lambda1s = FromByteVector<T>({payload->Data(), payload->size()});
+        auto received_lambda1s = FromByteVector<T>(communication::GetFastMessagePayload(message));
         assert(received_lambda1s.size() == in_values.size());
         for (auto i = 0u; i != received_lambda1s.size(); ++i) {
           auto& in = in_values[i];
@@ -422,7 +413,7 @@ template <typename T>
 astra::SharePointer<T> OutputGate<T>::GetOutputAsAstraShare() {
   auto wire = std::dynamic_pointer_cast<astra::Wire<T>>(output_wires_.at(0));
   assert(wire);
-  return std::make_shared<astra::Share<T>>(wire);
+  return backend_.GetRegister()->EmplaceShare<astra::Share<T>>(wire);
 }
 
 template class OutputGate<std::uint8_t>;
@@ -546,7 +537,7 @@ template <typename T>
 astra::SharePointer<T> AdditionGate<T>::GetOutputAsAstraShare() {
   auto wire = std::dynamic_pointer_cast<astra::Wire<T>>(output_wires_.at(0));
   assert(wire);
-  return std::make_shared<astra::Share<T>>(wire);
+  return backend_.GetRegister()->EmplaceShare<astra::Share<T>>(wire);
 }
 
 template class AdditionGate<std::uint8_t>;
@@ -668,7 +659,7 @@ template <typename T>
 astra::SharePointer<T> SubtractionGate<T>::GetOutputAsAstraShare() {
   auto wire = std::dynamic_pointer_cast<astra::Wire<T>>(output_wires_.at(0));
   assert(wire);
-  return std::make_shared<astra::Share<T>>(wire);
+  return backend_.GetRegister()->EmplaceShare<astra::Share<T>>(wire);
 }
 
 template class SubtractionGate<std::uint8_t>;
@@ -785,7 +776,7 @@ void MultiplicationGate<T>::EvaluateSetup() {
       assert(randoms0.size() == out_values.size());
 
       const auto message{multiply_future_setup_.get()};
-      const auto payload{communication::GetMessage(message.data())->payload()};
+      const auto payload{communication::GetMessage(message)->payload()};
       std::vector<T> message_gamma_ab_2 = FromByteVector<T>({payload->Data(), payload->size()});
       assert(message_gamma_ab_2.size() == out_values.size());
 
@@ -841,15 +832,11 @@ void MultiplicationGate<T>::EvaluateOnline() {
         }
         assert(message_values.size() == out_values.size());
 
-        {
-          auto payload = ToByteVector<T>(message_values);
-          auto message{communication::BuildMessage(
-              communication::MessageType::kAstraOnlineMultiplyGate, gate_id_, payload)};
-          communication_layer.SendMessage(2, message.Release());
-        }
+        communication_layer.SendFastMessage(
+            2, communication::MessageType::kAstraOnlineMultiplyGate, gate_id_,
+            std::move(message_values));
         const auto multiply_message{multiply_future_online_.get()};
-        const auto payload{communication::GetMessage(multiply_message.data())->payload()};
-        message_values = FromByteVector<T>({payload->Data(), payload->size()});
+        message_values = FromByteVector<T>(communication::GetFastMessagePayload(multiply_message));
         assert(message_values.size() == out_values.size());
 
         for (auto i = 0u; i != out_values.size(); ++i) {
@@ -875,16 +862,12 @@ void MultiplicationGate<T>::EvaluateOnline() {
         }
         assert(message_values.size() == out_values.size());
 
-        {
-          auto payload = ToByteVector<T>(message_values);
-          auto message{communication::BuildMessage(
-              communication::MessageType::kAstraOnlineMultiplyGate, gate_id_, payload)};
-          communication_layer.SendMessage(1, message.Release());
-        }
+        communication_layer.SendFastMessage(
+            1, communication::MessageType::kAstraOnlineMultiplyGate, gate_id_,
+            std::move(message_values));
 
         const auto message{multiply_future_online_.get()};
-        const auto payload{communication::GetMessage(message.data())->payload()};
-        message_values = FromByteVector<T>({payload->Data(), payload->size()});
+        message_values = FromByteVector<T>(communication::GetFastMessagePayload(message));
         assert(message_values.size() == out_values.size());
 
         for (auto i = 0u; i != out_values.size(); ++i) {
@@ -903,7 +886,7 @@ template <typename T>
 astra::SharePointer<T> MultiplicationGate<T>::GetOutputAsAstraShare() {
   auto wire = std::dynamic_pointer_cast<astra::Wire<T>>(output_wires_.at(0));
   assert(wire);
-  return std::make_shared<astra::Share<T>>(wire);
+  return backend_.GetRegister()->EmplaceShare<astra::Share<T>>(wire);
 }
 
 template class MultiplicationGate<std::uint8_t>;
@@ -1022,7 +1005,7 @@ void DotProductGate<T>::EvaluateSetup() {
       assert(randoms0.size() == out_values.size());
 
       const auto message{dot_product_future_setup_.get()};
-      const auto payload{communication::GetMessage(message.data())->payload()};
+      const auto payload{communication::GetMessage(message)->payload()};
       std::vector<T> message_gamma_ab_2 = FromByteVector<T>({payload->Data(), payload->size()});
       assert(message_gamma_ab_2.size() == out_values.size());
       for (auto i = 0u; i != out_values.size(); ++i) {
@@ -1111,7 +1094,7 @@ void DotProductGate<T>::EvaluateOnline() {
     }
 
     const auto message{dot_product_future_online_.get()};
-    const auto payload{communication::GetMessage(message.data())->payload()};
+    const auto payload{communication::GetMessage(message)->payload()};
     message_values = FromByteVector<T>({payload->Data(), payload->size()});
     assert(message_values.size() == out_values.size());
 
@@ -1127,7 +1110,7 @@ template <typename T>
 astra::SharePointer<T> DotProductGate<T>::GetOutputAsAstraShare() {
   auto wire = std::dynamic_pointer_cast<astra::Wire<T>>(output_wires_.at(0));
   assert(wire);
-  return std::make_shared<astra::Share<T>>(wire);
+  return backend_.GetRegister()->EmplaceShare<astra::Share<T>>(wire);
 }
 
 template class DotProductGate<std::uint8_t>;
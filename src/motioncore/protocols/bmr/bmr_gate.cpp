@@ -37,6 +37,7 @@
 #include "primitives/pseudo_random_generator.h"
 #include "protocols/boolean_gmw/boolean_gmw_wire.h"
 #include "utility/block.h"
+#include "utility/helpers.h"
 
 namespace encrypto::motion::proto::bmr {
 
@@ -198,7 +199,7 @@ void InputGate::EvaluateOnline() {
   else {
     std::vector<std::uint8_t> public_values_message{received_public_values_.get()};
     auto pointer{const_cast<std::uint8_t*>(
-        communication::GetMessage(public_values_message.data())->payload()->data())};
+        communication::GetMessage(public_values_message)->payload()->data())};
     BitSpan public_values_span(pointer, output_wires_.size() * number_of_simd_);
     for (auto i = 0ull; i < output_wires_.size(); ++i) {
       auto wire = std::dynamic_pointer_cast<bmr::Wire>(output_wires_.at(i));
@@ -263,8 +264,8 @@ void InputGate::EvaluateOnline() {
       std::vector<std::uint8_t> received_keys_message{
           received_public_keys_[party_i_remapped].get()};
       const std::uint8_t* received_keys_pointer{
-          communication::GetMessage(received_keys_message.data())->payload()->data()};
-      assert(communication::GetMessage(received_keys_message.data())->payload()->size() ==
+          communication::GetMessage(received_keys_message)->payload()->data()};
+      assert(communication::GetMessage(received_keys_message)->payload()->size() ==
              number_of_wires * number_of_simd * kKappa / 8);
 
       for (auto wire_j = 0ull; wire_j < number_of_wires; ++wire_j) {
@@ -313,8 +314,22 @@ void InputGate::EvaluateOnline() {
   assert(!online_is_ready_);
 }
 
+GateCost InputGate::GetCost() const {
+  auto& communication_layer = backend_.GetCommunicationLayer();
+  const auto number_of_parties = communication_layer.GetNumberOfParties();
+  const auto number_of_values = bit_size_ * number_of_simd_;
+  GateCost cost;
+  // the input owner publishes the public values, then everyone publishes the selected keys
+  cost.online_rounds = 2;
+  cost.online_bytes_sent = (number_of_parties - 1) * number_of_values * sizeof(Block128);
+  if (static_cast<std::size_t>(input_owner_id_) == communication_layer.GetMyId()) {
+    cost.online_bytes_sent += (number_of_parties - 1) * BitsToBytes(number_of_values);
+  }
+  return cost;
+}
+
 const bmr::SharePointer InputGate::GetOutputAsBmrShare() const {
-  auto result = std::make_shared<bmr::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<bmr::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -367,7 +382,7 @@ OutputGate::OutputGate(const motion::SharePointer& parent, std::size_t output_ow
     w = GetRegister().EmplaceWire<boolean_gmw::Wire>(dummy_bitvector, backend_);
   }
 
-  gmw_output_share_ = std::make_shared<boolean_gmw::Share>(gmw_wires);
+  gmw_output_share_ = backend_.GetRegister()->EmplaceShare<boolean_gmw::Share>(gmw_wires);
   output_gate_ =
       GetRegister().EmplaceGate<boolean_gmw::OutputGate>(gmw_output_share_, output_owner_);
 
@@ -438,8 +453,16 @@ void OutputGate::EvaluateOnline() {
   }
 }
 
+GateCost OutputGate::GetCost() const {
+  GateCost cost;
+  // the permutation bits are opened by the boolean_gmw::OutputGate, which accounts the
+  // communication, but its input wires are not connected to the circuit
+  cost.online_rounds = 1;
+  return cost;
+}
+
 const bmr::SharePointer OutputGate::GetOutputAsBmrShare() const {
-  auto result = std::make_shared<bmr::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<bmr::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -542,7 +565,7 @@ void XorGate::EvaluateOnline() {
 }
 
 const bmr::SharePointer XorGate::GetOutputAsBmrShare() const {
-  auto result = std::make_shared<bmr::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<bmr::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -648,7 +671,7 @@ void InvGate::EvaluateOnline() {
 }
 
 const bmr::SharePointer InvGate::GetOutputAsBmrShare() const {
-  auto result = std::make_shared<bmr::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<bmr::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -1050,8 +1073,8 @@ void AndGate::EvaluateSetup() {
     auto remapped_party_i{party_i > my_id ? party_i - 1 : party_i};
     std::vector<std::uint8_t> garbled_rows_message = received_garbled_rows_[remapped_party_i].get();
     auto pointer{reinterpret_cast<const std::byte*>(
-        communication::GetMessage(garbled_rows_message.data())->payload()->data())};
-    assert(communication::GetMessage(garbled_rows_message.data())->payload()->size() ==
+        communication::GetMessage(garbled_rows_message)->payload()->data())};
+    assert(communication::GetMessage(garbled_rows_message)->payload()->size() ==
            garbled_tables_.size() * kKappa / 8);
     std::transform(pointer, pointer + garbled_tables_.size() * Block128::size(),
                    garbled_tables_[0].data(), garbled_tables_[0].data(), std::bit_xor<std::byte>());
@@ -1193,8 +1216,22 @@ void AndGate::EvaluateOnline() {
   assert(!online_is_ready_);
 }
 
+GateCost AndGate::GetCost() const {
+  const auto number_of_parties = backend_.GetCommunicationLayer().GetNumberOfParties();
+  const auto number_of_values = parent_a_.size() * parent_a_.at(0)->GetNumberOfSimdValues();
+  GateCost cost;
+  cost.number_of_and_operations = number_of_values;
+  cost.multiplicative_depth = 1;
+  // per other party: the messages and corrections of the 1 bit and the 3 kappa bit OTs, and the
+  // partial garbled tables with 4 rows of one key per party
+  cost.setup_bytes_sent = (number_of_parties - 1) *
+                          (BitsToBytes(2 * number_of_values) + BitsToBytes(3 * number_of_values) +
+                           (3 + 4 * number_of_parties) * number_of_values * sizeof(Block128));
+  return cost;
+}
+
 const bmr::SharePointer AndGate::GetOutputAsBmrShare() const {
-  auto result = std::make_shared<bmr::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<bmr::Share>(output_wires_);
   assert(result);
   return result;
 }
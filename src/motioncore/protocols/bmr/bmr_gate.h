@@ -68,6 +68,8 @@ class InputGate final : public motion::InputGate {
 
   void EvaluateOnline() final override;
 
+  GateCost GetCost() const override;
+
   const bmr::SharePointer GetOutputAsBmrShare() const;
 
   const motion::SharePointer GetOutputAsShare() const;
@@ -99,6 +101,8 @@ class OutputGate final : public motion::OutputGate {
 
   bool NeedsSetup() const override { return false; }
 
+  GateCost GetCost() const override;
+
   const bmr::SharePointer GetOutputAsBmrShare() const;
 
   const motion::SharePointer GetOutputAsShare() const;
@@ -163,6 +167,8 @@ class AndGate final : public TwoGate {
 
   void EvaluateOnline() final override;
 
+  GateCost GetCost() const override;
+
   const bmr::SharePointer GetOutputAsBmrShare() const;
 
   const motion::SharePointer GetOutputAsShare() const;
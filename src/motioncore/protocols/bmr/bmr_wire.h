@@ -83,6 +83,16 @@ class Wire final : public BooleanWire {
 
   bool IsConstant() const noexcept final { return false; }
 
+  std::size_t GetPayloadSize() const noexcept final {
+    return public_values_.GetData().size() + secret_0_keys_.ByteSize() + public_keys_.ByteSize();
+  }
+
+  void ReleasePayload() final {
+    public_values_ = BitVector<>();
+    secret_0_keys_ = Block128Vector();
+    public_keys_ = Block128Vector();
+  }
+
  protected:
   void DynamicClear() final { setup_ready_ = false; }
 
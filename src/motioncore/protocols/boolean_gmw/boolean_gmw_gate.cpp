@@ -29,10 +29,12 @@
 #include <span>
 
 #include "base/backend.h"
+#include "base/configuration.h"
 #include "base/register.h"
 #include "communication/communication_layer.h"
 #include "communication/message.h"
 #include "communication/message_manager.h"
+#include "algorithm/compiled_circuit.h"
 #include "multiplication_triple/mt_provider.h"
 #include "primitives/sharing_randomness_generator.h"
 #include "utility/helpers.h"
@@ -53,6 +55,21 @@ InputGate::InputGate(std::vector<BitVector<>>&& input, std::size_t party_id, Bac
   InitializationHelper();
 }
 
+InputGate::InputGate(std::size_t party_id, std::size_t number_of_wires,
+                     std::size_t number_of_simd, Backend& backend)
+    : InputGate::Base(backend),
+      input_(number_of_wires, BitVector<>(number_of_simd)) {
+  input_owner_id_ = party_id;
+  bits_ = number_of_simd;
+  InitializationHelper();
+  if (static_cast<std::size_t>(input_owner_id_) == GetCommunicationLayer().GetMyId()) {
+    // if this party's input, create a promise/future pair to pass the inputs later
+    ReusableFiberPromise<std::vector<BitVector<>>> promise;
+    auto future{promise.get_future()};
+    input_promise_future_ = std::optional{std::pair(std::move(promise), std::move(future))};
+  }
+}
+
 void InputGate::InitializationHelper() {
   auto& communication_layer = GetCommunicationLayer();
   auto& _register = GetRegister();
@@ -95,6 +112,16 @@ void InputGate::EvaluateOnline() {
   auto my_id = communication_layer.GetMyId();
   auto number_of_parties = communication_layer.GetNumberOfParties();
 
+  if (input_promise_future_.has_value()) {
+    input_ = input_promise_future_->second.get();
+    if (input_.size() != output_wires_.size() || !BitVector<>::IsEqualSizeDimensions(input_) ||
+        input_.at(0).GetSize() != bits_) {
+      throw std::invalid_argument(
+          fmt::format("Boolean GMW InputGate#{} expects {} wires with {} SIMD values", gate_id_,
+                      output_wires_.size(), bits_));
+    }
+  }
+
   std::vector<BitVector<>> result(input_.size());
   auto sharing_id = boolean_sharing_id_;
   for (auto i = 0ull; i < result.size(); ++i) {
@@ -149,8 +176,16 @@ void InputGate::EvaluateOnline() {
   }
 }
 
+ReusableFiberPromise<std::vector<BitVector<>>>& InputGate::GetInputPromise() {
+  if (!input_promise_future_.has_value()) {
+    throw std::logic_error(
+        fmt::format("Boolean GMW InputGate#{} has no promise for passing inputs", gate_id_));
+  }
+  return input_promise_future_->first;
+}
+
 const boolean_gmw::SharePointer InputGate::GetOutputAsGmwShare() {
-  auto result = std::make_shared<boolean_gmw::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<boolean_gmw::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -239,21 +274,17 @@ void OutputGate::EvaluateOnline() {
     BitVector<> buffer;
     buffer.Reserve(bit_size * number_of_wires);
     for (auto& o : output) buffer.Append(o);
+    // the shares are written directly from the buffer of the BitVector
     // we need to send shares to one other party:
     if (!is_my_output_) {
-      std::span s(reinterpret_cast<const std::uint8_t*>(buffer.GetData().data()),
-                  buffer.GetData().size());
-      auto msg{
-          communication::BuildMessage(communication::MessageType::kOutputMessage, gate_id_, s)};
-      communication_layer.SendMessage(output_owner_, msg.Release());
+      communication_layer.SendFastMessage(output_owner_,
+                                          communication::MessageType::kOutputMessage, gate_id_,
+                                          std::move(buffer.GetMutableData()));
     }
     // we need to send shares to all other parties:
     else if (output_owner_ == kAll) {
-      std::span s(reinterpret_cast<const std::uint8_t*>(buffer.GetData().data()),
-                  buffer.GetData().size());
-      auto msg{
-          communication::BuildMessage(communication::MessageType::kOutputMessage, gate_id_, s)};
-      communication_layer.BroadcastMessage(msg.Release());
+      communication_layer.BroadcastFastMessage(communication::MessageType::kOutputMessage,
+                                               gate_id_, std::move(buffer.GetMutableData()));
     }
   }
 
@@ -270,10 +301,9 @@ void OutputGate::EvaluateOnline() {
       shared_outputs.at(i).reserve(number_of_wires);
 
       // Retrieve the received messsage or wait until it has arrived.
-      const auto output_message = output_message_futures_[i > my_id ? i - 1 : i].get();
-      auto message = communication::GetMessage(output_message.data());
-      BitSpan bit_span(const_cast<std::uint8_t*>(message->payload()->data()),
-                       bit_size * number_of_wires);
+      auto output_message = output_message_futures_[i > my_id ? i - 1 : i].get();
+      auto payload = communication::GetFastMessagePayload(output_message);
+      BitSpan bit_span(const_cast<std::uint8_t*>(payload.data()), bit_size * number_of_wires);
 
       // handle each wire
       for (std::size_t j = 0; j < number_of_wires; ++j) {
@@ -286,6 +316,7 @@ void OutputGate::EvaluateOnline() {
                                           parent_.at(0)->GetNumberOfSimdValues());
       }
       assert(shared_outputs.at(i).size() == number_of_wires);
+      communication_layer.GetMessageManager().ReleaseMessage(std::move(output_message));
     }
 
     // reconstruct the shared value
@@ -324,8 +355,21 @@ void OutputGate::EvaluateOnline() {
   }
 }
 
+GateCost OutputGate::GetCost() const {
+  const auto number_of_parties = backend_.GetCommunicationLayer().GetNumberOfParties();
+  const auto payload_size = BitsToBytes(parent_.size() * parent_.at(0)->GetNumberOfSimdValues());
+  GateCost cost;
+  cost.online_rounds = 1;
+  if (output_owner_ == kAll) {
+    cost.online_bytes_sent = (number_of_parties - 1) * payload_size;
+  } else if (!is_my_output_) {
+    cost.online_bytes_sent = payload_size;
+  }
+  return cost;
+}
+
 const boolean_gmw::SharePointer OutputGate::GetOutputAsGmwShare() const {
-  auto result = std::make_shared<boolean_gmw::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<boolean_gmw::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -396,7 +440,7 @@ void XorGate::EvaluateOnline() {
 }
 
 const boolean_gmw::SharePointer XorGate::GetOutputAsGmwShare() const {
-  auto result = std::make_shared<boolean_gmw::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<boolean_gmw::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -453,7 +497,7 @@ void InvGate::EvaluateOnline() {
 }
 
 const boolean_gmw::SharePointer InvGate::GetOutputAsGmwShare() const {
-  auto result = std::make_shared<boolean_gmw::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<boolean_gmw::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -476,25 +520,32 @@ AndGate::AndGate(const motion::SharePointer& a, const motion::SharePointer& b)
   auto number_of_wires = parent_a_.size();
   auto number_of_simd_values = a->GetNumberOfSimdValues();
 
-  std::vector<motion::WirePointer> dummy_wires_e(number_of_wires), dummy_wires_d(number_of_wires);
-
-  auto& _register = GetRegister();
-
-  for (auto& w : dummy_wires_d) {
-    w = _register.EmplaceWire<boolean_gmw::Wire>(backend_, number_of_simd_values);
-  }
-
-  for (auto& w : dummy_wires_e) {
-    w = _register.EmplaceWire<boolean_gmw::Wire>(backend_, number_of_simd_values);
+  // the chunk size counts the bits of all wires like the chunks of the MTs and OTs, s.t. a chunk
+  // of a wide gate does not span many chunks of its MTs
+  const auto simd_chunk_size = GetConfiguration().GetSimdChunkSize();
+  chunk_size_ = (simd_chunk_size == 0 || simd_chunk_size >= number_of_wires * number_of_simd_values)
+                    ? number_of_simd_values
+                    : std::max(simd_chunk_size / number_of_wires, std::size_t(1));
+  const auto number_of_chunks = (number_of_simd_values + chunk_size_ - 1) / chunk_size_;
+
+  // a single chunk is opened with the gate id, several with contiguous reserved ids, s.t. the
+  // openings of each party are registered as one range
+  first_chunk_message_id_ =
+      number_of_chunks > 1 ? GetRegister().ReserveGateIds(number_of_chunks) : gate_id_;
+  auto& message_manager = GetCommunicationLayer().GetMessageManager();
+  const auto my_id = GetCommunicationLayer().GetMyId();
+  const auto number_of_parties = GetCommunicationLayer().GetNumberOfParties();
+  opening_futures_.resize(number_of_chunks);
+  for (auto& chunk_futures : opening_futures_) chunk_futures.reserve(number_of_parties - 1);
+  for (std::size_t party_id = 0; party_id < number_of_parties; ++party_id) {
+    if (party_id == my_id) continue;
+    auto futures{message_manager.RegisterReceiveRange(
+        party_id, communication::MessageType::kAggregatedMessage, first_chunk_message_id_, number_of_chunks)};
+    for (std::size_t chunk = 0; chunk < number_of_chunks; ++chunk) {
+      opening_futures_[chunk].emplace_back(std::move(futures[chunk]));
+    }
   }
 
-  // TODO: replace Gate objects with Futures from CommunicationManager
-  d_ = std::make_shared<boolean_gmw::Share>(dummy_wires_d);
-  e_ = std::make_shared<boolean_gmw::Share>(dummy_wires_e);
-
-  d_output_ = _register.EmplaceGate<OutputGate>(d_);
-  e_output_ = _register.EmplaceGate<OutputGate>(e_);
-
   // create output wires
   output_wires_.reserve(number_of_wires);
   for (size_t i = 0; i < number_of_wires; ++i) {
@@ -527,73 +578,109 @@ void AndGate::EvaluateOnline() {
   }
 
   auto& mt_provider = GetMtProvider();
-  mt_provider.WaitFinished();
-  const auto& mts = mt_provider.GetBinaryAll();
-
-  auto& d_mutable_wires = d_->GetMutableWires();
-  for (auto i = 0ull; i < d_mutable_wires.size(); ++i) {
-    auto d = std::dynamic_pointer_cast<boolean_gmw::Wire>(d_mutable_wires.at(i));
-    const auto x = std::dynamic_pointer_cast<const boolean_gmw::Wire>(parent_a_.at(i));
-    assert(d);
-    assert(x);
-    d->GetMutableValues() = mts.a.Subset(mt_offset_ + i * x->GetNumberOfSimdValues(),
-                                         mt_offset_ + (i + 1) * x->GetNumberOfSimdValues());
-    d->GetMutableValues() ^= x->GetValues();
-    d->SetOnlineFinished();
-  }
-
-  auto& e_mutable_wires = e_->GetMutableWires();
-  for (auto i = 0ull; i < e_mutable_wires.size(); ++i) {
-    auto e = std::dynamic_pointer_cast<boolean_gmw::Wire>(e_mutable_wires.at(i));
-    const auto y = std::dynamic_pointer_cast<const boolean_gmw::Wire>(parent_b_.at(i));
-    assert(e);
-    assert(y);
-    e->GetMutableValues() = mts.b.Subset(mt_offset_ + i * y->GetNumberOfSimdValues(),
-                                         mt_offset_ + (i + 1) * y->GetNumberOfSimdValues());
-    e->GetMutableValues() ^= y->GetValues();
-    e->SetOnlineFinished();
-  }
-
-  d_output_->WaitOnline();
-  e_output_->WaitOnline();
-
-  const auto& d_clear = d_output_->GetOutputWires();
-  const auto& e_clear = e_output_->GetOutputWires();
-
-  for (auto& wire : d_clear) {
-    wire->GetIsReadyCondition().Wait();
+
+  auto& communication_layer = GetCommunicationLayer();
+  const auto my_id = communication_layer.GetMyId();
+  const auto number_of_parties = communication_layer.GetNumberOfParties();
+  const auto number_of_wires = parent_a_.size();
+  const auto number_of_simd_values = parent_a_.at(0)->GetNumberOfSimdValues();
+  const auto number_of_chunks = opening_futures_.size();
+
+  // the chunk [simd_begin, simd_end) of the values of a wire, copied into buffer only if the
+  // values are split into several chunks
+  const auto get_chunk = [number_of_chunks](const BitVector<>& values, std::size_t simd_begin,
+                                            std::size_t simd_end,
+                                            BitVector<>& buffer) -> const BitVector<>& {
+    if (number_of_chunks == 1) return values;
+    buffer = values.Subset(simd_begin, simd_end);
+    return buffer;
+  };
+  BitVector<> x_buffer, y_buffer;
+
+  // send d and e of each chunk as soon as its MTs are ready, s.t. the openings of the first chunks
+  // overlap with the generation of the MTs of the later ones
+  std::vector<BinaryMtVector> mts(number_of_chunks);
+  std::vector<BitVector<>> de(number_of_chunks);
+  for (std::size_t chunk = 0; chunk < number_of_chunks; ++chunk) {
+    const auto simd_begin = chunk * chunk_size_;
+    const auto simd_end = std::min(simd_begin + chunk_size_, number_of_simd_values);
+    const auto chunk_length = simd_end - simd_begin;
+    mts[chunk] = mt_provider.GetBinary(mt_offset_ + number_of_wires * simd_begin,
+                                       number_of_wires * chunk_length);
+
+    // d = x ^ a and e = y ^ b, laid out as d_0 || ... || d_last || e_0 || ... || e_last
+    de[chunk].Reserve(2 * number_of_wires * chunk_length);
+    for (auto i = 0ull; i < number_of_wires; ++i) {
+      const auto x = std::dynamic_pointer_cast<const boolean_gmw::Wire>(parent_a_.at(i));
+      assert(x);
+      auto d = mts[chunk].a.Subset(i * chunk_length, (i + 1) * chunk_length);
+      d ^= get_chunk(x->GetValues(), simd_begin, simd_end, x_buffer);
+      de[chunk].Append(d);
+    }
+    for (auto i = 0ull; i < number_of_wires; ++i) {
+      const auto y = std::dynamic_pointer_cast<const boolean_gmw::Wire>(parent_b_.at(i));
+      assert(y);
+      auto e = mts[chunk].b.Subset(i * chunk_length, (i + 1) * chunk_length);
+      e ^= get_chunk(y->GetValues(), simd_begin, simd_end, y_buffer);
+      de[chunk].Append(e);
+    }
+
+    communication_layer.BroadcastAggregatedMessage(
+        GetChunkMessageId(chunk),
+        std::span(reinterpret_cast<const std::uint8_t*>(de[chunk].GetData().data()),
+                  de[chunk].GetData().size()));
   }
-  for (auto& wire : e_clear) {
-    wire->GetIsReadyCondition().Wait();
+
+  if (number_of_chunks > 1) {
+    for (auto i = 0ull; i < number_of_wires; ++i) {
+      auto output = std::dynamic_pointer_cast<boolean_gmw::Wire>(output_wires_.at(i));
+      assert(output);
+      output->GetMutableValues() = BitVector<>();
+      output->GetMutableValues().Reserve(number_of_simd_values);
+    }
   }
 
-  for (auto i = 0ull; i < d_clear.size(); ++i) {
-    const auto d_w = std::dynamic_pointer_cast<const boolean_gmw::Wire>(d_clear.at(i));
-    const auto x_i_w = std::dynamic_pointer_cast<const boolean_gmw::Wire>(parent_a_.at(i));
-    const auto e_w = std::dynamic_pointer_cast<const boolean_gmw::Wire>(e_clear.at(i));
-    const auto y_i_w = std::dynamic_pointer_cast<const boolean_gmw::Wire>(parent_b_.at(i));
+  for (std::size_t chunk = 0; chunk < number_of_chunks; ++chunk) {
+    const auto simd_begin = chunk * chunk_size_;
+    const auto simd_end = std::min(simd_begin + chunk_size_, number_of_simd_values);
+    const auto chunk_length = simd_end - simd_begin;
+
+    // open d and e
+    for (std::size_t party_id = 0; party_id < number_of_parties; ++party_id) {
+      if (party_id == my_id) continue;
+      auto opening{opening_futures_[chunk].at(party_id > my_id ? party_id - 1 : party_id).get()};
+      assert(opening.size() == de[chunk].GetData().size());
+      de[chunk] ^= BitVector<>(opening.data(), de[chunk].GetSize());
+      communication_layer.GetMessageManager().ReleaseMessage(std::move(opening));
+    }
+
+    for (auto i = 0ull; i < number_of_wires; ++i) {
+      const auto x_i_w = std::dynamic_pointer_cast<const boolean_gmw::Wire>(parent_a_.at(i));
+      const auto y_i_w = std::dynamic_pointer_cast<const boolean_gmw::Wire>(parent_b_.at(i));
 
-    assert(d_w);
-    assert(x_i_w);
-    assert(e_w);
-    assert(y_i_w);
+      assert(x_i_w);
+      assert(y_i_w);
 
-    auto output = std::dynamic_pointer_cast<boolean_gmw::Wire>(output_wires_.at(i));
-    assert(output);
-    output->GetMutableValues() =
-        mts.c.Subset(mt_offset_ + i * parent_a_.at(0)->GetNumberOfSimdValues(),
-                     mt_offset_ + (i + 1) * parent_a_.at(0)->GetNumberOfSimdValues());
+      auto output = std::dynamic_pointer_cast<boolean_gmw::Wire>(output_wires_.at(i));
+      assert(output);
+      auto z = mts[chunk].c.Subset(i * chunk_length, (i + 1) * chunk_length);
 
-    const auto& d = d_w->GetValues();
-    const auto& x_i = x_i_w->GetValues();
-    const auto& e = e_w->GetValues();
-    const auto& y_i = y_i_w->GetValues();
+      const auto d = de[chunk].Subset(i * chunk_length, (i + 1) * chunk_length);
+      const auto e = de[chunk].Subset((number_of_wires + i) * chunk_length,
+                                      (number_of_wires + i + 1) * chunk_length);
+      const auto& x_i = get_chunk(x_i_w->GetValues(), simd_begin, simd_end, x_buffer);
+      const auto& y_i = get_chunk(y_i_w->GetValues(), simd_begin, simd_end, y_buffer);
 
-    if (GetCommunicationLayer().GetMyId() ==
-        (gate_id_ % GetCommunicationLayer().GetNumberOfParties())) {
-      output->GetMutableValues() ^= (d & y_i) ^ (e & x_i) ^ (e & d);
-    } else {
-      output->GetMutableValues() ^= (d & y_i) ^ (e & x_i);
+      if (my_id == (gate_id_ % number_of_parties)) {
+        z ^= (d & y_i) ^ (e & x_i) ^ (e & d);
+      } else {
+        z ^= (d & y_i) ^ (e & x_i);
+      }
+      if (number_of_chunks == 1) {
+        output->GetMutableValues() = std::move(z);
+      } else {
+        output->GetMutableValues().Append(z);
+      }
     }
   }
 
@@ -602,8 +689,20 @@ void AndGate::EvaluateOnline() {
   }
 }
 
+GateCost AndGate::GetCost() const {
+  const auto number_of_parties = backend_.GetCommunicationLayer().GetNumberOfParties();
+  GateCost cost;
+  cost.number_of_and_operations = mt_bitlen_;
+  cost.multiplicative_depth = 1;
+  cost.online_rounds = 1;
+  // d and e of each chunk
+  cost.online_bytes_sent = (number_of_parties - 1) * opening_futures_.size() *
+                           BitsToBytes(2 * parent_a_.size() * chunk_size_);
+  return cost;
+}
+
 const boolean_gmw::SharePointer AndGate::GetOutputAsGmwShare() const {
-  auto result = std::make_shared<boolean_gmw::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<boolean_gmw::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -752,8 +851,21 @@ void MuxGate::EvaluateOnline() {
   }
 }
 
+GateCost MuxGate::GetCost() const {
+  const auto number_of_parties = backend_.GetCommunicationLayer().GetNumberOfParties();
+  const auto number_of_simd = parent_a_.at(0)->GetNumberOfSimdValues();
+  GateCost cost;
+  cost.number_of_and_operations = parent_a_.size() * number_of_simd;
+  cost.multiplicative_depth = 1;
+  // the OT senders wait for the corrections of the receivers
+  cost.online_rounds = 2;
+  cost.online_bytes_sent = (number_of_parties - 1) * (BitsToBytes(number_of_simd) +
+                                                      BitsToBytes(number_of_simd * parent_a_.size()));
+  return cost;
+}
+
 const boolean_gmw::SharePointer MuxGate::GetOutputAsGmwShare() const {
-  auto result = std::make_shared<boolean_gmw::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<boolean_gmw::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -764,4 +876,216 @@ const motion::SharePointer MuxGate::GetOutputAsShare() const {
   return result;
 }
 
+namespace {
+
+// copies number_of_bits bits of source starting at bit_offset to the byte-aligned slot
+void CopyToSlot(const BitVector<>& source, std::size_t bit_offset, std::size_t number_of_bits,
+                std::byte* slot) {
+  if (bit_offset % 8 == 0) {
+    std::copy_n(source.GetData().data() + bit_offset / 8, BitsToBytes(number_of_bits), slot);
+  } else {
+    const auto subset = source.Subset(bit_offset, bit_offset + number_of_bits);
+    std::copy_n(subset.GetData().data(), BitsToBytes(number_of_bits), slot);
+  }
+}
+
+}  // namespace
+
+CompiledCircuitGate::CompiledCircuitGate(const motion::SharePointer& parent,
+                                         std::shared_ptr<const CompiledCircuit> circuit)
+    : NInputGate(parent->GetBackend()),
+      circuit_(std::move(circuit)),
+      number_of_simd_values_(parent->GetNumberOfSimdValues()),
+      mt_offset_(0) {
+  parents_ = parent->GetWires();
+
+  if (parents_.size() != circuit_->number_of_input_wires) {
+    throw std::invalid_argument(
+        fmt::format("CompiledCircuitGate: expected {} input wires, got {}",
+                    circuit_->number_of_input_wires, parents_.size()));
+  }
+  if (parents_.empty() || parents_.at(0)->GetProtocol() != MpcProtocol::kBooleanGmw) {
+    throw std::invalid_argument("CompiledCircuitGate expects a non-empty Boolean GMW share");
+  }
+
+  output_wires_.reserve(circuit_->output_slots.size());
+  for (std::size_t i = 0; i < circuit_->output_slots.size(); ++i) {
+    output_wires_.emplace_back(
+        GetRegister().EmplaceWire<boolean_gmw::Wire>(backend_, number_of_simd_values_));
+  }
+
+  if (circuit_->number_of_and_operations > 0) {
+    mt_offset_ = backend_.GetMtProvider().RequestBinaryMts(circuit_->number_of_and_operations *
+                                                           number_of_simd_values_);
+  }
+
+  // reserve a gate id per layer as message id for the openings
+  auto& message_manager = GetCommunicationLayer().GetMessageManager();
+  const auto number_of_layers = circuit_->GetNumberOfLayers();
+  const auto first_message_id = GetRegister().ReserveGateIds(number_of_layers);
+  layer_message_ids_.resize(number_of_layers);
+  opening_futures_.resize(number_of_layers);
+  for (std::size_t layer = 0; layer < number_of_layers; ++layer) {
+    layer_message_ids_[layer] = first_message_id + layer;
+  }
+  // the ids of all layers are registered as one range per party, but only the layers with AND
+  // operations are opened
+  const auto my_id = GetCommunicationLayer().GetMyId();
+  const auto number_of_parties = GetCommunicationLayer().GetNumberOfParties();
+  for (std::size_t party_id = 0; number_of_layers > 0 && party_id < number_of_parties;
+       ++party_id) {
+    if (party_id == my_id) continue;
+    auto futures{message_manager.RegisterReceiveRange(
+        party_id, communication::MessageType::kAggregatedMessage, first_message_id, number_of_layers)};
+    for (std::size_t layer = 0; layer < number_of_layers; ++layer) {
+      if (circuit_->and_offsets[layer] == circuit_->layer_offsets[layer + 1]) continue;
+      opening_futures_[layer].emplace_back(std::move(futures[layer]));
+    }
+  }
+
+  if constexpr (kDebug) {
+    GetLogger().LogDebug(fmt::format(
+        "Created a BooleanGMW CompiledCircuitGate with gate id {}, {} operations, {} layers",
+        gate_id_, circuit_->GetNumberOfOperations(), number_of_layers));
+  }
+}
+
+void CompiledCircuitGate::EvaluateSetup() {}
+
+void CompiledCircuitGate::EvaluateOnline() {
+  const auto& circuit = *circuit_;
+  auto& communication_layer = GetCommunicationLayer();
+  const auto my_id = communication_layer.GetMyId();
+  const auto number_of_parties = communication_layer.GetNumberOfParties();
+  const std::size_t simd = number_of_simd_values_;
+  const std::size_t stride = BitsToBytes(simd);
+  // only one party inverts its share
+  const bool invert = gate_id_ % number_of_parties == my_id;
+
+  // slot i occupies the bytes [i * stride, (i + 1) * stride)
+  std::vector<std::byte> values(circuit.number_of_slots * stride);
+  auto slot = [&values, stride](std::uint32_t i) { return values.data() + i * stride; };
+
+  for (std::size_t i = 0; i < parents_.size(); ++i) {
+    const auto wire = std::dynamic_pointer_cast<const boolean_gmw::Wire>(parents_[i]);
+    assert(wire);
+    wire->GetIsReadyCondition().Wait();
+    std::copy_n(wire->GetValues().GetData().data(), stride, slot(i));
+  }
+
+  const BinaryMtVector* mts{nullptr};
+  if (circuit.number_of_and_operations > 0) {
+    auto& mt_provider = GetMtProvider();
+    mt_provider.WaitFinished();
+    mts = &mt_provider.GetBinaryAll();
+  }
+  std::size_t mt_bit_offset = mt_offset_;
+
+  std::vector<std::byte> de;
+  for (std::size_t layer = 0; layer < circuit.GetNumberOfLayers(); ++layer) {
+    const std::size_t and_begin = circuit.and_offsets[layer];
+    const std::size_t layer_end = circuit.layer_offsets[layer + 1];
+
+    for (std::size_t op = circuit.layer_offsets[layer]; op < and_begin; ++op) {
+      const std::byte* a = slot(circuit.input_a[op]);
+      const std::byte* b = slot(circuit.input_b[op]);
+      std::byte* out = slot(circuit.output[op]);
+      if (circuit.operation_types[op] == CompiledOperationType::kXor) {
+        for (std::size_t k = 0; k < stride; ++k) out[k] = a[k] ^ b[k];
+      } else if (invert) {
+        for (std::size_t k = 0; k < stride; ++k) out[k] = ~a[k];
+      } else {
+        std::copy_n(a, stride, out);
+      }
+    }
+
+    const std::size_t number_of_ands = layer_end - and_begin;
+    if (number_of_ands == 0) continue;
+    assert(mts);
+
+    // d = x ^ a and e = y ^ b of all ANDs of this layer, laid out as d_0 || ... || e_0 || ...
+    de.resize(2 * number_of_ands * stride);
+    std::byte* d = de.data();
+    std::byte* e = de.data() + number_of_ands * stride;
+    for (std::size_t j = 0; j < number_of_ands; ++j) {
+      const std::byte* x = slot(circuit.input_a[and_begin + j]);
+      const std::byte* y = slot(circuit.input_b[and_begin + j]);
+      std::byte* d_j = d + j * stride;
+      std::byte* e_j = e + j * stride;
+      CopyToSlot(mts->a, mt_bit_offset + j * simd, simd, d_j);
+      CopyToSlot(mts->b, mt_bit_offset + j * simd, simd, e_j);
+      for (std::size_t k = 0; k < stride; ++k) {
+        d_j[k] ^= x[k];
+        e_j[k] ^= y[k];
+      }
+    }
+
+    communication_layer.BroadcastAggregatedMessage(
+        layer_message_ids_[layer],
+        std::span(reinterpret_cast<const std::uint8_t*>(de.data()), de.size()));
+
+    for (std::size_t party_id = 0; party_id < number_of_parties; ++party_id) {
+      if (party_id == my_id) continue;
+      auto opening{opening_futures_[layer].at(party_id > my_id ? party_id - 1 : party_id).get()};
+      assert(opening.size() == de.size());
+      const auto* opening_data = reinterpret_cast<const std::byte*>(opening.data());
+      for (std::size_t k = 0; k < de.size(); ++k) de[k] ^= opening_data[k];
+      communication_layer.GetMessageManager().ReleaseMessage(std::move(opening));
+    }
+
+    const bool add_de = layer_message_ids_[layer] % number_of_parties == my_id;
+    for (std::size_t j = 0; j < number_of_ands; ++j) {
+      const std::byte* x = slot(circuit.input_a[and_begin + j]);
+      const std::byte* y = slot(circuit.input_b[and_begin + j]);
+      const std::byte* d_j = d + j * stride;
+      const std::byte* e_j = e + j * stride;
+      std::byte* out = slot(circuit.output[and_begin + j]);
+      CopyToSlot(mts->c, mt_bit_offset + j * simd, simd, out);
+      for (std::size_t k = 0; k < stride; ++k) {
+        out[k] ^= (d_j[k] & y[k]) ^ (e_j[k] & x[k]);
+        if (add_de) out[k] ^= d_j[k] & e_j[k];
+      }
+    }
+    mt_bit_offset += number_of_ands * simd;
+  }
+
+  for (std::size_t i = 0; i < output_wires_.size(); ++i) {
+    auto wire = std::dynamic_pointer_cast<boolean_gmw::Wire>(output_wires_[i]);
+    assert(wire);
+    wire->GetMutableValues() = BitVector<>(slot(circuit.output_slots[i]), simd);
+  }
+
+  if constexpr (kVerboseDebug) {
+    GetLogger().LogTrace(
+        fmt::format("Evaluated BooleanGMW CompiledCircuitGate with id#{}", gate_id_));
+  }
+}
+
+GateCost CompiledCircuitGate::GetCost() const {
+  const auto number_of_parties = backend_.GetCommunicationLayer().GetNumberOfParties();
+  GateCost cost;
+  cost.number_of_and_operations = circuit_->number_of_and_operations * number_of_simd_values_;
+  for (std::size_t layer = 0; layer < circuit_->GetNumberOfLayers(); ++layer) {
+    const auto number_of_ands = circuit_->layer_offsets[layer + 1] - circuit_->and_offsets[layer];
+    if (number_of_ands == 0) continue;
+    ++cost.multiplicative_depth;
+    cost.online_bytes_sent +=
+        (number_of_parties - 1) * BitsToBytes(2 * number_of_ands * number_of_simd_values_);
+  }
+  cost.online_rounds = cost.multiplicative_depth;
+  return cost;
+}
+
+const boolean_gmw::SharePointer CompiledCircuitGate::GetOutputAsGmwShare() const {
+  auto result = backend_.GetRegister()->EmplaceShare<boolean_gmw::Share>(output_wires_);
+  assert(result);
+  return result;
+}
+
+const motion::SharePointer CompiledCircuitGate::GetOutputAsShare() const {
+  auto result = std::static_pointer_cast<motion::Share>(GetOutputAsGmwShare());
+  assert(result);
+  return result;
+}
+
 }  // namespace encrypto::motion::proto::boolean_gmw
@@ -26,8 +26,10 @@
 
 #include "boolean_gmw_share.h"
 
+#include <optional>
 #include <span>
 
+#include "algorithm/compiled_circuit.h"
 #include "oblivious_transfer/ot_flavors.h"
 #include "protocols/gate.h"
 #include "utility/bit_vector.h"
@@ -43,6 +45,11 @@ class InputGate final : public motion::InputGate {
 
   InputGate(std::vector<BitVector<>>&& input, std::size_t party_id, Backend& backend);
 
+  /// \brief Creates an input gate whose input is passed later (and for each evaluation) via the
+  /// promise returned by GetInputPromise().
+  InputGate(std::size_t party_id, std::size_t number_of_wires, std::size_t number_of_simd,
+            Backend& backend);
+
   void InitializationHelper();
 
   ~InputGate() final = default;
@@ -53,12 +60,23 @@ class InputGate final : public motion::InputGate {
 
   bool NeedsSetup() const override { return false; }
 
+  bool IsReusable() const override { return true; }
+
   const boolean_gmw::SharePointer GetOutputAsGmwShare();
 
+  /// \returns A ReusableFiberPromise that can be used to pass the plaintext inputs.
+  /// Throws if the gate was created with a fixed input or is not for the own input.
+  ReusableFiberPromise<std::vector<BitVector<>>>& GetInputPromise();
+
  protected:
   /// two-dimensional vector for storing the raw inputs
   std::vector<BitVector<>> input_;
 
+  /// Input promise-future pair for own inputs that are passed after the gate was created.
+  std::optional<std::pair<ReusableFiberPromise<std::vector<BitVector<>>>,
+                          ReusableFiberFuture<std::vector<BitVector<>>>>>
+      input_promise_future_;
+
   std::size_t bits_;                ///< Number of parallel values on wires
   std::size_t boolean_sharing_id_;  ///< Sharing ID for Boolean GMW for generating
   ///< correlated randomness using AES CTR
@@ -80,6 +98,10 @@ class OutputGate final : public motion::OutputGate {
 
   bool NeedsSetup() const override { return false; }
 
+  bool IsReusable() const override { return true; }
+
+  GateCost GetCost() const override;
+
   const boolean_gmw::SharePointer GetOutputAsGmwShare() const;
 
   const motion::SharePointer GetOutputAsShare() const;
@@ -105,6 +127,8 @@ class XorGate final : public TwoGate {
 
   bool NeedsSetup() const override { return false; }
 
+  bool IsReusable() const override { return true; }
+
   const boolean_gmw::SharePointer GetOutputAsGmwShare() const;
 
   const motion::SharePointer GetOutputAsShare() const;
@@ -126,6 +150,8 @@ class InvGate final : public OneGate {
 
   bool NeedsSetup() const override { return false; }
 
+  bool IsReusable() const override { return true; }
+
   const boolean_gmw::SharePointer GetOutputAsGmwShare() const;
 
   const motion::SharePointer GetOutputAsShare() const;
@@ -147,6 +173,10 @@ class AndGate final : public TwoGate {
 
   bool NeedsSetup() const override { return false; }
 
+  bool IsReusable() const override { return true; }
+
+  GateCost GetCost() const override;
+
   const boolean_gmw::SharePointer GetOutputAsGmwShare() const;
 
   const motion::SharePointer GetOutputAsShare() const;
@@ -156,11 +186,21 @@ class AndGate final : public TwoGate {
   AndGate(const Gate&) = delete;
 
  private:
+  std::size_t GetChunkMessageId(std::size_t chunk) const noexcept {
+    return first_chunk_message_id_ + chunk;
+  }
+
   std::size_t mt_offset_;
   std::size_t mt_bitlen_;
 
-  std::shared_ptr<motion::Share> d_, e_;
-  std::shared_ptr<OutputGate> d_output_, e_output_;
+  // the SIMD values are opened in chunks of chunk_size_ values, which hold about
+  // Configuration::GetSimdChunkSize() bits over all wires, the MTs of each chunk are contiguous
+  std::size_t chunk_size_;
+  std::size_t first_chunk_message_id_{0};
+
+  // the shares of d and e of the other parties per chunk, which are sent as aggregated messages
+  // together with the openings of all other AND gates evaluated in the same round
+  std::vector<std::vector<ReusableFiberFuture<std::vector<std::uint8_t>>>> opening_futures_;
 };
 
 class MuxGate final : public ThreeGate {
@@ -180,6 +220,8 @@ class MuxGate final : public ThreeGate {
 
   bool NeedsSetup() const override { return false; }
 
+  GateCost GetCost() const override;
+
   const boolean_gmw::SharePointer GetOutputAsGmwShare() const;
 
   const motion::SharePointer GetOutputAsShare() const;
@@ -193,4 +235,42 @@ class MuxGate final : public ThreeGate {
   std::vector<std::unique_ptr<XcOtSender>> ot_sender_;
 };
 
+/// \brief Evaluates a whole CompiledCircuit in a single gate by interpreting its flat
+/// representation on one value buffer, which avoids a gate object, wires and a fiber per operation.
+/// The AND operations of each layer are opened together in one aggregated message per party.
+class CompiledCircuitGate final : public NInputGate {
+ public:
+  CompiledCircuitGate(const motion::SharePointer& parent,
+                      std::shared_ptr<const CompiledCircuit> circuit);
+
+  ~CompiledCircuitGate() final = default;
+
+  void EvaluateSetup() final override;
+
+  void EvaluateOnline() final override;
+
+  bool NeedsSetup() const override { return false; }
+
+  bool IsReusable() const override { return true; }
+
+  GateCost GetCost() const override;
+
+  const boolean_gmw::SharePointer GetOutputAsGmwShare() const;
+
+  const motion::SharePointer GetOutputAsShare() const;
+
+  CompiledCircuitGate() = delete;
+
+  CompiledCircuitGate(const Gate&) = delete;
+
+ private:
+  std::shared_ptr<const CompiledCircuit> circuit_;
+  std::size_t number_of_simd_values_;
+  std::size_t mt_offset_;
+
+  // one message id and the futures for the openings of the other parties per layer with ANDs
+  std::vector<std::size_t> layer_message_ids_;
+  std::vector<std::vector<ReusableFiberFuture<std::vector<std::uint8_t>>>> opening_futures_;
+};
+
 }  // namespace encrypto::motion::proto::boolean_gmw
\ No newline at end of file
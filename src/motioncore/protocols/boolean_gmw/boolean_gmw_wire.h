@@ -61,6 +61,10 @@ class Wire final : public BooleanWire {
 
   bool IsConstant() const noexcept final { return false; }
 
+  std::size_t GetPayloadSize() const noexcept final { return values_.GetData().size(); }
+
+  void ReleasePayload() final { values_ = BitVector<>(); }
+
  private:
   BitVector<> values_;
 };
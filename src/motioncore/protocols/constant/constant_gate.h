@@ -66,6 +66,8 @@ class ConstantBooleanInputGate final : public Gate {
 
   bool NeedsOnline() const override { return false; }
 
+  bool IsReusable() const override { return true; }
+
   motion::SharePointer GetOutputAsShare() const;
 };
 
@@ -87,6 +89,8 @@ class ConstantArithmeticInputGate final : public Gate {
 
   bool NeedsOnline() const override { return false; }
 
+  bool IsReusable() const override { return true; }
+
   motion::SharePointer GetOutputAsShare() const;
 };
 
@@ -107,7 +107,7 @@ void BmrToBooleanGmwGate::EvaluateOnline() {
 }
 
 const proto::boolean_gmw::SharePointer BmrToBooleanGmwGate::GetOutputAsGmwShare() const {
-  auto result = std::make_shared<proto::boolean_gmw::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<proto::boolean_gmw::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -206,7 +206,7 @@ void BooleanGmwToBmrGate::EvaluateOnline() {
     auto public_values_message{
         received_public_values_[party_id > my_id ? party_id - 1 : party_id].get()};
     auto pointer{const_cast<std::uint8_t*>(
-        communication::GetMessage(public_values_message.data())->payload()->data())};
+        communication::GetMessage(public_values_message)->payload()->data())};
     BitSpan public_values_span(pointer, number_of_wires * number_of_simd);
     for (std::size_t i = 0; i < number_of_wires; ++i) {
       auto bmr_output = std::dynamic_pointer_cast<proto::bmr::Wire>(output_wires_[i]);
@@ -266,7 +266,7 @@ void BooleanGmwToBmrGate::EvaluateOnline() {
       auto received_keys_buffer =
           received_public_keys_.at(party_i > my_id ? party_i - 1 : party_i).get();
       const std::uint8_t* pointer{
-          communication::GetMessage(received_keys_buffer.data())->payload()->data()};
+          communication::GetMessage(received_keys_buffer)->payload()->data()};
       for (auto wire_j = 0ull; wire_j < number_of_wires; ++wire_j) {
         auto wire = std::dynamic_pointer_cast<proto::bmr::Wire>(output_wires_.at(wire_j));
         assert(wire);
@@ -287,7 +287,7 @@ void BooleanGmwToBmrGate::EvaluateOnline() {
 }
 
 const proto::bmr::SharePointer BooleanGmwToBmrGate::GetOutputAsBmrShare() const {
-  auto result = std::make_shared<proto::bmr::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<proto::bmr::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -399,7 +399,7 @@ void ArithmeticGmwToBmrGate::EvaluateOnline() {
 }
 
 const proto::bmr::SharePointer ArithmeticGmwToBmrGate::GetOutputAsBmrShare() const {
-  auto result = std::make_shared<proto::bmr::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<proto::bmr::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -52,6 +52,8 @@ class SubsetGate final : public OneGate {
 
   void EvaluateOnline() override;
 
+  bool IsReusable() const override { return true; }
+
   const SharePointer GetOutputAsShare();
 
   SubsetGate() = delete;
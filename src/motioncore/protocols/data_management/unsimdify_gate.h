@@ -49,6 +49,8 @@ class UnsimdifyGate final : public OneGate {
 
   void EvaluateOnline() override;
 
+  bool IsReusable() const override { return true; }
+
   std::vector<SharePointer> GetOutputAsVectorOfShares();
 
   UnsimdifyGate() = delete;
@@ -70,7 +70,7 @@ ReusableFiberPromise<InputGate::ValueType>& InputGate::GetInputPromise() {
 }
 
 const SharePointer InputGate::GetOutputAsGarbledCircuitShare() {
-  auto result = std::make_shared<garbled_circuit::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<garbled_circuit::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -179,6 +179,16 @@ void InputGateGarbler::EvaluateOnline() {
   }
 }
 
+GateCost InputGateGarbler::GetCost() const {
+  GateCost cost;
+  cost.online_rounds = 1;
+  // the garbler sends the labels of its inputs or both labels of each input of the evaluator as
+  // messages of the OTs
+  cost.online_bytes_sent =
+      (is_my_input_ ? 1 : 2) * number_of_wires_ * number_of_simd_ * Block128::kBlockSize;
+  return cost;
+}
+
 InputGateEvaluator::InputGateEvaluator(std::size_t input_owner_id, std::size_t number_of_wires,
                                        std::size_t number_of_simd, Backend& backend)
     : Base(input_owner_id, number_of_wires, number_of_simd, backend) {
@@ -232,7 +242,7 @@ void InputGateEvaluator::EvaluateOnline() {
   } else {  // garbler's input
     auto& label_future{std::get<ReusableFiberFuture<std::vector<std::uint8_t>>>(label_source_)};
     auto labels_msg{label_future.get()};
-    const auto payload = communication::GetMessage(labels_msg.data())->payload();
+    const auto payload = communication::GetMessage(labels_msg)->payload();
     assert(payload->size() == (Block128::kBlockSize * number_of_wires_ * number_of_simd_));
 
     for (std::size_t wire_i = 0; wire_i < number_of_wires_; ++wire_i) {
@@ -246,6 +256,18 @@ void InputGateEvaluator::EvaluateOnline() {
   }
 }
 
+GateCost InputGateEvaluator::GetCost() const {
+  GateCost cost;
+  if (is_my_input_) {
+    // the OT corrections are sent before the garbler sends the messages
+    cost.online_rounds = 2;
+    cost.online_bytes_sent = BitsToBytes(number_of_wires_ * number_of_simd_);
+  } else {
+    cost.online_rounds = 1;
+  }
+  return cost;
+}
+
 OutputGate::OutputGate(motion::SharePointer parent, std::size_t output_owner)
     : Base(parent->GetBackend()),
       output_owner_(output_owner),
@@ -298,7 +320,7 @@ void OutputGate::EvaluateOnline() {
   if (my_output_) {
     assert(output_future_.has_value());
     auto permutation_bits_msg{output_future_->get()};
-    auto permutation_bits = communication::GetMessage(permutation_bits_msg.data())->payload();
+    auto permutation_bits = communication::GetMessage(permutation_bits_msg)->payload();
     std::size_t number_of_simd{parent_[0]->GetNumberOfSimdValues()};
     BitSpan permutation_bits_span(const_cast<std::uint8_t*>(permutation_bits->data()),
                                   number_of_simd * output_wires_.size());
@@ -314,6 +336,15 @@ void OutputGate::EvaluateOnline() {
   }
 }
 
+GateCost OutputGate::GetCost() const {
+  GateCost cost;
+  cost.online_rounds = 1;
+  if (!my_output_ || everyones_output_) {
+    cost.online_bytes_sent = BitsToBytes(parent_.size() * parent_[0]->GetNumberOfSimdValues());
+  }
+  return cost;
+}
+
 XorGate::XorGate(motion::SharePointer parent_a, motion::SharePointer parent_b)
     : Base(parent_a->GetBackend()) {
   parent_a_ = parent_a->GetWires();
@@ -327,7 +358,7 @@ XorGate::XorGate(motion::SharePointer parent_a, motion::SharePointer parent_b)
 }
 
 SharePointer XorGate::GetOutputAsGarbledCircuitShare() const {
-  auto result = std::make_shared<garbled_circuit::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<garbled_circuit::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -386,7 +417,7 @@ InvGate::InvGate(motion::SharePointer parent) : Base(parent->GetBackend()) {
 }
 
 SharePointer InvGate::GetOutputAsGarbledCircuitShare() const {
-  auto result = std::make_shared<garbled_circuit::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<garbled_circuit::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -449,7 +480,7 @@ AndGate::AndGate(motion::SharePointer parent_a, motion::SharePointer parent_b)
 }
 
 SharePointer AndGate::GetOutputAsGarbledCircuitShare() const {
-  auto result = std::make_shared<garbled_circuit::Share>(output_wires_);
+  auto result = backend_.GetRegister()->EmplaceShare<garbled_circuit::Share>(output_wires_);
   assert(result);
   return result;
 }
@@ -458,6 +489,13 @@ encrypto::motion::SharePointer AndGate::GetOutputAsShare() const {
   return GetOutputAsGarbledCircuitShare();
 }
 
+GateCost AndGate::GetCost() const {
+  GateCost cost;
+  cost.number_of_and_operations = parent_a_.size() * parent_a_[0]->GetNumberOfSimdValues();
+  cost.multiplicative_depth = 1;
+  return cost;
+}
+
 AndGateGarbler::AndGateGarbler(motion::SharePointer parent_a, motion::SharePointer parent_b)
     : Base(parent_a, parent_b) {}
 
@@ -507,6 +545,13 @@ void AndGateGarbler::EvaluateSetup() {
 
 void AndGateGarbler::EvaluateOnline() {}
 
+GateCost AndGateGarbler::GetCost() const {
+  GateCost cost{Base::GetCost()};
+  cost.setup_bytes_sent = BitsToBytes(cost.number_of_and_operations *
+                                      (kGarbledTableBitSize + kGarbledControlBitsBitSize));
+  return cost;
+}
+
 AndGateEvaluator::AndGateEvaluator(motion::SharePointer parent_a, motion::SharePointer parent_b)
     : Base(parent_a, parent_b) {
   garbled_tables_msg_future_ = GetCommunicationLayer().GetMessageManager().RegisterReceive(
@@ -526,7 +571,7 @@ void AndGateEvaluator::EvaluateOnline() {
   std::size_t number_of_simd{parent_a_[0]->GetNumberOfSimdValues()};
 
   auto garbled_tables_msg{garbled_tables_msg_future_.get()};
-  auto garbled_tables{communication::GetMessage(garbled_tables_msg.data())->payload()};
+  auto garbled_tables{communication::GetMessage(garbled_tables_msg)->payload()};
   for (std::size_t wire_i = 0; wire_i < output_wires_.size(); ++wire_i) {
     auto gc_wire_a{std::dynamic_pointer_cast<garbled_circuit::Wire>(parent_a_[wire_i])};
     auto gc_wire_b{std::dynamic_pointer_cast<garbled_circuit::Wire>(parent_b_[wire_i])};
@@ -549,4 +594,204 @@ void AndGateEvaluator::EvaluateOnline() {
   }
 }
 
+CompiledCircuitGate::CompiledCircuitGate(motion::SharePointer parent,
+                                         std::shared_ptr<const CompiledCircuit> circuit)
+    : Base(parent->GetBackend()),
+      circuit_(std::move(circuit)),
+      number_of_simd_(parent->GetNumberOfSimdValues()) {
+  parents_ = parent->GetWires();
+  if (parents_.size() != circuit_->number_of_input_wires) {
+    throw std::invalid_argument(
+        fmt::format("CompiledCircuitGate: expected {} input wires, got {}",
+                    circuit_->number_of_input_wires, parents_.size()));
+  }
+  output_wires_.resize(circuit_->output_slots.size());
+  for (auto& wire : output_wires_) {
+    wire = GetRegister().EmplaceWire<garbled_circuit::Wire>(backend_, number_of_simd_);
+  }
+  tweak_offset_ =
+      GetRegister().ReserveGateIds(circuit_->number_of_and_operations * number_of_simd_);
+}
+
+SharePointer CompiledCircuitGate::GetOutputAsGarbledCircuitShare() const {
+  auto result = backend_.GetRegister()->EmplaceShare<garbled_circuit::Share>(output_wires_);
+  assert(result);
+  return result;
+}
+
+encrypto::motion::SharePointer CompiledCircuitGate::GetOutputAsShare() const {
+  return GetOutputAsGarbledCircuitShare();
+}
+
+GateCost CompiledCircuitGate::GetCost() const {
+  GateCost cost;
+  cost.number_of_and_operations = circuit_->number_of_and_operations * number_of_simd_;
+  for (std::size_t layer = 0; layer < circuit_->GetNumberOfLayers(); ++layer) {
+    if (circuit_->and_offsets[layer] != circuit_->layer_offsets[layer + 1]) {
+      ++cost.multiplicative_depth;
+    }
+  }
+  return cost;
+}
+
+void CompiledCircuitGate::CopyInputKeys(Block128Vector& keys) const {
+  for (std::size_t wire_i = 0; wire_i < parents_.size(); ++wire_i) {
+    auto gc_wire{std::dynamic_pointer_cast<garbled_circuit::Wire>(parents_[wire_i])};
+    assert(gc_wire);
+    assert(gc_wire->GetKeys().size() == number_of_simd_);
+    std::copy_n(gc_wire->GetKeys().data(), number_of_simd_, keys.data() + wire_i * number_of_simd_);
+  }
+}
+
+void CompiledCircuitGate::CopyOutputKeys(const Block128Vector& keys) {
+  for (std::size_t wire_i = 0; wire_i < output_wires_.size(); ++wire_i) {
+    auto gc_wire{std::dynamic_pointer_cast<garbled_circuit::Wire>(output_wires_[wire_i])};
+    assert(gc_wire);
+    const auto* slot{keys.data() + circuit_->output_slots[wire_i] * number_of_simd_};
+    gc_wire->GetMutableKeys() = Block128Vector(number_of_simd_, slot);
+  }
+}
+
+CompiledCircuitGateGarbler::CompiledCircuitGateGarbler(
+    motion::SharePointer parent, std::shared_ptr<const CompiledCircuit> circuit)
+    : Base(parent, std::move(circuit)) {}
+
+void CompiledCircuitGateGarbler::EvaluateSetup() {
+  auto& provider{dynamic_cast<ThreeHalvesGarblerProvider&>(GetGarbledCircuitProvider())};
+  provider.WaitSetup();
+  const auto& circuit{*circuit_};
+  const Block128& offset{provider.GetOffset()};
+
+  std::size_t total_number_of_ands{circuit.number_of_and_operations * number_of_simd_};
+  std::size_t tables_byte_size{total_number_of_ands * kGarbledTableByteSize};
+  std::size_t payload_size{
+      BitsToBytes(total_number_of_ands * (kGarbledTableBitSize + kGarbledControlBitsBitSize))};
+  auto garbled_tables_and_control_bits{std::make_unique<std::byte[]>(payload_size)};
+  std::byte* control_bits{garbled_tables_and_control_bits.get() + tables_byte_size};
+
+  for (auto& wire : parents_) {
+    auto gc_wire{std::dynamic_pointer_cast<garbled_circuit::Wire>(wire)};
+    assert(gc_wire);
+    gc_wire->WaitSetup();
+  }
+  Block128Vector keys(circuit.number_of_slots * number_of_simd_);
+  CopyInputKeys(keys);
+  auto slot = [&keys, this](std::uint32_t i) {
+    return std::span<Block128>(keys.data() + i * number_of_simd_, number_of_simd_);
+  };
+
+  std::size_t and_i{0};
+  for (std::size_t op = 0; op < circuit.GetNumberOfOperations(); ++op) {
+    auto a{slot(circuit.input_a[op])}, b{slot(circuit.input_b[op])}, out{slot(circuit.output[op])};
+    switch (circuit.operation_types[op]) {
+      case CompiledOperationType::kXor: {
+        for (std::size_t simd_i = 0; simd_i < number_of_simd_; ++simd_i) {
+          out[simd_i] = a[simd_i] ^ b[simd_i];
+        }
+        break;
+      }
+      case CompiledOperationType::kInv: {
+        for (std::size_t simd_i = 0; simd_i < number_of_simd_; ++simd_i) {
+          out[simd_i] = a[simd_i] ^ offset;
+        }
+        break;
+      }
+      case CompiledOperationType::kAnd: {
+        provider.Garble(a, b, out, garbled_tables_and_control_bits.get(), control_bits,
+                        and_i * number_of_simd_, tweak_offset_ + and_i * number_of_simd_);
+        ++and_i;
+        break;
+      }
+    }
+  }
+
+  CopyOutputKeys(keys);
+  for (auto& wire : output_wires_) {
+    std::dynamic_pointer_cast<garbled_circuit::Wire>(wire)->SetSetupIsReady();
+  }
+
+  if (circuit.number_of_and_operations > 0) {
+    auto builder{communication::BuildMessage(
+        communication::MessageType::kGarbledCircuitGarbledTables, gate_id_,
+        std::span(reinterpret_cast<const std::uint8_t*>(garbled_tables_and_control_bits.get()),
+                  payload_size))};
+    backend_.GetCommunicationLayer().SendMessage(
+        static_cast<std::size_t>(GarbledCircuitRole::kEvaluator), builder.Release());
+  }
+}
+
+void CompiledCircuitGateGarbler::EvaluateOnline() {}
+
+GateCost CompiledCircuitGateGarbler::GetCost() const {
+  GateCost cost{Base::GetCost()};
+  cost.setup_bytes_sent = BitsToBytes(cost.number_of_and_operations *
+                                      (kGarbledTableBitSize + kGarbledControlBitsBitSize));
+  return cost;
+}
+
+CompiledCircuitGateEvaluator::CompiledCircuitGateEvaluator(
+    motion::SharePointer parent, std::shared_ptr<const CompiledCircuit> circuit)
+    : Base(parent, std::move(circuit)) {
+  if (circuit_->number_of_and_operations > 0) {
+    garbled_tables_msg_future_ = GetCommunicationLayer().GetMessageManager().RegisterReceive(
+        static_cast<std::size_t>(GarbledCircuitRole::kGarbler),
+        communication::MessageType::kGarbledCircuitGarbledTables, gate_id_);
+  }
+}
+
+void CompiledCircuitGateEvaluator::EvaluateSetup() {
+  auto& provider{dynamic_cast<ThreeHalvesEvaluatorProvider&>(GetGarbledCircuitProvider())};
+  provider.WaitSetup();
+  if (circuit_->number_of_and_operations > 0) garbled_tables_msg_future_.wait();
+}
+
+void CompiledCircuitGateEvaluator::EvaluateOnline() {
+  auto& provider{dynamic_cast<ThreeHalvesEvaluatorProvider&>(GetGarbledCircuitProvider())};
+  const auto& circuit{*circuit_};
+  for (auto& wire : parents_) wire->GetIsReadyCondition().Wait();
+
+  std::vector<std::uint8_t> garbled_tables_msg;
+  const std::byte* garbled_tables{nullptr};
+  const std::byte* control_bits{nullptr};
+  if (circuit.number_of_and_operations > 0) {
+    garbled_tables_msg = garbled_tables_msg_future_.get();
+    garbled_tables = reinterpret_cast<const std::byte*>(
+        communication::GetMessage(garbled_tables_msg)->payload()->data());
+    control_bits = garbled_tables +
+                   circuit.number_of_and_operations * number_of_simd_ * kGarbledTableByteSize;
+  }
+
+  Block128Vector keys(circuit.number_of_slots * number_of_simd_);
+  CopyInputKeys(keys);
+  auto slot = [&keys, this](std::uint32_t i) {
+    return std::span<Block128>(keys.data() + i * number_of_simd_, number_of_simd_);
+  };
+
+  std::size_t and_i{0};
+  for (std::size_t op = 0; op < circuit.GetNumberOfOperations(); ++op) {
+    auto a{slot(circuit.input_a[op])}, b{slot(circuit.input_b[op])}, out{slot(circuit.output[op])};
+    switch (circuit.operation_types[op]) {
+      case CompiledOperationType::kXor: {
+        for (std::size_t simd_i = 0; simd_i < number_of_simd_; ++simd_i) {
+          out[simd_i] = a[simd_i] ^ b[simd_i];
+        }
+        break;
+      }
+      case CompiledOperationType::kInv: {
+        // only the garbler flips the keys
+        std::copy(a.begin(), a.end(), out.begin());
+        break;
+      }
+      case CompiledOperationType::kAnd: {
+        provider.Evaluate(a, b, out, garbled_tables, control_bits, and_i * number_of_simd_,
+                          tweak_offset_ + and_i * number_of_simd_);
+        ++and_i;
+        break;
+      }
+    }
+  }
+
+  CopyOutputKeys(keys);
+}
+
 }  // namespace encrypto::motion::proto::garbled_circuit
\ No newline at end of file
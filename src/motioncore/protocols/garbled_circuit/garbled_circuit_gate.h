@@ -28,6 +28,7 @@
 #include <span>
 #include <variant>
 
+#include "algorithm/compiled_circuit.h"
 #include "base/backend.h"
 #include "communication/communication_layer.h"
 #include "garbled_circuit_share.h"
@@ -117,6 +118,8 @@ class InputGateGarbler final : public garbled_circuit::InputGate {
   /// \brief Evaluates the online phase.
   void EvaluateOnline() override;
 
+  GateCost GetCost() const override;
+
  private:
   /// Promise is only required if the gate for own input is created.
   std::unique_ptr<GOt128Sender> ots_for_evaluators_inputs_{nullptr};
@@ -155,6 +158,8 @@ class InputGateEvaluator final : public garbled_circuit::InputGate {
   /// \brief Evaluates the online phase.
   void EvaluateOnline() override;
 
+  GateCost GetCost() const override;
+
  private:
   /// If this is the evaluator's input, the input label is obtained via OT. If this is the garbler's
   /// input, the corresponding label is simply transmitted to the evaluator by the garbler and
@@ -185,6 +190,8 @@ class OutputGate : public motion::OutputGate {
   /// \brief Evaluates the online phase.
   void EvaluateOnline() override;
 
+  GateCost GetCost() const override;
+
  protected:
   /// The id of the output owner.
   const std::size_t output_owner_;
@@ -313,6 +320,8 @@ class AndGate : public motion::TwoGate {
   /// \brief Calls GetOutputAsGarbledCircuitShare() and casts the result to motion::SharePointer.
   encrypto::motion::SharePointer GetOutputAsShare() const;
 
+  GateCost GetCost() const override;
+
  protected:
   AndGate(motion::SharePointer parent_a, motion::SharePointer parent_b);
 };
@@ -336,6 +345,9 @@ class AndGateGarbler final : public AndGate {
 
   /// \brief Evaluates the online phase.
   void EvaluateOnline() override;
+
+  /// \brief Adds the garbled tables sent to the evaluator to the cost of AndGate.
+  GateCost GetCost() const override;
 };
 
 class AndGateEvaluator final : public AndGate {
@@ -356,4 +368,78 @@ class AndGateEvaluator final : public AndGate {
   ReusableFiberFuture<std::vector<std::uint8_t>> garbled_tables_msg_future_;
 };
 
+/// \brief Evaluates a whole CompiledCircuit in a single gate by interpreting its flat
+/// representation on one buffer of keys. The garbled tables of all AND operations are sent in a
+/// single message.
+class CompiledCircuitGate : public motion::NInputGate {
+ public:
+  using Base = motion::NInputGate;
+  CompiledCircuitGate() = delete;
+  CompiledCircuitGate(const CompiledCircuitGate&) = delete;
+
+  /// \brief Interprets output wires as a garbled circuit share.
+  ///
+  /// Makes a copy of and dynamic_casts the wires, and create a share from those.
+  SharePointer GetOutputAsGarbledCircuitShare() const;
+
+  /// \brief Calls GetOutputAsGarbledCircuitShare() and casts the result to motion::SharePointer.
+  encrypto::motion::SharePointer GetOutputAsShare() const;
+
+  GateCost GetCost() const override;
+
+ protected:
+  CompiledCircuitGate(motion::SharePointer parent, std::shared_ptr<const CompiledCircuit> circuit);
+
+  /// \brief Copies the keys of the parent wires to the input slots of \p keys.
+  void CopyInputKeys(Block128Vector& keys) const;
+
+  /// \brief Copies the output slots of \p keys to the output wires.
+  void CopyOutputKeys(const Block128Vector& keys);
+
+  std::shared_ptr<const CompiledCircuit> circuit_;
+  std::size_t number_of_simd_;
+  /// First of the reserved tweaks for the AND operations, which use number_of_simd_ tweaks each.
+  std::size_t tweak_offset_;
+};
+
+class CompiledCircuitGateGarbler final : public CompiledCircuitGate {
+ public:
+  using Base = CompiledCircuitGate;
+
+  CompiledCircuitGateGarbler(motion::SharePointer parent,
+                             std::shared_ptr<const CompiledCircuit> circuit);
+
+  ~CompiledCircuitGateGarbler() override = default;
+
+  /// \brief Evaluates the setup phase.
+  void EvaluateSetup() override;
+
+  bool NeedsOnline() const override { return false; }
+
+  /// \brief Evaluates the online phase.
+  void EvaluateOnline() override;
+
+  /// \brief Adds the garbled tables sent to the evaluator to the cost of CompiledCircuitGate.
+  GateCost GetCost() const override;
+};
+
+class CompiledCircuitGateEvaluator final : public CompiledCircuitGate {
+ public:
+  using Base = CompiledCircuitGate;
+
+  CompiledCircuitGateEvaluator(motion::SharePointer parent,
+                               std::shared_ptr<const CompiledCircuit> circuit);
+
+  ~CompiledCircuitGateEvaluator() override = default;
+
+  /// \brief Evaluates the setup phase.
+  void EvaluateSetup() override;
+
+  /// \brief Evaluates the online phase.
+  void EvaluateOnline() override;
+
+ private:
+  ReusableFiberFuture<std::vector<std::uint8_t>> garbled_tables_msg_future_;
+};
+
 }  // namespace encrypto::motion::proto::garbled_circuit
@@ -27,6 +27,7 @@
 #include "communication/communication_layer.h"
 #include "communication/fbs_headers/garbled_circuit_message_generated.h"
 #include "communication/garbled_circuit_message.h"
+#include "communication/message.h"
 #include "garbled_circuit_constants.h"
 #include "garbled_circuit_utility.h"
 #include "garbled_circuit_wire.h"
@@ -70,7 +71,7 @@ void ThreeHalvesEvaluatorProvider::Setup() {
   }
 
   auto public_data_msg{three_halves_public_data_future_.get()};
-  auto payload{communication::GetMessage(public_data_msg.data())->payload()};
+  auto payload{communication::GetMessage(public_data_msg)->payload()};
   auto setup_msg{flatbuffers::GetRoot<communication::GarbledCircuitSetupMessage>(payload->data())};
 
   std::copy_n(setup_msg->aes_key()->data(), Block128::kBlockSize,
@@ -146,6 +147,14 @@ std::shared_ptr<garbled_circuit::XorGate> ThreeHalvesGarblerProvider::MakeXorGat
   return parent_a->GetRegister()->EmplaceGate<XorGateGarbler>(parent_a, parent_b);
 }
 
+std::shared_ptr<garbled_circuit::CompiledCircuitGate>
+ThreeHalvesGarblerProvider::MakeCompiledCircuitGate(
+    motion::SharePointer parent, std::shared_ptr<const CompiledCircuit> circuit) {
+  assert(parent->GetBackend().GetCommunicationLayer().GetMyId() ==
+         static_cast<std::size_t>(GarbledCircuitRole::kGarbler));
+  return parent->GetRegister()->EmplaceGate<CompiledCircuitGateGarbler>(parent, std::move(circuit));
+}
+
 std::shared_ptr<garbled_circuit::AndGate> ThreeHalvesEvaluatorProvider::MakeAndGate(
     motion::SharePointer parent_a, motion::SharePointer parent_b) {
   assert(parent_a->GetBackend().GetCommunicationLayer().GetMyId() ==
@@ -167,6 +176,15 @@ std::shared_ptr<garbled_circuit::XorGate> ThreeHalvesEvaluatorProvider::MakeXorG
   return parent_a->GetRegister()->EmplaceGate<XorGateEvaluator>(parent_a, parent_b);
 }
 
+std::shared_ptr<garbled_circuit::CompiledCircuitGate>
+ThreeHalvesEvaluatorProvider::MakeCompiledCircuitGate(
+    motion::SharePointer parent, std::shared_ptr<const CompiledCircuit> circuit) {
+  assert(parent->GetBackend().GetCommunicationLayer().GetMyId() ==
+         static_cast<std::size_t>(GarbledCircuitRole::kEvaluator));
+  return parent->GetRegister()->EmplaceGate<CompiledCircuitGateEvaluator>(parent,
+                                                                          std::move(circuit));
+}
+
 ThreeHalvesGarblerProvider::ThreeHalvesGarblerProvider(
     communication::CommunicationLayer& communication_layer)
     : Provider(communication_layer), random_key_offset_(Block128::MakeRandom()) {
@@ -260,14 +278,15 @@ inline void CopyControlBitsToZerothPositions(std::array<std::uint64_t, 8>& R_tim
   SetZerothBit(R_times_wires[7], GetBit<7>(compressed_wire_mapping));
 }
 
-void ThreeHalvesGarblerProvider::Garble(const Block128Vector& keys_a, const Block128Vector& keys_b,
-                                        Block128Vector& keys_out, std::byte* garbled_tables,
+void ThreeHalvesGarblerProvider::Garble(std::span<const Block128> keys_a,
+                                        std::span<const Block128> keys_b,
+                                        std::span<Block128> keys_out, std::byte* garbled_tables,
                                         std::byte* garbled_control_bits, std::size_t table_offset,
                                         std::size_t gate_index) {
   static_assert(kGarbledControlBitsBitSize == 5, "Garbling may not work for other bit-lengths");
   static_assert(kGarbledRowBitSize == 64, "Garbling may not work for other bit-lengths");
   const std::size_t number_of_simd{keys_a.size()};
-  keys_out.resize(number_of_simd);
+  assert(keys_out.size() == number_of_simd);
 
   auto randomness_pool_for_R{BitVector<>::SecureRandom(2 * number_of_simd)};
 
@@ -474,13 +493,14 @@ inline std::byte ExtractGarbledControlBits(const std::byte* data, std::size_t bi
   return z;
 }
 
-void ThreeHalvesEvaluatorProvider::Evaluate(const Block128Vector& keys_a,
-                                            const Block128Vector& keys_b, Block128Vector& keys_out,
+void ThreeHalvesEvaluatorProvider::Evaluate(std::span<const Block128> keys_a,
+                                            std::span<const Block128> keys_b,
+                                            std::span<Block128> keys_out,
                                             const std::byte* garbled_tables,
                                             const std::byte* garbled_control_bits,
                                             std::size_t table_offset, std::size_t gate_index) {
   const std::size_t number_of_simd{keys_a.size()};
-  keys_out.resize(number_of_simd);
+  assert(keys_out.size() == number_of_simd);
   for (std::size_t simd_i = 0; simd_i < number_of_simd; ++simd_i) {
     std::byte z{ExtractGarbledControlBits(garbled_control_bits,
                                           (table_offset + simd_i) * kGarbledControlBitsBitSize)};
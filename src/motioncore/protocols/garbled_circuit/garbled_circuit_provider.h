@@ -25,6 +25,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <unordered_map>
 
 #include "communication/message_manager.h"
@@ -97,6 +98,11 @@ class Provider : public FiberSetupWaitable {
   virtual std::shared_ptr<garbled_circuit::XorGate> MakeXorGate(motion::SharePointer parent_a,
                                                                 motion::SharePointer parent_b) = 0;
 
+  /// \brief Constructs a specific gate evaluating a whole compiled circuit depending on party's
+  /// role.
+  virtual std::shared_ptr<garbled_circuit::CompiledCircuitGate> MakeCompiledCircuitGate(
+      motion::SharePointer parent, std::shared_ptr<const CompiledCircuit> circuit) = 0;
+
   void AesNiFixedKeyForThreeHalvesGatesBatch3(std::span<const std::byte> round_keys,
                                               const Block128& hash_key, std::size_t gate_index,
                                               std::span<Block128> input);
@@ -131,8 +137,12 @@ class ThreeHalvesGarblerProvider final : public Provider {
   std::shared_ptr<garbled_circuit::XorGate> MakeXorGate(motion::SharePointer parent_a,
                                                         motion::SharePointer parent_b) override;
 
-  void Garble(const Block128Vector& keys_a, const Block128Vector& keys_b, Block128Vector& keys_out,
-              std::byte*, std::byte* garbled_control_bits,
+  std::shared_ptr<garbled_circuit::CompiledCircuitGate> MakeCompiledCircuitGate(
+      motion::SharePointer parent, std::shared_ptr<const CompiledCircuit> circuit) override;
+
+  /// \brief Garbles keys_a.size() AND gates. keys_out must have the same size as keys_a.
+  void Garble(std::span<const Block128> keys_a, std::span<const Block128> keys_b,
+              std::span<Block128> keys_out, std::byte*, std::byte* garbled_control_bits,
               std::size_t table_offset, std::size_t gate_index);
 
   void AesNiFixedKeyForThreeHalvesGatesBatch6(std::span<const std::byte> round_keys,
@@ -151,8 +161,9 @@ class ThreeHalvesEvaluatorProvider final : public Provider {
 
   void Setup() override;
 
-  void Evaluate(const Block128Vector& keys_a, const Block128Vector& keys_b,
-                Block128Vector& keys_out, const std::byte* garbled_tables,
+  /// \brief Evaluates keys_a.size() AND gates. keys_out must have the same size as keys_a.
+  void Evaluate(std::span<const Block128> keys_a, std::span<const Block128> keys_b,
+                std::span<Block128> keys_out, const std::byte* garbled_tables,
                 const std::byte* garbled_control_bits, std::size_t table_offset,
                 std::size_t gate_index);
 
@@ -164,6 +175,9 @@ class ThreeHalvesEvaluatorProvider final : public Provider {
   std::shared_ptr<garbled_circuit::XorGate> MakeXorGate(motion::SharePointer parent_a,
                                                         motion::SharePointer parent_b) override;
 
+  std::shared_ptr<garbled_circuit::CompiledCircuitGate> MakeCompiledCircuitGate(
+      motion::SharePointer parent, std::shared_ptr<const CompiledCircuit> circuit) override;
+
  private:
   ReusableFiberFuture<std::vector<std::uint8_t>> three_halves_public_data_future_;
 };
@@ -65,6 +65,10 @@ class Wire final : public BooleanWire, public FiberSetupWaitable {
 
   bool IsConstant() const noexcept final { return false; }
 
+  std::size_t GetPayloadSize() const noexcept final { return wire_labels_.ByteSize(); }
+
+  void ReleasePayload() final { wire_labels_ = Block128Vector(); }
+
  private:
   /// Generated wire labels of the garbler or evaluated/obtained wire labels of the evaluator.
   Block128Vector wire_labels_;
@@ -57,6 +57,22 @@ using WirePointer = std::shared_ptr<Wire>;
 namespace proto::garbled_circuit {
 class Provider;
 }
+/// \brief Static cost of a gate from the point of view of this party, which is derived from the
+/// parameters of the gate without evaluating it, see EstimateCircuitCost. The preprocessing that
+/// the gate requests from the MT, SP, SB and OT providers is accounted by the providers.
+struct GateCost {
+  // nonlinear operations, counted per SIMD value
+  std::size_t number_of_and_operations = 0;
+  std::size_t number_of_multiplications = 0;
+  // layers of nonlinear operations on the longest path through the gate
+  std::size_t multiplicative_depth = 0;
+  // sequential communication rounds of the online phase that depend on the inputs of the gate
+  std::size_t online_rounds = 0;
+  // bytes this party sends to all other parties in the setup and the online phase of the gate
+  std::size_t setup_bytes_sent = 0;
+  std::size_t online_bytes_sent = 0;
+};
+
 //
 //  inputs are not defined in the Gate class but only in the child classes
 //
@@ -78,12 +94,19 @@ class Gate {
 
   const std::vector<WirePointer>& GetOutputWires() const { return output_wires_; }
 
+  /// \brief Returns the wires this gate reads from, i.e., the output wires of its parent gates.
+  virtual std::vector<WirePointer> GetParentWires() const { return {}; }
+
   void Clear();
 
   virtual bool NeedsSetup() const { return true; }
 
   virtual bool NeedsOnline() const { return true; }
 
+  /// \brief Returns true if the gate can be evaluated again after Clear(), i.e., it does not hold
+  /// one-time state such as registered OTs.
+  virtual bool IsReusable() const { return false; }
+
   void SetSetupIsReady();
 
   void SetOnlineIsReady();
@@ -96,6 +119,17 @@ class Gate {
 
   std::int64_t GetId() const { return gate_id_; }
 
+  /// \brief Length of the longest path from this gate to a gate whose outputs are not read by other
+  /// gates. Gates with a higher priority are on the critical path and are started first if
+  /// prioritized scheduling is enabled.
+  std::size_t GetPriority() const { return priority_; }
+
+  void SetPriority(std::size_t priority) { priority_ = priority; }
+
+  /// \brief Returns the static cost of this gate. Gates that neither compute nonlinear operations
+  /// nor communicate keep the default of no cost.
+  virtual GateCost GetCost() const { return {}; }
+
   Gate(Gate&) = delete;
 
  protected:
@@ -111,6 +145,8 @@ class Gate {
 
   bool own_output_wires_{true};
 
+  std::size_t priority_ = 0;
+
   Gate(Backend& backend);
 
   Register& GetRegister();
@@ -151,6 +187,8 @@ class OneGate : public Gate {
 
   const std::vector<WirePointer>& GetParent() const { return parent_; }
 
+  std::vector<WirePointer> GetParentWires() const override { return parent_; }
+
  protected:
   std::vector<WirePointer> parent_;
 
@@ -229,6 +267,12 @@ class TwoGate : public Gate {
 
   const std::vector<WirePointer>& GetParentA() const { return parent_a_; }
   const std::vector<WirePointer>& GetParentB() const { return parent_b_; }
+
+  std::vector<WirePointer> GetParentWires() const override {
+    std::vector<WirePointer> parents(parent_a_);
+    parents.insert(parents.end(), parent_b_.begin(), parent_b_.end());
+    return parents;
+  }
 };
 
 //
@@ -255,6 +299,13 @@ class ThreeGate : public Gate {
   const std::vector<WirePointer>& GetParentA() const { return parent_a_; }
   const std::vector<WirePointer>& GetParentB() const { return parent_b_; }
   const std::vector<WirePointer>& GetParentC() const { return parent_c_; }
+
+  std::vector<WirePointer> GetParentWires() const override {
+    std::vector<WirePointer> parents(parent_a_);
+    parents.insert(parents.end(), parent_b_.begin(), parent_b_.end());
+    parents.insert(parents.end(), parent_c_.begin(), parent_c_.end());
+    return parents;
+  }
 };
 
 //
@@ -277,6 +328,8 @@ class NInputGate : public Gate {
   ~NInputGate() override = default;
 
   const std::vector<WirePointer>& GetParents() const { return parents_; }
+
+  std::vector<WirePointer> GetParentWires() const override { return parents_; }
 };
 
 }  // namespace encrypto::motion
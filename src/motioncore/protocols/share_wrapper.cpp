@@ -29,6 +29,7 @@
 #include <typeinfo>
 
 #include "algorithm/algorithm_description.h"
+#include "algorithm/compiled_circuit.h"
 #include "algorithm/low_depth_reduce.h"
 #include "base/backend.h"
 #include "protocols/arithmetic_gmw/arithmetic_gmw_gate.h"
@@ -980,6 +981,32 @@ namespace encrypto::motion
     return ShareWrapper::Concatenate(output);
   }
 
+  ShareWrapper ShareWrapper::Evaluate(const std::shared_ptr<const CompiledCircuit> &circuit) const
+  {
+    assert(circuit);
+    switch (share_->GetProtocol())
+    {
+    case MpcProtocol::kBooleanGmw:
+    {
+      auto compiled_gate =
+          share_->GetBackend()
+              .GetRegister()
+              ->EmplaceGate<proto::boolean_gmw::CompiledCircuitGate>(share_, circuit);
+      return ShareWrapper(compiled_gate->GetOutputAsShare());
+    }
+    case MpcProtocol::kGarbledCircuit:
+    {
+      auto compiled_gate =
+          share_->GetBackend().GetGarbledCircuitProvider().MakeCompiledCircuitGate(share_, circuit);
+      return ShareWrapper(compiled_gate->GetOutputAsShare());
+    }
+    default:
+      throw std::runtime_error(
+          fmt::format("Compiled circuits are not supported for protocol {}",
+                      to_string(share_->GetProtocol())));
+    }
+  }
+
   void ShareWrapper::ShareConsistencyCheck() const
   {
     if (share_->GetWires().size() == 0)
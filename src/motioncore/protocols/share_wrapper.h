@@ -34,6 +34,7 @@
 namespace encrypto::motion {
 
 struct AlgorithmDescription;
+struct CompiledCircuit;
 
 class Share;
 using SharePointer = std::shared_ptr<Share>;
@@ -151,6 +152,11 @@ class ShareWrapper {
   /// \returns a share over the output wires of the constructed circuit.
   ShareWrapper Evaluate(const AlgorithmDescription& algo) const;
 
+  /// \brief evaluates the CompiledCircuit circuit on this->share_ as input in a single gate
+  /// instead of one gate per operation. Only supported for Boolean GMW and garbled circuits.
+  /// \returns a share over the output wires of the circuit.
+  ShareWrapper Evaluate(const std::shared_ptr<const CompiledCircuit>& circuit) const;
+
   /// \brief constructs a SubsetGate that returns values stored at positions in this->share_.
   /// Internally calls ShareWrapper Subset(std::span<std::size_t> positions).
   ShareWrapper Subset(std::vector<std::size_t>&& positions);
@@ -68,11 +68,30 @@ class Wire {
 
   void Clear() {
     is_done_ = false;
+    remaining_consumers_ = number_of_consumers_;
     DynamicClear();
   }
 
   virtual bool IsConstant() const noexcept = 0;
 
+  /// \brief Registers a gate that reads this wire in its online phase.
+  void AddConsumer() noexcept {
+    ++number_of_consumers_;
+    ++remaining_consumers_;
+  }
+
+  /// \brief Marks that one of the consuming gates finished its online phase.
+  /// \return true if this was the last consuming gate, i.e., the payload is not needed anymore.
+  bool RemoveConsumer() noexcept { return --remaining_consumers_ == 0; }
+
+  std::size_t GetNumberOfConsumers() const noexcept { return number_of_consumers_; }
+
+  /// \brief Size of the values (shares, keys, labels) held by this wire in bytes.
+  virtual std::size_t GetPayloadSize() const noexcept { return 0; }
+
+  /// \brief Frees the values held by this wire. They are set again if the circuit is re-run.
+  virtual void ReleasePayload() {}
+
   Wire(const Wire&) = delete;
 
  protected:
@@ -89,6 +108,10 @@ class Wire {
 
   std::int64_t wire_id_ = -1;
 
+  // number of gates reading this wire in their online phase and how many of them did not finish
+  std::size_t number_of_consumers_ = 0;
+  std::atomic<std::size_t> remaining_consumers_ = 0;
+
   Wire(Backend& backend, std::size_t number_of_simd);
 
   virtual void DynamicClear(){};
@@ -22,12 +22,14 @@
 
 #include "analysis.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <sstream>
 
 #include <fmt/format.h>
 
+#include "communication/message.h"
 #include "communication/transport.h"
 #include "utility/runtime_info.h"
 #include "utility/version.h"
@@ -45,6 +47,8 @@ void AccumulatedRunTimeStatistics::Add(const RunTimeStatistics& statistics) {
        ++i) {
     accumulators_[i](ComputeDuration(statistics.data[i]));
   }
+  peak_wire_memory_accumulator_(static_cast<double>(statistics.peak_wire_memory) / 1024);
+  total_wire_memory_accumulator_(static_cast<double>(statistics.total_wire_memory) / 1024);
   ++count_;
 }
 
@@ -79,6 +83,9 @@ std::string AccumulatedRunTimeStatistics::PrintHumanReadable() const {
      << fmt::format("                    {:>{}s}    {:>{}s}    {:>{}s}\n", "mean", kFieldWidth,
                     "median", kFieldWidth, "stddev", kFieldWidth)
      << "---------------------------------------------------------------------------\n"
+     << FormatLine("Connection Setup", unit, At(accumulators_, StatId::kConnectionSetup),
+                   kFieldWidth)
+     << "---------------------------------------------------------------------------\n"
      << FormatLine("MT Presetup", unit, At(accumulators_, StatId::kMtPresetup), kFieldWidth)
      << FormatLine("MT Setup", unit, At(accumulators_, StatId::kMtSetup), kFieldWidth)
      << FormatLine("SP Presetup", unit, At(accumulators_, StatId::kSpPresetup), kFieldWidth)
@@ -98,18 +105,28 @@ std::string AccumulatedRunTimeStatistics::PrintHumanReadable() const {
      << "---------------------------------------------------------------------------\n"
      << FormatLine("Circuit Evaluation", unit, At(accumulators_, StatId::kEvaluate), kFieldWidth);
 
+  // only recorded if wire reclamation is enabled
+  if (boost::accumulators::mean(total_wire_memory_accumulator_) > 0) {
+    ss << "---------------------------------------------------------------------------\n"
+       << FormatLine("Wire Memory Peak", "KiB", peak_wire_memory_accumulator_, kFieldWidth)
+       << FormatLine("Wire Memory Total", "KiB", total_wire_memory_accumulator_, kFieldWidth);
+  }
+
   return ss.str();
 }
 
 boost::json::object AccumulatedRunTimeStatistics::ToJson() const {
-  const auto make_triple = [this](const auto& stat_id) {
-    const auto& acc = At(accumulators_, stat_id);
+  const auto make_accumulator_triple = [](const auto& acc) {
     return boost::json::object({{"mean", boost::accumulators::mean(acc)},
                                 {"median", boost::accumulators::median(acc)},
                                 // uncorrected standard deviation
                                 {"stddev", std::sqrt(boost::accumulators::variance(acc))}});
   };
+  const auto make_triple = [this, &make_accumulator_triple](const auto& stat_id) {
+    return make_accumulator_triple(At(accumulators_, stat_id));
+  };
   return {{"repetitions", count_},
+          {"connection_setup", make_triple(StatId::kConnectionSetup)},
           {"mt_presetup", make_triple(StatId::kMtPresetup)},
           {"mt_setup", make_triple(StatId::kMtSetup)},
           {"sp_presetup", make_triple(StatId::kSpPresetup)},
@@ -122,7 +139,16 @@ boost::json::object AccumulatedRunTimeStatistics::ToJson() const {
           {"preprocessing", make_triple(StatId::kPreprocessing)},
           {"gates_setup", make_triple(StatId::kGatesSetup)},
           {"gates_online", make_triple(StatId::kGatesOnline)},
-          {"evaluate", make_triple(StatId::kEvaluate)}};
+          {"evaluate", make_triple(StatId::kEvaluate)},
+          {"peak_wire_memory_kib", make_accumulator_triple(peak_wire_memory_accumulator_)},
+          {"total_wire_memory_kib", make_accumulator_triple(total_wire_memory_accumulator_)}};
+}
+
+static std::string GetMessageTypeName(std::uint8_t message_type) {
+  const auto* name = communication::EnumNameMessageType(
+      static_cast<communication::MessageType>(message_type));
+  // the name is empty for values which are not in the schema
+  return name && *name ? name : fmt::format("MessageType({})", message_type);
 }
 
 void AccumulatedCommunicationStatistics::Add(const communication::TransportStatistics& statistics) {
@@ -130,6 +156,16 @@ void AccumulatedCommunicationStatistics::Add(const communication::TransportStati
   accumulators_[kIdxNumberOfMessagesReceived](statistics.number_of_messages_received);
   accumulators_[kIdxNumberOfBytesSent](statistics.number_of_bytes_sent);
   accumulators_[kIdxNumberOfBytesReceived](statistics.number_of_bytes_received);
+  accumulators_[kIdxNumberOfWriteCalls](statistics.number_of_write_calls);
+  accumulators_[kIdxNumberOfReadCalls](statistics.number_of_read_calls);
+  number_of_io_threads_ = std::max(number_of_io_threads_, statistics.number_of_io_threads);
+  for (const auto& [key, message_type_statistics] : statistics.message_type_statistics) {
+    auto& sum{message_type_statistics_[key]};
+    sum.number_of_messages_sent += message_type_statistics.number_of_messages_sent;
+    sum.number_of_messages_received += message_type_statistics.number_of_messages_received;
+    sum.number_of_bytes_sent += message_type_statistics.number_of_bytes_sent;
+    sum.number_of_bytes_received += message_type_statistics.number_of_bytes_received;
+  }
   ++count_;
 }
 
@@ -153,9 +189,48 @@ std::string AccumulatedCommunicationStatistics::PrintHumanReadable() const {
                     boost::accumulators::mean(accumulators_[kIdxNumberOfBytesReceived]) / kMiB,
                     static_cast<std::size_t>(
                         boost::accumulators::mean(accumulators_[kIdxNumberOfMessagesReceived])));
+  // only reported by transports with dedicated I/O threads
+  if (number_of_io_threads_ > 0) {
+    ss << fmt::format("I/O: {:d} write and {:d} read calls on {:d} I/O threads\n",
+                      static_cast<std::size_t>(
+                          boost::accumulators::mean(accumulators_[kIdxNumberOfWriteCalls])),
+                      static_cast<std::size_t>(
+                          boost::accumulators::mean(accumulators_[kIdxNumberOfReadCalls])),
+                      number_of_io_threads_);
+  }
+  // the breakdown is only known for statistics of a CommunicationLayer
+  if (!message_type_statistics_.empty()) {
+    ss << fmt::format("{:<7} {:<36} {:>11} {:>9} {:>11} {:>9}\n", "Phase", "Message type",
+                      "Sent [KiB]", "Messages", "Recv [KiB]", "Messages");
+    for (const auto& [key, sum] : message_type_statistics_) {
+      const auto& [phase, message_type] = key;
+      ss << fmt::format("{:<7} {:<36} {:>11.3f} {:>9d} {:>11.3f} {:>9d}\n",
+                        phase == communication::CommunicationPhase::kSetup ? "setup" : "online",
+                        GetMessageTypeName(message_type),
+                        static_cast<double>(sum.number_of_bytes_sent) / count_ / 1024,
+                        sum.number_of_messages_sent / count_,
+                        static_cast<double>(sum.number_of_bytes_received) / count_ / 1024,
+                        sum.number_of_messages_received / count_);
+    }
+  }
   return ss.str();
 }
 
+boost::json::array AccumulatedCommunicationStatistics::MessageTypeStatisticsToJson() const {
+  boost::json::array result;
+  for (const auto& [key, sum] : message_type_statistics_) {
+    const auto& [phase, message_type] = key;
+    result.emplace_back(boost::json::object(
+        {{"phase", phase == communication::CommunicationPhase::kSetup ? "setup" : "online"},
+         {"message_type", GetMessageTypeName(message_type)},
+         {"bytes_sent", sum.number_of_bytes_sent / count_},
+         {"num_messages_sent", sum.number_of_messages_sent / count_},
+         {"bytes_received", sum.number_of_bytes_received / count_},
+         {"num_messages_received", sum.number_of_messages_received / count_}}));
+  }
+  return result;
+}
+
 boost::json::object AccumulatedCommunicationStatistics::ToJson() const {
   return {
       {"bytes_sent",
@@ -165,7 +240,13 @@ boost::json::object AccumulatedCommunicationStatistics::ToJson() const {
       {"bytes_received", static_cast<std::size_t>(
                              boost::accumulators::mean(accumulators_[kIdxNumberOfBytesReceived]))},
       {"num_messages_received", static_cast<std::size_t>(boost::accumulators::mean(
-                                    accumulators_[kIdxNumberOfMessagesReceived]))}};
+                                    accumulators_[kIdxNumberOfMessagesReceived]))},
+      {"num_write_calls",
+       static_cast<std::size_t>(boost::accumulators::mean(accumulators_[kIdxNumberOfWriteCalls]))},
+      {"num_read_calls",
+       static_cast<std::size_t>(boost::accumulators::mean(accumulators_[kIdxNumberOfReadCalls]))},
+      {"num_io_threads", number_of_io_threads_},
+      {"message_types", MessageTypeStatisticsToJson()}};
 }
 
 std::string PrintMotionInfo() {
@@ -30,14 +30,10 @@
 #include <boost/accumulators/statistics/variance.hpp>
 #include <boost/json.hpp>
 #include <list>
+#include <map>
+#include "communication/transport.h"
 #include "run_time_statistics.h"
 
-namespace encrypto::motion::communication {
-
-struct TransportStatistics;
-
-}  // namespace encrypto::motion::communication
-
 namespace encrypto::motion {
 
 class AccumulatedRunTimeStatistics {
@@ -60,6 +56,9 @@ class AccumulatedRunTimeStatistics {
   std::size_t count_ = 0;
   std::array<AccumulatorType, static_cast<std::size_t>(RunTimeStatistics::StatisticsId::kMax) + 1>
       accumulators_;
+  // in KiB
+  AccumulatorType peak_wire_memory_accumulator_;
+  AccumulatorType total_wire_memory_accumulator_;
 };
 
 class AccumulatedCommunicationStatistics {
@@ -72,6 +71,8 @@ class AccumulatedCommunicationStatistics {
   static constexpr std::size_t kIdxNumberOfMessagesReceived = 1;
   static constexpr std::size_t kIdxNumberOfBytesSent = 2;
   static constexpr std::size_t kIdxNumberOfBytesReceived = 3;
+  static constexpr std::size_t kIdxNumberOfWriteCalls = 4;
+  static constexpr std::size_t kIdxNumberOfReadCalls = 5;
 
   void Add(const communication::TransportStatistics& statistics);
 
@@ -82,8 +83,15 @@ class AccumulatedCommunicationStatistics {
   boost::json::object ToJson() const;
 
  private:
+  boost::json::array MessageTypeStatisticsToJson() const;
+
   std::size_t count_ = 0;
-  std::array<AccumulatorType, 4> accumulators_;
+  std::size_t number_of_io_threads_ = 0;
+  std::array<AccumulatorType, 6> accumulators_;
+  // sums of the traffic by phase and message type over all added statistics
+  std::map<std::pair<communication::CommunicationPhase, std::uint8_t>,
+           communication::MessageTypeStatistics>
+      message_type_statistics_;
 };
 
 std::string PrintStatistics(const std::string& experiment_name, const AccumulatedRunTimeStatistics&,
@@ -0,0 +1,238 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "circuit_cost.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include "base/backend.h"
+#include "base/register.h"
+#include "communication/communication_layer.h"
+#include "multiplication_triple/mt_provider.h"
+#include "multiplication_triple/sb_provider.h"
+#include "multiplication_triple/sp_provider.h"
+#include "oblivious_transfer/ot_provider.h"
+#include "protocols/gate.h"
+#include "protocols/wire.h"
+#include "utility/helpers.h"
+
+namespace encrypto::motion {
+
+// bits the receiver of an OT extension sends per OT, i.e., one column of the extension matrix
+constexpr std::size_t kOtExtensionBitSize = 128;
+
+namespace {
+
+struct PathCost {
+  std::size_t multiplicative_depth = 0;
+  std::size_t online_rounds = 0;
+};
+
+// accounts for number_of_ots correlated OTs of bit_size bits in which this party is the sender
+// or the receiver
+void AddOts(CircuitCost& cost, std::size_t number_of_ots, std::size_t bit_size, bool sender) {
+  if (sender) {
+    cost.number_of_ots_sent += number_of_ots;
+    cost.offline_bytes_sent += BitsToBytes(number_of_ots * bit_size);
+  } else {
+    cost.number_of_ots_received += number_of_ots;
+    cost.offline_bytes_sent += BitsToBytes(number_of_ots * kOtExtensionBitSize);
+  }
+}
+
+// MTs are generated with both roles with each other party, see MtProviderFromOts
+template <typename T>
+void AddIntegerMts(CircuitCost& cost, const MtProvider& mt_provider,
+                   std::size_t number_of_other_parties) {
+  constexpr std::size_t kBitSize = sizeof(T) * 8;
+  const std::size_t number_of_mts = mt_provider.GetNumberOfMts<T>();
+  cost.number_of_integer_mts += number_of_mts;
+  for (std::size_t i = 0; i < number_of_other_parties; ++i) {
+    AddOts(cost, number_of_mts * kBitSize, kBitSize, true);
+    AddOts(cost, number_of_mts * kBitSize, kBitSize, false);
+  }
+}
+
+// SPs are generated with one role with each other party, see SpProviderFromOts
+template <typename T>
+void AddSps(CircuitCost& cost, std::size_t number_of_sps, std::size_t my_id,
+            std::size_t number_of_parties) {
+  constexpr std::size_t kBitSize = sizeof(T) * 8;
+  for (std::size_t i = 0; i < number_of_parties; ++i) {
+    if (i != my_id) AddOts(cost, number_of_sps * kBitSize, kBitSize, i < my_id);
+  }
+}
+
+// SBs in Z/2^kZ consume SPs in Z/2^(2k)Z and broadcast two values of that size, see
+// SbProviderFromSps
+template <typename T, typename U>
+void AddSbs(CircuitCost& cost, const SbProvider& sb_provider, std::size_t my_id,
+            std::size_t number_of_parties) {
+  const std::size_t number_of_sbs = sb_provider.GetNumberOfSbs<T>();
+  cost.number_of_sbs += number_of_sbs;
+  AddSps<U>(cost, number_of_sbs, my_id, number_of_parties);
+  cost.offline_bytes_sent += (number_of_parties - 1) * 2 * number_of_sbs * sizeof(U);
+}
+
+}  // namespace
+
+CircuitCost EstimateCircuitCost(Backend& backend) {
+  CircuitCost cost;
+  auto& communication_layer = backend.GetCommunicationLayer();
+  const std::size_t my_id = communication_layer.GetMyId();
+  const std::size_t number_of_parties = communication_layer.GetNumberOfParties();
+
+  // the longest path to each wire, wires without a gate in the register are circuit inputs
+  std::unordered_map<const Wire*, PathCost> path_costs;
+  for (const auto& gate : backend.GetRegister()->GetGates()) {
+    PathCost path;
+    for (const auto& wire : gate->GetParentWires()) {
+      if (auto iterator = path_costs.find(wire.get()); iterator != path_costs.end()) {
+        path.multiplicative_depth =
+            std::max(path.multiplicative_depth, iterator->second.multiplicative_depth);
+        path.online_rounds = std::max(path.online_rounds, iterator->second.online_rounds);
+      }
+    }
+
+    const GateCost gate_cost{gate->GetCost()};
+    path.multiplicative_depth += gate_cost.multiplicative_depth;
+    path.online_rounds += gate_cost.online_rounds;
+    cost.multiplicative_depth = std::max(cost.multiplicative_depth, path.multiplicative_depth);
+    cost.online_rounds = std::max(cost.online_rounds, path.online_rounds);
+
+    const auto& output_wires{gate->GetOutputWires()};
+    for (const auto& wire : output_wires) path_costs[wire.get()] = path;
+    if (!output_wires.empty()) {
+      const auto protocol{static_cast<std::size_t>(output_wires.front()->GetProtocol())};
+      if (protocol < cost.number_of_gates_per_protocol.size()) {
+        ++cost.number_of_gates_per_protocol[protocol];
+      }
+    }
+
+    ++cost.number_of_gates;
+    cost.number_of_and_operations += gate_cost.number_of_and_operations;
+    cost.number_of_multiplications += gate_cost.number_of_multiplications;
+    cost.offline_bytes_sent += gate_cost.setup_bytes_sent;
+    cost.online_bytes_sent += gate_cost.online_bytes_sent;
+  }
+
+  if (number_of_parties < 2) return cost;
+  const std::size_t number_of_other_parties = number_of_parties - 1;
+
+  // OTs registered directly by the gates, the providers register theirs during preprocessing
+  for (std::size_t i = 0; i < number_of_parties; ++i) {
+    if (i == my_id) continue;
+    auto& ot_provider{backend.GetOtProvider(i)};
+    cost.number_of_ots_sent += ot_provider.GetNumOtsSender();
+    cost.number_of_ots_received += ot_provider.GetNumOtsReceiver();
+    cost.offline_bytes_sent += BitsToBytes(ot_provider.GetNumOtsReceiver() * kOtExtensionBitSize);
+  }
+
+  const auto& mt_provider{backend.GetMtProvider()};
+  cost.number_of_binary_mts = mt_provider.GetNumberOfMts<bool>();
+  for (std::size_t i = 0; i < number_of_other_parties; ++i) {
+    AddOts(cost, cost.number_of_binary_mts, 1, true);
+    AddOts(cost, cost.number_of_binary_mts, 1, false);
+  }
+  AddIntegerMts<std::uint8_t>(cost, mt_provider, number_of_other_parties);
+  AddIntegerMts<std::uint16_t>(cost, mt_provider, number_of_other_parties);
+  AddIntegerMts<std::uint32_t>(cost, mt_provider, number_of_other_parties);
+  AddIntegerMts<std::uint64_t>(cost, mt_provider, number_of_other_parties);
+
+  const auto& sp_provider{backend.GetSpProvider()};
+  const auto add_sps = [&](auto value) {
+    using T = decltype(value);
+    const std::size_t number_of_sps = sp_provider.GetNumberOfSps<T>();
+    cost.number_of_sps += number_of_sps;
+    AddSps<T>(cost, number_of_sps, my_id, number_of_parties);
+  };
+  add_sps(std::uint8_t{});
+  add_sps(std::uint16_t{});
+  add_sps(std::uint32_t{});
+  add_sps(std::uint64_t{});
+  add_sps(__uint128_t{});
+
+  const auto& sb_provider{backend.GetSbProvider()};
+  AddSbs<std::uint8_t, std::uint16_t>(cost, sb_provider, my_id, number_of_parties);
+  AddSbs<std::uint16_t, std::uint32_t>(cost, sb_provider, my_id, number_of_parties);
+  AddSbs<std::uint32_t, std::uint64_t>(cost, sb_provider, my_id, number_of_parties);
+  AddSbs<std::uint64_t, __uint128_t>(cost, sb_provider, my_id, number_of_parties);
+
+  return cost;
+}
+
+std::string CircuitCost::PrintHumanReadable() const {
+  std::stringstream ss;
+  ss << "Estimated circuit cost\n"
+     << "---------------------------------------------------------------------------\n";
+  ss << fmt::format("{:26s} {:>12}\n", "gates", number_of_gates);
+  for (std::size_t i = 0; i < number_of_gates_per_protocol.size(); ++i) {
+    if (number_of_gates_per_protocol[i] == 0) continue;
+    ss << fmt::format("  {:24s} {:>12}\n", to_string(static_cast<MpcProtocol>(i)),
+                      number_of_gates_per_protocol[i]);
+  }
+  ss << fmt::format("{:26s} {:>12}\n", "AND operations", number_of_and_operations)
+     << fmt::format("{:26s} {:>12}\n", "multiplications", number_of_multiplications)
+     << fmt::format("{:26s} {:>12}\n", "multiplicative depth", multiplicative_depth)
+     << fmt::format("{:26s} {:>12}\n", "online rounds", online_rounds)
+     << fmt::format("{:26s} {:>12}\n", "binary MTs", number_of_binary_mts)
+     << fmt::format("{:26s} {:>12}\n", "integer MTs", number_of_integer_mts)
+     << fmt::format("{:26s} {:>12}\n", "SPs", number_of_sps)
+     << fmt::format("{:26s} {:>12}\n", "SBs", number_of_sbs)
+     << fmt::format("{:26s} {:>12}\n", "OTs sent", number_of_ots_sent)
+     << fmt::format("{:26s} {:>12}\n", "OTs received", number_of_ots_received)
+     << fmt::format("{:26s} {:>12.3f} MiB\n", "offline sent",
+                    static_cast<double>(offline_bytes_sent) / 1024 / 1024)
+     << fmt::format("{:26s} {:>12.3f} MiB\n", "online sent",
+                    static_cast<double>(online_bytes_sent) / 1024 / 1024)
+     << "---------------------------------------------------------------------------\n";
+  return ss.str();
+}
+
+boost::json::object CircuitCost::ToJson() const {
+  boost::json::object gates_per_protocol;
+  for (std::size_t i = 0; i < number_of_gates_per_protocol.size(); ++i) {
+    gates_per_protocol[to_string(static_cast<MpcProtocol>(i))] = number_of_gates_per_protocol[i];
+  }
+  return {{"number_of_gates", number_of_gates},
+          {"number_of_gates_per_protocol", gates_per_protocol},
+          {"number_of_and_operations", number_of_and_operations},
+          {"number_of_multiplications", number_of_multiplications},
+          {"multiplicative_depth", multiplicative_depth},
+          {"online_rounds", online_rounds},
+          {"number_of_binary_mts", number_of_binary_mts},
+          {"number_of_integer_mts", number_of_integer_mts},
+          {"number_of_sps", number_of_sps},
+          {"number_of_sbs", number_of_sbs},
+          {"number_of_ots_sent", number_of_ots_sent},
+          {"number_of_ots_received", number_of_ots_received},
+          {"offline_bytes_sent", offline_bytes_sent},
+          {"online_bytes_sent", online_bytes_sent}};
+}
+
+}  // namespace encrypto::motion
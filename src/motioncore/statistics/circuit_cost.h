@@ -0,0 +1,77 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include <boost/json.hpp>
+
+#include "utility/typedefs.h"
+
+namespace encrypto::motion {
+
+class Backend;
+
+/// \brief Estimated cost of the circuit that is registered in a backend from the point of view of
+/// this party. It is computed from the parameters of the gates and the amount of requested
+/// preprocessing without any communication, see EstimateCircuitCost.
+struct CircuitCost {
+  std::size_t number_of_gates = 0;
+  // indexed by MpcProtocol of the first output wire of the gate
+  std::array<std::size_t, static_cast<std::size_t>(MpcProtocol::kInvalid)>
+      number_of_gates_per_protocol{};
+
+  std::size_t number_of_and_operations = 0;
+  std::size_t number_of_multiplications = 0;
+  // layers of nonlinear operations and communication rounds on the longest path of the circuit
+  std::size_t multiplicative_depth = 0;
+  std::size_t online_rounds = 0;
+
+  // preprocessing requested by the gates
+  std::size_t number_of_binary_mts = 0;
+  std::size_t number_of_integer_mts = 0;
+  std::size_t number_of_sps = 0;
+  std::size_t number_of_sbs = 0;
+  // OTs with all other parties, including the ones used for the MTs, SPs and SBs
+  std::size_t number_of_ots_sent = 0;
+  std::size_t number_of_ots_received = 0;
+
+  // bytes this party sends to all other parties
+  std::size_t offline_bytes_sent = 0;
+  std::size_t online_bytes_sent = 0;
+
+  std::string PrintHumanReadable() const;
+
+  boost::json::object ToJson() const;
+};
+
+/// \brief Estimates the cost of the gates registered in backend. Must be called after the circuit
+/// was built and before it is evaluated, since the providers register their own OTs only in the
+/// preprocessing. The OT extension is modelled as in MtProviderFromOts, SpProviderFromOts and
+/// SbProviderFromSps, the setup of the base OTs and the Kk13 OTs are not included.
+CircuitCost EstimateCircuitCost(Backend& backend);
+
+}  // namespace encrypto::motion
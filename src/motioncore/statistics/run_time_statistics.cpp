@@ -22,6 +22,7 @@
 
 #include "run_time_statistics.h"
 #include <fmt/format.h>
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 #include <string>
@@ -49,7 +50,10 @@ std::string RunTimeStatistics::PrintHumanReadable() const {
   auto width = static_cast<std::size_t>(std::ceil(std::log10(max))) + 4;
 
   std::stringstream ss;
-  ss << fmt::format("MT Presetup         {:{}.3f} ms\n",
+  ss << fmt::format("Connection Setup    {:{}.3f} ms\n",
+                    At(milliseconds, StatisticsId::kConnectionSetup), width)
+     << fmt::format("-------------------------\n")
+     << fmt::format("MT Presetup         {:{}.3f} ms\n",
                     At(milliseconds, StatisticsId::kMtPresetup), width)
      << fmt::format("MT Setup            {:{}.3f} ms\n", At(milliseconds, StatisticsId::kMtSetup),
                     width)
@@ -77,6 +81,12 @@ std::string RunTimeStatistics::PrintHumanReadable() const {
      << fmt::format("-------------------------\n")
      << fmt::format("Circuit Evaluation  {:{}.3f} ms\n", At(milliseconds, StatisticsId::kEvaluate),
                     width);
+  if (total_wire_memory > 0) {
+    ss << fmt::format("-------------------------\n")
+       << fmt::format("Wire Memory Peak    {:.3f} KiB of {:.3f} KiB\n",
+                      static_cast<double>(peak_wire_memory) / 1024,
+                      static_cast<double>(total_wire_memory) / 1024);
+  }
   return ss.str();
 }
 
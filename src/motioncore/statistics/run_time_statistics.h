@@ -48,6 +48,7 @@ struct RunTimeStatistics {
     kGatesOnline,
     kEvaluate,
     kBaseOts,
+    kConnectionSetup,
     kMax  // maximal value of this Enum, use as size
   };
 
@@ -65,11 +66,21 @@ struct RunTimeStatistics {
     // data.at(static_cast<std::size_t>(Id)).second = ClockType::now();
   }
 
+  template <StatisticsId Id>
+  void Record(const TimePointPair& time_point_pair) {
+    data[static_cast<std::size_t>(Id)] = time_point_pair;
+  }
+
   const TimePointPair& Get(StatisticsId id) const;
 
   std::string PrintHumanReadable() const;
 
   std::array<TimePointPair, static_cast<std::size_t>(StatisticsId::kMax) + 1> data;
+
+  // maximal number of bytes held by the wires at the same time and the number of bytes held by
+  // all wires, only recorded if wire reclamation is enabled
+  std::size_t peak_wire_memory = 0;
+  std::size_t total_wire_memory = 0;
 };
 
 }  // namespace encrypto::motion
@@ -0,0 +1,106 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+
+namespace encrypto::motion {
+
+/// \brief Memory resource for the gates, wires and shares of one circuit.
+///
+/// Objects are served from pools that are segregated by size, so memory of objects that are
+/// destroyed during the construction of the circuit (e.g., temporary shares) is reused for objects
+/// of the same size. The pools take their memory in large chunks from a monotonic buffer, which is
+/// released at once when the arena is destroyed.
+/// Allocation and deallocation are thread-safe, since the last reference to an object may be
+/// dropped by any thread.
+class Arena {
+ public:
+  explicit Arena(std::size_t initial_chunk_size = kDefaultInitialChunkSize)
+      : monotonic_resource_(initial_chunk_size), pool_resource_(&monotonic_resource_) {}
+
+  Arena(const Arena&) = delete;
+
+  Arena& operator=(const Arena&) = delete;
+
+  void* Allocate(std::size_t number_of_bytes, std::size_t alignment) {
+    std::scoped_lock lock(mutex_);
+    return pool_resource_.allocate(number_of_bytes, alignment);
+  }
+
+  void Deallocate(void* pointer, std::size_t number_of_bytes, std::size_t alignment) {
+    std::scoped_lock lock(mutex_);
+    pool_resource_.deallocate(pointer, number_of_bytes, alignment);
+  }
+
+  static constexpr std::size_t kDefaultInitialChunkSize = 1 << 20;
+
+ private:
+  std::mutex mutex_;
+  std::pmr::monotonic_buffer_resource monotonic_resource_;
+  std::pmr::unsynchronized_pool_resource pool_resource_;
+};
+
+/// \brief Allocator for std::allocate_shared that allocates from an Arena.
+/// Each control block holds a copy of the allocator and thereby keeps the arena alive, so objects
+/// may outlive the Register that created them.
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit ArenaAllocator(std::shared_ptr<Arena> arena) noexcept : arena_(std::move(arena)) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(other.arena_) {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* pointer, std::size_t n) noexcept {
+    arena_->Deallocate(pointer, n * sizeof(T), alignof(T));
+  }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const noexcept {
+    return arena_ == other.arena_;
+  }
+
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+    return arena_ != other.arena_;
+  }
+
+ private:
+  template <typename U>
+  friend class ArenaAllocator;
+
+  std::shared_ptr<Arena> arena_;
+};
+
+}  // namespace encrypto::motion
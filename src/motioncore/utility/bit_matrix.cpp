@@ -515,11 +515,6 @@ void BitMatrix::SenderTranspose128AndEncrypt(
     const std::array<const std::byte*, 128>& matrix, std::vector<BitVector<>>& y0,
     std::vector<BitVector<>>& y1, const BitVector<> choices, primitives::Prg& prg_fixed_key,
     const std::size_t number_of_colums, const std::vector<std::size_t>& bitlengths) {
-  constexpr std::size_t kKappa{128}, kNumberOfRows{128};
-  auto inp = [&matrix](auto r, auto c) {
-    return reinterpret_cast<const std::uint8_t* __restrict__>(
-        __builtin_assume_aligned(matrix.at(r), 16))[c / 8];
-  };
   assert(y0.size() == y1.size());
 
   const std::size_t original_size{y0.size()}, difference{number_of_colums - original_size};
@@ -527,6 +522,23 @@ void BitMatrix::SenderTranspose128AndEncrypt(
     y0.resize(number_of_colums);
     y1.resize(number_of_colums);
   }
+  SenderTranspose128AndEncrypt(matrix, std::span(y0), std::span(y1), choices, prg_fixed_key,
+                               number_of_colums, std::span(bitlengths).first(original_size));
+}
+
+void BitMatrix::SenderTranspose128AndEncrypt(const std::array<const std::byte*, 128>& matrix,
+                                             std::span<BitVector<>> y0, std::span<BitVector<>> y1,
+                                             const BitVector<>& choices,
+                                             primitives::Prg& prg_fixed_key,
+                                             const std::size_t number_of_colums,
+                                             std::span<const std::size_t> bitlengths) {
+  constexpr std::size_t kKappa{128}, kNumberOfRows{128};
+  auto inp = [&matrix](auto r, auto c) {
+    return reinterpret_cast<const std::uint8_t* __restrict__>(
+        __builtin_assume_aligned(matrix.at(r), 16))[c / 8];
+  };
+  assert(y0.size() == number_of_colums && y1.size() == number_of_colums);
+  const std::size_t original_size{bitlengths.size()};
 
   for (auto& block_vector : y0)
     block_vector = BitVector(std::vector<std::byte>(kKappa / 8), kKappa);
@@ -589,16 +601,26 @@ void BitMatrix::ReceiverTranspose128AndEncrypt(const std::array<const std::byte*
                                                primitives::Prg& prg_fixed_key,
                                                const std::size_t number_of_colums,
                                                const std::vector<std::size_t>& bitlengths) {
+  const std::size_t original_size{output.size()}, difference{number_of_colums - original_size};
+  if (difference) {
+    output.resize(number_of_colums);
+  }
+  ReceiverTranspose128AndEncrypt(matrix, std::span(output), prg_fixed_key, number_of_colums,
+                                 std::span(bitlengths).first(original_size));
+}
+
+void BitMatrix::ReceiverTranspose128AndEncrypt(const std::array<const std::byte*, 128>& matrix,
+                                               std::span<BitVector<>> output,
+                                               primitives::Prg& prg_fixed_key,
+                                               const std::size_t number_of_colums,
+                                               std::span<const std::size_t> bitlengths) {
   constexpr std::size_t kKappa{128}, kNumberOfRows{128};
   auto inp = [&matrix](auto r, auto c) {
     return reinterpret_cast<const std::uint8_t* __restrict__>(
         __builtin_assume_aligned(matrix.at(r), 16))[c / 8];
   };
-
-  const std::size_t original_size{output.size()}, difference{number_of_colums - original_size};
-  if (difference) {
-    output.resize(number_of_colums);
-  }
+  assert(output.size() == number_of_colums);
+  const std::size_t original_size{bitlengths.size()};
 
   for (auto& block_vector : output)
     block_vector = BitVector(std::vector<std::byte>(kKappa / 8), kKappa);
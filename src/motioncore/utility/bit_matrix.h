@@ -30,6 +30,7 @@
 #include <stdlib.h>
 #include <cassert>
 #include <memory>
+#include <span>
 
 namespace encrypto::motion::primitives {
 
@@ -197,6 +198,16 @@ class BitMatrix {
                                            const std::size_t number_of_columns,
                                            const std::vector<std::size_t>& bitlengths);
 
+  /// \brief Same as above, but writes the columns to y0 and y1, which must hold number_of_columns
+  /// elements, and only computes the outputs of the first bitlengths.size() of them. Allows
+  /// transposing the columns of an OT extension in chunks.
+  static void SenderTranspose128AndEncrypt(const std::array<const std::byte*, 128>& matrix,
+                                           std::span<BitVector<>> y0, std::span<BitVector<>> y1,
+                                           const BitVector<>& choices,
+                                           primitives::Prg& prg_fixed_key,
+                                           const std::size_t number_of_columns,
+                                           std::span<const std::size_t> bitlengths);
+
   /// \brief Transposes a matrix of 128 rows and arbitrary column size and encrypts it for the
   /// recipient role.
   /// \param matrix
@@ -213,6 +224,14 @@ class BitMatrix {
                                              const std::size_t number_of_columns,
                                              const std::vector<std::size_t>& bitlengths);
 
+  /// \brief Same as above, but writes the columns to output, which must hold number_of_columns
+  /// elements, and only computes the outputs of the first bitlengths.size() of them.
+  static void ReceiverTranspose128AndEncrypt(const std::array<const std::byte*, 128>& matrix,
+                                             std::span<BitVector<>> output,
+                                             primitives::Prg& prg_fixed_key,
+                                             const std::size_t number_of_columns,
+                                             std::span<const std::size_t> bitlengths);
+
   /// \brief Transposes a matrix of 256 rows and arbitrary column size and encrypts it for the
   /// sender role.
   /// \param matrix
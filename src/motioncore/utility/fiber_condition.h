@@ -55,6 +55,14 @@ class FiberCondition {
     condition_variable_.wait(lock, condition_function_);
   }
 
+  /// \brief Blocks until fiber is notified and \p predicate returns true. Allows waiting for
+  ///        different thresholds of the state guarded by this condition.
+  template <typename Predicate>
+  void Wait(Predicate predicate) const {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    condition_variable_.wait(lock, predicate);
+  }
+
   /// \brief Blocks until fiber is notified and condition_function_ returns true
   ///        or \p duration time has passed.
   template <typename Tick, typename Period>
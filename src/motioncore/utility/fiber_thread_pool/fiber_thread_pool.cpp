@@ -32,6 +32,7 @@
 #include <cassert>
 #include <iostream>
 #include <thread>
+#include <utility>
 
 #include "pooled_work_stealing.hpp"
 #include "singleton_pooled_fixedsize_stack.hpp"
@@ -48,7 +49,8 @@ FiberThreadPool::FiberThreadPool(std::size_t number_of_workers, std::size_t numb
       running_(false),
       suspend_scheduler_(suspend_scheduler),
       task_queue_(std::make_unique<boost::fibers::buffered_channel<task_t>>(64)),
-      worker_barrier_(std::make_unique<boost::fibers::barrier>(number_of_workers_)) {
+      worker_barrier_(std::make_unique<boost::fibers::barrier>(number_of_workers_)),
+      number_of_pending_tasks_(0) {
     if (number_of_workers_ == 1) {
         throw std::invalid_argument("FiberThreadPool needs at least two worker threads");
     }
@@ -145,9 +147,40 @@ void FiberThreadPool::join() {
     running_ = false;
 }
 
-void FiberThreadPool::post(std::function<void()> fctn) {
+void FiberThreadPool::post(std::function<void()> fctn, std::size_t priority) {
     assert(running_);
-    task_queue_->push(fctn);
+    {
+        std::scoped_lock lock(pending_tasks_mutex_);
+        ++number_of_pending_tasks_;
+    }
+    task_queue_->push([this, priority, fctn = std::move(fctn)] {
+        if (priority != 0) {
+            boost::this_fiber::properties<fiber_priority_props>().set_priority(priority);
+        }
+        std::exception_ptr exception;
+        try {
+            fctn();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        {
+            std::scoped_lock lock(pending_tasks_mutex_);
+            if (exception && !task_exception_) {
+                task_exception_ = exception;
+            }
+            --number_of_pending_tasks_;
+        }
+        pending_tasks_cv_.notify_all();
+    });
+}
+
+void FiberThreadPool::wait() {
+    std::unique_lock lock(pending_tasks_mutex_);
+    pending_tasks_cv_.wait(lock, [this] { return number_of_pending_tasks_ == 0; });
+    if (task_exception_) {
+        // reset the exception s.t. the pool can be used for the next batch
+        std::rethrow_exception(std::exchange(task_exception_, nullptr));
+    }
 }
 
 }  // namespace encrypto::motion
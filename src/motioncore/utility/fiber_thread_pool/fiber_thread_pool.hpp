@@ -21,8 +21,11 @@
 #ifndef FIBER_THREAD_POOL_HPP
 #define FIBER_THREAD_POOL_HPP
 
+#include <condition_variable>
+#include <exception>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -58,7 +61,20 @@ public:
 
     // Post a new task to the pool's queue.
     // This may block if the task queue is currently full
-    void post(task_t task);
+    // - priority
+    //   ready fibers with a higher priority are resumed first, e.g., gates
+    //   on the critical path of the circuit
+    void post(task_t task, std::size_t priority = 0);
+
+    // Block until all tasks posted so far have been completed.  In contrast
+    // to join(), the pool stays usable, so it can be reused for further
+    // batches of tasks without respawning the worker threads.
+    // If a task threw an exception, the first one is rethrown after all
+    // tasks have been completed.
+    // Note: Must not be called from a fiber running in this pool.
+    void wait();
+
+    std::size_t get_number_of_workers() const { return number_of_workers_; }
 
     // Close the pool.  No new tasks can be posted to the pool.
     // Note: Be sure that all previously posted tasks has been completed before
@@ -79,6 +95,11 @@ private:
     std::unique_ptr<boost::fibers::barrier> worker_barrier_;
     std::vector<std::thread> worker_threads_;
     std::shared_ptr<pool_ctx> pool_ctx_;
+
+    std::size_t number_of_pending_tasks_;
+    std::mutex pending_tasks_mutex_;
+    std::condition_variable pending_tasks_cv_;
+    std::exception_ptr task_exception_;
 };
 
 }  // namespace encrypto::motion
@@ -8,6 +8,7 @@
 
 #include "pooled_work_stealing.hpp"
 
+#include <limits>
 #include <random>
 
 #include <boost/assert.hpp>
@@ -55,11 +56,63 @@ pooled_work_stealing::~pooled_work_stealing() {
     pool_ctx_->barrier_.wait();
 }
 
-void pooled_work_stealing::awakened(boost::fibers::context* ctx) noexcept {
+void context_priority_queue::push(boost::fibers::context* ctx, std::size_t priority) noexcept {
+    boost::fibers::detail::spinlock_lock lk{splk_};
+    if (ctx->is_context(boost::fibers::type::pinned_context)) {
+        pinned_.push({priority, sequence_number_++, ctx});
+    }
+    else {
+        stealable_.push({priority, sequence_number_++, ctx});
+    }
+}
+
+boost::fibers::context* context_priority_queue::pop() noexcept {
+    boost::fibers::detail::spinlock_lock lk{splk_};
+    queue_type* queue = nullptr;
+    if (pinned_.empty()) {
+        queue = &stealable_;
+    }
+    else if (stealable_.empty()) {
+        queue = &pinned_;
+    }
+    else {
+        queue = lower_priority{}(pinned_.top(), stealable_.top()) ? &stealable_ : &pinned_;
+    }
+    if (queue->empty()) {
+        return nullptr;
+    }
+    boost::fibers::context* ctx = queue->top().ctx;
+    queue->pop();
+    return ctx;
+}
+
+boost::fibers::context* context_priority_queue::steal() noexcept {
+    boost::fibers::detail::spinlock_lock lk{splk_};
+    if (stealable_.empty()) {
+        return nullptr;
+    }
+    boost::fibers::context* ctx = stealable_.top().ctx;
+    stealable_.pop();
+    return ctx;
+}
+
+bool context_priority_queue::empty() const noexcept {
+    boost::fibers::detail::spinlock_lock lk{splk_};
+    return stealable_.empty() && pinned_.empty();
+}
+
+void pooled_work_stealing::awakened(boost::fibers::context* ctx,
+                                    fiber_priority_props& props) noexcept {
+    std::size_t priority = props.get_priority();
     if (!ctx->is_context(boost::fibers::type::pinned_context)) {
         ctx->detach();
     }
-    rqueue_.push(ctx);
+    else if (ctx->is_context(boost::fibers::type::dispatcher_context)) {
+        // the dispatcher moves fibers that were woken up by other threads into the ready queue,
+        // so run it first to let those compete by their priority
+        priority = std::numeric_limits<std::size_t>::max();
+    }
+    rqueue_.push(ctx, priority);
 }
 
 boost::fibers::context* pooled_work_stealing::pick_next() noexcept {
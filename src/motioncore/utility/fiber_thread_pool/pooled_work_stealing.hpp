@@ -15,6 +15,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <mutex>
+#include <queue>
 #include <vector>
 
 #include <boost/config.hpp>
@@ -23,8 +24,8 @@
 #include <boost/fiber/algo/algorithm.hpp>
 #include <boost/fiber/context.hpp>
 #include <boost/fiber/detail/config.hpp>
-#include <boost/fiber/detail/context_spinlock_queue.hpp>
-#include <boost/fiber/detail/context_spmc_queue.hpp>
+#include <boost/fiber/detail/spinlock.hpp>
+#include <boost/fiber/properties.hpp>
 #include <boost/fiber/scheduler.hpp>
 #include <boost/thread/barrier.hpp>
 
@@ -32,16 +33,71 @@
 
 struct pool_ctx;
 
-class pooled_work_stealing : public boost::fibers::algo::algorithm {
+// Scheduling priority of a fiber, fibers with a higher priority are resumed first.
+// The priority may only be changed by the fiber itself.
+class fiber_priority_props : public boost::fibers::fiber_properties {
+public:
+    explicit fiber_priority_props(boost::fibers::context* ctx) noexcept
+        : fiber_properties(ctx) {
+    }
+
+    std::size_t get_priority() const noexcept {
+        return priority_;
+    }
+
+    void set_priority(std::size_t priority) noexcept {
+        if (priority != priority_) {
+            priority_ = priority;
+            notify();
+        }
+    }
+
+private:
+    std::size_t priority_{0};
+};
+
+// Ready queue which orders the contexts by decreasing priority and contexts of the same priority
+// in FIFO order.  The pinned contexts, i.e., the main and the dispatcher context, are kept
+// separately since they must not be stolen.
+class context_priority_queue {
+public:
+    void push(boost::fibers::context*, std::size_t priority) noexcept;
+
+    boost::fibers::context* pop() noexcept;
+
+    boost::fibers::context* steal() noexcept;
+
+    bool empty() const noexcept;
+
+private:
+    struct entry {
+        std::size_t priority;
+        std::uint64_t sequence_number;
+        boost::fibers::context* ctx;
+    };
+
+    struct lower_priority {
+        bool operator()(entry const& a, entry const& b) const noexcept {
+            return a.priority < b.priority ||
+                   (a.priority == b.priority && a.sequence_number > b.sequence_number);
+        }
+    };
+
+    using queue_type = std::priority_queue<entry, std::vector<entry>, lower_priority>;
+
+    mutable boost::fibers::detail::spinlock splk_{};
+    queue_type stealable_{};
+    queue_type pinned_{};
+    std::uint64_t sequence_number_{0};
+};
+
+class pooled_work_stealing
+    : public boost::fibers::algo::algorithm_with_properties<fiber_priority_props> {
     std::shared_ptr<pool_ctx> pool_ctx_;
 
     std::uint32_t id_;
     std::uint32_t thread_count_;
-#ifdef BOOST_FIBERS_USE_SPMC_QUEUE
-    boost::fibers::detail::context_spmc_queue rqueue_ {};
-#else
-    boost::fibers::detail::context_spinlock_queue rqueue_ {};
-#endif
+    context_priority_queue rqueue_ {};
     std::mutex mtx_ {};
     std::condition_variable cnd_{};
     bool flag_{false};
@@ -60,7 +116,7 @@ public:
     pooled_work_stealing& operator=(pooled_work_stealing const&) = delete;
     pooled_work_stealing& operator=(pooled_work_stealing&&) = delete;
 
-    virtual void awakened(boost::fibers::context*) noexcept;
+    virtual void awakened(boost::fibers::context*, fiber_priority_props&) noexcept;
 
     virtual boost::fibers::context* pick_next() noexcept;
 
@@ -35,6 +35,11 @@ FiberSetupWaitable::FiberSetupWaitable() {
 
 void FiberSetupWaitable::WaitSetup() const { setup_ready_condition_->Wait(); }
 
+void FiberSetupWaitable::WaitSetup(std::size_t end) const {
+  setup_ready_condition_->Wait(
+      [this, end]() { return setup_ready_.load() || number_of_ready_items_.load() >= end; });
+}
+
 void FiberSetupWaitable::SetSetupIsReady() {
   {
     std::scoped_lock lock(setup_ready_condition_->GetMutex());
@@ -43,6 +48,14 @@ void FiberSetupWaitable::SetSetupIsReady() {
   setup_ready_condition_->NotifyAll();
 }
 
+void FiberSetupWaitable::SetSetupIsReady(std::size_t end) {
+  {
+    std::scoped_lock lock(setup_ready_condition_->GetMutex());
+    number_of_ready_items_.store(end);
+  }
+  setup_ready_condition_->NotifyAll();
+}
+
 FiberOnlineWaitable::FiberOnlineWaitable() {
   online_ready_condition_ =
       std::make_unique<FiberCondition>([this]() { return online_ready_.load(); });
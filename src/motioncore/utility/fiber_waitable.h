@@ -25,6 +25,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <memory>
 
 namespace encrypto::motion {
@@ -37,14 +38,24 @@ class FiberSetupWaitable {
 
   void WaitSetup() const;
 
+  // blocks until the whole setup or at least the items [0, end) of it are ready
+  void WaitSetup(std::size_t end) const;
+
   void SetSetupIsReady();
 
+  // publishes the items [0, end) while the setup of the remaining ones is still running
+  void SetSetupIsReady(std::size_t end);
+
   bool IsSetupReady() { return setup_ready_; }
 
-  void ResetSetupIsReady() { setup_ready_.store(false); }
+  void ResetSetupIsReady() {
+    setup_ready_.store(false);
+    number_of_ready_items_.store(0);
+  }
 
  protected:
   std::atomic<bool> setup_ready_{false};
+  std::atomic<std::size_t> number_of_ready_items_{0};
   std::shared_ptr<FiberCondition> setup_ready_condition_;
 };
 
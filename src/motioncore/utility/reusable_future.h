@@ -31,6 +31,7 @@
 #include <boost/fiber/future.hpp>
 #include <condition_variable>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <type_traits>
 
@@ -122,6 +123,9 @@ class ReusableSharedState {
 template <typename R, typename MutexType, typename ConditionVariableType>
 class ReusablePromise;
 
+template <typename R, typename MutexType, typename ConditionVariableType>
+class ReusablePromiseArray;
+
 // std::future-like future whose value can be set and read repeatedly,
 // basically the consumer end of a channel with a capacity of one
 template <typename R, typename MutexType = std::mutex,
@@ -171,8 +175,9 @@ class ReusableFuture {
   // TODO: wait_for, wait_until
 
  private:
-  // allow ReusablePromise to use the following constructor
+  // allow ReusablePromise and ReusablePromiseArray to use the following constructor
   friend ReusablePromise<R, MutexType, ConditionVariableType>;
+  friend ReusablePromiseArray<R, MutexType, ConditionVariableType>;
 
   // create future with associated state
   ReusableFuture(std::shared_ptr<detail::ReusableSharedState<R, MutexType, ConditionVariableType>>
@@ -265,6 +270,53 @@ template <typename R>
 using ReusableFiberPromise =
     ReusablePromise<R, boost::fibers::mutex, boost::fibers::condition_variable>;
 
+// fixed number of ReusablePromises whose shared states are stored contiguously in one array,
+// the futures keep the whole array alive
+template <typename R, typename MutexType = std::mutex,
+          typename ConditionVariableType = std::condition_variable>
+class ReusablePromiseArray {
+ public:
+  using shared_state_type = detail::ReusableSharedState<R, MutexType, ConditionVariableType>;
+
+  explicit ReusablePromiseArray(std::size_t size)
+      // make_shared<T[]> cannot be used since it requires the shared state to be copyable
+      : shared_states_(new shared_state_type[size]), size_(size) {}
+
+  ReusablePromiseArray(const ReusablePromiseArray&) = delete;
+  ReusablePromiseArray(ReusablePromiseArray&&) noexcept = default;
+  ~ReusablePromiseArray() = default;
+  ReusablePromiseArray& operator=(const ReusablePromiseArray&) = delete;
+  ReusablePromiseArray& operator=(ReusablePromiseArray&&) noexcept = default;
+
+  std::size_t size() const noexcept { return size_; }
+
+  // set value of the shared state at index
+  void set_value(std::size_t index, R&& value) {
+    if (!shared_states_) {
+      throw std::future_error(std::future_errc::no_state);
+    }
+    shared_states_[index].set(std::move(value));
+  }
+
+  // returns future associated with the shared state at index, which must be retrieved only once
+  ReusableFuture<R, MutexType, ConditionVariableType> get_future(std::size_t index) {
+    if (!shared_states_) {
+      throw std::future_error(std::future_errc::no_state);
+    }
+    // aliasing constructor: shares ownership of the array, points to a single state
+    return ReusableFuture<R, MutexType, ConditionVariableType>(
+        std::shared_ptr<shared_state_type>(shared_states_, &shared_states_[index]));
+  }
+
+ private:
+  std::shared_ptr<shared_state_type[]> shared_states_;
+  std::size_t size_;
+};
+
+template <typename R>
+using ReusableFiberPromiseArray =
+    ReusablePromiseArray<R, boost::fibers::mutex, boost::fibers::condition_variable>;
+
 // make ReusablePromise swappable
 template <typename R, typename MutexType, typename ConditionVariableType>
 void swap(ReusablePromise<R, MutexType, ConditionVariableType>& lhs,
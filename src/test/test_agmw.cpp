@@ -897,4 +897,41 @@ TYPED_TEST(TypedSignedAgmwTest, SignedSubtraction_1K_Simd_2_parties) {
   for (auto& future : futures) future.get();
 }
 
+TEST(ArithmeticGmw, EstimateCost_Multiplication_100_Simd_2_3_parties) {
+  constexpr auto kArithmeticGmw = encrypto::motion::MpcProtocol::kArithmeticGmw;
+  constexpr std::size_t kNumberOfSimd{100};
+  constexpr std::size_t kBitSize{sizeof(std::uint32_t) * 8};
+  for (auto number_of_parties : {2u, 3u}) {
+    std::vector<PartyPointer> motion_parties(
+        std::move(MakeLocallyConnectedParties(number_of_parties, kPortOffset)));
+    for (auto& party : motion_parties) {
+      party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+    }
+#pragma omp parallel for num_threads(motion_parties.size() + 1)
+    for (auto party_id = 0u; party_id < motion_parties.size(); ++party_id) {
+      auto& party{motion_parties.at(party_id)};
+      const std::vector<std::uint32_t> input(::RandomVector<std::uint32_t>(kNumberOfSimd));
+      ShareWrapper share_input_0{party->In<kArithmeticGmw>(input, 0)};
+      ShareWrapper share_input_1{party->In<kArithmeticGmw>(input, 1)};
+      auto share_output = (share_input_0 * share_input_1).Out();
+
+      const auto cost{party->EstimateCost()};
+      EXPECT_EQ(cost.number_of_multiplications, kNumberOfSimd);
+      EXPECT_EQ(cost.number_of_integer_mts, kNumberOfSimd);
+      EXPECT_EQ(cost.multiplicative_depth, 1u);
+      // opening d and e, then the output
+      EXPECT_EQ(cost.online_rounds, 2u);
+      // the MTs are generated with both roles and one OT per bit with each other party
+      EXPECT_EQ(cost.number_of_ots_sent, (number_of_parties - 1) * kNumberOfSimd * kBitSize);
+      EXPECT_EQ(cost.number_of_ots_received, (number_of_parties - 1) * kNumberOfSimd * kBitSize);
+      // d, e and the output are broadcast
+      EXPECT_EQ(cost.online_bytes_sent,
+                3 * (number_of_parties - 1) * kNumberOfSimd * sizeof(std::uint32_t));
+
+      party->Run();
+      party->Finish();
+    }
+  }
+}
+
 }  // namespace
\ No newline at end of file
@@ -22,12 +22,20 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <algorithm>
+#include <array>
+#include <thread>
+
 #include <gtest/gtest.h>
+#include "base/backend.h"
 #include "base/party.h"
+#include "multiplication_triple/mt_provider.h"
+#include "oblivious_transfer/ot_provider.h"
 #include "protocols/boolean_gmw/boolean_gmw_gate.h"
 #include "protocols/boolean_gmw/boolean_gmw_wire.h"
 #include "protocols/share_wrapper.h"
 #include "secure_type/secure_signed_integer.h"
+#include "statistics/run_time_statistics.h"
 #include "test_constants.h"
 #include "test_helpers.h"
 
@@ -707,6 +715,435 @@ TEST(BooleanGmw, And_64_bit_10_Simd_2_3_parties) {
   }
 }
 
+TEST(BooleanGmw, LevelSynchronous_And_Xor_64_bit_10_Simd_2_3_parties) {
+  for (auto i = 0ull; i < kTestIterations; ++i) {
+    constexpr auto kBooleanGmw = encrypto::motion::MpcProtocol::kBooleanGmw;
+    std::srand(std::time(nullptr));
+    for (auto number_of_parties : {2u, 3u}) {
+      const std::size_t output_owner = std::rand() % number_of_parties;
+      std::vector<std::vector<encrypto::motion::BitVector<>>> global_input_10_64_bit(
+          number_of_parties);
+      for (auto& bv_v : global_input_10_64_bit) {
+        bv_v.resize(64);
+        for (auto& bv : bv_v) {
+          bv = encrypto::motion::BitVector<>::SecureRandom(10);
+        }
+      }
+      std::vector<encrypto::motion::BitVector<>> dummy_input_10_64_bit(
+          64, encrypto::motion::BitVector<>(10, false));
+
+      try {
+        std::vector<PartyPointer> motion_parties(
+            std::move(MakeLocallyConnectedParties(number_of_parties, kPortOffset)));
+        for (auto& party : motion_parties) {
+          party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+          party->GetConfiguration()->SetLevelSynchronousEvaluation(true);
+          // small chunks so that every level is split across several fibers
+          party->GetConfiguration()->SetLevelChunkSize(i % 2 == 0 ? 1 : 16);
+        }
+#pragma omp parallel for num_threads(motion_parties.size() + 1)
+        for (auto party_id = 0u; party_id < motion_parties.size(); ++party_id) {
+          std::vector<encrypto::motion::ShareWrapper> share_input;
+
+          for (auto j = 0ull; j < number_of_parties; ++j) {
+            if (j == motion_parties.at(party_id)->GetConfiguration()->GetMyId()) {
+              share_input.push_back(
+                  motion_parties.at(party_id)->In<kBooleanGmw>(global_input_10_64_bit.at(j), j));
+            } else {
+              share_input.push_back(
+                  motion_parties.at(party_id)->In<kBooleanGmw>(dummy_input_10_64_bit, j));
+            }
+          }
+
+          auto share_and = share_input.at(0) & share_input.at(1);
+
+          for (auto j = 2ull; j < number_of_parties; ++j) {
+            share_and = share_and & share_input.at(j);
+          }
+
+          auto share_xor = share_and ^ share_input.at(0);
+
+          auto share_output = share_xor.Out(output_owner);
+
+          motion_parties.at(party_id)->Run();
+
+          if (party_id == output_owner) {
+            for (auto j = 0ull; j < global_input_10_64_bit.size(); ++j) {
+              auto wire_single =
+                  std::dynamic_pointer_cast<encrypto::motion::proto::boolean_gmw::Wire>(
+                      share_output->GetWires().at(j));
+              assert(wire_single);
+
+              std::vector<encrypto::motion::BitVector<>> global_input_single;
+              for (auto k = 0ull; k < number_of_parties; ++k) {
+                global_input_single.push_back(global_input_10_64_bit.at(k).at(j));
+              }
+
+              EXPECT_EQ(wire_single->GetValues(),
+                        encrypto::motion::BitVector<>::AndBitVectors(global_input_single) ^
+                            global_input_10_64_bit.at(0).at(j));
+            }
+          }
+
+          motion_parties.at(party_id)->Finish();
+        }
+      } catch (std::exception& e) {
+        std::cerr << e.what() << std::endl;
+      }
+    }
+  }
+}
+
+TEST(BooleanGmw, PrioritizedScheduling_And_Xor_64_bit_10_Simd_2_3_parties) {
+  constexpr auto kBooleanGmw = encrypto::motion::MpcProtocol::kBooleanGmw;
+  constexpr std::size_t kNumberOfWires{64}, kNumberOfSimd{10};
+  for (auto number_of_parties : {2u, 3u}) {
+    std::vector<std::vector<encrypto::motion::BitVector<>>> global_input(number_of_parties);
+    for (auto& bv_v : global_input) {
+      bv_v.resize(kNumberOfWires);
+      for (auto& bv : bv_v) {
+        bv = encrypto::motion::BitVector<>::SecureRandom(kNumberOfSimd);
+      }
+    }
+
+    std::vector<PartyPointer> motion_parties(
+        std::move(MakeLocallyConnectedParties(number_of_parties, kPortOffset)));
+    for (auto& party : motion_parties) {
+      party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+      party->GetConfiguration()->SetPrioritizedScheduling(true);
+    }
+#pragma omp parallel for num_threads(motion_parties.size() + 1)
+    for (auto party_id = 0u; party_id < motion_parties.size(); ++party_id) {
+      auto& party{motion_parties.at(party_id)};
+      std::vector<encrypto::motion::ShareWrapper> share_input;
+      for (auto j = 0ull; j < number_of_parties; ++j) {
+        share_input.push_back(party->In<kBooleanGmw>(global_input.at(j), j));
+      }
+
+      // a long AND chain on the first inputs and a short XOR branch that joins at the end
+      auto share_chain = share_input.at(0);
+      for (auto j = 1ull; j < number_of_parties; ++j) {
+        share_chain = share_chain & share_input.at(j);
+      }
+      auto share_output = (share_chain ^ (share_input.at(0) ^ share_input.at(1))).Out();
+
+      party->Run();
+
+      const auto output{share_output.As<std::vector<encrypto::motion::BitVector<>>>()};
+      for (auto j = 0ull; j < kNumberOfWires; ++j) {
+        std::vector<encrypto::motion::BitVector<>> global_input_single;
+        for (auto k = 0ull; k < number_of_parties; ++k) {
+          global_input_single.push_back(global_input.at(k).at(j));
+        }
+        EXPECT_EQ(output.at(j), encrypto::motion::BitVector<>::AndBitVectors(global_input_single) ^
+                                    global_input.at(0).at(j) ^ global_input.at(1).at(j));
+      }
+
+      // the gates are ordered by their remaining depth, which is 0 for the output gate
+      const auto& gates{party->GetBackend()->GetRegister()->GetGatesByPriority()};
+      EXPECT_TRUE(std::is_sorted(gates.begin(), gates.end(), [](const auto& a, const auto& b) {
+        return a->GetPriority() > b->GetPriority();
+      }));
+      EXPECT_EQ(gates.back()->GetPriority(), 0u);
+      EXPECT_GE(gates.front()->GetPriority(), number_of_parties);
+      party->Finish();
+    }
+  }
+}
+
+TEST(BooleanGmw, SimdChunks_And_Xor_8_bit_1K_Simd_2_3_parties) {
+  constexpr auto kBooleanGmw = encrypto::motion::MpcProtocol::kBooleanGmw;
+  constexpr std::size_t kNumberOfWires{8}, kNumberOfSimd{1000};
+  // chunks of 100 and 300 SIMD values, which do and do not divide the number of SIMD values
+  for (auto simd_chunk_size : {800u, 2400u}) {
+    for (auto number_of_parties : {2u, 3u}) {
+      std::vector<std::vector<encrypto::motion::BitVector<>>> global_input(number_of_parties);
+      for (auto& bv_v : global_input) {
+        bv_v.resize(kNumberOfWires);
+        for (auto& bv : bv_v) {
+          bv = encrypto::motion::BitVector<>::SecureRandom(kNumberOfSimd);
+        }
+      }
+
+      std::vector<PartyPointer> motion_parties(
+          std::move(MakeLocallyConnectedParties(number_of_parties, kPortOffset)));
+      for (auto& party : motion_parties) {
+        party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+        party->GetConfiguration()->SetSimdChunkSize(simd_chunk_size);
+      }
+#pragma omp parallel for num_threads(motion_parties.size() + 1)
+      for (auto party_id = 0u; party_id < motion_parties.size(); ++party_id) {
+        auto& party{motion_parties.at(party_id)};
+        std::vector<encrypto::motion::ShareWrapper> share_input;
+        for (auto j = 0ull; j < number_of_parties; ++j) {
+          share_input.push_back(party->In<kBooleanGmw>(global_input.at(j), j));
+        }
+
+        auto share_chain = share_input.at(0);
+        for (auto j = 1ull; j < number_of_parties; ++j) {
+          share_chain = share_chain & share_input.at(j);
+        }
+        auto share_output = ((share_chain ^ share_input.at(1)) & share_input.at(0)).Out();
+
+        party->Run();
+
+        const auto output{share_output.As<std::vector<encrypto::motion::BitVector<>>>()};
+        for (auto j = 0ull; j < kNumberOfWires; ++j) {
+          std::vector<encrypto::motion::BitVector<>> global_input_single;
+          for (auto k = 0ull; k < number_of_parties; ++k) {
+            global_input_single.push_back(global_input.at(k).at(j));
+          }
+          EXPECT_EQ(output.at(j),
+                    (encrypto::motion::BitVector<>::AndBitVectors(global_input_single) ^
+                     global_input.at(1).at(j)) &
+                        global_input.at(0).at(j));
+        }
+        party->Finish();
+      }
+    }
+  }
+}
+
+TEST(BooleanGmw, SimdChunks_Overlap_Ot_Extension_With_Online_2_parties) {
+  constexpr auto kBooleanGmw = encrypto::motion::MpcProtocol::kBooleanGmw;
+  constexpr std::size_t kNumberOfWires{64}, kNumberOfSimd{8192}, kNumberOfParties{2};
+  // 64 chunks of 128 SIMD values
+  constexpr std::size_t kSimdChunkSize{8192};
+  std::vector<std::vector<encrypto::motion::BitVector<>>> global_input(kNumberOfParties);
+  for (auto& bv_v : global_input) {
+    bv_v.resize(kNumberOfWires);
+    for (auto& bv : bv_v) {
+      bv = encrypto::motion::BitVector<>::SecureRandom(kNumberOfSimd);
+    }
+  }
+
+  // whether the first chunk of MTs, which the AND gate opens first, was ready before the OT
+  // extension with the other party was finished
+  std::array<bool, kNumberOfParties> first_chunk_before_ot_extension{};
+  std::vector<PartyPointer> motion_parties(
+      std::move(MakeLocallyConnectedParties(kNumberOfParties, kPortOffset)));
+  for (auto& party : motion_parties) {
+    party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+    party->GetConfiguration()->SetOnlineAfterSetup(false);
+    party->GetConfiguration()->SetSimdChunkSize(kSimdChunkSize);
+  }
+#pragma omp parallel for num_threads(motion_parties.size() + 1)
+  for (auto party_id = 0u; party_id < motion_parties.size(); ++party_id) {
+    auto& party{motion_parties.at(party_id)};
+    encrypto::motion::ShareWrapper share_a{party->In<kBooleanGmw>(global_input.at(0), 0)};
+    encrypto::motion::ShareWrapper share_b{party->In<kBooleanGmw>(global_input.at(1), 1)};
+    auto share_output{(share_a & share_b).Out()};
+
+    auto& backend{*party->GetBackend()};
+    std::thread observer([&backend, &first_chunk_before_ot_extension, party_id] {
+      backend.GetMtProvider().WaitBinary(0, 1);
+      first_chunk_before_ot_extension[party_id] =
+          !backend.GetOtProvider(1 - party_id).IsSetupReady();
+    });
+    party->Run();
+    observer.join();
+
+    const auto output{share_output.As<std::vector<encrypto::motion::BitVector<>>>()};
+    for (auto j = 0ull; j < kNumberOfWires; ++j) {
+      EXPECT_EQ(output.at(j), global_input.at(0).at(j) & global_input.at(1).at(j));
+    }
+    party->Finish();
+  }
+  EXPECT_TRUE(first_chunk_before_ot_extension.at(0) || first_chunk_before_ot_extension.at(1));
+}
+
+TEST(BooleanGmw, Rerun_And_Xor_64_bit_10_Simd_With_New_Inputs_2_3_parties) {
+  constexpr auto kBooleanGmw = encrypto::motion::MpcProtocol::kBooleanGmw;
+  constexpr std::size_t kNumberOfWires{64}, kNumberOfSimd{10}, kNumberOfEvaluations{3};
+  for (auto number_of_parties : {2u, 3u}) {
+    // one input per evaluation and party
+    std::vector<std::vector<std::vector<encrypto::motion::BitVector<>>>> global_inputs(
+        kNumberOfEvaluations,
+        std::vector<std::vector<encrypto::motion::BitVector<>>>(number_of_parties));
+    for (auto& evaluation_inputs : global_inputs) {
+      for (auto& bv_v : evaluation_inputs) {
+        bv_v.resize(kNumberOfWires);
+        for (auto& bv : bv_v) {
+          bv = encrypto::motion::BitVector<>::SecureRandom(kNumberOfSimd);
+        }
+      }
+    }
+
+    std::vector<PartyPointer> motion_parties(
+        std::move(MakeLocallyConnectedParties(number_of_parties, kPortOffset)));
+    for (auto& party : motion_parties) {
+      party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+    }
+#pragma omp parallel for num_threads(motion_parties.size() + 1)
+    for (auto party_id = 0u; party_id < motion_parties.size(); ++party_id) {
+      auto& party{motion_parties.at(party_id)};
+      std::vector<encrypto::motion::ShareWrapper> share_input;
+      encrypto::motion::ReusableFiberPromise<std::vector<encrypto::motion::BitVector<>>>*
+          input_promise{nullptr};
+      for (auto j = 0ull; j < number_of_parties; ++j) {
+        auto [share, promise] = party->In<kBooleanGmw>(j, kNumberOfWires, kNumberOfSimd);
+        share_input.emplace_back(share);
+        if (promise) {
+          input_promise = promise;
+        }
+      }
+      assert(input_promise);
+
+      auto share_and = share_input.at(0) & share_input.at(1);
+      for (auto j = 2ull; j < number_of_parties; ++j) {
+        share_and = share_and & share_input.at(j);
+      }
+      auto share_output = (share_and ^ share_input.at(0)).Out();
+
+      // the same gates are evaluated with new inputs each time
+      for (auto evaluation = 0ull; evaluation < kNumberOfEvaluations; ++evaluation) {
+        if (evaluation > 0) {
+          party->Clear();
+        }
+        input_promise->set_value(global_inputs.at(evaluation).at(party_id));
+        party->Run();
+
+        const auto output{share_output.As<std::vector<encrypto::motion::BitVector<>>>()};
+        for (auto j = 0ull; j < kNumberOfWires; ++j) {
+          std::vector<encrypto::motion::BitVector<>> global_input_single;
+          for (auto k = 0ull; k < number_of_parties; ++k) {
+            global_input_single.push_back(global_inputs.at(evaluation).at(k).at(j));
+          }
+          EXPECT_EQ(output.at(j),
+                    encrypto::motion::BitVector<>::AndBitVectors(global_input_single) ^
+                        global_inputs.at(evaluation).at(0).at(j));
+        }
+      }
+      party->Finish();
+    }
+  }
+}
+
+TEST(BooleanGmw, WireReclamation_And_Xor_Chain_64_bit_10_Simd_2_3_parties) {
+  constexpr auto kBooleanGmw = encrypto::motion::MpcProtocol::kBooleanGmw;
+  constexpr std::size_t kNumberOfWires{64}, kNumberOfSimd{10}, kDepth{8}, kNumberOfEvaluations{2};
+  for (auto number_of_parties : {2u, 3u}) {
+    std::vector<std::vector<std::vector<encrypto::motion::BitVector<>>>> global_inputs(
+        kNumberOfEvaluations,
+        std::vector<std::vector<encrypto::motion::BitVector<>>>(number_of_parties));
+    for (auto& evaluation_inputs : global_inputs) {
+      for (auto& bv_v : evaluation_inputs) {
+        bv_v.resize(kNumberOfWires);
+        for (auto& bv : bv_v) {
+          bv = encrypto::motion::BitVector<>::SecureRandom(kNumberOfSimd);
+        }
+      }
+    }
+
+    std::vector<PartyPointer> motion_parties(
+        std::move(MakeLocallyConnectedParties(number_of_parties, kPortOffset)));
+    for (auto& party : motion_parties) {
+      party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+      party->GetConfiguration()->SetWireReclamation(true);
+    }
+#pragma omp parallel for num_threads(motion_parties.size() + 1)
+    for (auto party_id = 0u; party_id < motion_parties.size(); ++party_id) {
+      auto& party{motion_parties.at(party_id)};
+      std::vector<encrypto::motion::ShareWrapper> share_input;
+      encrypto::motion::ReusableFiberPromise<std::vector<encrypto::motion::BitVector<>>>*
+          input_promise{nullptr};
+      for (auto j = 0ull; j < number_of_parties; ++j) {
+        auto [share, promise] = party->In<kBooleanGmw>(j, kNumberOfWires, kNumberOfSimd);
+        share_input.emplace_back(share);
+        if (promise) {
+          input_promise = promise;
+        }
+      }
+      assert(input_promise);
+
+      // every intermediate result is only read by the next AND gate
+      auto share_chain = share_input.at(0);
+      for (auto d = 0ull; d < kDepth; ++d) {
+        share_chain = (share_chain & share_input.at((d + 1) % number_of_parties)) ^
+                      share_input.at(0);
+      }
+      auto share_output = share_chain.Out();
+
+      // the released values are computed again in the second evaluation
+      for (auto evaluation = 0ull; evaluation < kNumberOfEvaluations; ++evaluation) {
+        if (evaluation > 0) {
+          party->Clear();
+        }
+        input_promise->set_value(global_inputs.at(evaluation).at(party_id));
+        party->Run();
+
+        const auto& inputs{global_inputs.at(evaluation)};
+        const auto output{share_output.As<std::vector<encrypto::motion::BitVector<>>>()};
+        for (auto j = 0ull; j < kNumberOfWires; ++j) {
+          auto expected{inputs.at(0).at(j)};
+          for (auto d = 0ull; d < kDepth; ++d) {
+            expected = (expected & inputs.at((d + 1) % number_of_parties).at(j)) ^
+                       inputs.at(0).at(j);
+          }
+          EXPECT_EQ(output.at(j), expected);
+        }
+
+        const auto& statistics{party->GetBackend()->GetRunTimeStatistics().back()};
+        EXPECT_GT(statistics.total_wire_memory, 0u);
+        EXPECT_LT(statistics.peak_wire_memory, statistics.total_wire_memory);
+      }
+      party->Finish();
+    }
+  }
+}
+
+// reads a wire, but neither needs a setup nor an online phase
+class NoInteractionGate final : public encrypto::motion::OneGate {
+ public:
+  NoInteractionGate(const encrypto::motion::SharePointer& parent)
+      : OneGate(parent->GetBackend()) {
+    parent_ = parent->GetWires();
+  }
+
+  void EvaluateSetup() override {}
+
+  void EvaluateOnline() override {}
+
+  bool NeedsSetup() const override { return false; }
+
+  bool NeedsOnline() const override { return false; }
+};
+
+TEST(BooleanGmw, WireReclamation_Gates_Without_Interaction_2_parties) {
+  constexpr auto kBooleanGmw = encrypto::motion::MpcProtocol::kBooleanGmw;
+  constexpr std::size_t kNumberOfSimd = 1000;
+  const auto global_input{encrypto::motion::BitVector<>::SecureRandom(kNumberOfSimd)};
+
+  for (bool level_synchronous : {false, true}) {
+    std::vector<PartyPointer> motion_parties(
+        std::move(MakeLocallyConnectedParties(2, kPortOffset)));
+    for (auto& party : motion_parties) {
+      party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+      party->GetConfiguration()->SetOnlineAfterSetup(false);
+      party->GetConfiguration()->SetLevelSynchronousEvaluation(level_synchronous);
+      party->GetConfiguration()->SetWireReclamation(true);
+    }
+#pragma omp parallel for num_threads(motion_parties.size() + 1)
+    for (auto party_id = 0u; party_id < motion_parties.size(); ++party_id) {
+      auto& party{motion_parties.at(party_id)};
+      encrypto::motion::ShareWrapper share_input{party->In<kBooleanGmw>(
+          party_id == 0 ? global_input : encrypto::motion::BitVector<>(kNumberOfSimd), 0)};
+      // the input wire is released once both the output gate and this gate are done
+      party->GetBackend()->GetRegister()->EmplaceGate<NoInteractionGate>(*share_input);
+      auto share_output{share_input.Out()};
+
+      party->Run();
+
+      EXPECT_EQ(share_output.As<std::vector<encrypto::motion::BitVector<>>>().at(0), global_input);
+      auto wire{std::dynamic_pointer_cast<encrypto::motion::proto::boolean_gmw::Wire>(
+          (*share_input)->GetWires().at(0))};
+      assert(wire);
+      EXPECT_EQ(wire->GetPayloadSize(), 0u);
+      party->Finish();
+    }
+  }
+}
+
 TEST(BooleanGmw, Or_1_bit_1_1K_Simd_2_3_parties) {
   for (auto i = 0ull; i < kTestIterations; ++i) {
     constexpr auto kBooleanGmw = encrypto::motion::MpcProtocol::kBooleanGmw;
@@ -982,4 +1419,47 @@ TYPED_TEST(TypedSignedBgmwTest, SignedSubtraction_1K_Simd_2_parties) {
   for (auto& future : futures) future.get();
 }
 
-}
\ No newline at end of file
+TEST(BooleanGmw, EstimateCost_And_Chain_8_bit_100_Simd_2_3_parties) {
+  constexpr auto kBooleanGmw = encrypto::motion::MpcProtocol::kBooleanGmw;
+  constexpr std::size_t kNumberOfWires{8}, kNumberOfSimd{100};
+  for (auto number_of_parties : {2u, 3u}) {
+    std::vector<PartyPointer> motion_parties(
+        std::move(MakeLocallyConnectedParties(number_of_parties, kPortOffset)));
+    for (auto& party : motion_parties) {
+      party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+    }
+#pragma omp parallel for num_threads(motion_parties.size() + 1)
+    for (auto party_id = 0u; party_id < motion_parties.size(); ++party_id) {
+      auto& party{motion_parties.at(party_id)};
+      std::vector<encrypto::motion::BitVector<>> input(
+          kNumberOfWires, encrypto::motion::BitVector<>::SecureRandom(kNumberOfSimd));
+      std::vector<encrypto::motion::ShareWrapper> share_input;
+      for (auto j = 0ull; j < number_of_parties; ++j) {
+        share_input.push_back(party->In<kBooleanGmw>(input, j));
+      }
+
+      // number_of_parties - 1 sequential ANDs, one XOR and another AND
+      auto share_chain = share_input.at(0);
+      for (auto j = 1ull; j < number_of_parties; ++j) {
+        share_chain = share_chain & share_input.at(j);
+      }
+      auto share_output = ((share_chain ^ share_input.at(1)) & share_input.at(0)).Out();
+
+      const auto cost{party->EstimateCost()};
+      constexpr std::size_t kAndsPerGate{kNumberOfWires * kNumberOfSimd};
+      EXPECT_EQ(cost.number_of_and_operations, number_of_parties * kAndsPerGate);
+      EXPECT_EQ(cost.number_of_binary_mts, number_of_parties * kAndsPerGate);
+      EXPECT_EQ(cost.multiplicative_depth, number_of_parties);
+      // one round per AND and one for the output
+      EXPECT_EQ(cost.online_rounds, number_of_parties + 1);
+      EXPECT_EQ(cost.number_of_ots_sent,
+                (number_of_parties - 1) * number_of_parties * kAndsPerGate);
+      EXPECT_GT(cost.online_bytes_sent, 0u);
+
+      party->Run();
+      party->Finish();
+    }
+  }
+}
+
+}
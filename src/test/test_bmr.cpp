@@ -605,4 +605,46 @@ INSTANTIATE_TEST_SUITE_P(BMRHeavyTestSuite, BmrHeavyTest,
                                std::get<1>(info.param), std::get<2>(info.param), mode);
                            return name;
                          });
+TEST(Bmr, EstimateCost_And_8_bit_100_Simd_2_3_parties) {
+  constexpr auto kBmr = encrypto::motion::MpcProtocol::kBmr;
+  constexpr std::size_t kNumberOfWires{8}, kNumberOfSimd{100};
+  constexpr std::size_t kNumberOfValues{kNumberOfWires * kNumberOfSimd};
+  for (auto number_of_parties : {2u, 3u}) {
+    std::vector<PartyPointer> motion_parties(
+        std::move(MakeLocallyConnectedParties(number_of_parties, kPortOffset)));
+    for (auto& party : motion_parties) {
+      party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+    }
+#pragma omp parallel for num_threads(motion_parties.size() + 1)
+    for (auto party_id = 0u; party_id < motion_parties.size(); ++party_id) {
+      auto& party{motion_parties.at(party_id)};
+      std::vector<BitVector<>> input(kNumberOfWires, BitVector<>::SecureRandom(kNumberOfSimd));
+      ShareWrapper share_input_0{party->In<kBmr>(input, 0)};
+      ShareWrapper share_input_1{party->In<kBmr>(input, 1)};
+      auto share_output = (share_input_0 & share_input_1).Out();
+
+      const auto cost{party->EstimateCost()};
+      EXPECT_EQ(cost.number_of_and_operations, kNumberOfValues);
+      EXPECT_EQ(cost.multiplicative_depth, 1u);
+      // two rounds per input, the AND is evaluated locally and the output takes one round
+      EXPECT_EQ(cost.online_rounds, 3u);
+      // everyone publishes the keys of both inputs and the permutation bits of the output, the
+      // owner additionally the public values of its input
+      const std::size_t number_of_own_inputs{party_id < 2 ? 1u : 0u};
+      EXPECT_EQ(cost.online_bytes_sent,
+                (number_of_parties - 1) *
+                    (2 * kNumberOfValues * sizeof(Block128) +
+                     (number_of_own_inputs + 1) * BitsToBytes(kNumberOfValues)));
+      EXPECT_GE(cost.offline_bytes_sent,
+                (number_of_parties - 1) *
+                    (BitsToBytes(2 * kNumberOfValues) + BitsToBytes(3 * kNumberOfValues) +
+                     (3 + 4 * number_of_parties) * kNumberOfValues * sizeof(Block128)));
+      EXPECT_GT(cost.number_of_ots_sent, 0u);
+
+      party->Run();
+      party->Finish();
+    }
+  }
+}
+
 }  // namespace
@@ -24,9 +24,17 @@
 #include <gtest/gtest.h>
 #include <boost/log/trivial.hpp>
 
+#include "base/backend.h"
+#include "base/party.h"
 #include "communication/communication_layer.h"
+#include "communication/dummy_transport.h"
 #include "communication/message.h"
 #include "communication/message_manager.h"
+#include "communication/shared_memory_transport.h"
+#include "communication/tcp_transport.h"
+#include "oblivious_transfer/base_ots/base_ot_provider.h"
+#include "protocols/share_wrapper.h"
+#include "test_constants.h"
 #include "utility/logger.h"
 
 namespace {
@@ -57,7 +65,7 @@ TEST(CommunicationLayer, Dummy) {
     communication_layer_alice->SendMessage(
         1, comm::BuildMessage(comm::MessageType::kOutputMessage, 0, message).Release());
     auto received_message = message_future_b1.get();
-    auto lhs = comm::GetMessage(received_message.data())->payload();
+    auto lhs = comm::GetMessage(received_message)->payload();
     for (std::size_t i = 0; i < message.size(); ++i) EXPECT_EQ(lhs->Get(i), message[i]);
   }
   // sync#1
@@ -73,10 +81,10 @@ TEST(CommunicationLayer, Dummy) {
     communication_layer_alice->BroadcastMessage(
         comm::BuildMessage(comm::MessageType::kOutputMessage, 1, message).Release());
     auto received_message_1 = message_future_b2.get();
-    auto lhs1 = comm::GetMessage(received_message_1.data())->payload();
+    auto lhs1 = comm::GetMessage(received_message_1)->payload();
     for (std::size_t i = 0; i < message.size(); ++i) EXPECT_EQ(lhs1->Get(i), message[i]);
     auto received_message_2 = message_future_c2.get();
-    auto lhs2 = comm::GetMessage(received_message_2.data())->payload();
+    auto lhs2 = comm::GetMessage(received_message_2)->payload();
     for (std::size_t i = 0; i < message.size(); ++i) EXPECT_EQ(lhs2->Get(i), message[i]);
   }
 
@@ -97,6 +105,530 @@ TEST(CommunicationLayer, Dummy) {
   std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
 }
 
+TEST(CommunicationLayer, DummyAggregated) {
+  constexpr std::size_t kNumberOfMessages = 100;
+  auto communication_layers = comm::MakeDummyCommunicationLayers(3);
+
+  std::vector<std::vector<std::uint8_t>> messages(kNumberOfMessages);
+  for (std::size_t i = 0; i < kNumberOfMessages; ++i) {
+    // payloads of varying size, including an empty one
+    messages.at(i).resize(i % 7, static_cast<std::uint8_t>(i));
+  }
+
+  std::vector<std::vector<comm::MessageManager::future_type>> futures_bob_charlie(2);
+  for (std::size_t i = 0; i < kNumberOfMessages; ++i) {
+    for (std::size_t party_id = 1; party_id < 3; ++party_id) {
+      futures_bob_charlie.at(party_id - 1).emplace_back(
+          communication_layers.at(party_id)->GetMessageManager().RegisterReceive(
+              0, comm::MessageType::kAggregatedMessage, i));
+    }
+  }
+
+  // the send threads wait for Start, so all payloads end up in the same aggregation buffer
+  for (std::size_t i = 0; i < kNumberOfMessages; ++i) {
+    communication_layers.at(0)->BroadcastAggregatedMessage(i, messages.at(i));
+  }
+
+  std::for_each(std::begin(communication_layers), std::end(communication_layers),
+                [](auto& cl) { cl->Start(); });
+
+  for (auto& futures : futures_bob_charlie) {
+    for (std::size_t i = 0; i < kNumberOfMessages; ++i) {
+      EXPECT_EQ(futures.at(i).get(), messages.at(i));
+    }
+  }
+
+  // exactly one aggregated message per party
+  for (auto& statistics : communication_layers.at(0)->GetTransportStatistics()) {
+    EXPECT_EQ(statistics.number_of_messages_sent, 1);
+    std::size_t number_of_aggregated_messages = 0;
+    for (const auto& [key, message_type_statistics] : statistics.message_type_statistics) {
+      if (key.second == static_cast<std::uint8_t>(comm::MessageType::kAggregatedMessage)) {
+        number_of_aggregated_messages += message_type_statistics.number_of_messages_sent;
+      }
+    }
+    EXPECT_EQ(number_of_aggregated_messages, 1);
+  }
+
+  std::vector<std::future<void>> futures;
+  for (auto& cl : communication_layers) {
+    futures.emplace_back(std::async(std::launch::async, [&cl] { cl->Shutdown(); }));
+  }
+  std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+}
+
+TEST(CommunicationLayer, MessageSlotRanges) {
+  constexpr std::size_t kFirstMessageId = 10;
+  constexpr std::size_t kNumberOfMessages = 50;
+  auto communication_layers = comm::MakeDummyCommunicationLayers(2);
+  auto& message_manager_bob = communication_layers.at(1)->GetMessageManager();
+
+  std::for_each(std::begin(communication_layers), std::end(communication_layers),
+                [](auto& cl) { cl->Start(); });
+
+  auto range_futures{message_manager_bob.RegisterReceiveRange(
+      0, comm::MessageType::kOutputMessage, kFirstMessageId, kNumberOfMessages)};
+  ASSERT_EQ(range_futures.size(), kNumberOfMessages);
+  // ids just below the range are still served by the maps
+  auto map_future{message_manager_bob.RegisterReceive(0, comm::MessageType::kOutputMessage,
+                                                      kFirstMessageId - 1)};
+  auto aggregated_futures{message_manager_bob.RegisterReceiveRange(
+      0, comm::MessageType::kAggregatedMessage, 0, kNumberOfMessages)};
+  EXPECT_THROW(auto _ = message_manager_bob.RegisterReceiveRange(
+                   0, comm::MessageType::kOutputMessage, kFirstMessageId + kNumberOfMessages - 1,
+                   2),
+               std::invalid_argument);
+  EXPECT_THROW(auto _ = message_manager_bob.RegisterReceiveRange(
+                   0, comm::MessageType::kOutputMessage, 0, kFirstMessageId + 1),
+               std::invalid_argument);
+
+  for (std::size_t i = kFirstMessageId - 1; i < kFirstMessageId + kNumberOfMessages; ++i) {
+    const std::vector<std::uint8_t> payload(4, static_cast<std::uint8_t>(i));
+    communication_layers.at(0)->SendMessage(
+        1, comm::BuildMessage(comm::MessageType::kOutputMessage, i, payload).Release());
+  }
+  for (std::size_t i = 0; i < kNumberOfMessages; ++i) {
+    // with two parties, broadcasting only reaches bob
+    communication_layers.at(0)->BroadcastAggregatedMessage(
+        i, std::vector<std::uint8_t>(i % 5, static_cast<std::uint8_t>(i)));
+  }
+
+  {
+    auto raw_message{map_future.get()};
+    EXPECT_EQ(comm::GetMessage(raw_message)->payload()->Get(0), kFirstMessageId - 1);
+  }
+  for (std::size_t i = 0; i < kNumberOfMessages; ++i) {
+    auto raw_message{range_futures.at(i).get()};
+    auto message{comm::GetMessage(raw_message)};
+    EXPECT_EQ(message->message_id(), kFirstMessageId + i);
+    EXPECT_EQ(message->payload()->Get(0), kFirstMessageId + i);
+    EXPECT_EQ(aggregated_futures.at(i).get(),
+              std::vector<std::uint8_t>(i % 5, static_cast<std::uint8_t>(i)));
+  }
+
+  std::vector<std::future<void>> futures;
+  for (auto& cl : communication_layers) {
+    futures.emplace_back(std::async(std::launch::async, [&cl] { cl->Shutdown(); }));
+  }
+  std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+}
+
+TEST(CommunicationLayer, MessageSlotRangesWhileReceiving) {
+  // the ranges span several pages of the slot index, s.t. its directory grows while the messages
+  // of the previous ranges are received
+  constexpr std::size_t kNumberOfRanges = 64;
+  constexpr std::size_t kNumberOfMessages = 700;
+  auto communication_layers = comm::MakeDummyCommunicationLayers(2);
+  auto& message_manager_bob = communication_layers.at(1)->GetMessageManager();
+
+  std::for_each(std::begin(communication_layers), std::end(communication_layers),
+                [](auto& cl) { cl->Start(); });
+
+  std::vector<std::vector<comm::MessageManager::future_type>> range_futures;
+  for (std::size_t range = 0; range < kNumberOfRanges; ++range) {
+    range_futures.emplace_back(message_manager_bob.RegisterReceiveRange(
+        0, comm::MessageType::kOutputMessage, range * kNumberOfMessages, kNumberOfMessages));
+    for (std::size_t i = range * kNumberOfMessages; i < (range + 1) * kNumberOfMessages; ++i) {
+      const std::vector<std::uint8_t> payload(1, static_cast<std::uint8_t>(i));
+      communication_layers.at(0)->SendMessage(
+          1, comm::BuildMessage(comm::MessageType::kOutputMessage, i, payload).Release());
+    }
+  }
+  for (std::size_t range = 0; range < kNumberOfRanges; ++range) {
+    for (std::size_t i = 0; i < kNumberOfMessages; ++i) {
+      auto raw_message{range_futures.at(range).at(i).get()};
+      EXPECT_EQ(comm::GetMessage(raw_message)->message_id(), range * kNumberOfMessages + i);
+    }
+  }
+
+  std::vector<std::future<void>> futures;
+  for (auto& cl : communication_layers) {
+    futures.emplace_back(std::async(std::launch::async, [&cl] { cl->Shutdown(); }));
+  }
+  std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+}
+
+TEST(CommunicationLayer, MessageTypeStatistics) {
+  auto communication_layers = comm::MakeDummyCommunicationLayers(2);
+  std::for_each(std::begin(communication_layers), std::end(communication_layers),
+                [](auto& cl) { cl->Start(); });
+  auto& communication_layer_alice = communication_layers.at(0);
+  auto& communication_layer_bob = communication_layers.at(1);
+
+  const std::vector<std::uint8_t> message = {0xde, 0xad, 0xbe, 0xef};
+  auto message_future_setup{communication_layer_bob->GetMessageManager().RegisterReceive(
+      0, comm::MessageType::kOutputMessage, 0)};
+  auto message_future_online{communication_layer_bob->GetMessageManager().RegisterReceive(
+      0, comm::MessageType::kOutputMessage, 1)};
+
+  // the traffic is attributed to the phase of the sender and the receiver, respectively
+  auto setup_message{comm::BuildMessage(comm::MessageType::kOutputMessage, 0, message).Release()};
+  const auto message_size{setup_message.size()};
+  communication_layer_alice->SendMessage(1, std::move(setup_message));
+  message_future_setup.get();
+  communication_layer_alice->SetCommunicationPhase(comm::CommunicationPhase::kOnline);
+  communication_layer_bob->SetCommunicationPhase(comm::CommunicationPhase::kOnline);
+  communication_layer_alice->SendMessage(
+      1, comm::BuildMessage(comm::MessageType::kOutputMessage, 1, message).Release());
+  message_future_online.get();
+
+  const auto key = [](comm::CommunicationPhase phase) {
+    return std::make_pair(phase, static_cast<std::uint8_t>(comm::MessageType::kOutputMessage));
+  };
+  const auto statistics_bob{communication_layer_bob->GetTransportStatistics().at(0)};
+  for (auto phase : {comm::CommunicationPhase::kSetup, comm::CommunicationPhase::kOnline}) {
+    ASSERT_TRUE(statistics_bob.message_type_statistics.contains(key(phase)));
+    const auto& message_type_statistics{statistics_bob.message_type_statistics.at(key(phase))};
+    EXPECT_EQ(message_type_statistics.number_of_messages_received, 1);
+    EXPECT_EQ(message_type_statistics.number_of_bytes_received, message_size);
+    EXPECT_EQ(message_type_statistics.number_of_messages_sent, 0);
+  }
+
+  std::vector<std::future<void>> futures;
+  for (auto& cl : communication_layers) {
+    futures.emplace_back(std::async(std::launch::async, [&cl] { cl->Shutdown(); }));
+  }
+  std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+
+  // the sent messages are counted by the send thread, which has finished after the shutdown
+  const auto statistics_alice{communication_layer_alice->GetTransportStatistics().at(0)};
+  for (auto phase : {comm::CommunicationPhase::kSetup, comm::CommunicationPhase::kOnline}) {
+    ASSERT_TRUE(statistics_alice.message_type_statistics.contains(key(phase)));
+    EXPECT_EQ(statistics_alice.message_type_statistics.at(key(phase)).number_of_bytes_sent,
+              message_size);
+  }
+}
+
+TEST(CommunicationLayer, FastMessages) {
+  auto communication_layers = comm::MakeLocalTcpCommunicationLayers(3, false);
+  std::for_each(std::begin(communication_layers), std::end(communication_layers),
+                [](auto& cl) { cl->Start(); });
+  auto& communication_layer_alice = communication_layers.at(0);
+
+  const std::vector<std::uint64_t> values = {0xdeadbeef, 0, 42};
+  const std::vector<std::uint8_t> message = {0xde, 0xad, 0xbe, 0xef};
+  std::vector<std::vector<comm::MessageManager::future_type>> futures_bob_charlie;
+  for (std::size_t party_id = 1; party_id < 3; ++party_id) {
+    auto& message_manager{communication_layers.at(party_id)->GetMessageManager()};
+    auto& futures{futures_bob_charlie.emplace_back()};
+    futures.emplace_back(message_manager.RegisterReceive(0, comm::MessageType::kOutputMessage, 0));
+    futures.emplace_back(message_manager.RegisterReceive(0, comm::MessageType::kOutputMessage, 1));
+    futures.emplace_back(
+        message_manager.RegisterReceive(0, comm::MessageType::kAstraOutputGate, 2));
+  }
+
+  // fast messages and flatbuffers are mixed on the same transports
+  communication_layer_alice->SendFastMessage(1, comm::MessageType::kOutputMessage, 0,
+                                             std::vector<std::uint64_t>(values));
+  communication_layer_alice->SendFastMessage(2, comm::MessageType::kOutputMessage, 0,
+                                             std::vector<std::uint64_t>(values));
+  communication_layer_alice->BroadcastMessage(
+      comm::BuildMessage(comm::MessageType::kOutputMessage, 1, message).Release());
+  communication_layer_alice->BroadcastFastMessage(comm::MessageType::kAstraOutputGate, 2,
+                                                  std::vector<std::uint8_t>());
+
+  for (auto& futures : futures_bob_charlie) {
+    const auto fast_message{futures.at(0).get()};
+    ASSERT_TRUE(comm::IsFastMessage(fast_message));
+    ASSERT_TRUE(comm::VerifyFastMessage(fast_message));
+    const auto header{comm::GetFastMessageHeader(fast_message)};
+    EXPECT_EQ(header.message_type, comm::MessageType::kOutputMessage);
+    EXPECT_EQ(header.message_id, 0);
+    const auto payload{comm::GetFastMessagePayload(fast_message)};
+    ASSERT_EQ(payload.size(), values.size() * sizeof(std::uint64_t));
+    EXPECT_TRUE(std::equal(payload.begin(), payload.end(),
+                           reinterpret_cast<const std::uint8_t*>(values.data())));
+
+    const auto flatbuffer_message{futures.at(1).get()};
+    EXPECT_FALSE(comm::IsFastMessage(flatbuffer_message));
+    const auto flatbuffer_payload{comm::GetMessage(flatbuffer_message)->payload()};
+    EXPECT_TRUE(std::equal(message.begin(), message.end(), flatbuffer_payload->data()));
+
+    const auto empty_message{futures.at(2).get()};
+    EXPECT_TRUE(comm::GetFastMessagePayload(empty_message).empty());
+  }
+
+  std::vector<std::future<void>> futures;
+  for (auto& cl : communication_layers) {
+    futures.emplace_back(std::async(std::launch::async, [&cl] { cl->Shutdown(); }));
+  }
+  std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+}
+
+TEST(CommunicationLayer, PrioritizedSending) {
+  const std::vector<std::uint8_t> bulk_payload(4 * comm::CommunicationLayer::kDefaultFragmentSize);
+  const std::vector<std::uint8_t> online_payload = {0xde, 0xad, 0xbe, 0xef};
+  for (bool prioritized_sending : {true, false}) {
+    auto [transport_01, transport_10] = comm::DummyTransport::MakeTransportPair();
+    std::vector<std::unique_ptr<comm::Transport>> transports(2);
+    transports.at(1) = std::move(transport_01);
+    comm::CommunicationLayer communication_layer(0, std::move(transports));
+    communication_layer.SetPrioritizedSending(prioritized_sending);
+
+    // both messages are waiting when the send thread starts
+    communication_layer.SendMessage(
+        1, comm::BuildMessage(comm::MessageType::kOtExtensionSender, 0, bulk_payload).Release());
+    communication_layer.SendMessage(
+        1, comm::BuildMessage(comm::MessageType::kOutputMessage, 0, online_payload).Release());
+    communication_layer.Start();
+
+    const auto first_message{transport_10->ReceiveMessage()};
+    ASSERT_TRUE(first_message.has_value());
+    const auto first_message_type{comm::GetMessage(*first_message)->message_type()};
+    if (prioritized_sending) {
+      // the online message overtakes the fragmented bulk message
+      EXPECT_EQ(first_message_type, comm::MessageType::kOutputMessage);
+    } else {
+      EXPECT_EQ(first_message_type, comm::MessageType::kOtExtensionSender);
+      EXPECT_GT(first_message->size(), bulk_payload.size());
+    }
+
+    const auto termination_message{
+        comm::BuildMessage(comm::MessageType::kTerminationMessage).Release()};
+    transport_10->SendMessage(std::span(termination_message.data(), termination_message.size()));
+    communication_layer.Shutdown();
+    // the termination message is sent last
+    std::optional<std::vector<std::uint8_t>> message;
+    while ((message = transport_10->ReceiveMessage()).has_value()) {
+      if (comm::GetMessage(*message)->message_type() ==
+          comm::MessageType::kTerminationMessage) {
+        break;
+      }
+    }
+    ASSERT_TRUE(message.has_value());
+    EXPECT_FALSE(transport_10->Available());
+    transport_10->Shutdown();
+  }
+}
+
+TEST(CommunicationLayer, FragmentedBulkMessages) {
+  constexpr std::size_t kFragmentSize = 1000;
+  auto communication_layers = comm::MakeDummyCommunicationLayers(2);
+  auto& communication_layer_alice = communication_layers.at(0);
+  auto& communication_layer_bob = communication_layers.at(1);
+  communication_layer_alice->SetPrioritizedSending(true, kFragmentSize);
+  std::for_each(std::begin(communication_layers), std::end(communication_layers),
+                [](auto& cl) { cl->Start(); });
+
+  std::vector<std::uint8_t> payload(10 * kFragmentSize + 1);
+  for (std::size_t i = 0; i < payload.size(); ++i) payload.at(i) = static_cast<std::uint8_t>(i);
+  auto& message_manager_bob{communication_layer_bob->GetMessageManager()};
+  auto flatbuffer_future{
+      message_manager_bob.RegisterReceive(0, comm::MessageType::kOtExtensionSender, 0)};
+  auto fast_message_future{
+      message_manager_bob.RegisterReceive(0, comm::MessageType::kKK13OtExtensionSender, 1)};
+
+  communication_layer_alice->SendMessage(
+      1, comm::BuildMessage(comm::MessageType::kOtExtensionSender, 0, payload).Release());
+  communication_layer_alice->SendFastMessage(1, comm::MessageType::kKK13OtExtensionSender, 1,
+                                             std::vector<std::uint8_t>(payload));
+
+  // the fragments are reassembled before the messages are handed to the message manager
+  const auto flatbuffer_message{flatbuffer_future.get()};
+  const auto flatbuffer_payload{comm::GetMessage(flatbuffer_message)->payload()};
+  ASSERT_EQ(flatbuffer_payload->size(), payload.size());
+  EXPECT_TRUE(std::equal(payload.begin(), payload.end(), flatbuffer_payload->data()));
+  const auto fast_message{fast_message_future.get()};
+  ASSERT_TRUE(comm::VerifyFastMessage(fast_message));
+  const auto fast_message_payload{comm::GetFastMessagePayload(fast_message)};
+  EXPECT_TRUE(std::equal(payload.begin(), payload.end(), fast_message_payload.begin(),
+                         fast_message_payload.end()));
+
+  std::vector<std::future<void>> futures;
+  for (auto& cl : communication_layers) {
+    futures.emplace_back(std::async(std::launch::async, [&cl] { cl->Shutdown(); }));
+  }
+  std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+
+  // each message is counted once, however many fragments it was split into
+  const auto key{std::make_pair(comm::CommunicationPhase::kSetup,
+                                static_cast<std::uint8_t>(comm::MessageType::kOtExtensionSender))};
+  const auto statistics_alice{communication_layer_alice->GetTransportStatistics().at(0)};
+  EXPECT_EQ(statistics_alice.message_type_statistics.at(key).number_of_messages_sent, 1);
+  const auto statistics_bob{communication_layer_bob->GetTransportStatistics().at(0)};
+  EXPECT_EQ(statistics_bob.message_type_statistics.at(key).number_of_messages_received, 1);
+  EXPECT_EQ(statistics_bob.message_type_statistics.at(key).number_of_bytes_received,
+            flatbuffer_message.size());
+}
+
+TEST(CommunicationLayer, Sessions) {
+  constexpr std::uint32_t kSessionId = 7;
+  constexpr std::size_t kFragmentSize = 1000;
+  auto communication_layers = comm::MakeDummyCommunicationLayers(2);
+  auto& communication_layer_alice = communication_layers.at(0);
+  auto& communication_layer_bob = communication_layers.at(1);
+  communication_layer_alice->SetPrioritizedSending(true, kFragmentSize);
+  std::for_each(std::begin(communication_layers), std::end(communication_layers),
+                [](auto& cl) { cl->Start(); });
+  EXPECT_THROW(communication_layer_alice->CreateSession(0), std::invalid_argument);
+
+  auto session_alice{communication_layer_alice->CreateSession(kSessionId)};
+  EXPECT_THROW(communication_layer_alice->CreateSession(kSessionId), std::invalid_argument);
+  EXPECT_EQ(session_alice->GetSessionId(), kSessionId);
+  session_alice->Start();
+
+  // the same message type and id are used in both sessions
+  const std::vector<std::uint8_t> root_payload = {0x01, 0x02};
+  std::vector<std::uint8_t> session_payload(3 * kFragmentSize);
+  for (std::size_t i = 0; i < session_payload.size(); ++i) {
+    session_payload.at(i) = static_cast<std::uint8_t>(i);
+  }
+  auto root_future{communication_layer_bob->GetMessageManager().RegisterReceive(
+      0, comm::MessageType::kOutputMessage, 0)};
+  communication_layer_alice->SendMessage(
+      1, comm::BuildMessage(comm::MessageType::kOutputMessage, 0, root_payload).Release());
+  session_alice->SendMessage(
+      1, comm::BuildMessage(comm::MessageType::kOutputMessage, 0, session_payload).Release());
+  // a fast message which is fragmented and an aggregated message
+  session_alice->SendFastMessage(1, comm::MessageType::kOtExtensionSender, 0,
+                                 std::vector<std::uint8_t>(session_payload));
+  session_alice->BroadcastAggregatedMessage(0, root_payload);
+
+  const auto root_message{root_future.get()};
+  const auto root_message_payload{comm::GetMessage(root_message)->payload()};
+  ASSERT_EQ(root_message_payload->size(), root_payload.size());
+  EXPECT_TRUE(std::equal(root_payload.begin(), root_payload.end(), root_message_payload->data()));
+
+  // the messages of the session are held back until Bob has created and started it
+  auto session_bob{communication_layer_bob->CreateSession(kSessionId)};
+  auto& message_manager_bob{session_bob->GetMessageManager()};
+  auto session_future{message_manager_bob.RegisterReceive(0, comm::MessageType::kOutputMessage, 0)};
+  auto fast_message_future{
+      message_manager_bob.RegisterReceive(0, comm::MessageType::kOtExtensionSender, 0)};
+  auto aggregated_future{
+      message_manager_bob.RegisterReceive(0, comm::MessageType::kAggregatedMessage, 0)};
+  session_bob->Start();
+
+  const auto session_message{session_future.get()};
+  const auto session_message_payload{comm::GetMessage(session_message)->payload()};
+  ASSERT_EQ(session_message_payload->size(), session_payload.size());
+  EXPECT_TRUE(std::equal(session_payload.begin(), session_payload.end(),
+                         session_message_payload->data()));
+  const auto fast_message{fast_message_future.get()};
+  ASSERT_TRUE(comm::VerifyFastMessage(fast_message));
+  const auto fast_message_payload{comm::GetFastMessagePayload(fast_message)};
+  EXPECT_TRUE(std::equal(session_payload.begin(), session_payload.end(),
+                         fast_message_payload.begin(), fast_message_payload.end()));
+  EXPECT_EQ(aggregated_future.get(), root_payload);
+
+  // the sessions synchronize independently of each other
+  {
+    auto future{std::async(std::launch::async, [&] { session_alice->Synchronize(); })};
+    session_bob->Synchronize();
+    future.get();
+  }
+  session_alice->Shutdown();
+  session_bob->Shutdown();
+
+  std::vector<std::future<void>> futures;
+  for (auto& cl : communication_layers) {
+    futures.emplace_back(std::async(std::launch::async, [&cl] { cl->Shutdown(); }));
+  }
+  std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+}
+
+TEST(CommunicationLayer, ConcurrentPartySessions) {
+  using encrypto::motion::BitVector;
+  using encrypto::motion::MpcProtocol;
+  using encrypto::motion::Party;
+  using encrypto::motion::ShareWrapper;
+  constexpr std::uint32_t kSessionId = 1;
+  constexpr std::size_t kNumberOfSimd = 100;
+  std::array<BitVector<>, 2> boolean_inputs;
+  std::array<std::vector<std::uint32_t>, 2> arithmetic_inputs;
+  for (std::uint32_t party_id = 0; party_id < 2; ++party_id) {
+    boolean_inputs.at(party_id) = BitVector<>(kNumberOfSimd);
+    arithmetic_inputs.at(party_id).resize(kNumberOfSimd);
+    for (std::uint32_t i = 0; i < kNumberOfSimd; ++i) {
+      boolean_inputs.at(party_id).Set((i + party_id) % 3 != 0, i);
+      arithmetic_inputs.at(party_id).at(i) = 1000 * party_id + i;
+    }
+  }
+  BitVector<> expected_and(kNumberOfSimd);
+  std::vector<std::uint32_t> expected_product(kNumberOfSimd);
+  for (std::size_t i = 0; i < kNumberOfSimd; ++i) {
+    expected_and.Set(boolean_inputs.at(0).Get(i) && boolean_inputs.at(1).Get(i), i);
+    expected_product.at(i) = arithmetic_inputs.at(0).at(i) * arithmetic_inputs.at(1).at(i);
+  }
+  const auto run_in_parallel = [](auto&& function) {
+    auto future{std::async(std::launch::async, [&] { function(1); })};
+    function(0);
+    future.get();
+  };
+
+  auto communication_layers = comm::MakeDummyCommunicationLayers(2);
+  std::array<std::unique_ptr<Party>, 2> root_parties, session_parties;
+  std::array<ShareWrapper, 2> root_outputs, session_and_outputs, session_product_outputs;
+  for (std::size_t party_id = 0; party_id < 2; ++party_id) {
+    root_parties.at(party_id) =
+        std::make_unique<Party>(std::move(communication_layers.at(party_id)));
+    root_parties.at(party_id)->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+  }
+  // session 0 computes the base OTs in its first evaluation
+  run_in_parallel([&](std::size_t my_id) {
+    auto& party{*root_parties.at(my_id)};
+    const ShareWrapper boolean_share_0{party.In<MpcProtocol::kBooleanGmw>(boolean_inputs.at(0), 0)};
+    const ShareWrapper boolean_share_1{party.In<MpcProtocol::kBooleanGmw>(boolean_inputs.at(1), 1)};
+    const auto and_share{boolean_share_0 & boolean_share_1};
+    root_outputs.at(my_id) = and_share.Out();
+    party.Run();
+  });
+  EXPECT_EQ(root_outputs.at(0).As<BitVector<>>(), expected_and);
+
+  for (std::size_t party_id = 0; party_id < 2; ++party_id) {
+    auto& root_backend{*root_parties.at(party_id)->GetBackend()};
+    session_parties.at(party_id) = std::make_unique<Party>(
+        root_backend.GetCommunicationLayer().CreateSession(kSessionId));
+    session_parties.at(party_id)->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+    auto& session_backend{*session_parties.at(party_id)->GetBackend()};
+    EXPECT_THROW(session_backend.DeriveBaseOts(session_backend), std::invalid_argument);
+    session_backend.DeriveBaseOts(root_backend);
+  }
+
+  // both sessions evaluate their circuits at the same time over the same connections
+  run_in_parallel([&](std::size_t my_id) {
+    auto root_future{std::async(std::launch::async, [&] {
+      root_parties.at(my_id)->Clear();
+      root_parties.at(my_id)->Run();
+    })};
+    auto& party{*session_parties.at(my_id)};
+    const ShareWrapper boolean_share_0{party.In<MpcProtocol::kBooleanGmw>(boolean_inputs.at(0), 0)};
+    const ShareWrapper boolean_share_1{party.In<MpcProtocol::kBooleanGmw>(boolean_inputs.at(1), 1)};
+    const auto and_share{boolean_share_0 & boolean_share_1};
+    const ShareWrapper arithmetic_share_0{
+        party.In<MpcProtocol::kArithmeticGmw>(arithmetic_inputs.at(0), 0)};
+    const ShareWrapper arithmetic_share_1{
+        party.In<MpcProtocol::kArithmeticGmw>(arithmetic_inputs.at(1), 1)};
+    const auto product_share{arithmetic_share_0 * arithmetic_share_1};
+    session_and_outputs.at(my_id) = and_share.Out();
+    session_product_outputs.at(my_id) = product_share.Out();
+    party.Run();
+    root_future.get();
+  });
+  for (std::size_t party_id = 0; party_id < 2; ++party_id) {
+    EXPECT_EQ(root_outputs.at(party_id).As<BitVector<>>(), expected_and);
+    EXPECT_EQ(session_and_outputs.at(party_id).As<BitVector<>>(), expected_and);
+    EXPECT_EQ(session_product_outputs.at(party_id).As<std::vector<std::uint32_t>>(),
+              expected_product);
+  }
+
+  // the session used the derived base OTs instead of computing its own
+  for (std::size_t party_id = 0; party_id < 2; ++party_id) {
+    const std::size_t other_id{1 - party_id};
+    const auto [root_receiver, root_sender] =
+        root_parties.at(party_id)->GetBackend()->GetBaseOtProvider().ExportBaseOts(other_id);
+    const auto [session_receiver, session_sender] =
+        session_parties.at(party_id)->GetBackend()->GetBaseOtProvider().ExportBaseOts(other_id);
+    EXPECT_EQ(session_receiver.c, root_receiver.c);
+    ASSERT_EQ(session_receiver.messages_c.size(), root_receiver.messages_c.size());
+    EXPECT_NE(session_receiver.messages_c, root_receiver.messages_c);
+    EXPECT_NE(session_sender.messages_0, root_sender.messages_0);
+  }
+
+  run_in_parallel([&](std::size_t my_id) { session_parties.at(my_id)->Finish(); });
+  run_in_parallel([&](std::size_t my_id) { root_parties.at(my_id)->Finish(); });
+}
+
 class CommunicationLayerTest : public testing::TestWithParam<bool> {};
 
 TEST_P(CommunicationLayerTest, Tcp) {
@@ -123,7 +655,7 @@ TEST_P(CommunicationLayerTest, Tcp) {
     communication_layer_alice->SendMessage(
         1, comm::BuildMessage(comm::MessageType::kOutputMessage, 0, message).Release());
     auto received_message = message_future_b1.get();
-    auto lhs = comm::GetMessage(received_message.data())->payload();
+    auto lhs = comm::GetMessage(received_message)->payload();
     for (std::size_t i = 0; i < message.size(); ++i) EXPECT_EQ(lhs->Get(i), message[i]);
   }
 
@@ -139,10 +671,10 @@ TEST_P(CommunicationLayerTest, Tcp) {
     communication_layer_alice->BroadcastMessage(
         comm::BuildMessage(comm::MessageType::kOutputMessage, 1, message).Release());
     auto received_message_1 = message_future_b2.get();
-    auto lhs_1 = comm::GetMessage(received_message_1.data())->payload();
+    auto lhs_1 = comm::GetMessage(received_message_1)->payload();
     for (std::size_t i = 0; i < message.size(); ++i) EXPECT_EQ(lhs_1->Get(i), message[i]);
     auto received_message_2 = message_future_c2.get();
-    auto lhs_2 = comm::GetMessage(received_message_2.data())->payload();
+    auto lhs_2 = comm::GetMessage(received_message_2)->payload();
     for (std::size_t i = 0; i < message.size(); ++i) EXPECT_EQ(lhs_2->Get(i), message[i]);
   }
 
@@ -154,6 +686,96 @@ TEST_P(CommunicationLayerTest, Tcp) {
   std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
 }
 
+TEST(CommunicationLayer, TcpIoService) {
+  constexpr std::size_t kFragmentSize = 1000;
+  // the connections of all parties are served by one I/O thread, on which the messages are also
+  // handed to the message managers
+  auto io_service{std::make_shared<comm::TcpIoService>(1)};
+  auto communication_layers = comm::MakeLocalTcpCommunicationLayers(3, false, io_service);
+  auto& communication_layer_alice = communication_layers.at(0);
+  auto& communication_layer_bob = communication_layers.at(1);
+  auto& communication_layer_charlie = communication_layers.at(2);
+  communication_layer_alice->SetPrioritizedSending(true, kFragmentSize);
+  std::for_each(std::begin(communication_layers), std::end(communication_layers),
+                [](auto& cl) { cl->Start(); });
+
+  std::vector<std::uint8_t> payload(10 * kFragmentSize + 1);
+  for (std::size_t i = 0; i < payload.size(); ++i) payload.at(i) = static_cast<std::uint8_t>(i);
+  auto bulk_future{communication_layer_bob->GetMessageManager().RegisterReceive(
+      0, comm::MessageType::kOtExtensionSender, 0)};
+  auto message_future_b{communication_layer_bob->GetMessageManager().RegisterReceive(
+      0, comm::MessageType::kOutputMessage, 1)};
+  auto message_future_c{communication_layer_charlie->GetMessageManager().RegisterReceive(
+      0, comm::MessageType::kOutputMessage, 1)};
+  communication_layer_alice->SendMessage(
+      1, comm::BuildMessage(comm::MessageType::kOtExtensionSender, 0, payload).Release());
+  communication_layer_alice->BroadcastMessage(
+      comm::BuildMessage(comm::MessageType::kOutputMessage, 1, payload).Release());
+  for (auto* future : {&bulk_future, &message_future_b, &message_future_c}) {
+    auto received_message = future->get();
+    auto received_payload = comm::GetMessage(received_message)->payload();
+    ASSERT_EQ(received_payload->size(), payload.size());
+    EXPECT_TRUE(std::equal(payload.begin(), payload.end(), received_payload->data()));
+  }
+
+  {
+    std::vector<std::future<void>> futures;
+    for (auto& cl : communication_layers) {
+      futures.emplace_back(std::async(std::launch::async, [&cl] { cl->Synchronize(); }));
+    }
+    std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+  }
+
+  std::vector<std::future<void>> futures;
+  for (auto& cl : communication_layers) {
+    futures.emplace_back(std::async(std::launch::async, [&cl] { cl->Shutdown(); }));
+  }
+  std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+
+  const auto key{std::make_pair(comm::CommunicationPhase::kSetup,
+                                static_cast<std::uint8_t>(comm::MessageType::kOtExtensionSender))};
+  const auto statistics_bob{communication_layer_bob->GetTransportStatistics().at(0)};
+  EXPECT_EQ(statistics_bob.number_of_io_threads, 1);
+  EXPECT_EQ(statistics_bob.message_type_statistics.at(key).number_of_messages_received, 1);
+}
+
+TEST(CommunicationLayer, SharedMemory) {
+  auto communication_layers =
+      encrypto::motion::communication::MakeLocalSharedMemoryCommunicationLayers(3);
+  auto& communication_layer_alice = communication_layers.at(0);
+  auto& communication_layer_bob = communication_layers.at(1);
+  auto& communication_layer_charlie = communication_layers.at(2);
+
+  std::for_each(std::begin(communication_layers), std::end(communication_layers),
+                [](auto& cl) { cl->Start(); });
+
+  // larger than a ring buffer, so that it is streamed through the ring
+  const std::vector<std::uint8_t> message(
+      encrypto::motion::communication::SharedMemorySetupHelper::kDefaultRingSize + 123, 0x42);
+
+  auto message_future_b{communication_layer_bob->GetMessageManager().RegisterReceive(
+      2, comm::MessageType::kOutputMessage, 0)};
+  auto message_future_c{communication_layer_charlie->GetMessageManager().RegisterReceive(
+      0, comm::MessageType::kOutputMessage, 0)};
+  communication_layer_charlie->SendMessage(
+      1, comm::BuildMessage(comm::MessageType::kOutputMessage, 0, message).Release());
+  communication_layer_alice->SendMessage(
+      2, comm::BuildMessage(comm::MessageType::kOutputMessage, 0, message).Release());
+  for (auto* future : {&message_future_b, &message_future_c}) {
+    auto received_message = future->get();
+    auto payload = comm::GetMessage(received_message)->payload();
+    ASSERT_EQ(payload->size(), message.size());
+    EXPECT_TRUE(std::equal(payload->begin(), payload->end(), message.begin()));
+  }
+
+  // shutdown all commmunication layers
+  std::vector<std::future<void>> futures;
+  for (auto& cl : communication_layers) {
+    futures.emplace_back(std::async(std::launch::async, [&cl] { cl->Shutdown(); }));
+  }
+  std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+}
+
 INSTANTIATE_TEST_SUITE_P(CommunicationLayerTcpTests, CommunicationLayerTest, testing::Bool(),
                          [](auto& info) { return info.param ? "ipv6" : "ipv4"; });
 }  // namespace
\ No newline at end of file
@@ -0,0 +1,183 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "base/motion_base_provider.h"
+#include "communication/communication_layer.h"
+#include "oblivious_transfer/base_ots/base_ot_provider.h"
+#include "oblivious_transfer/file_ot_provider.h"
+#include "oblivious_transfer/ot_flavors.h"
+
+namespace {
+
+constexpr std::size_t kNumberOfOts = 1000;
+
+// two parties in a fresh process whose OT providers keep their state in directory
+class Parties {
+ public:
+  Parties(const std::string& directory, const encrypto::motion::OtProviderFromFile::Key& key)
+      : communication_layers_(encrypto::motion::communication::MakeDummyCommunicationLayers(2)) {
+    for (std::size_t i = 0; i < 2; ++i) {
+      base_ot_providers_[i] =
+          std::make_unique<encrypto::motion::BaseOtProvider>(*communication_layers_[i]);
+      motion_base_providers_[i] =
+          std::make_unique<encrypto::motion::BaseProvider>(*communication_layers_[i]);
+    }
+    try {
+      for (std::size_t i = 0; i < 2; ++i) {
+        managers_[i] = std::make_unique<encrypto::motion::OtProviderManager>(
+            *communication_layers_[i], *base_ot_providers_[i], *motion_base_providers_[i],
+            encrypto::motion::OtExtensionProtocol::kIknp, 4, directory, key);
+      }
+    } catch (...) {
+      // the communication layers have to be started before they are shut down
+      Start();
+      Shutdown();
+      throw;
+    }
+  }
+
+  ~Parties() { Shutdown(); }
+
+  encrypto::motion::OtProviderFromFile& GetProvider(std::size_t i) {
+    return dynamic_cast<encrypto::motion::OtProviderFromFile&>(managers_[i]->GetProvider(1 - i));
+  }
+
+  encrypto::motion::BaseOtProvider& GetBaseOtProvider(std::size_t i) {
+    return *base_ot_providers_[i];
+  }
+
+  // runs kNumberOfOts ROts from party 0 to party 1 and returns the receiver's outputs
+  std::vector<encrypto::motion::BitVector<>> RunROts() {
+    auto ot_sender = GetProvider(0).RegisterSendROt(kNumberOfOts, 128);
+    auto ot_receiver = GetProvider(1).RegisterReceiveROt(kNumberOfOts, 128);
+    for (std::size_t i = 0; i < 2; ++i) {
+      managers_[i]->PreSetup();
+      if (base_ot_providers_[i]->HasWork()) base_ot_providers_[i]->PreSetup();
+    }
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 0; i < 2; ++i) {
+      futures.emplace_back(std::async(std::launch::async, [this, i] {
+        communication_layers_[i]->Start();
+        communication_layers_[i]->Synchronize();
+        motion_base_providers_[i]->Setup();
+        if (base_ot_providers_[i]->HasWork()) base_ot_providers_[i]->ComputeBaseOts();
+        auto send_setup{std::async(std::launch::async, [this, i] { GetProvider(i).SendSetup(); })};
+        GetProvider(i).ReceiveSetup();
+        send_setup.get();
+      }));
+    }
+    std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+
+    ot_sender->ComputeOutputs();
+    ot_receiver->ComputeOutputs();
+    const auto sender_outputs = ot_sender->GetOutputs();
+    const auto receiver_outputs = ot_receiver->GetOutputs();
+    const auto& choices = ot_receiver->GetChoices();
+    for (std::size_t ot_i = 0; ot_i < kNumberOfOts; ++ot_i) {
+      const std::size_t offset{choices.Get(ot_i) ? 128u : 0u};
+      EXPECT_EQ(receiver_outputs[ot_i], sender_outputs[ot_i].Subset(offset, offset + 128));
+    }
+    for (auto& manager : managers_) manager->Clear();
+    return {receiver_outputs.begin(), receiver_outputs.end()};
+  }
+
+ private:
+  void Start() {
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 0; i < 2; ++i) {
+      futures.emplace_back(
+          std::async(std::launch::async, [this, i] { communication_layers_[i]->Start(); }));
+    }
+    std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+  }
+
+  void Shutdown() {
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 0; i < 2; ++i) {
+      futures.emplace_back(
+          std::async(std::launch::async, [this, i] { communication_layers_[i]->Shutdown(); }));
+    }
+    std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+  }
+
+  std::vector<std::unique_ptr<encrypto::motion::communication::CommunicationLayer>>
+      communication_layers_;
+  std::array<std::unique_ptr<encrypto::motion::BaseOtProvider>, 2> base_ot_providers_;
+  std::array<std::unique_ptr<encrypto::motion::BaseProvider>, 2> motion_base_providers_;
+  std::array<std::unique_ptr<encrypto::motion::OtProviderManager>, 2> managers_;
+};
+
+class OtProviderFromFileTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const auto* test_info{::testing::UnitTest::GetInstance()->current_test_info()};
+    directory_ = std::filesystem::temp_directory_path() /
+                 fmt::format("motion_ot_store_{}", test_info->name());
+    std::filesystem::remove_all(directory_);
+    std::filesystem::create_directory(directory_);
+    key_.fill(std::byte(0x42));
+  }
+
+  void TearDown() override { std::filesystem::remove_all(directory_); }
+
+  std::filesystem::path directory_;
+  encrypto::motion::OtProviderFromFile::Key key_;
+};
+
+TEST_F(OtProviderFromFileTest, ReloadsBaseOts) {
+  std::vector<encrypto::motion::BitVector<>> first_outputs;
+  {
+    Parties parties(directory_, key_);
+    for (std::size_t i = 0; i < 2; ++i) EXPECT_FALSE(parties.GetProvider(i).IsLoaded());
+    first_outputs = parties.RunROts();
+    parties.RunROts();
+  }
+  for (std::size_t restart = 0; restart < 2; ++restart) {
+    Parties parties(directory_, key_);
+    for (std::size_t i = 0; i < 2; ++i) {
+      EXPECT_TRUE(parties.GetProvider(i).IsLoaded());
+      // the base OTs are not computed again
+      EXPECT_FALSE(parties.GetBaseOtProvider(i).HasWork());
+    }
+    // the PRG streams continue after the blocks used by the earlier processes
+    EXPECT_NE(parties.RunROts(), first_outputs);
+  }
+}
+
+TEST_F(OtProviderFromFileTest, RejectsWrongKey) {
+  { Parties(directory_, key_).RunROts(); }
+  auto wrong_key{key_};
+  wrong_key[0] ^= std::byte(1);
+  EXPECT_THROW(Parties(directory_, wrong_key), std::runtime_error);
+}
+
+}  // namespace
@@ -423,4 +423,62 @@ INSTANTIATE_TEST_SUITE_P(GarbledCircuitTestSuite, GarbledCircuitTest,
                            return name;
                          });
 
+TEST(GarbledCircuit, EstimateCost_And_8_bit_100_Simd) {
+  constexpr auto kGarbledCircuit = encrypto::motion::MpcProtocol::kGarbledCircuit;
+  constexpr std::size_t kNumberOfWires{8}, kNumberOfSimd{100};
+  constexpr std::size_t kNumberOfValues{kNumberOfWires * kNumberOfSimd};
+  using encrypto::motion::proto::garbled_circuit::kGarbledControlBitsBitSize;
+  using encrypto::motion::proto::garbled_circuit::kGarbledTableBitSize;
+  constexpr auto kGarblerId{
+      static_cast<std::size_t>(encrypto::motion::GarbledCircuitRole::kGarbler)};
+  auto parties{encrypto::motion::MakeLocallyConnectedParties(2, kPortOffset)};
+  for (auto& party : parties) party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+  std::vector<std::future<void>> futures;
+  for (std::size_t party_id = 0; party_id < 2u; ++party_id) {
+    futures.emplace_back(std::async(std::launch::async, [party_id, &parties, kNumberOfValues]() {
+      auto& party{parties[party_id]};
+      auto [input_share_0, input_promise_0] =
+          party->In<kGarbledCircuit>(0, kNumberOfWires, kNumberOfSimd);
+      auto [input_share_1, input_promise_1] =
+          party->In<kGarbledCircuit>(1, kNumberOfWires, kNumberOfSimd);
+      encrypto::motion::ShareWrapper input_0(input_share_0), input_1(input_share_1);
+      auto output{(input_0 & input_1).Out()};
+
+      const auto cost{party->EstimateCost()};
+      EXPECT_EQ(cost.number_of_and_operations, kNumberOfValues);
+      EXPECT_EQ(cost.multiplicative_depth, 1u);
+      // the evaluator obtains the labels of its input via OT
+      EXPECT_EQ(cost.number_of_ots_sent, party_id == kGarblerId ? kNumberOfValues : 0u);
+      EXPECT_EQ(cost.number_of_ots_received, party_id == kGarblerId ? 0u : kNumberOfValues);
+      if (party_id == kGarblerId) {
+        EXPECT_EQ(cost.online_rounds, 2u);
+        EXPECT_EQ(cost.offline_bytes_sent,
+                  encrypto::motion::BitsToBytes(kNumberOfValues * (kGarbledTableBitSize +
+                                                                   kGarbledControlBitsBitSize)));
+        // one label per own input, both labels per input of the evaluator and the output
+        EXPECT_EQ(cost.online_bytes_sent,
+                  3 * kNumberOfValues * encrypto::motion::Block128::kBlockSize +
+                      encrypto::motion::BitsToBytes(kNumberOfValues));
+      } else {
+        EXPECT_EQ(cost.online_rounds, 3u);
+        EXPECT_EQ(cost.offline_bytes_sent,
+                  kNumberOfValues * encrypto::motion::Block128::kBlockSize);
+        // the OT corrections and the output
+        EXPECT_EQ(cost.online_bytes_sent, 2 * encrypto::motion::BitsToBytes(kNumberOfValues));
+      }
+
+      std::vector<encrypto::motion::BitVector<>> input(
+          kNumberOfWires, encrypto::motion::BitVector<>::SecureRandom(kNumberOfSimd));
+      if (party_id == 0) {
+        input_promise_0->set_value(input);
+      } else {
+        input_promise_1->set_value(input);
+      }
+      party->Run();
+      party->Finish();
+    }));
+  }
+  for (auto& f : futures) f.get();
+}
+
 }  // namespace
@@ -30,6 +30,7 @@
 #include <type_traits>
 
 #include "algorithm/algorithm_description.h"
+#include "algorithm/compiled_circuit.h"
 #include "base/party.h"
 #include "protocols/bmr/bmr_wire.h"
 #include "protocols/boolean_gmw/boolean_gmw_wire.h"
@@ -82,6 +83,198 @@ TEST(AlgorithmDescription, FromBristolFormatIntAdd8Size) {
   EXPECT_EQ(gate33.selection_bit.has_value(), false);
 }
 
+TEST(CompiledCircuit, CompileIntAdd8Size) {
+  const auto int_add8 = encrypto::motion::AlgorithmDescription::FromBristol(
+      std::string(encrypto::motion::kRootDir) + "/circuits/int/int_add8_size.bristol");
+  const auto circuit = encrypto::motion::CompiledCircuit::Compile(int_add8);
+  const auto number_of_ands = std::count_if(
+      int_add8.gates.begin(), int_add8.gates.end(), [](const auto& gate) {
+        return gate.type == encrypto::motion::PrimitiveOperationType::kAnd;
+      });
+  EXPECT_EQ(circuit.number_of_input_wires, 16);
+  EXPECT_EQ(circuit.number_of_and_operations, number_of_ands);
+  EXPECT_EQ(circuit.GetNumberOfOperations(), int_add8.gates.size());
+  EXPECT_EQ(circuit.output_slots.size(), 8);
+  ASSERT_EQ(circuit.layer_offsets.size(), circuit.GetNumberOfLayers() + 1);
+  EXPECT_EQ(circuit.layer_offsets.back(), circuit.GetNumberOfOperations());
+
+  // every slot is written before it is read, and ANDs only read values of earlier rounds
+  std::vector<std::size_t> round(circuit.number_of_slots, std::numeric_limits<std::size_t>::max());
+  std::fill_n(round.begin(), circuit.number_of_input_wires, 0);
+  for (std::size_t layer = 0; layer < circuit.GetNumberOfLayers(); ++layer) {
+    for (auto i = circuit.layer_offsets[layer]; i < circuit.layer_offsets[layer + 1]; ++i) {
+      const bool is_and{i >= circuit.and_offsets[layer]};
+      EXPECT_EQ(is_and,
+                circuit.operation_types[i] == encrypto::motion::CompiledOperationType::kAnd);
+      EXPECT_LE(round[circuit.input_a[i]], layer);
+      if (circuit.operation_types[i] != encrypto::motion::CompiledOperationType::kInv) {
+        EXPECT_LE(round[circuit.input_b[i]], layer);
+      }
+      round[circuit.output[i]] = is_and ? layer + 1 : layer;
+    }
+  }
+}
+
+TEST(CompiledCircuit, IntAdd8InBooleanGmwAndGarbledCircuit) {
+  const auto int_add8 = encrypto::motion::AlgorithmDescription::FromBristol(
+      std::string(encrypto::motion::kRootDir) + "/circuits/int/int_add8_size.bristol");
+  const auto circuit{std::make_shared<const encrypto::motion::CompiledCircuit>(
+      encrypto::motion::CompiledCircuit::Compile(int_add8))};
+  std::mt19937 mersenne_twister(sizeof(std::uint8_t));
+  std::uniform_int_distribution<std::uint16_t> distribution(0, 255);
+  const std::vector<std::uint8_t> raw_global_input = {
+      static_cast<std::uint8_t>(distribution(mersenne_twister)),
+      static_cast<std::uint8_t>(distribution(mersenne_twister))};
+  const std::uint8_t expected = raw_global_input.at(0) + raw_global_input.at(1);
+
+  for (auto protocol : {encrypto::motion::MpcProtocol::kBooleanGmw,
+                        encrypto::motion::MpcProtocol::kGarbledCircuit}) {
+    std::vector<PartyPointer> parties(std::move(MakeLocallyConnectedParties(2, kPortOffset)));
+    for (auto& party : parties) {
+      party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+      party->GetConfiguration()->SetOnlineAfterSetup(true);
+    }
+    std::vector<std::thread> threads;
+    for (auto party_id = 0u; party_id < parties.size(); ++party_id) {
+      threads.emplace_back([party_id, protocol, expected, &circuit, &parties,
+                            &raw_global_input]() {
+        auto& party{parties.at(party_id)};
+        std::vector<encrypto::motion::ShareWrapper> inputs;
+        for (std::size_t input_owner = 0; input_owner < 2; ++input_owner) {
+          const auto input{encrypto::motion::ToInput(
+              input_owner == party_id ? raw_global_input.at(input_owner) : std::uint8_t(0))};
+          if (protocol == encrypto::motion::MpcProtocol::kBooleanGmw) {
+            inputs.emplace_back(party->In<MpcProtocol::kBooleanGmw>(input, input_owner));
+          } else {
+            inputs.emplace_back(party->In<MpcProtocol::kGarbledCircuit>(input, input_owner));
+          }
+        }
+        auto share_output{
+            encrypto::motion::ShareWrapper::Concatenate(inputs).Evaluate(circuit).Out()};
+
+        party->Run();
+        const auto output{share_output.As<std::vector<encrypto::motion::BitVector<>>>()};
+        EXPECT_EQ(encrypto::motion::ToOutput<std::uint8_t>(output), expected);
+        party->Finish();
+      });
+    }
+    for (auto& t : threads)
+      if (t.joinable()) t.join();
+  }
+}
+
+// wires 0, 1 and 2 are the inputs a, b and s, the outputs are a | b and s ? a : b
+encrypto::motion::AlgorithmDescription MakeOrMuxAlgorithm() {
+  encrypto::motion::AlgorithmDescription algorithm;
+  algorithm.number_of_input_wires_parent_a = 2;
+  algorithm.number_of_input_wires_parent_b = 1;
+  algorithm.number_of_output_wires = 2;
+  algorithm.number_of_wires = 5;
+  algorithm.number_of_gates = 2;
+  algorithm.gates.push_back({.type = encrypto::motion::PrimitiveOperationType::kOr,
+                             .parent_a = 0,
+                             .parent_b = 1,
+                             .output_wire = 3});
+  algorithm.gates.push_back({.type = encrypto::motion::PrimitiveOperationType::kMux,
+                             .parent_a = 0,
+                             .parent_b = 1,
+                             .selection_bit = 2,
+                             .output_wire = 4});
+  return algorithm;
+}
+
+TEST(CompiledCircuit, LoweredOrAndMuxMatchPlaintext) {
+  const auto circuit = encrypto::motion::CompiledCircuit::Compile(MakeOrMuxAlgorithm());
+  ASSERT_EQ(circuit.number_of_input_wires, 3);
+  ASSERT_EQ(circuit.output_slots.size(), 2);
+  EXPECT_EQ(circuit.number_of_and_operations, 2);
+
+  for (std::size_t inputs = 0; inputs < 8; ++inputs) {
+    const bool a = inputs & 1, b = (inputs >> 1) & 1, s = (inputs >> 2) & 1;
+    std::vector<bool> slots(circuit.number_of_slots, false);
+    slots[0] = a;
+    slots[1] = b;
+    slots[2] = s;
+    for (std::size_t i = 0; i < circuit.GetNumberOfOperations(); ++i) {
+      const bool x = slots[circuit.input_a[i]], y = slots[circuit.input_b[i]];
+      switch (circuit.operation_types[i]) {
+        case encrypto::motion::CompiledOperationType::kXor:
+          slots[circuit.output[i]] = x != y;
+          break;
+        case encrypto::motion::CompiledOperationType::kInv:
+          slots[circuit.output[i]] = !x;
+          break;
+        case encrypto::motion::CompiledOperationType::kAnd:
+          slots[circuit.output[i]] = x && y;
+          break;
+      }
+    }
+    EXPECT_EQ(slots[circuit.output_slots[0]], a || b);
+    EXPECT_EQ(slots[circuit.output_slots[1]], s ? a : b);
+  }
+}
+
+TEST(CompiledCircuit, OrAndMuxInBooleanGmwAndGarbledCircuit) {
+  constexpr std::size_t kNumberOfSimd = 8;
+  const auto circuit{std::make_shared<const encrypto::motion::CompiledCircuit>(
+      encrypto::motion::CompiledCircuit::Compile(MakeOrMuxAlgorithm()))};
+  // the SIMD values enumerate all combinations of a, b and s
+  std::vector<encrypto::motion::BitVector<>> raw_global_input(
+      3, encrypto::motion::BitVector<>(kNumberOfSimd));
+  for (std::size_t i = 0; i < kNumberOfSimd; ++i) {
+    for (std::size_t wire_i = 0; wire_i < raw_global_input.size(); ++wire_i) {
+      raw_global_input.at(wire_i).Set((i >> wire_i) & 1, i);
+    }
+  }
+  const auto& a = raw_global_input.at(0);
+  const auto& b = raw_global_input.at(1);
+  const auto& s = raw_global_input.at(2);
+  const auto expected_or{a | b};
+  const auto expected_mux{b ^ (s & (a ^ b))};
+
+  for (auto protocol : {encrypto::motion::MpcProtocol::kBooleanGmw,
+                        encrypto::motion::MpcProtocol::kGarbledCircuit}) {
+    std::vector<PartyPointer> parties(std::move(MakeLocallyConnectedParties(2, kPortOffset)));
+    for (auto& party : parties) {
+      party->GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+      party->GetConfiguration()->SetOnlineAfterSetup(true);
+    }
+    std::vector<std::thread> threads;
+    for (auto party_id = 0u; party_id < parties.size(); ++party_id) {
+      threads.emplace_back([party_id, protocol, &circuit, &parties, &raw_global_input,
+                            &expected_or, &expected_mux]() {
+        auto& party{parties.at(party_id)};
+        std::vector<encrypto::motion::ShareWrapper> inputs;
+        for (std::size_t wire_i = 0; wire_i < raw_global_input.size(); ++wire_i) {
+          // party 0 provides a and s, party 1 provides b
+          const std::size_t input_owner = wire_i % 2;
+          std::vector<encrypto::motion::BitVector<>> input{
+              input_owner == party_id ? raw_global_input.at(wire_i)
+                                      : encrypto::motion::BitVector<>(kNumberOfSimd)};
+          if (protocol == encrypto::motion::MpcProtocol::kBooleanGmw) {
+            inputs.emplace_back(
+                party->In<MpcProtocol::kBooleanGmw>(std::move(input), input_owner));
+          } else {
+            inputs.emplace_back(
+                party->In<MpcProtocol::kGarbledCircuit>(std::move(input), input_owner));
+          }
+        }
+        auto share_output{
+            encrypto::motion::ShareWrapper::Concatenate(inputs).Evaluate(circuit).Out()};
+
+        party->Run();
+        const auto output{share_output.As<std::vector<encrypto::motion::BitVector<>>>()};
+        ASSERT_EQ(output.size(), 2);
+        EXPECT_EQ(output.at(0), expected_or);
+        EXPECT_EQ(output.at(1), expected_mux);
+        party->Finish();
+      });
+    }
+    for (auto& t : threads)
+      if (t.joinable()) t.join();
+  }
+}
+
 // TODO: rewrite as generic tests
 template <typename T>
 class SecureUintTest : public ::testing::Test {
@@ -22,15 +22,20 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <atomic>
 #include <future>
+#include <stdexcept>
 #include <thread>
 #include <vector>
 
+#include <boost/fiber/operations.hpp>
 #include <gtest/gtest.h>
 
 #include "test_constants.h"
 #include "utility/bit_vector.h"
 #include "utility/condition.h"
+#include "utility/fiber_thread_pool/fiber_thread_pool.hpp"
+#include "utility/fiber_thread_pool/pooled_work_stealing.hpp"
 #include "utility/helpers.h"
 
 namespace {
@@ -292,4 +297,68 @@ TYPED_TEST(TwosComplementTest, Conversion) {
   }
 }
 
+TEST(FiberThreadPool, ReusedAcrossBatches) {
+  constexpr std::size_t kNumberOfBatches = 5;
+  constexpr std::size_t kNumberOfTasks = 100;
+  encrypto::motion::FiberThreadPool fiber_pool(2);
+  std::atomic<std::size_t> counter = 0;
+
+  for (std::size_t batch = 1; batch <= kNumberOfBatches; ++batch) {
+    for (std::size_t i = 0; i < kNumberOfTasks; ++i) {
+      fiber_pool.post([&counter] { ++counter; });
+    }
+    fiber_pool.wait();
+    EXPECT_EQ(counter, batch * kNumberOfTasks);
+  }
+
+  fiber_pool.join();
+}
+
+TEST(FiberThreadPool, WaitRethrowsTaskException) {
+  constexpr std::size_t kNumberOfTasks = 100;
+  encrypto::motion::FiberThreadPool fiber_pool(2);
+  std::atomic<std::size_t> counter = 0;
+
+  for (std::size_t i = 0; i < kNumberOfTasks; ++i) {
+    fiber_pool.post([&counter, i] {
+      ++counter;
+      if (i % 10 == 0) throw std::runtime_error("task failed");
+    });
+  }
+  EXPECT_THROW(fiber_pool.wait(), std::runtime_error);
+  EXPECT_EQ(counter, kNumberOfTasks);
+
+  // the pool stays usable after the exception has been reported
+  fiber_pool.post([&counter] { ++counter; });
+  EXPECT_NO_THROW(fiber_pool.wait());
+  EXPECT_EQ(counter, kNumberOfTasks + 1);
+
+  fiber_pool.join();
+}
+
+TEST(FiberThreadPool, PrioritizedTasks) {
+  constexpr std::size_t kNumberOfTasks = 100;
+  encrypto::motion::FiberThreadPool fiber_pool(2);
+  std::atomic<std::size_t> counter = 0, number_of_wrong_priorities = 0;
+
+  for (std::size_t i = 0; i < kNumberOfTasks; ++i) {
+    const std::size_t priority = i % 4;
+    fiber_pool.post(
+        [&, priority] {
+          // yield s.t. the fiber is scheduled by its priority, possibly on the other worker
+          boost::this_fiber::yield();
+          if (boost::this_fiber::properties<fiber_priority_props>().get_priority() != priority) {
+            ++number_of_wrong_priorities;
+          }
+          ++counter;
+        },
+        priority);
+  }
+  fiber_pool.wait();
+  EXPECT_EQ(counter, kNumberOfTasks);
+  EXPECT_EQ(number_of_wrong_priorities, 0);
+
+  fiber_pool.join();
+}
+
 }  // namespace
\ No newline at end of file
@@ -0,0 +1,247 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <thread>
+
+#include <fmt/format.h>
+#include <unistd.h>
+
+#include "base/configuration.h"
+#include "base/party.h"
+#include "communication/communication_layer.h"
+#include "communication/dummy_transport.h"
+#include "communication/message.h"
+#include "communication/message_manager.h"
+#include "communication/recording_transport.h"
+#include "protocols/arithmetic_gmw/arithmetic_gmw_wire.h"
+#include "protocols/boolean_gmw/boolean_gmw_wire.h"
+#include "protocols/share_wrapper.h"
+#include "test_constants.h"
+
+using namespace encrypto::motion::communication;
+using namespace std::chrono_literals;
+
+namespace {
+
+std::string GetTemporaryPath(const std::string& name) {
+  const auto file_name = fmt::format("motion-{}-{}", getpid(), name);
+  return (std::filesystem::temp_directory_path() / file_name).string();
+}
+
+TEST(RecordingTransport, RecordAndReplay) {
+  const auto path = GetTemporaryPath("record-and-replay");
+  const std::vector<std::vector<std::uint8_t>> messages = {{0xde, 0xad}, {}, {0xbe, 0xef, 0x42}};
+  {
+    auto [transport_alice, transport_bob] = DummyTransport::MakeTransportPair();
+    RecordingTransport recording_transport(std::move(transport_bob), path);
+    for (const auto& message : messages) transport_alice->SendMessage(message);
+    for (const auto& message : messages) {
+      EXPECT_EQ(recording_transport.ReceiveMessage(), message);
+    }
+    // sent messages are passed on, but not recorded
+    recording_transport.SendMessage(messages.front());
+    EXPECT_EQ(transport_alice->ReceiveMessage(), messages.front());
+    EXPECT_EQ(recording_transport.GetStatistics().number_of_messages_received, messages.size());
+    recording_transport.Shutdown();
+  }
+
+  ReplayTransport replay_transport(path);
+  EXPECT_EQ(replay_transport.GetNumberOfRemainingMessages(), messages.size());
+  replay_transport.SendMessage(messages.back());
+  for (const auto& message : messages) {
+    EXPECT_TRUE(replay_transport.Available());
+    EXPECT_EQ(replay_transport.ReceiveMessage(), message);
+  }
+  EXPECT_FALSE(replay_transport.Available());
+  EXPECT_FALSE(replay_transport.ReceiveMessage().has_value());
+  EXPECT_EQ(replay_transport.GetStatistics().number_of_messages_sent, 1);
+  std::filesystem::remove(path);
+}
+
+TEST(RecordingTransport, PreserveTiming) {
+  const auto path = GetTemporaryPath("preserve-timing");
+  {
+    auto [transport_alice, transport_bob] = DummyTransport::MakeTransportPair();
+    RecordingTransport recording_transport(std::move(transport_bob), path);
+    std::this_thread::sleep_for(20ms);
+    transport_alice->SendMessage(std::vector<std::uint8_t>{0x42});
+    ASSERT_TRUE(recording_transport.ReceiveMessage().has_value());
+    recording_transport.Shutdown();
+  }
+
+  ReplayTransport fast_replay_transport(path);
+  EXPECT_TRUE(fast_replay_transport.Available());
+
+  const auto start = std::chrono::steady_clock::now();
+  ReplayTransport replay_transport(path, /* preserve_timing = */ true);
+  EXPECT_FALSE(replay_transport.Available());
+  EXPECT_TRUE(replay_transport.ReceiveMessage().has_value());
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+  std::filesystem::remove(path);
+}
+
+TEST(RecordingTransport, InvalidRecording) {
+  const auto path = GetTemporaryPath("invalid-recording");
+  EXPECT_THROW(ReplayTransport{path}, std::runtime_error);
+  std::ofstream(path) << "no recording";
+  EXPECT_THROW(ReplayTransport{path}, std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+// a communication layer replays the messages received by a party without the other party
+TEST(RecordingTransport, ReplayCommunicationLayer) {
+  const auto path_prefix = GetTemporaryPath("replay-communication-layer");
+  const std::vector<std::uint8_t> message = {0xde, 0xad, 0xbe, 0xef};
+  const auto receive_message = [&message](CommunicationLayer& communication_layer) {
+    auto message_future{communication_layer.GetMessageManager().RegisterReceive(
+        0, MessageType::kOutputMessage, 0)};
+    communication_layer.Start();
+    auto received_message = message_future.get();
+    auto payload = GetMessage(received_message)->payload();
+    ASSERT_EQ(payload->size(), message.size());
+    for (std::size_t i = 0; i < message.size(); ++i) EXPECT_EQ(payload->Get(i), message[i]);
+  };
+  {
+    auto [transport_alice, transport_bob] = DummyTransport::MakeTransportPair();
+    std::vector<std::unique_ptr<Transport>> transports_alice(2), transports_bob(2);
+    transports_alice.at(1) = std::move(transport_alice);
+    transports_bob.at(0) = std::move(transport_bob);
+    RecordTransports(transports_bob, path_prefix);
+    CommunicationLayer communication_layer_alice(0, std::move(transports_alice));
+    CommunicationLayer communication_layer_bob(1, std::move(transports_bob));
+    communication_layer_alice.Start();
+    communication_layer_alice.SendMessage(
+        1, BuildMessage(MessageType::kOutputMessage, 0, message).Release());
+    receive_message(communication_layer_bob);
+    auto shutdown_future =
+        std::async(std::launch::async, [&] { communication_layer_alice.Shutdown(); });
+    communication_layer_bob.Shutdown();
+    shutdown_future.get();
+  }
+
+  CommunicationLayer communication_layer(1, MakeReplayTransports(1, 2, path_prefix));
+  receive_message(communication_layer);
+  communication_layer.Shutdown();
+  std::filesystem::remove(path_prefix + ".0");
+}
+
+// a party with a seeded configuration reproduces its evaluation from the recorded messages alone
+TEST(RecordingTransport, ReplayPartyEvaluation) {
+  using encrypto::motion::BitVector;
+  using encrypto::motion::Configuration;
+  using encrypto::motion::MpcProtocol;
+  using encrypto::motion::Party;
+  using encrypto::motion::ShareWrapper;
+  namespace boolean_gmw = encrypto::motion::proto::boolean_gmw;
+  namespace arithmetic_gmw = encrypto::motion::proto::arithmetic_gmw;
+  constexpr std::size_t kNumberOfSimd = 100;
+
+  struct Result {
+    BitVector<> and_share, and_output;
+    std::vector<std::uint32_t> product_share, product_output;
+  };
+  std::array<std::byte, 16> seed;
+  seed.fill(std::byte(0x42));
+  std::vector<BitVector<>> boolean_inputs;
+  std::vector<std::vector<std::uint32_t>> arithmetic_inputs;
+  for (std::uint32_t party_id = 0; party_id < 2; ++party_id) {
+    BitVector<> boolean_input(kNumberOfSimd);
+    std::vector<std::uint32_t> arithmetic_input(kNumberOfSimd);
+    for (std::uint32_t i = 0; i < kNumberOfSimd; ++i) {
+      boolean_input.Set((i + party_id) % 3 != 0, i);
+      arithmetic_input.at(i) = 1000 * party_id + i;
+    }
+    boolean_inputs.push_back(std::move(boolean_input));
+    arithmetic_inputs.push_back(std::move(arithmetic_input));
+  }
+
+  const auto evaluate = [&](std::size_t my_id, std::unique_ptr<CommunicationLayer> layer) {
+    auto configuration = std::make_shared<Configuration>(my_id, 2);
+    configuration->SetRandomSeed(seed);
+    Party party(std::move(layer), configuration);
+    party.GetLogger()->SetEnabled(kDetailedLoggingEnabled);
+    std::array<ShareWrapper, 2> boolean_shares, arithmetic_shares;
+    for (std::size_t party_id = 0; party_id < 2; ++party_id) {
+      boolean_shares.at(party_id) =
+          party.In<MpcProtocol::kBooleanGmw>(boolean_inputs.at(party_id), party_id);
+      arithmetic_shares.at(party_id) =
+          party.In<MpcProtocol::kArithmeticGmw>(arithmetic_inputs.at(party_id), party_id);
+    }
+    const auto and_share{boolean_shares.at(0) & boolean_shares.at(1)};
+    const auto product_share{arithmetic_shares.at(0) * arithmetic_shares.at(1)};
+    const auto and_output{and_share.Out()};
+    const auto product_output{product_share.Out()};
+    party.Run();
+    Result result;
+    result.and_share =
+        std::dynamic_pointer_cast<boolean_gmw::Wire>(and_share->GetWires().at(0))->GetValues();
+    result.product_share =
+        std::dynamic_pointer_cast<arithmetic_gmw::Wire<std::uint32_t>>(
+            product_share->GetWires().at(0))
+            ->GetValues();
+    result.and_output =
+        std::dynamic_pointer_cast<boolean_gmw::Wire>(and_output->GetWires().at(0))->GetValues();
+    result.product_output = product_output.As<std::vector<std::uint32_t>>();
+    party.Finish();
+    return result;
+  };
+
+  const auto path_prefix = GetTemporaryPath("replay-party-evaluation");
+  Result recorded_result;
+  {
+    auto [transport_alice, transport_bob] = DummyTransport::MakeTransportPair();
+    std::vector<std::unique_ptr<Transport>> transports_alice(2), transports_bob(2);
+    transports_alice.at(1) = std::move(transport_alice);
+    transports_bob.at(0) = std::move(transport_bob);
+    RecordTransports(transports_bob, path_prefix);
+    auto future_alice = std::async(std::launch::async, [&] {
+      evaluate(0, std::make_unique<CommunicationLayer>(0, std::move(transports_alice)));
+    });
+    recorded_result =
+        evaluate(1, std::make_unique<CommunicationLayer>(1, std::move(transports_bob)));
+    future_alice.get();
+  }
+  for (std::size_t i = 0; i < kNumberOfSimd; ++i) {
+    EXPECT_EQ(recorded_result.and_output.Get(i),
+              boolean_inputs.at(0).Get(i) && boolean_inputs.at(1).Get(i));
+    EXPECT_EQ(recorded_result.product_output.at(i),
+              arithmetic_inputs.at(0).at(i) * arithmetic_inputs.at(1).at(i));
+  }
+
+  const auto replayed_result =
+      evaluate(1, std::make_unique<CommunicationLayer>(1, MakeReplayTransports(1, 2, path_prefix)));
+  // the shares are only equal if the replayed party drew the same randomness
+  EXPECT_EQ(replayed_result.and_share, recorded_result.and_share);
+  EXPECT_EQ(replayed_result.product_share, recorded_result.product_share);
+  EXPECT_EQ(replayed_result.and_output, recorded_result.and_output);
+  EXPECT_EQ(replayed_result.product_output, recorded_result.product_output);
+  std::filesystem::remove(path_prefix + ".0");
+}
+
+}  // namespace
@@ -20,6 +20,8 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "utility/fiber_waitable.h"
@@ -89,6 +91,21 @@ TEST(ReusableFuture, RetrieveFutureTwice) {
   EXPECT_THROW(promise.get_future(), std::future_error);
 }
 
+TEST(ReusableFuture, PromiseArray) {
+  constexpr std::size_t kSize = 8;
+  std::vector<ReusableFuture<int>> futures;
+  {
+    ReusablePromiseArray<int> promises(kSize);
+    for (std::size_t i = 0; i < kSize; ++i) futures.emplace_back(promises.get_future(i));
+    for (std::size_t i = 0; i < kSize; ++i) promises.set_value(kSize - 1 - i, static_cast<int>(i));
+    EXPECT_THROW(promises.set_value(0, 42), std::future_error);
+  }
+  // the futures keep the shared states alive
+  for (std::size_t i = 0; i < kSize; ++i) {
+    EXPECT_EQ(futures.at(i).get(), static_cast<int>(kSize - 1 - i));
+  }
+}
+
 TEST(WaitableFuture, Wait) {
   class SetupWaitableClass : public encrypto::motion::FiberSetupWaitable {};
 
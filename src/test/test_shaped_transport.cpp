@@ -0,0 +1,123 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+#include "communication/dummy_transport.h"
+#include "communication/shaped_transport.h"
+
+using namespace encrypto::motion::communication;
+using namespace std::chrono_literals;
+
+static std::pair<std::unique_ptr<Transport>, std::unique_ptr<Transport>> MakeTransportPair(
+    const LinkShapingConfiguration& configuration) {
+  auto [transport_alice, transport_bob] = DummyTransport::MakeTransportPair();
+  return {std::make_unique<ShapedTransport>(std::move(transport_alice), configuration),
+          std::make_unique<ShapedTransport>(std::move(transport_bob), configuration)};
+}
+
+TEST(ShapedTransport, Latency) {
+  LinkShapingConfiguration configuration;
+  configuration.latency = 20ms;
+  auto [transport_alice, transport_bob] = MakeTransportPair(configuration);
+
+  const std::vector<std::uint8_t> message = {0xde, 0xad, 0xbe, 0xef};
+  const auto start = std::chrono::steady_clock::now();
+  transport_alice->SendMessage(message);
+  EXPECT_FALSE(transport_bob->Available());
+  auto received_message = transport_bob->ReceiveMessage();
+  EXPECT_GE(std::chrono::steady_clock::now() - start, configuration.latency);
+  ASSERT_TRUE(received_message.has_value());
+  EXPECT_EQ(*received_message, message);
+
+  transport_alice->ShutdownSend();
+  EXPECT_FALSE(transport_bob->ReceiveMessage().has_value());
+  transport_alice->Shutdown();
+  transport_bob->Shutdown();
+}
+
+TEST(ShapedTransport, JitterKeepsOrder) {
+  LinkShapingConfiguration configuration;
+  configuration.latency = 1ms;
+  configuration.jitter = 5ms;
+  configuration.seed = 42;
+  auto [transport_alice, transport_bob] = MakeTransportPair(configuration);
+
+  constexpr std::size_t kNumberOfMessages = 50;
+  for (std::size_t i = 0; i < kNumberOfMessages; ++i) {
+    transport_alice->SendMessage(std::vector<std::uint8_t>(i % 10, static_cast<std::uint8_t>(i)));
+  }
+  for (std::size_t i = 0; i < kNumberOfMessages; ++i) {
+    auto received_message = transport_bob->ReceiveMessage();
+    ASSERT_TRUE(received_message.has_value());
+    EXPECT_EQ(*received_message, std::vector<std::uint8_t>(i % 10, static_cast<std::uint8_t>(i)));
+  }
+  EXPECT_EQ(transport_bob->GetStatistics().number_of_messages_received, kNumberOfMessages);
+  transport_alice->Shutdown();
+  transport_bob->Shutdown();
+}
+
+TEST(ShapedTransport, Bandwidth) {
+  LinkShapingConfiguration configuration;
+  // 1 MB/s
+  configuration.bandwidth = 8'000'000;
+  configuration.burst_size = 10'000;
+  auto [transport_alice, transport_bob] = MakeTransportPair(configuration);
+
+  constexpr std::size_t kNumberOfMessages = 10;
+  const std::vector<std::uint8_t> message(10'000, 0x42);
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < kNumberOfMessages; ++i) {
+    transport_alice->SendMessage(message);
+  }
+  for (std::size_t i = 0; i < kNumberOfMessages; ++i) {
+    ASSERT_TRUE(transport_bob->ReceiveMessage().has_value());
+  }
+  // all but the first message, which fits into the burst, wait for the link
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 90ms);
+  transport_alice->Shutdown();
+  transport_bob->Shutdown();
+}
+
+TEST(ShapedTransport, RejectsNegativeParameters) {
+  for (auto setter : {+[](LinkShapingConfiguration& c) { c.latency = -1ms; },
+                      +[](LinkShapingConfiguration& c) { c.jitter = -1ms; },
+                      +[](LinkShapingConfiguration& c) { c.bandwidth = -1; }}) {
+    LinkShapingConfiguration configuration;
+    setter(configuration);
+    EXPECT_THROW(configuration.Validate(), std::invalid_argument);
+    auto [transport_alice, transport_bob] = DummyTransport::MakeTransportPair();
+    EXPECT_THROW(ShapedTransport(std::move(transport_alice), configuration),
+                 std::invalid_argument);
+    std::vector<std::unique_ptr<Transport>> transports;
+    transports.emplace_back(std::move(transport_bob));
+    EXPECT_THROW(ShapeTransports(transports, configuration), std::invalid_argument);
+    // the transports are left untouched
+    ASSERT_NE(transports.at(0), nullptr);
+    transports.at(0)->Shutdown();
+  }
+}
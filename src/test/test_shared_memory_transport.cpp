@@ -0,0 +1,88 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <future>
+
+#include <fmt/format.h>
+#include <unistd.h>
+
+#include "communication/shared_memory_transport.h"
+
+using namespace encrypto::motion::communication;
+
+static std::pair<std::unique_ptr<Transport>, std::unique_ptr<Transport>> MakeTransportPair(
+    const std::string& name, std::size_t ring_size) {
+  auto transport_alice_future = std::async(std::launch::async, [&name, ring_size] {
+    SharedMemorySetupHelper helper(0, 2, name, ring_size);
+    return std::move(helper.SetupConnections().at(1));
+  });
+  auto transport_bob_future = std::async(std::launch::async, [&name, ring_size] {
+    SharedMemorySetupHelper helper(1, 2, name, ring_size);
+    return std::move(helper.SetupConnections().at(0));
+  });
+  auto transport_alice = transport_alice_future.get();
+  return {std::move(transport_alice), transport_bob_future.get()};
+}
+
+TEST(SharedMemoryTransport, Dummy) {
+  auto [transport_alice, transport_bob] =
+      MakeTransportPair(fmt::format("/motion-test-{}-a", getpid()), 1024);
+
+  const std::vector<std::uint8_t> message = {0xde, 0xad, 0xbe, 0xef};
+
+  EXPECT_FALSE(transport_bob->Available());
+  transport_alice->SendMessage(message);
+  EXPECT_TRUE(transport_bob->Available());
+  auto received_message = transport_bob->ReceiveMessage();
+  EXPECT_FALSE(transport_bob->Available());
+
+  EXPECT_EQ(received_message, message);
+
+  transport_alice->ShutdownSend();
+  EXPECT_FALSE(transport_bob->ReceiveMessage().has_value());
+}
+
+TEST(SharedMemoryTransport, MessagesLargerThanRing) {
+  constexpr std::size_t kRingSize = 1024;
+  auto [transport_alice, transport_bob] =
+      MakeTransportPair(fmt::format("/motion-test-{}-b", getpid()), kRingSize);
+
+  std::vector<std::vector<std::uint8_t>> messages;
+  for (std::size_t size : {std::size_t(0), kRingSize - 1, 10 * kRingSize + 7, std::size_t(3)}) {
+    std::vector<std::uint8_t> message(size);
+    for (std::size_t i = 0; i < size; ++i) message[i] = static_cast<std::uint8_t>(i * 7 + size);
+    messages.emplace_back(std::move(message));
+  }
+  auto send_future = std::async(std::launch::async, [&] {
+    for (const auto& message : messages) transport_alice->SendMessage(message);
+  });
+  for (const auto& message : messages) {
+    auto received_message = transport_bob->ReceiveMessage();
+    ASSERT_TRUE(received_message.has_value());
+    EXPECT_EQ(*received_message, message);
+  }
+  send_future.get();
+  EXPECT_EQ(transport_bob->GetStatistics().number_of_messages_received, messages.size());
+}
@@ -0,0 +1,212 @@
+// MIT License
+//
+// Copyright (c) 2026 Cryptography and Privacy Engineering Group (ENCRYPTO)
+// TU Darmstadt, Germany
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <stdexcept>
+
+#include "base/configuration.h"
+#include "base/motion_base_provider.h"
+#include "communication/communication_layer.h"
+#include "communication/message_manager.h"
+#include "data_storage/ot_extension_data.h"
+#include "oblivious_transfer/base_ots/base_ot_provider.h"
+#include "oblivious_transfer/ot_flavors.h"
+#include "oblivious_transfer/softspoken_ot_provider.h"
+#include "utility/block.h"
+
+namespace {
+
+// parameterized by the number of bits k of the field, 3 and 5 do not divide 128 and leave a
+// smaller last block
+class SoftSpokenOtTest : public ::testing::TestWithParam<std::size_t> {
+ protected:
+  void SetUp() override {
+    communication_layers_ = encrypto::motion::communication::MakeDummyCommunicationLayers(2);
+    for (std::size_t i = 0; i < 2; ++i) {
+      auto& communication_layer{*communication_layers_[i]};
+      base_ot_providers_[i] =
+          std::make_unique<encrypto::motion::BaseOtProvider>(communication_layer);
+      motion_base_providers_[i] =
+          std::make_unique<encrypto::motion::BaseProvider>(communication_layer);
+      auto send_function = [&communication_layer, i](flatbuffers::FlatBufferBuilder&& builder) {
+        communication_layer.SendMessage(1 - i, builder.Release());
+      };
+      data_[i] = std::make_unique<encrypto::motion::OtExtensionData>(
+          1 - i, send_function, communication_layer.GetMessageManager(),
+          communication_layer.GetLogger());
+      providers_[i] = std::make_unique<encrypto::motion::OtProviderFromSoftSpokenOt>(
+          *data_[i], *base_ot_providers_[i], *motion_base_providers_[i], GetParam());
+    }
+  }
+
+  void TearDown() override {
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 0; i < 2; ++i) {
+      futures.emplace_back(
+          std::async(std::launch::async, [this, i] { communication_layers_[i]->Shutdown(); }));
+    }
+    std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+  }
+
+  // computes the base OTs in the first call and only the OT extension in later calls
+  void RunSetup() {
+    for (std::size_t i = 0; i < 2; ++i) {
+      providers_[i]->PreSetup();
+      if (!started_) base_ot_providers_[i]->PreSetup();
+    }
+
+    std::vector<std::future<void>> futures;
+    if (!started_) {
+      for (std::size_t i = 0; i < 2; ++i) {
+        futures.emplace_back(std::async(std::launch::async, [this, i] {
+          communication_layers_[i]->Start();
+          communication_layers_[i]->Synchronize();
+          motion_base_providers_[i]->Setup();
+          base_ot_providers_[i]->ComputeBaseOts();
+        }));
+      }
+      std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+      futures.clear();
+      started_ = true;
+    }
+
+    for (std::size_t i = 0; i < 2; ++i) {
+      futures.emplace_back(
+          std::async(std::launch::async, [this, i] { providers_[i]->SendSetup(); }));
+      futures.emplace_back(
+          std::async(std::launch::async, [this, i] { providers_[i]->ReceiveSetup(); }));
+    }
+    std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+  }
+
+  static constexpr std::size_t kSender = 0;
+  static constexpr std::size_t kReceiver = 1;
+
+  bool started_{false};
+  std::vector<std::unique_ptr<encrypto::motion::communication::CommunicationLayer>>
+      communication_layers_;
+  std::array<std::unique_ptr<encrypto::motion::BaseOtProvider>, 2> base_ot_providers_;
+  std::array<std::unique_ptr<encrypto::motion::BaseProvider>, 2> motion_base_providers_;
+  std::array<std::unique_ptr<encrypto::motion::OtExtensionData>, 2> data_;
+  std::array<std::unique_ptr<encrypto::motion::OtProviderFromSoftSpokenOt>, 2> providers_;
+};
+
+// the later evaluations reuse the GGM trees of the first one with fresh parts of the PRG streams
+TEST_P(SoftSpokenOtTest, ROt) {
+  for (const std::size_t number_of_ots : {1, 128, 1000, 5000}) {
+    for (const std::size_t bitlength : {1, 128, 200}) {
+      auto ot_sender = providers_[kSender]->RegisterSendROt(number_of_ots, bitlength);
+      auto ot_receiver = providers_[kReceiver]->RegisterReceiveROt(number_of_ots, bitlength);
+
+      RunSetup();
+
+      ot_sender->ComputeOutputs();
+      ot_receiver->ComputeOutputs();
+      const auto sender_outputs = ot_sender->GetOutputs();
+      const auto receiver_outputs = ot_receiver->GetOutputs();
+      const auto& choices = ot_receiver->GetChoices();
+      for (std::size_t ot_i = 0; ot_i < number_of_ots; ++ot_i) {
+        const std::size_t offset{choices.Get(ot_i) ? bitlength : 0};
+        EXPECT_EQ(receiver_outputs[ot_i],
+                  sender_outputs[ot_i].Subset(offset, offset + bitlength));
+        if (bitlength >= 64) {
+          const std::size_t other_offset{bitlength - offset};
+          EXPECT_NE(receiver_outputs[ot_i],
+                    sender_outputs[ot_i].Subset(other_offset, other_offset + bitlength));
+        }
+      }
+      for (auto& provider : providers_) provider->Clear();
+    }
+  }
+}
+
+TEST_P(SoftSpokenOtTest, BothDirections) {
+  constexpr std::size_t kNumberOfOts = 300;
+  const auto correlations = encrypto::motion::BitVector<>::SecureRandom(kNumberOfOts);
+  const auto choice_bits = encrypto::motion::BitVector<>::SecureRandom(kNumberOfOts);
+  std::array<std::unique_ptr<encrypto::motion::XcOtBitSender>, 2> ot_senders;
+  std::array<std::unique_ptr<encrypto::motion::XcOtBitReceiver>, 2> ot_receivers;
+  for (std::size_t i = 0; i < 2; ++i) {
+    ot_senders[i] = providers_[i]->RegisterSendXcOtBit(kNumberOfOts);
+    ot_receivers[1 - i] = providers_[1 - i]->RegisterReceiveXcOtBit(kNumberOfOts);
+  }
+
+  RunSetup();
+
+  for (std::size_t i = 0; i < 2; ++i) {
+    ot_senders[i]->SetCorrelations(correlations);
+    ot_senders[i]->SendMessages();
+    ot_receivers[i]->SetChoices(choice_bits);
+    ot_receivers[i]->SendCorrections();
+  }
+  for (std::size_t i = 0; i < 2; ++i) {
+    ot_senders[i]->ComputeOutputs();
+    ot_receivers[1 - i]->ComputeOutputs();
+    const auto sender_output = ot_senders[i]->GetOutputs();
+    const auto receiver_output = ot_receivers[1 - i]->GetOutputs();
+    EXPECT_EQ(receiver_output, sender_output ^ (choice_bits & correlations));
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(FieldBits, SoftSpokenOtTest, ::testing::Values(2, 3, 5, 8));
+
+TEST(SoftSpokenOt, InvalidFieldBits) {
+  auto communication_layers = encrypto::motion::communication::MakeDummyCommunicationLayers(2);
+  encrypto::motion::BaseOtProvider base_ot_provider(*communication_layers[0]);
+  encrypto::motion::BaseProvider motion_base_provider(*communication_layers[0]);
+  encrypto::motion::OtExtensionData data(
+      1, [](flatbuffers::FlatBufferBuilder&&) {}, communication_layers[0]->GetMessageManager(),
+      communication_layers[0]->GetLogger());
+  for (const std::size_t field_bits : {0, 1, 9}) {
+    EXPECT_THROW(encrypto::motion::OtProviderFromSoftSpokenOt(data, base_ot_provider,
+                                                              motion_base_provider, field_bits),
+                 std::invalid_argument);
+  }
+
+  // the communication layers have to be started before they are shut down
+  std::vector<std::future<void>> futures;
+  for (std::size_t i = 0; i < 2; ++i) {
+    futures.emplace_back(std::async(std::launch::async, [&, i] {
+      communication_layers[i]->Start();
+      communication_layers[i]->Shutdown();
+    }));
+  }
+  std::for_each(std::begin(futures), std::end(futures), [](auto& f) { f.get(); });
+}
+
+TEST(SoftSpokenOt, ConfigurationFieldBits) {
+  encrypto::motion::Configuration configuration(0, 2);
+  for (const std::size_t field_bits : {1, 9, 128}) {
+    EXPECT_THROW(configuration.SetSoftSpokenOtFieldBits(field_bits), std::invalid_argument);
+  }
+  EXPECT_EQ(configuration.GetSoftSpokenOtFieldBits(), 0);
+  for (const std::size_t field_bits : {2, 8, 0}) {
+    configuration.SetSoftSpokenOtFieldBits(field_bits);
+    EXPECT_EQ(configuration.GetSoftSpokenOtFieldBits(), field_bits);
+  }
+}
+
+}  // namespace
@@ -22,8 +22,14 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <future>
+#include <thread>
 
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+
+#include "communication/receive_buffer_pool.h"
 #include "communication/tcp_transport.h"
 
 class TcpTransportTest : public testing::TestWithParam<std::string> {};
@@ -56,5 +62,238 @@ TEST_P(TcpTransportTest, dummy) {
   EXPECT_EQ(ReceivedMessage, message);
 }
 
+TEST_P(TcpTransportTest, ReceiveBufferPool) {
+  auto localhost = GetParam();
+  auto transport_alice_future = std::async(std::launch::async, [localhost] {
+    encrypto::motion::communication::TcpSetupHelper helper(
+        0, {{localhost, 13339}, {localhost, 13340}});
+    auto transports = helper.SetupConnections();
+    return std::move(transports.at(1));
+  });
+  auto transport_bob_future = std::async(std::launch::async, [localhost] {
+    encrypto::motion::communication::TcpSetupHelper helper(
+        1, {{localhost, 13339}, {localhost, 13340}});
+    auto transports = helper.SetupConnections();
+    return std::move(transports.at(0));
+  });
+  auto transport_alice = transport_alice_future.get();
+  auto transport_bob = transport_bob_future.get();
+  auto pool = std::make_shared<encrypto::motion::communication::ReceiveBufferPool>();
+  transport_bob->SetReceiveBufferPool(pool);
+
+  // the second message of the same size class is received into the buffer of the first one
+  const std::vector<std::uint8_t> message_1(100, 0x42), message_2(80, 0x23);
+  transport_alice->SendMessage(message_1);
+  auto received_message_1 = transport_bob->ReceiveMessage();
+  ASSERT_TRUE(received_message_1.has_value());
+  EXPECT_EQ(*received_message_1, message_1);
+  const auto* buffer = received_message_1->data();
+  pool->Release(std::move(*received_message_1));
+
+  transport_alice->SendMessage(message_2);
+  auto received_message_2 = transport_bob->ReceiveMessage();
+  ASSERT_TRUE(received_message_2.has_value());
+  EXPECT_EQ(*received_message_2, message_2);
+  EXPECT_EQ(received_message_2->data(), buffer);
+  EXPECT_EQ(pool->GetNumberOfAllocations(), 1);
+  EXPECT_EQ(pool->GetNumberOfReuses(), 1);
+}
+
+TEST(ReceiveBufferPool, LimitsPooledBytes) {
+  using ReceiveBufferPool = encrypto::motion::communication::ReceiveBufferPool;
+  // two buffers of 1 KiB fit into the pool, a third one is freed
+  ReceiveBufferPool pool(64, 2048);
+  std::vector<ReceiveBufferPool::buffer_type> buffers;
+  for (std::size_t i = 0; i < 3; ++i) buffers.emplace_back(pool.Acquire(1024));
+  for (auto& buffer : buffers) pool.Release(std::move(buffer));
+  EXPECT_EQ(pool.GetNumberOfPooledBytes(), 2048);
+
+  // taking a buffer makes room for another one
+  auto buffer{pool.Acquire(1000)};
+  EXPECT_EQ(pool.GetNumberOfReuses(), 1);
+  EXPECT_EQ(pool.GetNumberOfPooledBytes(), 1024);
+  pool.Release(std::move(buffer));
+  EXPECT_EQ(pool.GetNumberOfPooledBytes(), 2048);
+}
+
+TEST_P(TcpTransportTest, StripedConnections) {
+  constexpr std::size_t kNumberOfConnections = 4;
+  auto localhost = GetParam();
+  auto transport_alice_future = std::async(std::launch::async, [localhost] {
+    encrypto::motion::communication::TcpSetupHelper helper(
+        0, {{localhost, 13341}, {localhost, 13342}}, kNumberOfConnections);
+    auto transports = helper.SetupConnections();
+    return std::move(transports.at(1));
+  });
+  auto transport_bob_future = std::async(std::launch::async, [localhost] {
+    encrypto::motion::communication::TcpSetupHelper helper(
+        1, {{localhost, 13341}, {localhost, 13342}}, kNumberOfConnections);
+    auto transports = helper.SetupConnections();
+    return std::move(transports.at(0));
+  });
+  auto transport_alice = transport_alice_future.get();
+  auto transport_bob = transport_bob_future.get();
+  const auto* striped_transport =
+      dynamic_cast<encrypto::motion::communication::StripedTcpTransport*>(transport_alice.get());
+  ASSERT_NE(striped_transport, nullptr);
+  EXPECT_EQ(striped_transport->GetNumberOfConnections(), kNumberOfConnections);
+
+  // small messages use one connection, large ones are striped, and the order is preserved
+  constexpr std::size_t kLarge = encrypto::motion::communication::StripedTcpTransport::
+      kMinimumStripedMessageSize * 3 + 1;
+  std::vector<std::vector<std::uint8_t>> messages;
+  for (std::size_t size : {std::size_t(4), kLarge, std::size_t(100), kLarge + 2}) {
+    std::vector<std::uint8_t> message(size);
+    for (std::size_t i = 0; i < size; ++i) message[i] = static_cast<std::uint8_t>(i * 7 + size);
+    messages.emplace_back(std::move(message));
+  }
+  auto send_future = std::async(std::launch::async, [&] {
+    for (const auto& message : messages) transport_alice->SendMessage(message);
+  });
+  std::size_t number_of_bytes = 0;
+  for (const auto& message : messages) {
+    auto received_message = transport_bob->ReceiveMessage();
+    ASSERT_TRUE(received_message.has_value());
+    EXPECT_EQ(*received_message, message);
+    number_of_bytes += message.size() + sizeof(std::uint32_t);
+  }
+  send_future.get();
+  EXPECT_EQ(transport_bob->GetStatistics().number_of_messages_received, messages.size());
+  EXPECT_EQ(transport_bob->GetStatistics().number_of_bytes_received, number_of_bytes);
+  EXPECT_EQ(transport_alice->GetStatistics().number_of_bytes_sent, number_of_bytes);
+}
+
+TEST_P(TcpTransportTest, AsyncIo) {
+  namespace comm = encrypto::motion::communication;
+  auto localhost = GetParam();
+  // both parties share one I/O thread, i.e., both sockets are multiplexed on it
+  auto io_service = std::make_shared<comm::TcpIoService>(1);
+  auto transport_alice_future = std::async(std::launch::async, [localhost, io_service] {
+    comm::TcpSetupHelper helper(0, {{localhost, 13343}, {localhost, 13344}});
+    helper.SetIoService(io_service);
+    auto transports = helper.SetupConnections();
+    return std::move(transports.at(1));
+  });
+  auto transport_bob_future = std::async(std::launch::async, [localhost, io_service] {
+    comm::TcpSetupHelper helper(1, {{localhost, 13343}, {localhost, 13344}});
+    helper.SetIoService(io_service);
+    auto transports = helper.SetupConnections();
+    return std::move(transports.at(0));
+  });
+  auto transport_alice = transport_alice_future.get();
+  auto transport_bob = transport_bob_future.get();
+  ASSERT_NE(dynamic_cast<comm::AsyncTcpTransport*>(transport_alice.get()), nullptr);
+
+  // many small messages, an empty one, and one which is read directly into its buffer
+  constexpr std::size_t kNumberOfMessages = 1000;
+  std::vector<std::vector<std::uint8_t>> messages;
+  for (std::size_t j = 0; j < kNumberOfMessages; ++j) {
+    const std::size_t size = j == kNumberOfMessages / 2 ? 1024 * 1024 + 3 : j % 50;
+    std::vector<std::uint8_t> message(size);
+    for (std::size_t i = 0; i < size; ++i) message[i] = static_cast<std::uint8_t>(i * 7 + j);
+    messages.emplace_back(std::move(message));
+  }
+  std::size_t number_of_bytes = 0;
+  for (const auto& message : messages) {
+    transport_alice->SendMessage(message);
+    transport_bob->SendMessage(message);
+    number_of_bytes += message.size() + sizeof(std::uint32_t);
+  }
+  for (const auto& message : messages) {
+    auto received_message_alice = transport_alice->ReceiveMessage();
+    auto received_message_bob = transport_bob->ReceiveMessage();
+    ASSERT_TRUE(received_message_alice.has_value());
+    ASSERT_TRUE(received_message_bob.has_value());
+    EXPECT_EQ(*received_message_alice, message);
+    EXPECT_EQ(*received_message_bob, message);
+  }
+  auto statistics = transport_bob->GetStatistics();
+  EXPECT_EQ(statistics.number_of_messages_received, kNumberOfMessages);
+  EXPECT_EQ(statistics.number_of_bytes_received, number_of_bytes);
+  EXPECT_EQ(statistics.number_of_bytes_sent, number_of_bytes);
+  EXPECT_EQ(statistics.number_of_io_threads, 1);
+
+  // while the I/O thread is blocked, all messages are appended to the send buffer, which is then
+  // written with a single call, since it fits into the socket buffer
+  constexpr std::size_t kNumberOfBatchedMessages = 200;
+  transport_alice->ResetStatistics();
+  transport_bob->ResetStatistics();
+  std::promise<void> io_thread_blocked, unblock_io_thread;
+  boost::asio::post(*io_service->GetIoContext(), [&io_thread_blocked, &unblock_io_thread] {
+    io_thread_blocked.set_value();
+    unblock_io_thread.get_future().wait();
+  });
+  io_thread_blocked.get_future().wait();
+  for (std::size_t j = 0; j < kNumberOfBatchedMessages; ++j) {
+    transport_alice->SendMessage(messages.at(j % 50));
+  }
+  unblock_io_thread.set_value();
+  for (std::size_t j = 0; j < kNumberOfBatchedMessages; ++j) {
+    auto received_message = transport_bob->ReceiveMessage();
+    ASSERT_TRUE(received_message.has_value());
+    EXPECT_EQ(*received_message, messages.at(j % 50));
+  }
+  transport_alice->ShutdownSend();
+  EXPECT_FALSE(transport_bob->ReceiveMessage().has_value());
+  transport_bob->Shutdown();
+  transport_alice->Shutdown();
+
+  // the handlers of the I/O thread do not count any longer after the shutdown
+  EXPECT_EQ(transport_alice->GetStatistics().number_of_write_calls, 1);
+  statistics = transport_bob->GetStatistics();
+  EXPECT_EQ(statistics.number_of_messages_received, kNumberOfBatchedMessages);
+  EXPECT_EQ(statistics.number_of_write_calls, 0);
+  // at least one read for the messages and one for the end of the stream
+  EXPECT_GE(statistics.number_of_read_calls, 2);
+}
+
+TEST_P(TcpTransportTest, LatePartyAndTimeout) {
+  namespace comm = encrypto::motion::communication;
+  using namespace std::chrono_literals;
+  constexpr std::size_t kNumberOfParties = 3;
+  auto localhost = GetParam();
+  const comm::TcpPartiesConfiguration configuration = {
+      {localhost, 13345}, {localhost, 13346}, {localhost, 13347}};
+  // party 1 starts late, s.t. party 2 has to retry its connect to party 1
+  std::vector<std::future<std::vector<std::unique_ptr<comm::Transport>>>> futures;
+  for (std::size_t party_id = 0; party_id < kNumberOfParties; ++party_id) {
+    futures.emplace_back(std::async(std::launch::async, [party_id, &configuration] {
+      if (party_id == 1) std::this_thread::sleep_for(200ms);
+      comm::TcpSetupHelper helper(party_id, configuration);
+      helper.SetRetryDelays(1ms, 20ms);
+      return helper.SetupConnections();
+    }));
+  }
+  std::vector<std::vector<std::unique_ptr<comm::Transport>>> transports;
+  for (auto& future : futures) transports.emplace_back(future.get());
+  for (std::size_t party_id = 0; party_id < kNumberOfParties; ++party_id) {
+    for (std::size_t other_id = 0; other_id < kNumberOfParties; ++other_id) {
+      if (other_id == party_id) {
+        EXPECT_EQ(transports.at(party_id).at(other_id), nullptr);
+        continue;
+      }
+      auto& transport = transports.at(party_id).at(other_id);
+      ASSERT_NE(transport, nullptr);
+      const auto& statistics = transport->GetStatistics();
+      EXPECT_LT(statistics.connection_setup_start, statistics.connection_setup_end);
+      // the transports are connected to the right parties
+      transport->SendMessage(std::vector<std::uint8_t>{static_cast<std::uint8_t>(party_id)});
+    }
+  }
+  for (std::size_t party_id = 0; party_id < kNumberOfParties; ++party_id) {
+    for (std::size_t other_id = 0; other_id < kNumberOfParties; ++other_id) {
+      if (other_id == party_id) continue;
+      EXPECT_EQ(transports.at(party_id).at(other_id)->ReceiveMessage(),
+                std::vector<std::uint8_t>{static_cast<std::uint8_t>(other_id)});
+    }
+  }
+
+  // party 0 never shows up
+  comm::TcpSetupHelper helper(1, {{localhost, 13348}, {localhost, 13349}});
+  helper.SetTimeout(100ms);
+  EXPECT_THROW(helper.SetupConnections(), std::runtime_error);
+  EXPECT_THROW(helper.SetRetryDelays(10ms, 1ms), std::invalid_argument);
+}
+
 INSTANTIATE_TEST_SUITE_P(TcpTransportSuite, TcpTransportTest, testing::Values("127.0.0.1", "::1"),
                          [](auto& info) { return info.param == "::1" ? "ipv6" : "ipv4"; });